@@ -153,7 +153,8 @@
 #define ELF_SPRITE 0x0043
 #define ELF_VIDEO_MODE 0x0044
 #define ELF_GENERAL 0x0045
-#define ELF_OBJECT_TYPE_COUNT 0x0046
+#define ELF_SCENE_LOADER 0x0046
+#define ELF_OBJECT_TYPE_COUNT 0x0047
 #define ELF_PERSPECTIVE 0x0000
 #define ELF_ORTHOGRAPHIC 0x0001
 #define ELF_BOX 0x0001
@@ -210,6 +211,14 @@
 #define ELF_CHAR_INPUT 0x0005
 #define ELF_SELECTION_CHANGED 0x0006
 #define ELF_STATE_CHANGED 0x0007
+#define ELF_SCRIPT_GC_FULL 0x0001
+#define ELF_SCRIPT_GC_INCREMENTAL 0x0002
+#define ELF_PACING_FIXED 0x0001
+#define ELF_PACING_ADAPTIVE 0x0002
+#define ELF_LOG_DEBUG 0x0001
+#define ELF_LOG_INFO 0x0002
+#define ELF_LOG_WARNING 0x0003
+#define ELF_LOG_ERROR 0x0004
 #define ELF_JOYSTICK_BUTTON_1 0x0000
 #define ELF_JOYSTICK_BUTTON_2 0x0001
 #define ELF_JOYSTICK_BUTTON_3 0x0002
@@ -325,6 +334,7 @@ ELF_API int ELF_APIENTRY elfGetObjectType(elf_handle obj);
 ELF_API int ELF_APIENTRY elfGetObjectRefCount(elf_handle obj);
 ELF_API int ELF_APIENTRY elfGetGlobalRefCount();
 ELF_API int ELF_APIENTRY elfGetGlobalObjCount();
+ELF_API int ELF_APIENTRY elfGetCreatedObjCount();
 ELF_API bool ELF_APIENTRY elfIsActor(elf_handle obj);
 ELF_API bool ELF_APIENTRY elfIsGuiObject(elf_handle obj);
 ELF_API elf_handle ELF_APIENTRY elfCreateList();
@@ -343,10 +353,13 @@ ELF_API elf_handle ELF_APIENTRY elfReadConfig(const char* file_path);
 ELF_API int ELF_APIENTRY elfGetConfigWindowWidth(elf_handle config);
 ELF_API int ELF_APIENTRY elfGetConfigWindowHeight(elf_handle config);
 ELF_API bool ELF_APIENTRY elfGetConfigFullscreen(elf_handle config);
+ELF_API bool ELF_APIENTRY elfGetConfigHeadless(elf_handle config);
 ELF_API float ELF_APIENTRY elfGetConfigTextureAnisotropy(elf_handle config);
 ELF_API int ELF_APIENTRY elfGetConfigShadowMapSize(elf_handle config);
 ELF_API const char* ELF_APIENTRY elfGetConfigStart(elf_handle config);
 ELF_API const char* ELF_APIENTRY elfGetConfigLog(elf_handle config);
+ELF_API void ELF_APIENTRY elfSetLogLevel(int level);
+ELF_API int ELF_APIENTRY elfGetLogLevel();
 ELF_API void ELF_APIENTRY elfSetTitle(const char* title);
 ELF_API int ELF_APIENTRY elfGetWindowWidth();
 ELF_API int ELF_APIENTRY elfGetWindowHeight();
@@ -357,6 +370,7 @@ ELF_API const char* ELF_APIENTRY elfGetTitle();
 ELF_API int ELF_APIENTRY elfGetMultisamples();
 ELF_API double ELF_APIENTRY elfGetTime();
 ELF_API bool ELF_APIENTRY elfIsWindowOpened();
+ELF_API bool ELF_APIENTRY elfIsHeadless();
 ELF_API elf_vec2i ELF_APIENTRY elfGetMousePosition();
 ELF_API elf_vec2i ELF_APIENTRY elfGetMouseForce();
 ELF_API void ELF_APIENTRY elfSetMousePosition(int x, int y);
@@ -371,6 +385,7 @@ ELF_API int ELF_APIENTRY elfGetJoystickButtonState(int joy, int but);
 ELF_API int ELF_APIENTRY elfGetEventCount();
 ELF_API elf_handle ELF_APIENTRY elfGetEvent(int idx);
 ELF_API bool ELF_APIENTRY elfInit(int width, int height, const char* title, bool fullscreen, const char* log);
+ELF_API bool ELF_APIENTRY elfInitHeadless(int width, int height, const char* log);
 ELF_API bool ELF_APIENTRY elfInitWithConfig(const char* file_path);
 ELF_API void ELF_APIENTRY elfDeinit();
 ELF_API void ELF_APIENTRY elfResizeWindow(int width, int height);
@@ -387,6 +402,9 @@ ELF_API void ELF_APIENTRY elfQuit();
 ELF_API void ELF_APIENTRY elfSetF10Exit(bool exit);
 ELF_API bool ELF_APIENTRY elfGetF10Exit();
 ELF_API elf_handle ELF_APIENTRY elfLoadScene(const char* file_path);
+ELF_API bool ELF_APIENTRY elfLoadSceneAsync(const char* file_path);
+ELF_API bool ELF_APIENTRY elfIsSceneLoading();
+ELF_API float ELF_APIENTRY elfGetSceneLoadProgress();
 ELF_API void ELF_APIENTRY elfSetScene(elf_handle scene);
 ELF_API elf_handle ELF_APIENTRY elfGetScene();
 ELF_API void ELF_APIENTRY elfSetGui(elf_handle gui);
@@ -398,6 +416,12 @@ ELF_API void ELF_APIENTRY elfSetFpsLimit(int fps_limit);
 ELF_API int ELF_APIENTRY elfGetFpsLimit();
 ELF_API void ELF_APIENTRY elfSetTickRate(float tick_rate);
 ELF_API float ELF_APIENTRY elfGetTickRate();
+ELF_API void ELF_APIENTRY elfSetFixedTickRate(float tick_rate);
+ELF_API float ELF_APIENTRY elfGetFixedTickRate();
+ELF_API void ELF_APIENTRY elfSetMaxTicksPerFrame(int max_ticks);
+ELF_API int ELF_APIENTRY elfGetMaxTicksPerFrame();
+ELF_API int ELF_APIENTRY elfGetFrameTicks();
+ELF_API float ELF_APIENTRY elfGetTickBlend();
 ELF_API void ELF_APIENTRY elfSetSpeed(float speed);
 ELF_API float ELF_APIENTRY elfGetSpeed();
 ELF_API void ELF_APIENTRY elfSetTextureAnisotropy(float anisotropy);
@@ -405,6 +429,15 @@ ELF_API float ELF_APIENTRY elfGetTextureAnisotropy();
 ELF_API void ELF_APIENTRY elfSetShadowMapSize(int size);
 ELF_API int ELF_APIENTRY elfGetShadowMapSize();
 ELF_API int ELF_APIENTRY elfGetPolygonsRendered();
+ELF_API int ELF_APIENTRY elfGetDrawCalls();
+ELF_API int ELF_APIENTRY elfGetStateChanges();
+ELF_API int ELF_APIENTRY elfGetTextureMemory();
+ELF_API int ELF_APIENTRY elfGetVertexBufferMemory();
+ELF_API void ELF_APIENTRY elfSetShaderCachePath(const char* path);
+ELF_API const char* ELF_APIENTRY elfGetShaderCachePath();
+ELF_API bool ELF_APIENTRY elfIsShaderBinaryCacheSupported();
+ELF_API int ELF_APIENTRY elfGetShaderCacheHits();
+ELF_API int ELF_APIENTRY elfGetShaderProgramCount();
 ELF_API void ELF_APIENTRY elfSetBloom(float threshold);
 ELF_API void ELF_APIENTRY elfDisableBloom();
 ELF_API float ELF_APIENTRY elfGetBloomThreshold();
@@ -445,6 +478,7 @@ ELF_API elf_vec3f ELF_APIENTRY elfAddVec3fVec3f(elf_vec3f vec1, elf_vec3f vec2);
 ELF_API float ELF_APIENTRY elfGetVec3fLength(elf_vec3f vec);
 ELF_API bool ELF_APIENTRY elfAboutZero(float val);
 ELF_API float ELF_APIENTRY elfFloatAbs(float val);
+ELF_API float ELF_APIENTRY elfFloatMin(float a, float b);
 ELF_API float ELF_APIENTRY elfFloatMax(float a, float b);
 ELF_API float ELF_APIENTRY elfRandomFloat();
 ELF_API float ELF_APIENTRY elfRandomFloatRange(float min, float max);
@@ -467,6 +501,26 @@ ELF_API bool ELF_APIENTRY elfIsFramePlayerPaused(elf_handle player);
 ELF_API elf_handle ELF_APIENTRY elfCreateTimer();
 ELF_API void ELF_APIENTRY elfStartTimer(elf_handle timer);
 ELF_API double ELF_APIENTRY elfGetElapsedTime(elf_handle timer);
+ELF_API bool ELF_APIENTRY elfIsProfilerAvailable();
+ELF_API void ELF_APIENTRY elfSetProfilerEnabled(bool enabled);
+ELF_API bool ELF_APIENTRY elfIsProfilerEnabled();
+ELF_API int ELF_APIENTRY elfGetProfileFrameCount();
+ELF_API float ELF_APIENTRY elfGetProfileFrameTime(int frame);
+ELF_API int ELF_APIENTRY elfGetProfileSlowestFrame();
+ELF_API int ELF_APIENTRY elfGetProfileScopeCount(int frame);
+ELF_API const char* ELF_APIENTRY elfGetProfileScopeName(int frame, int idx);
+ELF_API int ELF_APIENTRY elfGetProfileScopeDepth(int frame, int idx);
+ELF_API float ELF_APIENTRY elfGetProfileScopeStart(int frame, int idx);
+ELF_API float ELF_APIENTRY elfGetProfileScopeTime(int frame, int idx);
+ELF_API float ELF_APIENTRY elfGetProfileTime(int frame, const char* name);
+ELF_API bool ELF_APIENTRY elfSaveProfileTrace(const char* file_path);
+ELF_API void ELF_APIENTRY elfSetFramePacingMode(int mode);
+ELF_API int ELF_APIENTRY elfGetFramePacingMode();
+ELF_API float ELF_APIENTRY elfGetFramePacingJitter();
+ELF_API float ELF_APIENTRY elfGetFramePacingMaxJitter();
+ELF_API float ELF_APIENTRY elfGetFrameWorkTime();
+ELF_API float ELF_APIENTRY elfGetFramePacingSpinTime();
+ELF_API int ELF_APIENTRY elfGetLateFrameCount();
 ELF_API elf_handle ELF_APIENTRY elfCreateTextureFromFile(const char* file_path);
 ELF_API const char* ELF_APIENTRY elfGetTextureName(elf_handle texture);
 ELF_API const char* ELF_APIENTRY elfGetTextureFilePath(elf_handle texture);
@@ -683,6 +737,7 @@ ELF_API void ELF_APIENTRY elfSetParticlesEntity(elf_handle particles, elf_handle
 ELF_API void ELF_APIENTRY elfSetParticlesGravity(elf_handle particles, float x, float y, float z);
 ELF_API void ELF_APIENTRY elfSetParticlesSpawnDelay(elf_handle particles, float delay);
 ELF_API void ELF_APIENTRY elfSetParticlesSpawn(elf_handle particles, bool spawn);
+ELF_API void ELF_APIENTRY elfSetParticlesRandomSeed(elf_handle particles, int seed);
 ELF_API void ELF_APIENTRY elfSetParticlesSize(elf_handle particles, float min, float max);
 ELF_API void ELF_APIENTRY elfSetParticlesSizeGrowth(elf_handle particles, float min, float max);
 ELF_API void ELF_APIENTRY elfSetParticlesRotation(elf_handle particles, float min, float max);
@@ -732,6 +787,7 @@ ELF_API bool ELF_APIENTRY elfGetSpriteFaceCamera(elf_handle sprite);
 ELF_API elf_handle ELF_APIENTRY elfCreateScene(const char* name);
 ELF_API elf_handle ELF_APIENTRY elfCreateSceneFromFile(const char* file_path);
 ELF_API bool ELF_APIENTRY elfSaveScene(elf_handle scene, const char* file_path);
+ELF_API bool ELF_APIENTRY elfSaveSceneCompressed(elf_handle scene, const char* file_path);
 ELF_API void ELF_APIENTRY elfSetSceneAmbientColor(elf_handle scene, float r, float g, float b, float a);
 ELF_API elf_color ELF_APIENTRY elfGetSceneAmbientColor(elf_handle scene);
 ELF_API void ELF_APIENTRY elfSetSceneGravity(elf_handle scene, float x, float y, float z);
@@ -792,6 +848,7 @@ ELF_API bool ELF_APIENTRY elfRemoveLightByObject(elf_handle scene, elf_handle li
 ELF_API bool ELF_APIENTRY elfRemoveParticlesByObject(elf_handle scene, elf_handle particles);
 ELF_API bool ELF_APIENTRY elfRemoveSpriteByObject(elf_handle scene, elf_handle sprite);
 ELF_API bool ELF_APIENTRY elfRemoveActorByObject(elf_handle scene, elf_handle actor);
+ELF_API int ELF_APIENTRY elfWarmUpSceneShaders(elf_handle scene);
 ELF_API elf_handle ELF_APIENTRY elfCreateScript();
 ELF_API elf_handle ELF_APIENTRY elfCreateScriptFromFile(const char* file_path);
 ELF_API const char* ELF_APIENTRY elfGetScriptName(elf_handle script);
@@ -800,13 +857,35 @@ ELF_API void ELF_APIENTRY elfSetScriptText(elf_handle script, const char* text);
 ELF_API bool ELF_APIENTRY elfIsScriptError(elf_handle script);
 ELF_API bool ELF_APIENTRY elfRunString(const char* str);
 ELF_API bool ELF_APIENTRY elfRunScript(elf_handle script);
+ELF_API void ELF_APIENTRY elfSetScriptGcMode(int mode);
+ELF_API int ELF_APIENTRY elfGetScriptGcMode();
+ELF_API void ELF_APIENTRY elfSetScriptGcBudget(float budget);
+ELF_API float ELF_APIENTRY elfGetScriptGcBudget();
+ELF_API void ELF_APIENTRY elfSetScriptGcStepSize(int size);
+ELF_API int ELF_APIENTRY elfGetScriptGcStepSize();
+ELF_API float ELF_APIENTRY elfGetScriptMemory();
+ELF_API float ELF_APIENTRY elfGetScriptGcTime();
+ELF_API int ELF_APIENTRY elfGetScriptGcCycles();
 ELF_API void ELF_APIENTRY elfSetAudioVolume(float volume);
 ELF_API float ELF_APIENTRY elfGetAudioVolume();
 ELF_API void ELF_APIENTRY elfSetAudioRolloff(float rolloff);
 ELF_API float ELF_APIENTRY elfGetAudioRolloff();
+ELF_API void ELF_APIENTRY elfSetAudioStreamBufferCount(int count);
+ELF_API int ELF_APIENTRY elfGetAudioStreamBufferCount();
+ELF_API void ELF_APIENTRY elfSetAudioCullDistance(float distance);
+ELF_API float ELF_APIENTRY elfGetAudioCullDistance();
+ELF_API int ELF_APIENTRY elfGetAudioVoiceCount();
+ELF_API int ELF_APIENTRY elfGetAudioActiveVoiceCount();
+ELF_API int ELF_APIENTRY elfGetAudioStolenVoiceCount();
+ELF_API int ELF_APIENTRY elfGetAudioCulledSoundCount();
+ELF_API int ELF_APIENTRY elfGetAudioCachedSoundCount();
 ELF_API elf_handle ELF_APIENTRY elfLoadSound(const char* file_path);
+ELF_API elf_handle ELF_APIENTRY elfLoadSoundAsync(const char* file_path);
 ELF_API elf_handle ELF_APIENTRY elfLoadStreamedSound(const char* file_path);
+ELF_API bool ELF_APIENTRY elfIsSoundLoaded(elf_handle sound);
 ELF_API int ELF_APIENTRY elfGetSoundFileType(elf_handle sound);
+ELF_API void ELF_APIENTRY elfSetSoundPriority(elf_handle sound, int priority);
+ELF_API int ELF_APIENTRY elfGetSoundPriority(elf_handle sound);
 ELF_API elf_handle ELF_APIENTRY elfPlaySound(elf_handle sound, float volume);
 ELF_API elf_handle ELF_APIENTRY elfPlayEntitySound(elf_handle entity, elf_handle sound, float volume);
 ELF_API elf_handle ELF_APIENTRY elfLoopSound(elf_handle sound, float volume);
@@ -69,14 +69,14 @@ void elf_init_actor(elf_actor *actor, unsigned char camera)
 	actor->moved = ELF_TRUE;
 }
 
-void elf_update_actor(elf_actor *actor)
+void elf_sync_actor_transform(elf_actor *actor)
 {
-	static float oposition[3];
-	static float oorient[4];
-	static float position[3];
-	static float orient[4];
-	static elf_audio_source *source;
+	float oposition[3];
+	float oorient[4];
+	float position[3];
+	float orient[4];
 
+	// only touches the actor and its own bodies, the scene runs this on the worker threads
 	if(actor->object && !elf_is_physics_object_static(actor->object))
 	{
 		gfx_get_transform_position(actor->transform, oposition);
@@ -97,19 +97,21 @@ void elf_update_actor(elf_actor *actor)
 		if(memcmp(&oposition, &position, sizeof(float)*3)) actor->moved = ELF_TRUE;
 		if(memcmp(&oorient, &orient, sizeof(float)*4)) actor->moved = ELF_TRUE;
 	}
-	else
-	{
-		elf_get_actor_position_(actor, position);
-	}
+}
+
+void elf_update_actor(elf_actor *actor)
+{
+	static float position[3];
+	static elf_audio_source *source;
+
+	elf_get_actor_position_(actor, position);
 
 	if(actor->script && actor->scene->run_scripts)
 	{
 		eng->actor = (elf_object*)actor;
 		elf_inc_ref((elf_object*)actor);
 
-		elf_run_string("me = elf.GetActor()");
-		elf_run_script(actor->script);
-		elf_run_string("me = nil");
+		elf_run_actor_script(actor->script, 0);
 
 		elf_dec_ref((elf_object*)actor);
 		eng->actor = NULL;
@@ -159,6 +159,11 @@ void elf_update_armature_bones(elf_armature *armature)
 
 	armature->bone_count = max_id+1;
 
+	if(armature->matrices) free(armature->matrices);
+	armature->matrices = (float*)malloc(sizeof(float)*16*armature->bone_count);
+	memset(armature->matrices, 0x0, sizeof(float)*16*armature->bone_count);
+	armature->pose_valid = ELF_FALSE;
+
 	for(cbone = (elf_bone*)elf_begin_list(armature->root_bones); cbone;
 		cbone = (elf_bone*)elf_next_in_list(armature->root_bones))
 	{
@@ -186,26 +191,19 @@ elf_armature* elf_create_armature(const char *name)
 	return armature;
 }
 
-void elf_deform_entity_with_armature(elf_armature *armature, elf_entity *entity, float frame)
+void elf_update_armature_pose(elf_armature *armature, float frame)
 {
-	int i, j;
-	int id;
-	float temp_vec1[3];
-	float temp_vec2[3];
+	int i;
 	int cid;
 	int nid;
 	float t;
 	float temp_qua[4];
-	float *vertex_buffer;
-	float *normal_buffer;
-	float *orig_vertex_buffer;
-	float *orig_normal_buffer;
+	float axis[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+	float *mat;
 	elf_bone *bone;
-	elf_model *model;
-
-	model = elf_get_entity_model(entity);
 
-	if(!model || !armature->bone_count || !model->boneids || !model->weights) return;
+	// every entity playing the armature at the same frame shares the pose
+	if(armature->pose_valid && armature->pose_frame == frame) return;
 
 	cid = ((int)frame)-1;
 	if(cid < 0) cid = 0;
@@ -219,7 +217,14 @@ void elf_deform_entity_with_armature(elf_armature *armature, elf_entity *entity,
 	for(i = 0; i < armature->bone_count; i++)
 	{
 		bone = armature->bones[i];
-		if(!bone) continue;
+		mat = &armature->matrices[i*16];
+
+		// a missing bone gets a zero matrix, so its weights add nothing like before
+		if(!bone)
+		{
+			memset(mat, 0x0, sizeof(float)*16);
+			continue;
+		}
 
 		bone->cur_offset_pos.x = bone->frames[cid].offset_pos.x+(bone->frames[nid].offset_pos.x-bone->frames[cid].offset_pos.x)*t;
 		bone->cur_offset_pos.y = bone->frames[cid].offset_pos.y+(bone->frames[nid].offset_pos.y-bone->frames[cid].offset_pos.y)*t;
@@ -231,37 +236,121 @@ void elf_deform_entity_with_armature(elf_armature *armature, elf_entity *entity,
 		gfx_qua_slerp(&bone->frames[cid].offset_qua.x, &bone->frames[nid].offset_qua.x, t, &bone->cur_offset_qua.x);
 		gfx_mul_qua_qua(&bone->qua.x, &bone->cur_offset_qua.x, temp_qua);
 		memcpy(&bone->cur_qua.x, temp_qua, sizeof(float)*4);
-	}
 
-	if(!entity->vertices)
-	{
-		entity->vertices = gfx_create_vertex_data(3*model->vertice_count, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
-		gfx_inc_ref((gfx_object*)entity->vertices);
+		// rotate around the rest position and move by the offset, as a 3x4 matrix kept as
+		// four columns padded to four floats: v' = r*v+(pos+offset_pos-r*pos)
+		gfx_mul_qua_vec(&bone->cur_offset_qua.x, axis[0], &mat[0]);
+		gfx_mul_qua_vec(&bone->cur_offset_qua.x, axis[1], &mat[4]);
+		gfx_mul_qua_vec(&bone->cur_offset_qua.x, axis[2], &mat[8]);
+		mat[12] = bone->pos.x+bone->cur_offset_pos.x-(mat[0]*bone->pos.x+mat[4]*bone->pos.y+mat[8]*bone->pos.z);
+		mat[13] = bone->pos.y+bone->cur_offset_pos.y-(mat[1]*bone->pos.x+mat[5]*bone->pos.y+mat[9]*bone->pos.z);
+		mat[14] = bone->pos.z+bone->cur_offset_pos.z-(mat[2]*bone->pos.x+mat[6]*bone->pos.y+mat[10]*bone->pos.z);
+		mat[3] = mat[7] = mat[11] = mat[15] = 0.0;
 	}
 
-	if(!entity->normals)
+	armature->pose_frame = frame;
+	armature->pose_valid = ELF_TRUE;
+}
+
+void elf_skin_vertices(elf_armature *armature, float *weights, int *boneids,
+	float *orig_vertices, float *orig_normals, float *vertices, float *normals, int first, int last)
+{
+	int i, j;
+	int id;
+	float *mat;
+#ifdef ELF_SSE
+	__m128 c0, c1, c2, c3;
+	__m128 w, v, n;
+#else
+	float blend[12];
+	float w;
+	int k;
+#endif
+
+	// the matrices of the influencing bones are blended by weight first, then each vertex
+	// and normal goes through the blended matrix once
+	for(i = first; i < last; i++)
 	{
-		entity->normals = gfx_create_vertex_data(3*model->vertice_count, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
-		gfx_inc_ref((gfx_object*)entity->normals);
+#ifdef ELF_SSE
+		c0 = c1 = c2 = c3 = _mm_setzero_ps();
+
+		for(j = 0; j < 4; j++)
+		{
+			id = boneids[i*4+j];
+			if(id < 0 || id > armature->bone_count-1 || weights[i*4+j] == 0.0) continue;
+
+			mat = &armature->matrices[id*16];
+			w = _mm_set1_ps(weights[i*4+j]);
+			c0 = _mm_add_ps(c0, _mm_mul_ps(_mm_loadu_ps(mat), w));
+			c1 = _mm_add_ps(c1, _mm_mul_ps(_mm_loadu_ps(mat+4), w));
+			c2 = _mm_add_ps(c2, _mm_mul_ps(_mm_loadu_ps(mat+8), w));
+			c3 = _mm_add_ps(c3, _mm_mul_ps(_mm_loadu_ps(mat+12), w));
+		}
+
+		v = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(orig_vertices[i*3])), _mm_mul_ps(c1, _mm_set1_ps(orig_vertices[i*3+1])));
+		v = _mm_add_ps(v, _mm_mul_ps(c2, _mm_set1_ps(orig_vertices[i*3+2])));
+		v = _mm_add_ps(v, c3);
+
+		n = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(orig_normals[i*3])), _mm_mul_ps(c1, _mm_set1_ps(orig_normals[i*3+1])));
+		n = _mm_add_ps(n, _mm_mul_ps(c2, _mm_set1_ps(orig_normals[i*3+2])));
+
+		// three floats per vertex, don't write into the next one or past the end
+		_mm_storel_pi((__m64*)&vertices[i*3], v);
+		_mm_store_ss(&vertices[i*3+2], _mm_movehl_ps(v, v));
+		_mm_storel_pi((__m64*)&normals[i*3], n);
+		_mm_store_ss(&normals[i*3+2], _mm_movehl_ps(n, n));
+#else
+		memset(blend, 0x0, sizeof(float)*12);
+
+		for(j = 0; j < 4; j++)
+		{
+			id = boneids[i*4+j];
+			if(id < 0 || id > armature->bone_count-1 || weights[i*4+j] == 0.0) continue;
+
+			mat = &armature->matrices[id*16];
+			w = weights[i*4+j];
+			for(k = 0; k < 3; k++)
+			{
+				blend[k] += mat[k]*w;
+				blend[3+k] += mat[4+k]*w;
+				blend[6+k] += mat[8+k]*w;
+				blend[9+k] += mat[12+k]*w;
+			}
+		}
+
+		for(k = 0; k < 3; k++)
+		{
+			vertices[i*3+k] = blend[k]*orig_vertices[i*3]+blend[3+k]*orig_vertices[i*3+1]+
+				blend[6+k]*orig_vertices[i*3+2]+blend[9+k];
+			normals[i*3+k] = blend[k]*orig_normals[i*3]+blend[3+k]*orig_normals[i*3+1]+
+				blend[6+k]*orig_normals[i*3+2];
+		}
+#endif
 	}
+}
 
-	vertex_buffer = gfx_get_vertex_data_buffer(entity->vertices);
-	normal_buffer = gfx_get_vertex_data_buffer(entity->normals);
-	orig_vertex_buffer = gfx_get_vertex_data_buffer(model->vertices);
-	orig_normal_buffer = gfx_get_vertex_data_buffer(model->normals);
+void elf_skin_vertices_with_quaternions(elf_armature *armature, float *weights, int *boneids,
+	float *orig_vertices, float *orig_normals, float *vertices, float *normals, int first, int last)
+{
+	int i, j;
+	int id;
+	float temp_vec1[3];
+	float temp_vec2[3];
+	elf_bone *bone;
 
-	for(i = 0; i < model->vertice_count; i++)
+	// the old per bone path, only kept for comparing against in elf_benchmark_skinning
+	for(i = first; i < last; i++)
 	{
-		memset(&vertex_buffer[i*3], 0x0, sizeof(float)*3);
-		memset(&normal_buffer[i*3], 0x0, sizeof(float)*3);
+		memset(&vertices[i*3], 0x0, sizeof(float)*3);
+		memset(&normals[i*3], 0x0, sizeof(float)*3);
 
 		for(j = 0; j < 4; j++)
 		{
-			id = model->boneids[i*4+j];
+			id = boneids[i*4+j];
 
 			if(id < 0 || id > (int)armature->bone_count-1 || !(bone = armature->bones[id])) continue;
 
-			memcpy(temp_vec1, &orig_vertex_buffer[i*3], sizeof(float)*3);
+			memcpy(temp_vec1, &orig_vertices[i*3], sizeof(float)*3);
 			temp_vec1[0] -= bone->pos.x;
 			temp_vec1[1] -= bone->pos.y;
 			temp_vec1[2] -= bone->pos.z;
@@ -273,18 +362,63 @@ void elf_deform_entity_with_armature(elf_armature *armature, elf_entity *entity,
 			temp_vec2[1] += bone->cur_offset_pos.y;
 			temp_vec2[2] += bone->cur_offset_pos.z;
 
-			vertex_buffer[i*3] += temp_vec2[0]*model->weights[i*4+j];
-			vertex_buffer[i*3+1] += temp_vec2[1]*model->weights[i*4+j];
-			vertex_buffer[i*3+2] += temp_vec2[2]*model->weights[i*4+j];
+			vertices[i*3] += temp_vec2[0]*weights[i*4+j];
+			vertices[i*3+1] += temp_vec2[1]*weights[i*4+j];
+			vertices[i*3+2] += temp_vec2[2]*weights[i*4+j];
 
-			gfx_mul_qua_vec(&bone->cur_offset_qua.x, &orig_normal_buffer[i*3], temp_vec1);
+			gfx_mul_qua_vec(&bone->cur_offset_qua.x, &orig_normals[i*3], temp_vec1);
 
-			normal_buffer[i*3] += temp_vec1[0]*model->weights[i*4+j];
-			normal_buffer[i*3+1] += temp_vec1[1]*model->weights[i*4+j];
-			normal_buffer[i*3+2] += temp_vec1[2]*model->weights[i*4+j];
+			normals[i*3] += temp_vec1[0]*weights[i*4+j];
+			normals[i*3+1] += temp_vec1[1]*weights[i*4+j];
+			normals[i*3+2] += temp_vec1[2]*weights[i*4+j];
 		}
 	}
-	
+}
+
+void elf_run_skin_job(void *data, int first, int last)
+{
+	elf_skin_job *job;
+
+	job = (elf_skin_job*)data;
+
+	elf_skin_vertices(job->armature, job->weights, job->boneids, job->orig_vertices, job->orig_normals,
+		job->vertices, job->normals, first, last);
+}
+
+void elf_deform_entity_with_armature(elf_armature *armature, elf_entity *entity, float frame)
+{
+	elf_model *model;
+	elf_skin_job job;
+
+	model = elf_get_entity_model(entity);
+
+	if(!model || !armature->bone_count || !model->boneids || !model->weights) return;
+
+	elf_update_armature_pose(armature, frame);
+
+	if(!entity->vertices)
+	{
+		entity->vertices = gfx_create_vertex_data(3*model->vertice_count, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
+		gfx_inc_ref((gfx_object*)entity->vertices);
+	}
+
+	if(!entity->normals)
+	{
+		entity->normals = gfx_create_vertex_data(3*model->vertice_count, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
+		gfx_inc_ref((gfx_object*)entity->normals);
+	}
+
+	// the pose is shared by every entity on the armature, so the vertices are split up instead
+	job.armature = armature;
+	job.weights = model->weights;
+	job.boneids = model->boneids;
+	job.orig_vertices = (float*)gfx_get_vertex_data_buffer(model->vertices);
+	job.orig_normals = (float*)gfx_get_vertex_data_buffer(model->normals);
+	job.vertices = (float*)gfx_get_vertex_data_buffer(entity->vertices);
+	job.normals = (float*)gfx_get_vertex_data_buffer(entity->normals);
+
+	elf_run_workers(eng->workers, elf_run_skin_job, &job, model->vertice_count, ELF_SKIN_JOB_SIZE);
+
 	gfx_update_vertex_data(entity->vertices);
 	gfx_update_vertex_data(entity->normals);
 }
@@ -297,6 +431,7 @@ void elf_destroy_armature(elf_armature *armature)
 	elf_dec_ref((elf_object*)armature->root_bones);
 
 	if(armature->bones) free(armature->bones);
+	if(armature->matrices) free(armature->matrices);
 
 	free(armature);
 
@@ -424,3 +559,138 @@ void elf_draw_armature_debug(elf_armature *armature, gfx_shader_params *shader_p
 	}
 }
 
+void elf_benchmark_skinning()
+{
+	elf_armature *armature;
+	elf_bone *root;
+	elf_bone *bone;
+	float *weights;
+	int *boneids;
+	float *orig_vertices;
+	float *orig_normals;
+	float *vertices;
+	float *normals;
+	float *ref_vertices;
+	float *ref_normals;
+	float total;
+	float len;
+	float diff;
+	double time;
+	int counts[2] = {10000, 100000};
+	int bone_count = 32;
+	int i, j, k;
+
+	armature = elf_create_armature("SkinBenchmark");
+	elf_inc_ref((elf_object*)armature);
+	armature->frame_count = 8;
+
+	// a root with bone_count-1 children, every bone has random key frames
+	srand(1234);
+	root = NULL;
+	for(i = 0; i < bone_count; i++)
+	{
+		bone = elf_create_bone("Bone");
+		bone->id = i;
+		bone->pos.x = ((float)rand()/(float)RAND_MAX-0.5)*2.0;
+		bone->pos.y = ((float)rand()/(float)RAND_MAX-0.5)*2.0;
+		bone->pos.z = ((float)rand()/(float)RAND_MAX-0.5)*2.0;
+		gfx_qua_set_identity(&bone->qua.x);
+
+		bone->frames = (elf_bone_frame*)malloc(sizeof(elf_bone_frame)*armature->frame_count);
+		memset(bone->frames, 0x0, sizeof(elf_bone_frame)*armature->frame_count);
+		for(j = 0; j < armature->frame_count; j++)
+		{
+			gfx_set_qua_rotation((float)rand()/(float)RAND_MAX*90.0, (float)rand()/(float)RAND_MAX*90.0,
+				(float)rand()/(float)RAND_MAX*90.0, &bone->frames[j].offset_qua.x);
+			bone->frames[j].offset_pos.x = ((float)rand()/(float)RAND_MAX-0.5)*0.2;
+			bone->frames[j].offset_pos.y = ((float)rand()/(float)RAND_MAX-0.5)*0.2;
+			bone->frames[j].offset_pos.z = ((float)rand()/(float)RAND_MAX-0.5)*0.2;
+		}
+
+		if(!root) root = bone;
+		else
+		{
+			bone->parent = root;
+			elf_append_to_list(root->children, (elf_object*)bone);
+		}
+	}
+	elf_add_root_bone_to_armature(armature, root);
+
+	weights = (float*)malloc(sizeof(float)*4*counts[1]);
+	boneids = (int*)malloc(sizeof(int)*4*counts[1]);
+	orig_vertices = (float*)malloc(sizeof(float)*3*counts[1]);
+	orig_normals = (float*)malloc(sizeof(float)*3*counts[1]);
+	vertices = (float*)malloc(sizeof(float)*3*counts[1]);
+	normals = (float*)malloc(sizeof(float)*3*counts[1]);
+	ref_vertices = (float*)malloc(sizeof(float)*3*counts[1]);
+	ref_normals = (float*)malloc(sizeof(float)*3*counts[1]);
+
+	for(i = 0; i < counts[1]; i++)
+	{
+		total = 0.0;
+		for(j = 0; j < 4; j++)
+		{
+			boneids[i*4+j] = rand()%bone_count;
+			weights[i*4+j] = (float)rand()/(float)RAND_MAX;
+			total += weights[i*4+j];
+		}
+		for(j = 0; j < 4; j++) weights[i*4+j] /= total;
+
+		len = 0.0;
+		for(j = 0; j < 3; j++)
+		{
+			orig_vertices[i*3+j] = ((float)rand()/(float)RAND_MAX-0.5)*2.0;
+			orig_normals[i*3+j] = (float)rand()/(float)RAND_MAX-0.5;
+			len += orig_normals[i*3+j]*orig_normals[i*3+j];
+		}
+		len = sqrt(len);
+		for(j = 0; j < 3; j++) orig_normals[i*3+j] /= len;
+	}
+
+	for(k = 0; k < 2; k++)
+	{
+		// the old path posed the bones again for every entity, so invalidate the pose every time
+		time = elf_get_time();
+		for(j = 0; j < 20; j++)
+		{
+			armature->pose_valid = ELF_FALSE;
+			elf_update_armature_pose(armature, 1.0+j*0.3);
+			elf_skin_vertices_with_quaternions(armature, weights, boneids, orig_vertices, orig_normals,
+				ref_vertices, ref_normals, 0, counts[k]);
+		}
+		time = elf_get_time()-time;
+
+		elf_write_to_log("skin benchmark: %d vertices, quaternions: %f ms\n", counts[k], time/20.0*1000.0);
+
+		time = elf_get_time();
+		for(j = 0; j < 20; j++)
+		{
+			armature->pose_valid = ELF_FALSE;
+			elf_update_armature_pose(armature, 1.0+j*0.3);
+			elf_skin_vertices(armature, weights, boneids, orig_vertices, orig_normals,
+				vertices, normals, 0, counts[k]);
+		}
+		time = elf_get_time()-time;
+
+		diff = 0.0;
+		for(i = 0; i < counts[k]*3; i++)
+		{
+			if(fabs(vertices[i]-ref_vertices[i]) > diff) diff = fabs(vertices[i]-ref_vertices[i]);
+			if(fabs(normals[i]-ref_normals[i]) > diff) diff = fabs(normals[i]-ref_normals[i]);
+		}
+
+		elf_write_to_log("skin benchmark: %d vertices, matrices: %f ms, largest difference %f\n", counts[k], time/20.0*1000.0, diff);
+	}
+
+	free(weights);
+	free(boneids);
+	free(orig_vertices);
+	free(orig_normals);
+	free(vertices);
+	free(normals);
+	free(ref_vertices);
+	free(ref_normals);
+
+	elf_dec_ref((elf_object*)armature);
+}
+
@@ -0,0 +1,121 @@
+
+// growable array of object pointers. like elf_list it keeps a reference to every item,
+// but the items are contiguous, indexing is constant time and there is no cursor, so
+// the same array can be walked from several places at once.
+
+elf_array* elf_create_array()
+{
+	elf_array *array;
+
+	array = (elf_array*)malloc(sizeof(elf_array));
+	memset(array, 0x0, sizeof(elf_array));
+
+	elf_inc_obj_count();
+
+	return array;
+}
+
+void elf_destroy_array(elf_array *array)
+{
+	elf_truncate_array(array, 0);
+
+	if(array->items) free(array->items);
+
+	free(array);
+
+	elf_dec_obj_count();
+}
+
+int elf_get_array_length(elf_array *array)
+{
+	return array->length;
+}
+
+void elf_append_to_array(elf_array *array, elf_object *obj)
+{
+	if(!obj) return;
+
+	if(array->length >= array->capacity)
+	{
+		array->capacity = array->capacity ? array->capacity*2 : 16;
+		array->items = (elf_object**)realloc(array->items, sizeof(elf_object*)*array->capacity);
+	}
+
+	array->items[array->length++] = obj;
+
+	elf_inc_ref(obj);
+}
+
+elf_object* elf_get_item_from_array(elf_array *array, int idx)
+{
+	if(idx < 0 || idx > array->length-1) return NULL;
+
+	return array->items[idx];
+}
+
+void elf_set_array_item(elf_array *array, int idx, elf_object *obj)
+{
+	if(idx < 0 || idx > array->length-1 || !obj) return;
+
+	// take the new reference first in case the item is set to itself
+	elf_inc_ref(obj);
+	elf_dec_ref(array->items[idx]);
+	array->items[idx] = obj;
+}
+
+void elf_remove_array_item(elf_array *array, int idx)
+{
+	elf_object *obj;
+
+	if(idx < 0 || idx > array->length-1) return;
+
+	obj = array->items[idx];
+
+	memmove(&array->items[idx], &array->items[idx+1], sizeof(elf_object*)*(array->length-idx-1));
+	array->length--;
+
+	elf_dec_ref(obj);
+}
+
+void elf_swap_remove_array_item(elf_array *array, int idx)
+{
+	elf_object *obj;
+
+	if(idx < 0 || idx > array->length-1) return;
+
+	obj = array->items[idx];
+
+	array->items[idx] = array->items[array->length-1];
+	array->length--;
+
+	elf_dec_ref(obj);
+}
+
+unsigned char elf_remove_from_array(elf_array *array, elf_object *obj)
+{
+	int i;
+
+	for(i = 0; i < array->length; i++)
+	{
+		if(array->items[i] == obj)
+		{
+			elf_remove_array_item(array, i);
+			return ELF_TRUE;
+		}
+	}
+
+	return ELF_FALSE;
+}
+
+void elf_truncate_array(elf_array *array, int length)
+{
+	elf_object *obj;
+
+	// release from the end so that the array stays valid if a destructor looks at it
+	while(array->length > length && array->length > 0)
+	{
+		obj = array->items[--array->length];
+		elf_dec_ref(obj);
+	}
+}
+
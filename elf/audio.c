@@ -1,14 +1,33 @@
-
 #include "default.h"
 
 #include "gfx.h"
 #include "blendelf.h"
 #include "types.h"
 
-#define ELF_AUDIO_STREAM_CHUNK_SIZE 4096*8
+// streamed sources and async loads are served by an audio thread. the game thread hands work
+// over through a ring of commands that only it pushes to and only the audio thread pops from,
+// neither side ever waits on a lock. the audio thread owns the buffer queues of the streams it
+// holds and decodes the async loads a few chunks at a time in between topping them up. without
+// the thread the commands run right away and the streams are topped up in elf_update_audio.
+
+#define ELF_AUDIO_STREAM_CHUNK_SIZE	4096*8
+#define ELF_AUDIO_COMMAND_COUNT		256
+#define ELF_AUDIO_MAX_STREAMS		64
+#define ELF_AUDIO_LOAD_CHUNKS		8
+#define ELF_AUDIO_THREAD_INTERVAL	0.005
+#define ELF_AUDIO_MAX_VOICES		32
+#define ELF_AUDIO_SOUND_TABLE_SIZE	256
+
+#define ELF_AUDIO_PLAY_STREAM		0x0001
+#define ELF_AUDIO_STOP_STREAM		0x0002
+#define ELF_AUDIO_PAUSE_STREAM		0x0003
+#define ELF_AUDIO_RESUME_STREAM		0x0004
+#define ELF_AUDIO_LOAD_SOUND		0x0005
 
 typedef struct elf_data_chunk			elf_data_chunk;
 typedef struct elf_data_dump			elf_data_dump;
+typedef struct elf_audio_command		elf_audio_command;
+typedef struct elf_audio_voice			elf_audio_voice;
 
 struct elf_data_chunk {
 	elf_data_chunk *next;
@@ -18,6 +37,8 @@ struct elf_data_chunk {
 
 struct elf_data_dump {
 	elf_data_chunk *first;
+	elf_data_chunk *last;
+	int length;
 	int offset;
 };
 
@@ -33,9 +54,16 @@ elf_data_chunk* elf_create_data_chunk()
 
 void elf_destroy_data_chunk(elf_data_chunk *chunk)
 {
-	if(chunk->next) elf_destroy_data_chunk(chunk->next);
-	if(chunk->data) free(chunk->data);
-	free(chunk);
+	elf_data_chunk *next;
+
+	// long sounds have thousands of chunks, don't recurse through them
+	while(chunk)
+	{
+		next = chunk->next;
+		if(chunk->data) free(chunk->data);
+		free(chunk);
+		chunk = next;
+	}
 }
 
 elf_data_dump* elf_create_data_dump()
@@ -56,41 +84,23 @@ void elf_destroy_data_dump(elf_data_dump *dump)
 
 int elf_get_data_dump_length(elf_data_dump *dump)
 {
-	elf_data_chunk *chk;
-	int length;
-
-	length = 0;
-
-	chk = dump->first;
-	while(chk)
-	{
-		length += chk->length;
-		chk = chk->next;
-	}
-
-	return length;
+	return dump->length;
 }
 
 void elf_add_chunk_to_data_dump(elf_data_dump *dump, void *data, int length)
 {
 	elf_data_chunk *chunk;
-	elf_data_chunk *chk;
 
 	chunk = elf_create_data_chunk();
 	chunk->length = length;
 	chunk->data = malloc(length);
 	memcpy(chunk->data, data, length);
 
-	if(!dump->first)
-	{
-		dump->first = chunk;
-	}
-	else
-	{
-		chk = dump->first;
-		while(chk->next) chk = chk->next;
-		chk->next = chunk;
-	}
+	if(!dump->first) dump->first = chunk;
+	else dump->last->next = chunk;
+
+	dump->last = chunk;
+	dump->length += length;
 }
 
 void elf_data_dump_to_buffer(elf_data_dump *dump, void *buf)
@@ -109,39 +119,101 @@ void elf_data_dump_to_buffer(elf_data_dump *dump, void *buf)
 	}
 }
 
+struct elf_audio_command {
+	int type;
+	elf_audio_source *source;
+	elf_sound *sound;
+};
+
+// an openal source of the pool and the audio source playing on it
+struct elf_audio_voice {
+	ALuint source;
+	elf_audio_source *owner;
+};
+
 struct elf_audio_device {
 	ELF_OBJECT_HEADER;
 	ALCdevice *device;
 	ALCcontext *context;
 	float volume;
 	float rolloff;
+	int stream_buffer_count;
+	float listener[3];
+	float cull_distance;
 	elf_list *sources;
+	elf_list *loads;
+
+	elf_audio_voice voices[ELF_AUDIO_MAX_VOICES];
+	int voice_count;
+	int play_count;
+	int stolen_voices;
+	int culled_sounds;
+
+	// the sounds by file path, a sound leaves when it is destroyed
+	elf_sound *sound_table[ELF_AUDIO_SOUND_TABLE_SIZE];
+	int cached_sounds;
+
+	elf_thread *thread;
+	unsigned char thread_running;
+	volatile unsigned char quit;
+
+	// written by the game thread, read by the audio thread
+	elf_audio_command commands[ELF_AUDIO_COMMAND_COUNT];
+	volatile unsigned int command_read;
+	volatile unsigned int command_write;
+
+	// only touched by the audio thread
+	elf_audio_source *streams[ELF_AUDIO_MAX_STREAMS];
+	int stream_count;
+	elf_sound *first_load;
+	elf_sound *last_load;
 };
 
 struct elf_audio_source {
 	ELF_OBJECT_HEADER;
 	elf_sound *sound;
 	ALuint source;
+	int voice;
+	int priority;
+	int started;
+	float volume;
+	float position[3];
+	unsigned char positional;
+	unsigned char entity;
 	unsigned char loop;
-	unsigned char paused;
+	unsigned char stopped;
+	volatile unsigned char paused;
+	volatile unsigned char attached;
+	volatile int pending;
 };
 
 struct elf_sound {
 	ELF_OBJECT_HEADER;
 	char *file_path;
 	unsigned char file_type;
-	ALuint buffer[3];
+	int priority;
+	ALuint buffer[ELF_AUDIO_MAX_STREAM_BUFFERS];
+	int buffer_count;
 	int freq;
 	int format;
 
 	unsigned char streamed;
 	unsigned char streaming;
-	unsigned char eof;
+	volatile unsigned char eof;
+	volatile unsigned char loading;
 	OggVorbis_File ogg_file;
 	FILE *file;
 	int length;
 	int position;
-	unsigned char oldest_buffer;
+	int data_offset;
+	int oldest_buffer;
+
+	elf_data_dump *dump;
+	elf_sound *next_load;
+
+	unsigned char cached;
+	unsigned int hash;
+	elf_sound *next_cached;
 };
 
 elf_audio_device *audio_device = NULL;
@@ -156,16 +228,26 @@ elf_audio_device* elf_create_audio_device()
 
 	device->volume = 1.0;
 	device->rolloff = 1.0;
+	device->stream_buffer_count = ELF_AUDIO_STREAM_BUFFERS;
 
 	device->sources = elf_create_list();
+	device->loads = elf_create_list();
 	elf_inc_ref((elf_object*)device->sources);
+	elf_inc_ref((elf_object*)device->loads);
 
 	return device;
 }
 
 void elf_destroy_audio_device(elf_audio_device *device)
 {
+	int i;
+
+	elf_stop_audio_thread(device);
+
 	if(device->sources) elf_dec_ref((elf_object*)device->sources);
+	if(device->loads) elf_dec_ref((elf_object*)device->loads);
+
+	for(i = 0; i < device->voice_count; i++) alDeleteSources(1, &device->voices[i].source);
 
 	if(device->device)
 	{
@@ -177,8 +259,219 @@ void elf_destroy_audio_device(elf_audio_device *device)
 	free(device);
 }
 
+unsigned char elf_attach_audio_stream(elf_audio_device *device, elf_audio_source *source)
+{
+	if(source->attached) return ELF_TRUE;
+
+	if(device->stream_count >= ELF_AUDIO_MAX_STREAMS)
+	{
+		elf_write_to_log("warning: too many streamed sounds playing, can't play \"%s\"\n", source->sound->file_path);
+		return ELF_FALSE;
+	}
+
+	device->streams[device->stream_count++] = source;
+	source->attached = ELF_TRUE;
+
+	return ELF_TRUE;
+}
+
+void elf_detach_audio_stream(elf_audio_device *device, elf_audio_source *source)
+{
+	int i;
+
+	for(i = 0; i < device->stream_count; i++)
+	{
+		if(device->streams[i] == source)
+		{
+			device->streams[i] = device->streams[--device->stream_count];
+			break;
+		}
+	}
+
+	source->attached = ELF_FALSE;
+}
+
+void elf_run_audio_command(elf_audio_device *device, elf_audio_command *cmd)
+{
+	elf_audio_source *source;
+	int queued;
+	unsigned int buffer;
+
+	source = cmd->source;
+
+	switch(cmd->type)
+	{
+		case ELF_AUDIO_PLAY_STREAM:
+		case ELF_AUDIO_RESUME_STREAM:
+			if(cmd->type == ELF_AUDIO_PLAY_STREAM || source->sound->eof)
+			{
+				if(source->sound->eof) elf_rewind_sound(source->sound);
+				if(!elf_attach_audio_stream(device, source))
+				{
+					source->sound->eof = ELF_TRUE;
+					break;
+				}
+				elf_stream_audio_source(source);
+			}
+			alSourcePlay(source->source);
+			break;
+		case ELF_AUDIO_STOP_STREAM:
+			alSourceStop(source->source);
+			alGetSourcei(source->source, AL_BUFFERS_QUEUED, &queued);
+			while(queued-- > 0) alSourceUnqueueBuffers(source->source, 1, &buffer);
+			source->sound->eof = ELF_TRUE;
+			elf_detach_audio_stream(device, source);
+			break;
+		case ELF_AUDIO_PAUSE_STREAM:
+			alSourcePause(source->source);
+			break;
+		case ELF_AUDIO_LOAD_SOUND:
+			cmd->sound->next_load = NULL;
+			if(!device->first_load) device->first_load = cmd->sound;
+			else device->last_load->next_load = cmd->sound;
+			device->last_load = cmd->sound;
+			break;
+	}
+}
+
+void elf_run_audio_commands(elf_audio_device *device)
+{
+	elf_audio_command *cmd;
+
+	while(device->command_read != device->command_write)
+	{
+		elf_memory_barrier();
+
+		cmd = &device->commands[device->command_read&(ELF_AUDIO_COMMAND_COUNT-1)];
+		elf_run_audio_command(device, cmd);
+		if(cmd->source) elf_atomic_add(&cmd->source->pending, -1);
+
+		elf_memory_barrier();
+		device->command_read++;
+	}
+}
+
+void elf_push_audio_command(int type, elf_audio_source *source, elf_sound *sound)
+{
+	elf_audio_command *cmd;
+
+	// only full if the audio thread is stuck, wait for it rather than lose a stop
+	while(audio_device->command_write-audio_device->command_read >= ELF_AUDIO_COMMAND_COUNT)
+		elf_sleep(0.001);
+
+	cmd = &audio_device->commands[audio_device->command_write&(ELF_AUDIO_COMMAND_COUNT-1)];
+	cmd->type = type;
+	cmd->source = source;
+	cmd->sound = sound;
+
+	// the source is kept alive until the audio thread is done with the command
+	if(source) elf_atomic_add(&source->pending, 1);
+
+	elf_memory_barrier();
+	audio_device->command_write++;
+
+	if(!audio_device->thread_running) elf_run_audio_commands(audio_device);
+}
+
+void elf_update_audio_streams(elf_audio_device *device)
+{
+	elf_audio_source *source;
+	int queued;
+	int state;
+	int i;
+
+	for(i = 0; i < device->stream_count; )
+	{
+		source = device->streams[i];
+
+		elf_stream_audio_source(source);
+
+		alGetSourcei(source->source, AL_BUFFERS_QUEUED, &queued);
+		alGetSourcei(source->source, AL_SOURCE_STATE, &state);
+
+		if(state != AL_PLAYING && state != AL_PAUSED && !source->paused)
+		{
+			if(queued > 0)
+			{
+				// the queue ran dry before it was topped up, pick up where it stopped
+				alSourcePlay(source->source);
+			}
+			else if(source->sound->eof)
+			{
+				// played out, the slot now holds the next stream
+				elf_detach_audio_stream(device, source);
+				continue;
+			}
+		}
+
+		i++;
+	}
+}
+
+unsigned char elf_update_audio_loads(elf_audio_device *device)
+{
+	elf_sound *sound;
+
+	sound = device->first_load;
+	if(!sound) return ELF_FALSE;
+
+	if(elf_decode_sound(sound, ELF_AUDIO_LOAD_CHUNKS))
+	{
+		elf_upload_sound(sound);
+
+		device->first_load = sound->next_load;
+		if(!device->first_load) device->last_load = NULL;
+		sound->next_load = NULL;
+
+		elf_memory_barrier();
+		sound->loading = ELF_FALSE;
+	}
+
+	return ELF_TRUE;
+}
+
+void elf_run_audio_thread(void *arg)
+{
+	elf_audio_device *device;
+
+	device = (elf_audio_device*)arg;
+
+	while(!device->quit)
+	{
+		elf_run_audio_commands(device);
+		elf_update_audio_streams(device);
+
+		// keep going while there is something to decode, otherwise check again in a bit
+		if(!elf_update_audio_loads(device)) elf_sleep(ELF_AUDIO_THREAD_INTERVAL);
+	}
+}
+
+void elf_start_audio_thread(elf_audio_device *device)
+{
+	if(device->thread_running) return;
+
+	device->quit = ELF_FALSE;
+	device->thread = elf_create_thread(elf_run_audio_thread, device);
+	if(device->thread) device->thread_running = ELF_TRUE;
+	else elf_write_to_log("warning: could not start the audio thread, streaming on the main thread\n");
+}
+
+void elf_stop_audio_thread(elf_audio_device *device)
+{
+	if(!device->thread_running) return;
+
+	device->quit = ELF_TRUE;
+	elf_wait_thread(device->thread);
+	device->thread = NULL;
+	device->thread_running = ELF_FALSE;
+
+	elf_run_audio_commands(device);
+}
+
 unsigned char elf_init_audio()
 {
+	int i;
+
 	if(audio_device)
 	{
 		elf_write_to_log("warning: cannot initialize audio twice\n");
@@ -215,6 +508,16 @@ unsigned char elf_init_audio()
 
 	alListenerf(AL_GAIN, 1.0);
 
+	// as many voices as the device gives, up to the size of the pool
+	for(i = 0; i < ELF_AUDIO_MAX_VOICES; i++)
+	{
+		alGenSources(1, &audio_device->voices[i].source);
+		if(alGetError() != AL_NO_ERROR) break;
+		audio_device->voice_count++;
+	}
+
+	elf_start_audio_thread(audio_device);
+
 	return ELF_TRUE;
 }
 
@@ -230,29 +533,61 @@ void elf_deinit_audio()
 void elf_update_audio()
 {
 	elf_audio_source *source;
+	elf_sound *sound;
+
+	if(!audio_device) return;
+
+	if(!audio_device->thread_running) elf_update_audio_streams(audio_device);
 
 	for(source = (elf_audio_source*)elf_begin_list(audio_device->sources); source;
 		source = (elf_audio_source*)elf_next_in_list(audio_device->sources))
 	{
-		if(source->sound->streamed && !source->paused)
+		// the streams keep their voices, the audio thread is feeding them
+		if(!source->sound->streamed)
 		{
-			elf_stream_audio_source(source);
+			if(source->voice >= 0 && source->loop && elf_is_audio_source_culled(source))
+			{
+				// a loop out of range gives up its voice and waits to come back
+				elf_release_audio_voice(source);
+				audio_device->culled_sounds++;
+			}
+			else if(source->voice >= 0 && !source->paused && !elf_is_sound_playing(source))
+			{
+				// played out, the voice goes back to the pool right away
+				elf_release_audio_voice(source);
+			}
+			else if(source->voice < 0 && source->loop && !source->stopped && !source->paused &&
+				!elf_is_audio_source_culled(source))
+			{
+				// only a free voice, otherwise two loops could keep stealing from each other
+				elf_start_audio_source(source, ELF_FALSE);
+			}
 		}
 
-		if(elf_get_object_ref_count((elf_object*)source) < 2 &&
+		// the entity the source plays on holds a reference too, it lets go once the source is gone from here
+		if(elf_get_object_ref_count((elf_object*)source) < (source->entity ? 3 : 2) &&
 			!elf_is_sound_playing(source) &&
 			!elf_is_sound_paused(source))
 		{
 			if(source->sound->streamed)
 			{
-				if(source->sound->eof && !source->loop) elf_remove_from_list(audio_device->sources, (elf_object*)source);
+				// not before the audio thread has let go of it, a stopped loop is as done as a played out stream
+				if(source->sound->eof && (!source->loop || source->stopped) && !source->attached && source->pending < 1)
+					elf_remove_from_list(audio_device->sources, (elf_object*)source);
 			}
-			else
+			else if(!source->loop || source->stopped)
 			{
 				elf_remove_from_list(audio_device->sources, (elf_object*)source);
 			}
 		}
 	}
+
+	// the loads hold on to their sounds until the audio thread is done with them
+	for(sound = (elf_sound*)elf_begin_list(audio_device->loads); sound;
+		sound = (elf_sound*)elf_next_in_list(audio_device->loads))
+	{
+		if(!sound->loading) elf_remove_from_list(audio_device->loads, (elf_object*)sound);
+	}
 }
 
 void elf_set_audio_volume(float volume)
@@ -279,9 +614,30 @@ float elf_get_audio_rolloff()
 	return audio_device->rolloff;
 }
 
+void elf_set_audio_stream_buffer_count(int count)
+{
+	if(!audio_device) return;
+
+	if(count < 2) count = 2;
+	if(count > ELF_AUDIO_MAX_STREAM_BUFFERS) count = ELF_AUDIO_MAX_STREAM_BUFFERS;
+
+	audio_device->stream_buffer_count = count;
+}
+
+int elf_get_audio_stream_buffer_count()
+{
+	if(!audio_device) return 0;
+	return audio_device->stream_buffer_count;
+}
+
 void elf_set_audio_listener_position(float x, float y, float z)
 {
 	if(!audio_device) return;
+
+	audio_device->listener[0] = x;
+	audio_device->listener[1] = y;
+	audio_device->listener[2] = z;
+
 	alListener3f(AL_POSITION, x, y, z);
 }
 
@@ -291,103 +647,328 @@ void elf_set_audio_listener_orientation(float *params)
 	alListenerfv(AL_ORIENTATION, params);
 }
 
-elf_sound* elf_create_sound()
+void elf_set_audio_cull_distance(float distance)
 {
-	elf_sound *sound;
+	if(!audio_device) return;
+	audio_device->cull_distance = distance < 0.0 ? 0.0 : distance;
+}
 
-	sound = (elf_sound*)malloc(sizeof(elf_sound));
-	memset(sound, 0x0, sizeof(elf_sound));
-	sound->type = ELF_SOUND;
+float elf_get_audio_cull_distance()
+{
+	if(!audio_device) return 0.0;
+	return audio_device->cull_distance;
+}
 
-	return sound;
+int elf_get_audio_voice_count()
+{
+	if(!audio_device) return 0;
+	return audio_device->voice_count;
 }
 
-void elf_destroy_sound(elf_sound *sound)
+int elf_get_audio_active_voice_count()
 {
-	if(sound->file_path) elf_destroy_string(sound->file_path);
-	if(!sound->streamed)
-	{
-		if(sound->buffer[0]) alDeleteBuffers(1, &sound->buffer[0]);
-	}
-	else
+	int count;
+	int i;
+
+	if(!audio_device) return 0;
+
+	count = 0;
+	for(i = 0; i < audio_device->voice_count; i++)
 	{
-		alDeleteBuffers(3, sound->buffer);
-		if(sound->file_type == ELF_OGG) ov_clear(&sound->ogg_file);
-		if(sound->file_type == ELF_WAV) fclose(sound->file);
+		if(audio_device->voices[i].owner) count++;
 	}
-	free(sound);
+
+	return count;
 }
 
-unsigned char elf_init_sound_with_ogg(elf_sound *snd, const char *file_path)
+int elf_get_audio_stolen_voice_count()
 {
-	vorbis_info *info = NULL;
+	if(!audio_device) return 0;
+	return audio_device->stolen_voices;
+}
 
-	if(snd->streamed && snd->file_type == ELF_OGG)
-	{
-		ov_clear(&snd->ogg_file);
-		snd->file = NULL;
-	}
-	if(snd->streamed && snd->file_type == ELF_WAV)
-	{
-		fclose(snd->file);
-		snd->file = NULL;
-	}
+int elf_get_audio_culled_sound_count()
+{
+	if(!audio_device) return 0;
+	return audio_device->culled_sounds;
+}
 
-	snd->file_type = ELF_NONE;
-	snd->length = 0;
-	snd->position = 0;
-	snd->eof = ELF_FALSE;
+int elf_get_audio_cached_sound_count()
+{
+	if(!audio_device) return 0;
+	return audio_device->cached_sounds;
+}
 
-	snd->file = fopen(file_path, "rb");
-	if(!snd->file)
+// the sounds loaded whole are shared by file path, a streamed sound reads from its own file
+// and is never shared. the table doesn't hold a reference, a sound is in it for as long as
+// it lives.
+
+unsigned int elf_get_sound_path_hash(const char *file_path)
+{
+	unsigned int hash;
+
+	// FNV-1a
+	hash = 2166136261u;
+
+	while(*file_path)
 	{
-		elf_set_error(ELF_CANT_OPEN_FILE, "error: can't open file \"%s\"\n", file_path);
-		return ELF_FALSE;
+		hash = (hash^(unsigned char)*file_path)*16777619u;
+		file_path++;
 	}
 
-	snd->file_type = ELF_OGG;
+	return hash;
+}
 
-	ov_open(snd->file, &snd->ogg_file, NULL, 0);
-	info = ov_info(&snd->ogg_file, -1);
+elf_sound* elf_get_cached_sound(const char *file_path)
+{
+	elf_sound *snd;
+	unsigned int hash;
 
-	if(info->channels == 1) snd->format = AL_FORMAT_MONO16;
-	else if(info->channels == 2) snd->format = AL_FORMAT_STEREO16;
-	else
+	hash = elf_get_sound_path_hash(file_path);
+
+	for(snd = audio_device->sound_table[hash&(ELF_AUDIO_SOUND_TABLE_SIZE-1)]; snd; snd = snd->next_cached)
 	{
-		elf_set_error(ELF_CANT_OPEN_FILE, "error: invalid number of channels in \"%s\"\n", file_path);
-		ov_clear(&snd->ogg_file);
-		return ELF_FALSE;
+		if(snd->hash == hash && !strcmp(snd->file_path, file_path)) return snd;
 	}
 
-	snd->freq = info->rate;
+	return NULL;
+}
 
-	return ELF_TRUE;
+void elf_add_cached_sound(elf_sound *snd)
+{
+	elf_sound **bucket;
+
+	snd->hash = elf_get_sound_path_hash(snd->file_path);
+	bucket = &audio_device->sound_table[snd->hash&(ELF_AUDIO_SOUND_TABLE_SIZE-1)];
+
+	snd->next_cached = *bucket;
+	*bucket = snd;
+	snd->cached = ELF_TRUE;
+
+	audio_device->cached_sounds++;
 }
 
-unsigned char elf_init_sound_with_wav(elf_sound *snd, const char *file_path)
+void elf_remove_cached_sound(elf_sound *snd)
 {
-	char buf[ELF_AUDIO_STREAM_CHUNK_SIZE];
+	elf_sound **cur;
 
-	char magic[5] = "\0\0\0\0";
-	unsigned int chunk_length = 0;
-	int junk_data = 0;
-	unsigned short int audio_format = 0;
-	unsigned short int channels = 0;
-	unsigned int freq = 0;
-	unsigned char fmt_found = ELF_FALSE;
-	unsigned char data_found = ELF_FALSE;
+	if(!snd->cached || !audio_device) return;
 
-	if(snd->streamed && snd->file_type == ELF_OGG)
+	for(cur = &audio_device->sound_table[snd->hash&(ELF_AUDIO_SOUND_TABLE_SIZE-1)]; *cur; cur = &(*cur)->next_cached)
 	{
-		ov_clear(&snd->ogg_file);
-		snd->file = NULL;
+		if(*cur == snd)
+		{
+			*cur = snd->next_cached;
+			break;
+		}
 	}
-	if(snd->streamed && snd->file_type == ELF_WAV)
+
+	snd->next_cached = NULL;
+	snd->cached = ELF_FALSE;
+
+	audio_device->cached_sounds--;
+}
+
+// the audio sources play on a fixed pool of voices. a play takes a free voice, or one that
+// has played out, or steals the one of the oldest source with the lowest priority that isn't
+// above its own. streams and paused sources keep their voices. with a cull distance set the
+// entity sounds further away from the listener don't get a voice, the loops among them get
+// one once they come back in range.
+
+unsigned char elf_is_audio_source_culled(elf_audio_source *source)
+{
+	float dx, dy, dz;
+
+	if(!source->positional || audio_device->cull_distance <= 0.0) return ELF_FALSE;
+
+	dx = source->position[0]-audio_device->listener[0];
+	dy = source->position[1]-audio_device->listener[1];
+	dz = source->position[2]-audio_device->listener[2];
+
+	return dx*dx+dy*dy+dz*dz > audio_device->cull_distance*audio_device->cull_distance;
+}
+
+unsigned char elf_acquire_audio_voice(elf_audio_source *source, unsigned char steal)
+{
+	elf_audio_voice *voice;
+	elf_audio_source *owner;
+	elf_audio_source *victim;
+	int idx;
+	int state;
+	int i;
+
+	if(source->voice >= 0) return ELF_TRUE;
+
+	idx = -1;
+	victim = NULL;
+
+	for(i = 0; i < audio_device->voice_count; i++)
+	{
+		owner = audio_device->voices[i].owner;
+		if(!owner)
+		{
+			idx = i;
+			victim = NULL;
+			break;
+		}
+
+		if(owner->sound->streamed || owner->paused) continue;
+
+		alGetSourcei(audio_device->voices[i].source, AL_SOURCE_STATE, &state);
+		if(state != AL_PLAYING)
+		{
+			idx = i;
+			victim = NULL;
+			break;
+		}
+
+		if(!steal || owner->priority > source->priority) continue;
+
+		if(!victim || owner->priority < victim->priority ||
+			(owner->priority == victim->priority && owner->started < victim->started))
+		{
+			idx = i;
+			victim = owner;
+		}
+	}
+
+	if(idx < 0) return ELF_FALSE;
+
+	voice = &audio_device->voices[idx];
+
+	if(victim) audio_device->stolen_voices++;
+	if(voice->owner) elf_release_audio_voice(voice->owner);
+
+	voice->owner = source;
+	source->voice = idx;
+	source->source = voice->source;
+
+	return ELF_TRUE;
+}
+
+void elf_release_audio_voice(elf_audio_source *source)
+{
+	elf_audio_voice *voice;
+
+	if(source->voice < 0) return;
+
+	voice = &audio_device->voices[source->voice];
+
+	// unbinds the buffer, or what is left of a stream queue
+	alSourceStop(voice->source);
+	alSourcei(voice->source, AL_BUFFER, 0);
+
+	voice->owner = NULL;
+	source->voice = -1;
+	source->source = 0;
+}
+
+unsigned char elf_start_audio_source(elf_audio_source *source, unsigned char steal)
+{
+	if(!elf_acquire_audio_voice(source, steal)) return ELF_FALSE;
+
+	// the voice may come from any sound, nothing of that is carried over
+	alSourcei(source->source, AL_BUFFER, source->sound->streamed ? 0 : source->sound->buffer[0]);
+	alSourcei(source->source, AL_LOOPING, source->loop && !source->sound->streamed ? AL_TRUE : AL_FALSE);
+	alSourcef(source->source, AL_GAIN, source->volume);
+	alSourcef(source->source, AL_ROLLOFF_FACTOR, audio_device->rolloff);
+	alSource3f(source->source, AL_POSITION, source->position[0], source->position[1], source->position[2]);
+
+	if(source->sound->streamed)
+	{
+		source->sound->streaming = ELF_TRUE;
+		elf_push_audio_command(ELF_AUDIO_PLAY_STREAM, source, NULL);
+	}
+	else
+	{
+		alSourcePlay(source->source);
+	}
+
+	return ELF_TRUE;
+}
+
+elf_sound* elf_create_sound()
+{
+	elf_sound *sound;
+
+	sound = (elf_sound*)malloc(sizeof(elf_sound));
+	memset(sound, 0x0, sizeof(elf_sound));
+	sound->type = ELF_SOUND;
+
+	return sound;
+}
+
+void elf_destroy_sound(elf_sound *sound)
+{
+	elf_remove_cached_sound(sound);
+
+	if(sound->file_path) elf_destroy_string(sound->file_path);
+	if(sound->buffer_count) alDeleteBuffers(sound->buffer_count, sound->buffer);
+	if(sound->dump) elf_destroy_data_dump(sound->dump);
+	if(sound->file)
+	{
+		if(sound->file_type == ELF_OGG) ov_clear(&sound->ogg_file);
+		else fclose(sound->file);
+	}
+	free(sound);
+}
+
+unsigned char elf_init_sound_with_ogg(elf_sound *snd, const char *file_path)
+{
+	vorbis_info *info = NULL;
+
+	snd->file_type = ELF_NONE;
+	snd->length = 0;
+	snd->position = 0;
+	snd->eof = ELF_FALSE;
+
+	snd->file = fopen(file_path, "rb");
+	if(!snd->file)
+	{
+		elf_set_error(ELF_CANT_OPEN_FILE, "error: can't open file \"%s\"\n", file_path);
+		return ELF_FALSE;
+	}
+
+	if(ov_open(snd->file, &snd->ogg_file, NULL, 0) < 0)
 	{
+		elf_set_error(ELF_INVALID_FILE, "error: \"%s\" invalid ogg file\n", file_path);
 		fclose(snd->file);
 		snd->file = NULL;
+		return ELF_FALSE;
+	}
+
+	snd->file_type = ELF_OGG;
+
+	info = ov_info(&snd->ogg_file, -1);
+
+	if(info->channels == 1) snd->format = AL_FORMAT_MONO16;
+	else if(info->channels == 2) snd->format = AL_FORMAT_STEREO16;
+	else
+	{
+		elf_set_error(ELF_CANT_OPEN_FILE, "error: invalid number of channels in \"%s\"\n", file_path);
+		ov_clear(&snd->ogg_file);
+		snd->file = NULL;
+		return ELF_FALSE;
 	}
 
+	snd->freq = info->rate;
+
+	return ELF_TRUE;
+}
+
+unsigned char elf_init_sound_with_wav(elf_sound *snd, const char *file_path)
+{
+	char buf[ELF_AUDIO_STREAM_CHUNK_SIZE];
+
+	char magic[5] = "\0\0\0\0";
+	unsigned int chunk_length = 0;
+	int junk_data = 0;
+	unsigned short int audio_format = 0;
+	unsigned short int channels = 0;
+	unsigned int freq = 0;
+	unsigned char fmt_found = ELF_FALSE;
+	unsigned char data_found = ELF_FALSE;
+
 	snd->file_type = ELF_NONE;
 	snd->length = 0;
 	snd->position = 0;
@@ -465,6 +1046,7 @@ unsigned char elf_init_sound_with_wav(elf_sound *snd, const char *file_path)
 		else if(strcmp((char*)&magic, "data") == 0)
 		{
 			snd->length = chunk_length;
+			snd->data_offset = ftell(snd->file);
 			data_found = ELF_TRUE;
 		}
 	}
@@ -472,306 +1054,280 @@ unsigned char elf_init_sound_with_wav(elf_sound *snd, const char *file_path)
 	return ELF_TRUE;
 }
 
-elf_sound* elf_load_sound(const char *file_path)
+int elf_read_sound_data(elf_sound *snd, char *buf, int size)
 {
-	elf_sound *snd = NULL;
-
-	elf_data_dump *dump;
-	char buf[ELF_AUDIO_STREAM_CHUNK_SIZE];
-	int bytes_read = 0;
-	char *data;
-
-	int endian = 0;
+	int bytes_read;
+	int read;
 	int bit_stream = 0;
 
-	char *type = NULL;
-
-	if(!audio_device) return NULL;
+	bytes_read = 0;
 
-	snd = elf_create_sound();
-	snd->file_path = elf_create_string(file_path);
-
-	type = strrchr((char*)file_path, '.');
-
-	if(strcmp(type, ".ogg") == 0)
+	if(snd->file_type == ELF_OGG)
 	{
-		if(!elf_init_sound_with_ogg(snd, snd->file_path))
+		// ov_read hands out at most a packet at a time
+		while(bytes_read < size)
 		{
-			elf_destroy_sound(snd);
-			return NULL;
+			read = ov_read(&snd->ogg_file, &buf[bytes_read], size-bytes_read, 0, 2, 1, &bit_stream);
+			if(read == OV_HOLE) continue;
+			if(read < 1) break;
+			bytes_read += read;
 		}
+	}
+	else if(snd->file_type == ELF_WAV)
+	{
+		bytes_read = snd->length-snd->position;
+		if(bytes_read > size) bytes_read = size;
+		if(bytes_read > 0) bytes_read = fread(buf, sizeof(char), bytes_read, snd->file);
+		else bytes_read = 0;
+	}
 
-		dump = elf_create_data_dump();
-		do
-		{
-			bytes_read = ov_read(&snd->ogg_file, buf, ELF_AUDIO_STREAM_CHUNK_SIZE, endian, 2, 1, &bit_stream);
-			elf_add_chunk_to_data_dump(dump, buf, bytes_read);
-			snd->length += bytes_read;
-		}
-		while (bytes_read > 0);
+	snd->position += bytes_read;
 
-		snd->length = elf_get_data_dump_length(dump);
-		data = (char*)malloc(snd->length);
-		elf_data_dump_to_buffer(dump, data);
+	return bytes_read;
+}
 
-		elf_destroy_data_dump(dump);
-		ov_clear(&snd->ogg_file);
-	}
-	else if(strcmp(type, ".wav") == 0)
-	{
-		if(!elf_init_sound_with_wav(snd, snd->file_path))
-		{
-			elf_destroy_sound(snd);
-			return NULL;
-		}
+void elf_rewind_sound(elf_sound *snd)
+{
+	if(snd->file_type == ELF_OGG) ov_pcm_seek(&snd->ogg_file, 0);
+	else if(snd->file_type == ELF_WAV) fseek(snd->file, snd->data_offset, SEEK_SET);
 
-		data = (char*)malloc(snd->length);
-		fread(data, sizeof(char), snd->length, snd->file);
+	snd->position = 0;
+	snd->eof = ELF_FALSE;
+}
 
-		fclose(snd->file);
-		snd->file = NULL;
-	}
-	else
+unsigned char elf_decode_sound(elf_sound *snd, int max_chunks)
+{
+	char buf[ELF_AUDIO_STREAM_CHUNK_SIZE];
+	int bytes_read;
+	int i;
+
+	// everything when max_chunks is 0
+	for(i = 0; max_chunks < 1 || i < max_chunks; i++)
 	{
-		elf_set_error(ELF_UNKNOWN_FORMAT, "error: can't load \"%s\", unknown format\n", file_path);
-		elf_destroy_sound(snd);
-		return NULL;
+		bytes_read = elf_read_sound_data(snd, buf, ELF_AUDIO_STREAM_CHUNK_SIZE);
+		if(bytes_read < 1) return ELF_TRUE;
+
+		elf_add_chunk_to_data_dump(snd->dump, buf, bytes_read);
 	}
 
+	return ELF_FALSE;
+}
+
+void elf_upload_sound(elf_sound *snd)
+{
+	char *data;
+
+	snd->length = elf_get_data_dump_length(snd->dump);
+	data = (char*)malloc(snd->length);
+	elf_data_dump_to_buffer(snd->dump, data);
+
 	alGenBuffers(1, &snd->buffer[0]);
 	alBufferData(snd->buffer[0], snd->format, data, snd->length, snd->freq);
+	snd->buffer_count = 1;
 
 	free(data);
 
-	return snd;
+	elf_destroy_data_dump(snd->dump);
+	snd->dump = NULL;
+
+	if(snd->file_type == ELF_OGG) ov_clear(&snd->ogg_file);
+	else fclose(snd->file);
+	snd->file = NULL;
 }
 
-elf_sound* elf_load_streamed_sound(const char *file_path)
+elf_sound* elf_open_sound(const char *file_path, unsigned char streamed)
 {
 	elf_sound *snd = NULL;
 
 	char *type = NULL;
 
-	if(!audio_device) return NULL;
-
 	snd = elf_create_sound();
 
 	snd->file_path = elf_create_string(file_path);
-	snd->streamed = ELF_TRUE;
+	snd->streamed = streamed;
 
 	type = strrchr((char*)file_path, '.');
 
-	if(strcmp(type, ".ogg") == 0)
+	if(type && strcmp(type, ".ogg") == 0)
 	{
-		if(!elf_init_sound_with_ogg(snd, snd->file_path))
-		{
-			elf_destroy_sound(snd);
-			return NULL;
-		}
+		if(elf_init_sound_with_ogg(snd, snd->file_path)) return snd;
 	}
-	else if(strcmp(type, ".wav") == 0)
+	else if(type && strcmp(type, ".wav") == 0)
 	{
-		if(!elf_init_sound_with_wav(snd, snd->file_path))
-		{
-			elf_destroy_sound(snd);
-			return NULL;
-		}
+		if(elf_init_sound_with_wav(snd, snd->file_path)) return snd;
 	}
 	else
 	{
 		elf_set_error(ELF_UNKNOWN_FORMAT, "error: can't load \"%s\", unknown format\n", file_path);
-		elf_destroy_sound(snd);
-		return NULL;
 	}
 
-	alGenBuffers(3, snd->buffer);
+	elf_destroy_sound(snd);
 
-	return snd;
-}
-
-int elf_get_sound_file_type(elf_sound *sound)
-{
-	return sound->file_type;
+	return NULL;
 }
 
-elf_audio_source* elf_play_sound(elf_sound *sound, float volume)
+elf_sound* elf_load_sound(const char *file_path)
 {
-	elf_audio_source *source;
+	elf_sound *snd = NULL;
 
-	if(!audio_device || sound->streaming) return NULL;
+	if(!audio_device) return NULL;
 
-	source = elf_create_audio_source();
+	// an async load of the same file is finished first
+	snd = elf_get_cached_sound(file_path);
+	if(snd)
+	{
+		elf_wait_sound_load(snd);
+		return snd;
+	}
 
-	// clear errors
-	alGetError();
+	snd = elf_open_sound(file_path, ELF_FALSE);
+	if(!snd) return NULL;
 
-	source->sound = sound;
-	elf_inc_ref((elf_object*)sound);
+	snd->dump = elf_create_data_dump();
+	elf_decode_sound(snd, 0);
+	elf_upload_sound(snd);
 
-	alGenSources(1, &source->source);
+	elf_add_cached_sound(snd);
 
-	// check if everything went well
-	if(alGetError() != AL_NO_ERROR)
-	{
-		elf_destroy_audio_source(source);
-		return NULL;
-	}
+	return snd;
+}
 
-	if(!source->sound->streamed) alSourcei(source->source, AL_BUFFER, sound->buffer[0]);
+elf_sound* elf_load_sound_async(const char *file_path)
+{
+	elf_sound *snd = NULL;
 
-	alSourcef(source->source, AL_GAIN, volume);
-	alSourcef(source->source, AL_ROLLOFF_FACTOR, audio_device->rolloff);
+	if(!audio_device) return NULL;
+	if(!audio_device->thread_running) return elf_load_sound(file_path);
 
-	if(source->sound->streamed)
-	{
-		elf_stream_audio_source(source);
-		source->sound->streaming = ELF_TRUE;
-	}
-	alSourcePlay(source->source);
+	snd = elf_get_cached_sound(file_path);
+	if(snd) return snd;
 
-	elf_append_to_list(audio_device->sources, (elf_object*)source);
+	// the header is read right away, a bad file is still reported here
+	snd = elf_open_sound(file_path, ELF_FALSE);
+	if(!snd) return NULL;
 
-	return source;
-}
+	snd->dump = elf_create_data_dump();
+	snd->loading = ELF_TRUE;
 
-elf_audio_source* elf_play_entity_sound(elf_entity *entity, elf_sound *sound, float volume)
-{
-	elf_audio_source *source;
-	float position[3];
+	elf_add_cached_sound(snd);
 
-	if(!audio_device || sound->streaming) return NULL;
+	elf_append_to_list(audio_device->loads, (elf_object*)snd);
+	elf_push_audio_command(ELF_AUDIO_LOAD_SOUND, NULL, snd);
 
-	source = elf_create_audio_source();
+	return snd;
+}
 
-	// clear errors
-	alGetError();
+elf_sound* elf_load_streamed_sound(const char *file_path)
+{
+	elf_sound *snd = NULL;
 
-	source->sound = sound;
-	elf_inc_ref((elf_object*)sound);
+	if(!audio_device) return NULL;
 
-	alGenSources(1, &source->source);
+	snd = elf_open_sound(file_path, ELF_TRUE);
+	if(!snd) return NULL;
 
-	// check if everything went well
-	if(alGetError() != AL_NO_ERROR)
-	{
-		elf_destroy_audio_source(source);
-		return NULL;
-	}
+	snd->buffer_count = audio_device->stream_buffer_count;
+	alGenBuffers(snd->buffer_count, snd->buffer);
 
-	if(!source->sound->streamed) alSourcei(source->source, AL_BUFFER, sound->buffer[0]);
+	return snd;
+}
 
-	alSourcef(source->source, AL_GAIN, volume);
-	alSourcef(source->source, AL_ROLLOFF_FACTOR, audio_device->rolloff);
+unsigned char elf_is_sound_loaded(elf_sound *sound)
+{
+	return !sound->loading;
+}
 
-	elf_get_actor_position_((elf_actor*)entity, position);
-	alSource3f(source->source, AL_POSITION, position[0], position[1], position[2]);
+void elf_wait_sound_load(elf_sound *sound)
+{
+	while(sound->loading) elf_sleep(0.001);
+	elf_memory_barrier();
+}
 
-	if(source->sound->streamed)
-	{
-		elf_stream_audio_source(source);
-		source->sound->streaming = ELF_TRUE;
-	}
-	alSourcePlay(source->source);
+int elf_get_sound_file_type(elf_sound *sound)
+{
+	return sound->file_type;
+}
 
-	elf_append_to_list(audio_device->sources, (elf_object*)source);
-	elf_append_to_list(entity->sources, (elf_object*)source);
+void elf_set_sound_priority(elf_sound *sound, int priority)
+{
+	sound->priority = priority;
+}
 
-	return source;
+int elf_get_sound_priority(elf_sound *sound)
+{
+	return sound->priority;
 }
 
-elf_audio_source* elf_loop_sound(elf_sound *sound, float volume)
+elf_audio_source* elf_play_audio_source(elf_entity *entity, elf_sound *sound, float volume, unsigned char loop)
 {
 	elf_audio_source *source;
 
 	if(!audio_device || sound->streaming) return NULL;
 
-	source = elf_create_audio_source();
+	// an async load is finished first
+	elf_wait_sound_load(sound);
 
-	// clear errors
-	alGetError();
+	source = elf_create_audio_source();
 
-	source->loop = ELF_TRUE;
 	source->sound = sound;
 	elf_inc_ref((elf_object*)sound);
 
-	alGenSources(1, &source->source);
+	source->loop = loop;
+	source->volume = volume;
+	source->priority = sound->priority;
+	source->started = audio_device->play_count++;
 
-	// check if everything went well
-	if(alGetError() != AL_NO_ERROR)
+	if(entity)
 	{
-		elf_destroy_audio_source(source);
-		return NULL;
+		elf_get_actor_position_((elf_actor*)entity, source->position);
+		source->positional = ELF_TRUE;
 	}
 
-	if(!source->sound->streamed)
+	if(elf_is_audio_source_culled(source))
 	{
-		alSourcei(source->source, AL_BUFFER, sound->buffer[0]);
-		alSourcei(source->source, AL_LOOPING, AL_TRUE);
+		audio_device->culled_sounds++;
 	}
-
-	alSourcef(source->source, AL_GAIN, volume);
-	alSourcef(source->source, AL_ROLLOFF_FACTOR, audio_device->rolloff);
-
-	if(source->sound->streamed)
+	else if(!elf_start_audio_source(source, ELF_TRUE))
 	{
-		elf_stream_audio_source(source);
-		source->sound->streaming = ELF_TRUE;
+		elf_log(ELF_LOG_DEBUG, "no free voice to play \"%s\"\n", sound->file_path);
 	}
-	alSourcePlay(source->source);
-
-	elf_append_to_list(audio_device->sources, (elf_object*)source);
 
-	return source;
-}
-
-elf_audio_source* elf_loop_entity_sound(elf_entity *entity, elf_sound *sound, float volume)
-{
-	elf_audio_source *source;
-	float position[3];
-
-	if(!audio_device || sound->streaming) return NULL;
-
-	source = elf_create_audio_source();
-
-	// clear errors
-	alGetError();
-
-	source->loop = ELF_TRUE;
-	source->sound = sound;
-	elf_inc_ref((elf_object*)sound);
-
-	alGenSources(1, &source->source);
-
-	// check if everything went well
-	if(alGetError() != AL_NO_ERROR)
+	// a loop without a voice waits for one, anything else is dropped
+	if(source->voice < 0 && (!loop || sound->streamed))
 	{
 		elf_destroy_audio_source(source);
 		return NULL;
 	}
 
-	if(!source->sound->streamed)
+	elf_append_to_list(audio_device->sources, (elf_object*)source);
+
+	if(entity)
 	{
-		alSourcei(source->source, AL_BUFFER, sound->buffer[0]);
-		alSourcei(source->source, AL_LOOPING, AL_TRUE);
+		elf_append_to_list(entity->sources, (elf_object*)source);
+		source->entity = ELF_TRUE;
 	}
 
-	alSourcef(source->source, AL_GAIN, volume);
-	alSourcef(source->source, AL_ROLLOFF_FACTOR, audio_device->rolloff);
+	return source;
+}
 
-	elf_get_actor_position_((elf_actor*)entity, position);
-	alSource3f(source->source, AL_POSITION, position[0], position[1], position[2]);
+elf_audio_source* elf_play_sound(elf_sound *sound, float volume)
+{
+	return elf_play_audio_source(NULL, sound, volume, ELF_FALSE);
+}
 
-	if(source->sound->streamed)
-	{
-		elf_stream_audio_source(source);
-		source->sound->streaming = ELF_TRUE;
-	}
-	alSourcePlay(source->source);
+elf_audio_source* elf_play_entity_sound(elf_entity *entity, elf_sound *sound, float volume)
+{
+	return elf_play_audio_source(entity, sound, volume, ELF_FALSE);
+}
 
-	elf_append_to_list(audio_device->sources, (elf_object*)source);
-	elf_append_to_list(entity->sources, (elf_object*)source);
+elf_audio_source* elf_loop_sound(elf_sound *sound, float volume)
+{
+	return elf_play_audio_source(NULL, sound, volume, ELF_TRUE);
+}
 
-	return source;
+elf_audio_source* elf_loop_entity_sound(elf_entity *entity, elf_sound *sound, float volume)
+{
+	return elf_play_audio_source(entity, sound, volume, ELF_TRUE);
 }
 
 elf_audio_source* elf_create_audio_source()
@@ -782,90 +1338,44 @@ elf_audio_source* elf_create_audio_source()
 	memset(source, 0x0, sizeof(elf_audio_source));
 	source->type = ELF_AUDIO_SOURCE;
 
+	source->voice = -1;
+
 	return source;
 }
 
 void elf_stream_audio_source(elf_audio_source *source)
 {
+	elf_sound *sound;
 	int queued;
 	int processed;
 	unsigned int buffer;
 
 	char buf[ELF_AUDIO_STREAM_CHUNK_SIZE];
-	int read;
 	int bytes_read;
-	int bytes_to_read;
 
-	int endian = 0;
-	int bit_stream = 0;
-
-	if(!source->sound->eof)
-	{
-		if(!elf_is_sound_playing(source) && !elf_is_sound_paused(source))
-		{
-			elf_resume_sound(source);
-		}
-	}
-	else
-	{
-		if(!source->loop)
-		{
-			return;
-		}
-	}
+	sound = source->sound;
 
-	alGetSourcei(source->source, AL_BUFFERS_QUEUED, &queued);
 	alGetSourcei(source->source, AL_BUFFERS_PROCESSED, &processed);
+	while(processed-- > 0) alSourceUnqueueBuffers(source->source, 1, &buffer);
 
-	while(processed--) alSourceUnqueueBuffers(source->source, 1, &buffer);
+	alGetSourcei(source->source, AL_BUFFERS_QUEUED, &queued);
 
-	if(queued < 3)
+	// the buffers are queued in turn, so the oldest one is always the one played out first
+	while(queued < sound->buffer_count && !sound->eof)
 	{
-		bytes_read = 0;
-		if(source->sound->file_type == ELF_OGG)
-		{
-			bytes_to_read = ELF_AUDIO_STREAM_CHUNK_SIZE;
-
-			do
-			{
-				read = ov_read(&source->sound->ogg_file, &buf[bytes_read], ELF_AUDIO_STREAM_CHUNK_SIZE-bytes_read, endian, 2, 1, &bit_stream);
-				if(read < 1)
-				{
-					if(source->loop) elf_init_sound_with_ogg(source->sound, source->sound->file_path);
-					else source->sound->eof = ELF_TRUE;
-					break;
-				}
-				bytes_read += read;
-				bytes_to_read -= read;
-			}
-			while (bytes_to_read > 0);
-
-			source->sound->position += bytes_read;
-		}
-		else if(source->sound->file_type == ELF_WAV)
+		bytes_read = elf_read_sound_data(sound, buf, ELF_AUDIO_STREAM_CHUNK_SIZE);
+		if(bytes_read < 1)
 		{
-			if(source->sound->length-source->sound->position > ELF_AUDIO_STREAM_CHUNK_SIZE)
-				bytes_to_read = ELF_AUDIO_STREAM_CHUNK_SIZE;
-			else bytes_to_read = source->sound->length-source->sound->position;
-
-			if(bytes_to_read > 0) fread(buf, sizeof(char), bytes_to_read, source->sound->file);
-			else
-			{
-				if(source->loop) elf_init_sound_with_wav(source->sound, source->sound->file_path);
-				else source->sound->eof = ELF_TRUE;
-			}
-
-			bytes_read = bytes_to_read;
-			source->sound->position += bytes_read;
+			// a loop carries on from the start in the same queue, unless there is nothing to play
+			if(source->loop && sound->position > 0) elf_rewind_sound(sound);
+			else sound->eof = ELF_TRUE;
+			continue;
 		}
 
-		if(bytes_read > 0)
-		{
-			alBufferData(source->sound->buffer[source->sound->oldest_buffer], source->sound->format, buf, bytes_read, source->sound->freq);
-			alSourceQueueBuffers(source->source, 1, &source->sound->buffer[source->sound->oldest_buffer]);
-			source->sound->oldest_buffer++;
-			if(source->sound->oldest_buffer > 2) source->sound->oldest_buffer = 0;
-		}
+		alBufferData(sound->buffer[sound->oldest_buffer], sound->format, buf, bytes_read, sound->freq);
+		alSourceQueueBuffers(source->source, 1, &sound->buffer[sound->oldest_buffer]);
+		sound->oldest_buffer = (sound->oldest_buffer+1)%sound->buffer_count;
+		queued++;
 	}
 }
 
@@ -876,74 +1386,56 @@ void elf_destroy_audio_source(elf_audio_source *source)
 		source->sound->streaming = ELF_FALSE;
 		elf_dec_ref((elf_object*)source->sound);
 	}
-	if(source->source) alDeleteSources(1, &source->source);
+	if(audio_device) elf_release_audio_voice(source);
 
 	free(source);
 }
 
 void elf_set_sound_volume(elf_audio_source *source, float volume)
 {
-	alSourcef(source->source, AL_GAIN, volume);
+	source->volume = volume;
+	if(source->voice >= 0) alSourcef(source->source, AL_GAIN, volume);
 }
 
 float elf_get_sound_volume(elf_audio_source *source)
 {
-	float volume = 0.0;
-	alGetSourcef(source->source, AL_GAIN, &volume);
-	return volume;
+	return source->volume;
 }
 
 void elf_pause_sound(elf_audio_source *audio_source)
 {
-	alSourcePause(audio_source->source);
 	audio_source->paused = ELF_TRUE;
+
+	if(audio_source->sound->streamed) elf_push_audio_command(ELF_AUDIO_PAUSE_STREAM, audio_source, NULL);
+	else if(audio_source->voice >= 0) alSourcePause(audio_source->source);
 }
 
 void elf_resume_sound(elf_audio_source *source)
 {
 	if(elf_is_sound_playing(source)) return;
 
-	if(source->sound->streamed)
-	{
-		if(source->sound->eof)
-		{
-			if(source->sound->file_type == ELF_OGG) elf_init_sound_with_ogg(source->sound, source->sound->file_path);
-			else if(source->sound->file_type == ELF_WAV) elf_init_sound_with_wav(source->sound, source->sound->file_path);
-		}
-		else
-		{
-			alSourcePlay(source->source);
-		}
-	}
-	else
-	{
-		alSourcePlay(source->source);
-	}
 	source->paused = ELF_FALSE;
+	source->stopped = ELF_FALSE;
+
+	// a stream that played out or was stopped starts over, a sound that lost its voice asks for a new one
+	if(source->sound->streamed) elf_push_audio_command(ELF_AUDIO_RESUME_STREAM, source, NULL);
+	else if(source->voice >= 0) alSourcePlay(source->source);
+	else if(!elf_is_audio_source_culled(source)) elf_start_audio_source(source, ELF_TRUE);
 }
 
 void elf_stop_sound(elf_audio_source *source)
 {
-	int queued;
-	unsigned int buffer;
+	if(source->sound->streamed) elf_push_audio_command(ELF_AUDIO_STOP_STREAM, source, NULL);
+	else elf_release_audio_voice(source);
 
-	if(source->sound->streamed)
-	{
-		alSourceStop(source->source);
-		alGetSourcei(source->source, AL_BUFFERS_QUEUED, &queued);
-		while(queued--) alSourceUnqueueBuffers(source->source, 1, &buffer);
-		source->sound->eof = ELF_TRUE;
-	}
-	else
-	{
-		alSourceStop(source->source);
-		source->paused = ELF_FALSE;
-	}
+	source->paused = ELF_FALSE;
+	source->stopped = ELF_TRUE;
 }
 
 unsigned char elf_is_sound_playing(elf_audio_source *source)
 {
 	int state = 0;
+	if(source->voice < 0) return ELF_FALSE;
 	alGetSourcei(source->source, AL_SOURCE_STATE, &state);
 	if(state == AL_PLAYING) return ELF_TRUE;
 	return ELF_FALSE;
@@ -956,6 +1448,9 @@ unsigned char elf_is_sound_paused(elf_audio_source *source)
 
 void elf_set_sound_position(elf_audio_source *source, float x, float y, float z)
 {
-	alSource3f(source->source, AL_POSITION, x, y, z);
-}
+	source->position[0] = x;
+	source->position[1] = y;
+	source->position[2] = z;
 
+	if(source->voice >= 0) alSource3f(source->source, AL_POSITION, x, y, z);
+}
@@ -0,0 +1,502 @@
+
+// synthetic scenes for comparing engine versions. every scene is built from a fixed random seed,
+// saved to a pak and loaded back like a real one, then stepped and drawn for a fixed number of
+// ticks at a fixed tick rate. the timings of the profiler scopes and the object counts of every
+// scene go to a json report.
+
+elf_model* elf_create_bench_model(elf_scene *scene, const char *name, int rings, int segments, int bone_count)
+{
+	elf_decoded_model decoded;
+	elf_model *model;
+	float angle;
+	float height;
+	float pos;
+	int vertice_count;
+	int i, j, k;
+
+	memset(&decoded, 0x0, sizeof(elf_decoded_model));
+
+	// a closed tube two units high, bones are spread evenly from bottom to top
+	vertice_count = (rings+1)*segments;
+
+	strncpy(decoded.name, name, 63);
+	decoded.vertice_count = vertice_count;
+	decoded.frame_count = 1;
+	decoded.indice_count = rings*segments*6;
+	decoded.area_count = 1;
+	decoded.is_tex_coords = ELF_TRUE;
+
+	decoded.vertices = (float*)malloc(sizeof(float)*3*vertice_count);
+	decoded.normals = (float*)malloc(sizeof(float)*3*vertice_count);
+	decoded.tex_coords = (float*)malloc(sizeof(float)*2*vertice_count);
+	decoded.index = (unsigned int*)malloc(sizeof(unsigned int)*decoded.indice_count);
+	decoded.area_indice_counts = (int*)malloc(sizeof(int));
+	decoded.area_indice_counts[0] = decoded.indice_count;
+
+	if(bone_count > 0)
+	{
+		decoded.weights = (float*)malloc(sizeof(float)*4*vertice_count);
+		decoded.boneids = (int*)malloc(sizeof(int)*4*vertice_count);
+		memset(decoded.weights, 0x0, sizeof(float)*4*vertice_count);
+		memset(decoded.boneids, 0x0, sizeof(int)*4*vertice_count);
+	}
+
+	for(i = 0; i <= rings; i++)
+	{
+		height = (float)i/(float)rings;
+
+		for(j = 0; j < segments; j++)
+		{
+			k = i*segments+j;
+			angle = (float)j/(float)segments*360.0*GFX_PI_DIV_180;
+
+			decoded.vertices[k*3] = (float)cos(angle)*0.4;
+			decoded.vertices[k*3+1] = (float)sin(angle)*0.4;
+			decoded.vertices[k*3+2] = height*2.0;
+			decoded.normals[k*3] = (float)cos(angle);
+			decoded.normals[k*3+1] = (float)sin(angle);
+			decoded.normals[k*3+2] = 0.0;
+			decoded.tex_coords[k*2] = (float)j/(float)segments;
+			decoded.tex_coords[k*2+1] = height;
+
+			if(bone_count > 0)
+			{
+				// blend between the two closest bones
+				pos = height*(bone_count-1);
+				decoded.boneids[k*4] = (int)pos;
+				decoded.boneids[k*4+1] = (int)pos < bone_count-1 ? (int)pos+1 : (int)pos;
+				decoded.weights[k*4] = 1.0-(pos-(int)pos);
+				decoded.weights[k*4+1] = pos-(int)pos;
+			}
+		}
+	}
+
+	for(i = 0, k = 0; i < rings; i++)
+	{
+		for(j = 0; j < segments; j++)
+		{
+			decoded.index[k++] = i*segments+j;
+			decoded.index[k++] = i*segments+(j+1)%segments;
+			decoded.index[k++] = (i+1)*segments+j;
+			decoded.index[k++] = (i+1)*segments+j;
+			decoded.index[k++] = i*segments+(j+1)%segments;
+			decoded.index[k++] = (i+1)*segments+(j+1)%segments;
+		}
+	}
+
+	decoded.bb_min.x = -0.4; decoded.bb_min.y = -0.4; decoded.bb_min.z = 0.0;
+	decoded.bb_max.x = 0.4; decoded.bb_max.y = 0.4; decoded.bb_max.z = 2.0;
+
+	model = elf_create_model_from_decoded(&decoded, name, scene);
+	elf_clear_decoded_model(&decoded);
+
+	return model;
+}
+
+elf_armature* elf_create_bench_armature(const char *name, int bone_count, int frame_count)
+{
+	elf_armature *armature;
+	elf_bone *root;
+	elf_bone *parent;
+	elf_bone *bone;
+	char bone_name[32];
+	float angle;
+	int i, j;
+
+	armature = elf_create_armature(name);
+	armature->frame_count = frame_count;
+
+	// a chain up the tube, every bone sways back and forth once over the animation
+	root = NULL;
+	parent = NULL;
+	for(i = 0; i < bone_count; i++)
+	{
+		sprintf(bone_name, "Bone%d", i);
+		bone = elf_create_bone(bone_name);
+		bone->id = i;
+		bone->pos.z = bone_count > 1 ? (float)i/(float)(bone_count-1)*2.0 : 0.0;
+		gfx_qua_set_identity(&bone->qua.x);
+
+		bone->frames = (elf_bone_frame*)malloc(sizeof(elf_bone_frame)*frame_count);
+		memset(bone->frames, 0x0, sizeof(elf_bone_frame)*frame_count);
+		for(j = 0; j < frame_count; j++)
+		{
+			angle = (float)sin((float)j/(float)frame_count*360.0*GFX_PI_DIV_180)*20.0;
+			gfx_set_qua_rotation(angle, 0.0, 0.0, &bone->frames[j].qua.x);
+			memcpy(&bone->frames[j].offset_qua.x, &bone->frames[j].qua.x, sizeof(float)*4);
+			memcpy(&bone->frames[j].pos.x, &bone->pos.x, sizeof(float)*3);
+		}
+
+		if(!root) root = bone;
+		else
+		{
+			bone->parent = parent;
+			elf_append_to_list(parent->children, (elf_object*)bone);
+		}
+		parent = bone;
+	}
+
+	if(root) elf_add_root_bone_to_armature(armature, root);
+
+	return armature;
+}
+
+void elf_get_bench_grid_position(int idx, int count, float spacing, float *position)
+{
+	int side;
+
+	side = (int)ceil(sqrt((float)count));
+	if(side < 1) side = 1;
+
+	position[0] = ((idx%side)-(side-1)*0.5)*spacing;
+	position[1] = ((idx/side)-(side-1)*0.5)*spacing;
+	position[2] = 0.0;
+}
+
+elf_scene* elf_create_bench_scene(const char *name, int entity_count, int light_count,
+	int skinned_count, int particles_count, int scripted_count)
+{
+	elf_scene *scene;
+	elf_camera *camera;
+	elf_model *model;
+	elf_model *skinned_model;
+	elf_armature *armature;
+	elf_material *material;
+	elf_script *script;
+	elf_entity *entity;
+	elf_light *light;
+	elf_particles *particles;
+	float position[3];
+	float size;
+	int total;
+	int i;
+
+	srand(ELF_BENCH_SEED);
+
+	scene = elf_create_scene(name);
+
+	// everything is laid out on one grid, the camera looks down on it from the side
+	total = entity_count+skinned_count+particles_count+scripted_count;
+	size = (float)ceil(sqrt((float)total))*3.0;
+	if(size < 10.0) size = 10.0;
+
+	camera = elf_create_camera("BenchCamera");
+	elf_set_camera_perspective(camera, 35.0, -1.0, 1.0, size*4.0);
+	elf_set_actor_position((elf_actor*)camera, 0.0, -size, size*0.8);
+	elf_set_actor_rotation((elf_actor*)camera, 50.0, 0.0, 0.0);
+	elf_add_camera_to_scene(scene, camera);
+
+	model = elf_create_bench_model(scene, "BenchBody", 4, 12, 0);
+	skinned_model = elf_create_bench_model(scene, "BenchCharacter", 16, 16, ELF_BENCH_BONE_COUNT);
+	armature = elf_create_bench_armature("BenchArmature", ELF_BENCH_BONE_COUNT, 30);
+
+	material = elf_create_material("BenchMaterial");
+	elf_set_material_diffuse_color(material, 0.8, 0.8, 0.8, 1.0);
+
+	script = elf_create_script();
+	script->name = elf_create_string("BenchSpin");
+	elf_set_script_text(script, "elf.RotateActor(me, 0.0, 0.0, 90.0*elf.GetSync())\n");
+
+	elf_inc_ref((elf_object*)model);
+	elf_inc_ref((elf_object*)skinned_model);
+	elf_inc_ref((elf_object*)armature);
+	elf_inc_ref((elf_object*)material);
+	elf_inc_ref((elf_object*)script);
+
+	for(i = 0; i < total; i++)
+	{
+		elf_get_bench_grid_position(i, total, 3.0, position);
+
+		if(i < entity_count+skinned_count+scripted_count)
+		{
+			entity = elf_create_entity("BenchEntity");
+			elf_set_actor_position((elf_actor*)entity, position[0], position[1], position[2]);
+			elf_set_actor_rotation((elf_actor*)entity, 0.0, 0.0, elf_random_float()*360.0);
+			elf_add_entity_material(entity, material);
+
+			if(i < entity_count)
+			{
+				elf_set_entity_model(entity, model);
+			}
+			else if(i < entity_count+skinned_count)
+			{
+				elf_set_entity_model(entity, skinned_model);
+				elf_set_entity_armature(entity, armature);
+			}
+			else
+			{
+				elf_set_entity_model(entity, model);
+				elf_set_actor_script((elf_actor*)entity, script);
+			}
+
+			elf_add_entity_to_scene(scene, entity);
+		}
+		else
+		{
+			particles = elf_create_particles("BenchEmitter", 256);
+			elf_set_actor_position((elf_actor*)particles, position[0], position[1], position[2]);
+			elf_set_particles_spawn_delay(particles, 0.01);
+			elf_set_particles_life_span(particles, 1.5, 2.5);
+			elf_set_particles_size(particles, 0.1, 0.3);
+			elf_set_particles_gravity(particles, 0.0, 0.0, -4.0);
+			elf_set_particles_velocity_min(particles, -1.0, -1.0, 3.0);
+			elf_set_particles_velocity_max(particles, 1.0, 1.0, 5.0);
+			elf_add_particles_to_scene(scene, particles);
+		}
+	}
+
+	for(i = 0; i < light_count; i++)
+	{
+		elf_get_bench_grid_position(i, light_count, size/(float)ceil(sqrt((float)light_count)), position);
+
+		light = elf_create_light("BenchLight");
+		elf_set_light_type(light, ELF_POINT_LIGHT);
+		elf_set_light_color(light, 0.5+elf_random_float()*0.5, 0.5+elf_random_float()*0.5, 0.5+elf_random_float()*0.5, 1.0);
+		elf_set_light_distance(light, size/(float)ceil(sqrt((float)light_count))*1.5);
+		elf_set_actor_position((elf_actor*)light, position[0], position[1], 4.0);
+		elf_add_light_to_scene(scene, light);
+	}
+
+	elf_dec_ref((elf_object*)model);
+	elf_dec_ref((elf_object*)skinned_model);
+	elf_dec_ref((elf_object*)armature);
+	elf_dec_ref((elf_object*)material);
+	elf_dec_ref((elf_object*)script);
+
+	return scene;
+}
+
+unsigned char elf_save_bench_scene(const char *file_path, int entity_count, int light_count,
+	int skinned_count, int particles_count, int scripted_count)
+{
+	elf_scene *scene;
+	unsigned char result;
+
+	scene = elf_create_bench_scene("BenchScene", entity_count, light_count, skinned_count, particles_count, scripted_count);
+	elf_inc_ref((elf_object*)scene);
+
+	result = elf_save_scene_to_pak(scene, file_path, ELF_TRUE);
+
+	elf_dec_ref((elf_object*)scene);
+
+	return result;
+}
+
+int elf_compare_bench_times(const void *a, const void *b)
+{
+	if(*(const double*)a < *(const double*)b) return -1;
+	if(*(const double*)a > *(const double*)b) return 1;
+	return 0;
+}
+
+unsigned char elf_run_bench_scene(const char *file_path, int ticks, float tick_rate, FILE *report)
+{
+	elf_scene *scene;
+	elf_scene *prev_scene;
+	elf_entity *ent;
+	elf_profile_scope *scope;
+	char names[ELF_BENCH_MAX_TIMINGS][ELF_PROFILE_NAME_LENGTH];
+	double scope_times[ELF_BENCH_MAX_TIMINGS];
+	double *times;
+	double start;
+	double load_time;
+	double total_time;
+	double draw_calls;
+	double state_changes;
+	double polygons;
+	float prev_tick_rate;
+	int created_objs;
+	int alive_objs;
+	int gfx_objs;
+	int name_count;
+	int i, j, k;
+
+	if(ticks < 1 || tick_rate <= 0.0) return ELF_FALSE;
+
+	// the emitters take their seeds from the global random sequence while loading
+	srand(ELF_BENCH_SEED);
+
+	start = elf_get_time();
+	scene = elf_create_scene_from_file(file_path);
+	if(!scene) return ELF_FALSE;
+	load_time = elf_get_time()-start;
+
+	elf_inc_ref((elf_object*)scene);
+
+	// playback is not part of the pak, start every armature the same way
+	for(i = 0; i < elf_get_array_length(scene->entities); i++)
+	{
+		ent = (elf_entity*)elf_get_item_from_array(scene->entities, i);
+		if(ent->armature) elf_loop_entity_armature(ent, 1.0, ent->armature->frame_count, 24.0);
+	}
+
+	prev_scene = eng->scene;
+	if(prev_scene) elf_inc_ref((elf_object*)prev_scene);
+	elf_set_scene(scene);
+
+	prev_tick_rate = elf_get_tick_rate();
+	elf_set_tick_rate(tick_rate);
+
+	times = (double*)malloc(sizeof(double)*ticks);
+	memset(names, 0x0, sizeof(names));
+	memset(scope_times, 0x0, sizeof(scope_times));
+	strcpy(names[ELF_BENCH_MAX_TIMINGS-1], "other");
+	name_count = 0;
+	draw_calls = 0.0;
+	state_changes = 0.0;
+	polygons = 0.0;
+
+	created_objs = elf_get_created_obj_count();
+
+	// the same steps as elf_run without the window, the gui and the fps limit
+	for(i = 0; i < ticks; i++)
+	{
+		start = elf_get_time();
+
+		ELF_PROFILE_BEGIN_FRAME();
+
+		gfx_reset_vertices_drawn();
+		gfx_clear_buffers(0.0, 0.0, 0.0, 0.0, 1.0);
+
+		ELF_PROFILE_BEGIN("pre draw");
+		elf_scene_pre_draw(scene);
+		ELF_PROFILE_END();
+
+		ELF_PROFILE_BEGIN("draw scene");
+		elf_draw_scene(scene);
+		ELF_PROFILE_END();
+
+		ELF_PROFILE_BEGIN("post draw");
+		elf_scene_post_draw(scene);
+		ELF_PROFILE_END();
+
+		draw_calls += gfx_get_draw_calls();
+		state_changes += gfx_get_state_changes();
+		polygons += elf_get_polygons_rendered();
+
+		eng->sync = eng->tick_rate;
+
+		ELF_PROFILE_BEGIN("update scene");
+		elf_update_scene(scene, eng->sync);
+		ELF_PROFILE_END();
+
+		ELF_PROFILE_END_FRAME();
+
+		times[i] = elf_get_time()-start;
+
+		if(!elf_is_profiler_enabled()) continue;
+
+		// scopes with the same name are summed, the rest goes under "other" once the table is full
+		for(j = 0; j < elf_get_profile_scope_count(0); j++)
+		{
+			scope = elf_get_profile_frame_scope(0, j);
+
+			for(k = 0; k < name_count; k++)
+				if(!strcmp(names[k], scope->name)) break;
+
+			if(k == name_count)
+			{
+				if(name_count < ELF_BENCH_MAX_TIMINGS-1) strcpy(names[name_count++], scope->name);
+				else k = ELF_BENCH_MAX_TIMINGS-1;
+			}
+
+			scope_times[k] += scope->end-scope->start;
+		}
+	}
+
+	// after the run, so that leaked objects show up next to the created ones
+	alive_objs = elf_get_global_obj_count();
+	created_objs = elf_get_created_obj_count()-created_objs;
+	gfx_objs = gfx_get_global_obj_count();
+
+	total_time = 0.0;
+	for(i = 0; i < ticks; i++) total_time += times[i];
+
+	qsort(times, ticks, sizeof(double), elf_compare_bench_times);
+
+	fprintf(report, "{\"pak\":\"");
+	elf_write_profile_trace_name(report, file_path);
+	fprintf(report, "\",\"entities\":%d,\"lights\":%d,\"particles\":%d,\"load_ms\":%.3f,",
+		elf_get_array_length(scene->entities), elf_get_list_length(scene->lights),
+		elf_get_list_length(scene->particles), load_time*1000.0);
+	fprintf(report, "\"tick_ms\":{\"mean\":%.4f,\"median\":%.4f,\"p95\":%.4f,\"min\":%.4f,\"max\":%.4f},",
+		total_time/ticks*1000.0, times[ticks/2]*1000.0, times[(int)(ticks*0.95) < ticks ? (int)(ticks*0.95) : ticks-1]*1000.0,
+		times[0]*1000.0, times[ticks-1]*1000.0);
+	fprintf(report, "\"per_tick\":{\"draw_calls\":%.1f,\"state_changes\":%.1f,\"polygons\":%.1f,\"objects_created\":%.2f},",
+		draw_calls/ticks, state_changes/ticks, polygons/ticks, (float)created_objs/ticks);
+	fprintf(report, "\"objects\":{\"alive\":%d,\"created\":%d,\"gfx_alive\":%d},", alive_objs, created_objs, gfx_objs);
+	fprintf(report, "\"memory\":{\"textures\":%d,\"vertex_buffers\":%d},", gfx_get_texture_memory(), gfx_get_vertex_buffer_memory());
+
+	fprintf(report, "\"subsystems_ms\":{");
+	for(i = 0; i < ELF_BENCH_MAX_TIMINGS; i++)
+	{
+		if(i >= name_count && (i < ELF_BENCH_MAX_TIMINGS-1 || scope_times[i] <= 0.0)) continue;
+
+		fprintf(report, "%s\"", i > 0 ? "," : "");
+		elf_write_profile_trace_name(report, names[i]);
+		fprintf(report, "\":%.4f", scope_times[i]/ticks*1000.0);
+	}
+	fprintf(report, "}}");
+
+	free(times);
+
+	elf_set_tick_rate(prev_tick_rate);
+
+	elf_set_scene(prev_scene);
+	if(prev_scene) elf_dec_ref((elf_object*)prev_scene);
+
+	elf_dec_ref((elf_object*)scene);
+
+	return ELF_TRUE;
+}
+
+void elf_benchmark_scenes(int ticks, float tick_rate, const char *report_path)
+{
+	FILE *report;
+	char file_path[64];
+	unsigned char first;
+	const char *names[6] = {"entities", "lights", "skinned", "particles", "scripted", "mixed"};
+	// entities, lights, skinned characters, particle emitters, scripted actors
+	int counts[6][5] = {
+		{2000, 1, 0, 0, 0},
+		{400, 32, 0, 0, 0},
+		{0, 1, 64, 0, 0},
+		{100, 1, 0, 32, 0},
+		{0, 1, 0, 0, 500},
+		{500, 8, 16, 8, 100}};
+	int i;
+
+	report = fopen(report_path, "w");
+	if(!report)
+	{
+		elf_set_error(ELF_CANT_OPEN_FILE, "error: can't open file \"%s\" for writing\n", report_path);
+		return;
+	}
+
+	fprintf(report, "{\"version\":\"%s\",\"platform\":\"%s\",\"headless\":%s,\"profiler\":%s,\"ticks\":%d,\"tick_rate\":%f,\"scenes\":{\n",
+		elf_get_version(), elf_get_platform(), elf_is_headless() ? "true" : "false",
+		elf_is_profiler_available() ? "true" : "false", ticks, tick_rate);
+
+	first = ELF_TRUE;
+	for(i = 0; i < 6; i++)
+	{
+		sprintf(file_path, "bench_%s.pak", names[i]);
+
+		if(!elf_save_bench_scene(file_path, counts[i][0], counts[i][1], counts[i][2], counts[i][3], counts[i][4]))
+			continue;
+
+		fprintf(report, "%s\"%s\":", first ? "" : ",\n", names[i]);
+		if(!elf_run_bench_scene(file_path, ticks, tick_rate, report)) fprintf(report, "null");
+		first = ELF_FALSE;
+
+		elf_write_to_log("bench: %s done\n", names[i]);
+
+		remove(file_path);
+	}
+
+	fprintf(report, "\n}}\n");
+	fclose(report);
+
+	elf_write_to_log("bench: report saved to %s\n", report_path);
+}
+
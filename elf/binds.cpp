@@ -113,6 +113,10 @@ ELF_API int ELF_APIENTRY elfGetGlobalObjCount()
 {
 	return elf_get_global_obj_count();
 }
+ELF_API int ELF_APIENTRY elfGetCreatedObjCount()
+{
+	return elf_get_created_obj_count();
+}
 ELF_API bool ELF_APIENTRY elfIsActor(elf_handle obj)
 {
 	if(!obj.get())
@@ -493,6 +497,24 @@ ELF_API bool ELF_APIENTRY elfGetConfigFullscreen(elf_handle config)
 	}
 	return (bool)elf_get_config_fullscreen((elf_config*)config.get());
 }
+ELF_API bool ELF_APIENTRY elfGetConfigHeadless(elf_handle config)
+{
+	if(!config.get() || elf_get_object_type(config.get()) != ELF_CONFIG)
+	{
+		elf_script *script = elf_get_current_script();
+		if(script)
+		{
+			int line = elf_get_current_script_line();
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "[script \"%s\" %s]:%d: GetConfigHeadless() -> invalid handle\n", elf_get_script_name(script), elf_get_script_file_path(script), line);
+		}
+		else
+		{
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "GetConfigHeadless() -> invalid handle\n");
+		}
+		return false;
+	}
+	return (bool)elf_get_config_headless((elf_config*)config.get());
+}
 ELF_API float ELF_APIENTRY elfGetConfigTextureAnisotropy(elf_handle config)
 {
 	if(!config.get() || elf_get_object_type(config.get()) != ELF_CONFIG)
@@ -565,6 +587,14 @@ ELF_API const char* ELF_APIENTRY elfGetConfigLog(elf_handle config)
 	}
 	return elf_get_config_log((elf_config*)config.get());
 }
+ELF_API void ELF_APIENTRY elfSetLogLevel(int level)
+{
+	elf_set_log_level(level);
+}
+ELF_API int ELF_APIENTRY elfGetLogLevel()
+{
+	return elf_get_log_level();
+}
 ELF_API void ELF_APIENTRY elfSetTitle(const char* title)
 {
 	elf_set_title(title);
@@ -608,6 +638,10 @@ ELF_API bool ELF_APIENTRY elfIsWindowOpened()
 {
 	return (bool)elf_is_window_opened();
 }
+ELF_API bool ELF_APIENTRY elfIsHeadless()
+{
+	return (bool)elf_is_headless();
+}
 ELF_API elf_vec2i ELF_APIENTRY elfGetMousePosition()
 {
 	return elf_get_mouse_position();
@@ -669,6 +703,10 @@ ELF_API bool ELF_APIENTRY elfInit(int width, int height, const char* title, bool
 {
 	return (bool)elf_init(width, height, title, fullscreen, log);
 }
+ELF_API bool ELF_APIENTRY elfInitHeadless(int width, int height, const char* log)
+{
+	return (bool)elf_init_headless(width, height, log);
+}
 ELF_API bool ELF_APIENTRY elfInitWithConfig(const char* file_path)
 {
 	return (bool)elf_init_with_config(file_path);
@@ -735,6 +773,18 @@ ELF_API elf_handle ELF_APIENTRY elfLoadScene(const char* file_path)
 	handle = (elf_object*)elf_load_scene(file_path);
 	return handle;
 }
+ELF_API bool ELF_APIENTRY elfLoadSceneAsync(const char* file_path)
+{
+	return (bool)elf_load_scene_async(file_path);
+}
+ELF_API bool ELF_APIENTRY elfIsSceneLoading()
+{
+	return (bool)elf_is_scene_loading();
+}
+ELF_API float ELF_APIENTRY elfGetSceneLoadProgress()
+{
+	return elf_get_scene_load_progress();
+}
 ELF_API void ELF_APIENTRY elfSetScene(elf_handle scene)
 {
 	if(!scene.get() || elf_get_object_type(scene.get()) != ELF_SCENE)
@@ -811,6 +861,30 @@ ELF_API float ELF_APIENTRY elfGetTickRate()
 {
 	return elf_get_tick_rate();
 }
+ELF_API void ELF_APIENTRY elfSetFixedTickRate(float tick_rate)
+{
+	elf_set_fixed_tick_rate(tick_rate);
+}
+ELF_API float ELF_APIENTRY elfGetFixedTickRate()
+{
+	return elf_get_fixed_tick_rate();
+}
+ELF_API void ELF_APIENTRY elfSetMaxTicksPerFrame(int max_ticks)
+{
+	elf_set_max_ticks_per_frame(max_ticks);
+}
+ELF_API int ELF_APIENTRY elfGetMaxTicksPerFrame()
+{
+	return elf_get_max_ticks_per_frame();
+}
+ELF_API int ELF_APIENTRY elfGetFrameTicks()
+{
+	return elf_get_frame_ticks();
+}
+ELF_API float ELF_APIENTRY elfGetTickBlend()
+{
+	return elf_get_tick_blend();
+}
 ELF_API void ELF_APIENTRY elfSetSpeed(float speed)
 {
 	elf_set_speed(speed);
@@ -839,6 +913,42 @@ ELF_API int ELF_APIENTRY elfGetPolygonsRendered()
 {
 	return elf_get_polygons_rendered();
 }
+ELF_API int ELF_APIENTRY elfGetDrawCalls()
+{
+	return elf_get_draw_calls();
+}
+ELF_API int ELF_APIENTRY elfGetStateChanges()
+{
+	return elf_get_state_changes();
+}
+ELF_API int ELF_APIENTRY elfGetTextureMemory()
+{
+	return elf_get_texture_memory();
+}
+ELF_API int ELF_APIENTRY elfGetVertexBufferMemory()
+{
+	return elf_get_vertex_buffer_memory();
+}
+ELF_API void ELF_APIENTRY elfSetShaderCachePath(const char* path)
+{
+	elf_set_shader_cache_path(path);
+}
+ELF_API const char* ELF_APIENTRY elfGetShaderCachePath()
+{
+	return elf_get_shader_cache_path();
+}
+ELF_API bool ELF_APIENTRY elfIsShaderBinaryCacheSupported()
+{
+	return (bool)elf_is_shader_binary_cache_supported();
+}
+ELF_API int ELF_APIENTRY elfGetShaderCacheHits()
+{
+	return elf_get_shader_cache_hits();
+}
+ELF_API int ELF_APIENTRY elfGetShaderProgramCount()
+{
+	return elf_get_shader_program_count();
+}
 ELF_API void ELF_APIENTRY elfSetBloom(float threshold)
 {
 	elf_set_bloom(threshold);
@@ -1402,6 +1512,86 @@ ELF_API double ELF_APIENTRY elfGetElapsedTime(elf_handle timer)
 	}
 	return elf_get_elapsed_time((elf_timer*)timer.get());
 }
+ELF_API bool ELF_APIENTRY elfIsProfilerAvailable()
+{
+	return (bool)elf_is_profiler_available();
+}
+ELF_API void ELF_APIENTRY elfSetProfilerEnabled(bool enabled)
+{
+	elf_set_profiler_enabled(enabled);
+}
+ELF_API bool ELF_APIENTRY elfIsProfilerEnabled()
+{
+	return (bool)elf_is_profiler_enabled();
+}
+ELF_API int ELF_APIENTRY elfGetProfileFrameCount()
+{
+	return elf_get_profile_frame_count();
+}
+ELF_API float ELF_APIENTRY elfGetProfileFrameTime(int frame)
+{
+	return elf_get_profile_frame_time(frame);
+}
+ELF_API int ELF_APIENTRY elfGetProfileSlowestFrame()
+{
+	return elf_get_profile_slowest_frame();
+}
+ELF_API int ELF_APIENTRY elfGetProfileScopeCount(int frame)
+{
+	return elf_get_profile_scope_count(frame);
+}
+ELF_API const char* ELF_APIENTRY elfGetProfileScopeName(int frame, int idx)
+{
+	return elf_get_profile_scope_name(frame, idx);
+}
+ELF_API int ELF_APIENTRY elfGetProfileScopeDepth(int frame, int idx)
+{
+	return elf_get_profile_scope_depth(frame, idx);
+}
+ELF_API float ELF_APIENTRY elfGetProfileScopeStart(int frame, int idx)
+{
+	return elf_get_profile_scope_start(frame, idx);
+}
+ELF_API float ELF_APIENTRY elfGetProfileScopeTime(int frame, int idx)
+{
+	return elf_get_profile_scope_time(frame, idx);
+}
+ELF_API float ELF_APIENTRY elfGetProfileTime(int frame, const char* name)
+{
+	return elf_get_profile_time(frame, name);
+}
+ELF_API bool ELF_APIENTRY elfSaveProfileTrace(const char* file_path)
+{
+	return (bool)elf_save_profile_trace(file_path);
+}
+ELF_API void ELF_APIENTRY elfSetFramePacingMode(int mode)
+{
+	elf_set_frame_pacing_mode(mode);
+}
+ELF_API int ELF_APIENTRY elfGetFramePacingMode()
+{
+	return elf_get_frame_pacing_mode();
+}
+ELF_API float ELF_APIENTRY elfGetFramePacingJitter()
+{
+	return elf_get_frame_pacing_jitter();
+}
+ELF_API float ELF_APIENTRY elfGetFramePacingMaxJitter()
+{
+	return elf_get_frame_pacing_max_jitter();
+}
+ELF_API float ELF_APIENTRY elfGetFrameWorkTime()
+{
+	return elf_get_frame_work_time();
+}
+ELF_API float ELF_APIENTRY elfGetFramePacingSpinTime()
+{
+	return elf_get_frame_pacing_spin_time();
+}
+ELF_API int ELF_APIENTRY elfGetLateFrameCount()
+{
+	return elf_get_late_frame_count();
+}
 ELF_API elf_handle ELF_APIENTRY elfCreateTextureFromFile(const char* file_path)
 {
 	elf_handle handle;
@@ -5626,6 +5816,24 @@ ELF_API void ELF_APIENTRY elfSetParticlesSpawn(elf_handle particles, bool spawn)
 	}
 	elf_set_particles_spawn((elf_particles*)particles.get(), spawn);
 }
+ELF_API void ELF_APIENTRY elfSetParticlesRandomSeed(elf_handle particles, int seed)
+{
+	if(!particles.get() || elf_get_object_type(particles.get()) != ELF_PARTICLES)
+	{
+		elf_script *script = elf_get_current_script();
+		if(script)
+		{
+			int line = elf_get_current_script_line();
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "[script \"%s\" %s]:%d: SetParticlesRandomSeed() -> invalid handle\n", elf_get_script_name(script), elf_get_script_file_path(script), line);
+		}
+		else
+		{
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "SetParticlesRandomSeed() -> invalid handle\n");
+		}
+		return;
+	}
+	elf_set_particles_random_seed((elf_particles*)particles.get(), seed);
+}
 ELF_API void ELF_APIENTRY elfSetParticlesSize(elf_handle particles, float min, float max)
 {
 	if(!particles.get() || elf_get_object_type(particles.get()) != ELF_PARTICLES)
@@ -6518,6 +6726,24 @@ ELF_API bool ELF_APIENTRY elfSaveScene(elf_handle scene, const char* file_path)
 	}
 	return (bool)elf_save_scene((elf_scene*)scene.get(), file_path);
 }
+ELF_API bool ELF_APIENTRY elfSaveSceneCompressed(elf_handle scene, const char* file_path)
+{
+	if(!scene.get() || elf_get_object_type(scene.get()) != ELF_SCENE)
+	{
+		elf_script *script = elf_get_current_script();
+		if(script)
+		{
+			int line = elf_get_current_script_line();
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "[script \"%s\" %s]:%d: SaveSceneCompressed() -> invalid handle\n", elf_get_script_name(script), elf_get_script_file_path(script), line);
+		}
+		else
+		{
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "SaveSceneCompressed() -> invalid handle\n");
+		}
+		return false;
+	}
+	return (bool)elf_save_scene_compressed((elf_scene*)scene.get(), file_path);
+}
 ELF_API void ELF_APIENTRY elfSetSceneAmbientColor(elf_handle scene, float r, float g, float b, float a)
 {
 	if(!scene.get() || elf_get_object_type(scene.get()) != ELF_SCENE)
@@ -7816,6 +8042,24 @@ ELF_API bool ELF_APIENTRY elfRemoveActorByObject(elf_handle scene, elf_handle ac
 	}
 	return (bool)elf_remove_actor_by_object((elf_scene*)scene.get(), (elf_actor*)actor.get());
 }
+ELF_API int ELF_APIENTRY elfWarmUpSceneShaders(elf_handle scene)
+{
+	if(!scene.get() || elf_get_object_type(scene.get()) != ELF_SCENE)
+	{
+		elf_script *script = elf_get_current_script();
+		if(script)
+		{
+			int line = elf_get_current_script_line();
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "[script \"%s\" %s]:%d: WarmUpSceneShaders() -> invalid handle\n", elf_get_script_name(script), elf_get_script_file_path(script), line);
+		}
+		else
+		{
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "WarmUpSceneShaders() -> invalid handle\n");
+		}
+		return 0;
+	}
+	return elf_warm_up_scene_shaders((elf_scene*)scene.get());
+}
 ELF_API elf_handle ELF_APIENTRY elfCreateScript()
 {
 	elf_handle handle;
@@ -7922,6 +8166,42 @@ ELF_API bool ELF_APIENTRY elfRunScript(elf_handle script)
 	}
 	return (bool)elf_run_script((elf_script*)script.get());
 }
+ELF_API void ELF_APIENTRY elfSetScriptGcMode(int mode)
+{
+	elf_set_script_gc_mode(mode);
+}
+ELF_API int ELF_APIENTRY elfGetScriptGcMode()
+{
+	return elf_get_script_gc_mode();
+}
+ELF_API void ELF_APIENTRY elfSetScriptGcBudget(float budget)
+{
+	elf_set_script_gc_budget(budget);
+}
+ELF_API float ELF_APIENTRY elfGetScriptGcBudget()
+{
+	return elf_get_script_gc_budget();
+}
+ELF_API void ELF_APIENTRY elfSetScriptGcStepSize(int size)
+{
+	elf_set_script_gc_step_size(size);
+}
+ELF_API int ELF_APIENTRY elfGetScriptGcStepSize()
+{
+	return elf_get_script_gc_step_size();
+}
+ELF_API float ELF_APIENTRY elfGetScriptMemory()
+{
+	return elf_get_script_memory();
+}
+ELF_API float ELF_APIENTRY elfGetScriptGcTime()
+{
+	return elf_get_script_gc_time();
+}
+ELF_API int ELF_APIENTRY elfGetScriptGcCycles()
+{
+	return elf_get_script_gc_cycles();
+}
 ELF_API void ELF_APIENTRY elfSetAudioVolume(float volume)
 {
 	elf_set_audio_volume(volume);
@@ -7938,18 +8218,78 @@ ELF_API float ELF_APIENTRY elfGetAudioRolloff()
 {
 	return elf_get_audio_rolloff();
 }
+ELF_API void ELF_APIENTRY elfSetAudioStreamBufferCount(int count)
+{
+	elf_set_audio_stream_buffer_count(count);
+}
+ELF_API int ELF_APIENTRY elfGetAudioStreamBufferCount()
+{
+	return elf_get_audio_stream_buffer_count();
+}
+ELF_API void ELF_APIENTRY elfSetAudioCullDistance(float distance)
+{
+	elf_set_audio_cull_distance(distance);
+}
+ELF_API float ELF_APIENTRY elfGetAudioCullDistance()
+{
+	return elf_get_audio_cull_distance();
+}
+ELF_API int ELF_APIENTRY elfGetAudioVoiceCount()
+{
+	return elf_get_audio_voice_count();
+}
+ELF_API int ELF_APIENTRY elfGetAudioActiveVoiceCount()
+{
+	return elf_get_audio_active_voice_count();
+}
+ELF_API int ELF_APIENTRY elfGetAudioStolenVoiceCount()
+{
+	return elf_get_audio_stolen_voice_count();
+}
+ELF_API int ELF_APIENTRY elfGetAudioCulledSoundCount()
+{
+	return elf_get_audio_culled_sound_count();
+}
+ELF_API int ELF_APIENTRY elfGetAudioCachedSoundCount()
+{
+	return elf_get_audio_cached_sound_count();
+}
 ELF_API elf_handle ELF_APIENTRY elfLoadSound(const char* file_path)
 {
 	elf_handle handle;
 	handle = (elf_object*)elf_load_sound(file_path);
 	return handle;
 }
+ELF_API elf_handle ELF_APIENTRY elfLoadSoundAsync(const char* file_path)
+{
+	elf_handle handle;
+	handle = (elf_object*)elf_load_sound_async(file_path);
+	return handle;
+}
 ELF_API elf_handle ELF_APIENTRY elfLoadStreamedSound(const char* file_path)
 {
 	elf_handle handle;
 	handle = (elf_object*)elf_load_streamed_sound(file_path);
 	return handle;
 }
+ELF_API bool ELF_APIENTRY elfIsSoundLoaded(elf_handle sound)
+{
+	if(!sound.get() || elf_get_object_type(sound.get()) != ELF_SOUND)
+	{
+		elf_script *script = elf_get_current_script();
+		if(script)
+		{
+			int line = elf_get_current_script_line();
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "[script \"%s\" %s]:%d: IsSoundLoaded() -> invalid handle\n", elf_get_script_name(script), elf_get_script_file_path(script), line);
+		}
+		else
+		{
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "IsSoundLoaded() -> invalid handle\n");
+		}
+		return false;
+	}
+	return (bool)elf_is_sound_loaded((elf_sound*)sound.get());
+}
 ELF_API int ELF_APIENTRY elfGetSoundFileType(elf_handle sound)
 {
 	if(!sound.get() || elf_get_object_type(sound.get()) != ELF_SOUND)
@@ -7968,6 +8308,42 @@ ELF_API int ELF_APIENTRY elfGetSoundFileType(elf_handle sound)
 	}
 	return elf_get_sound_file_type((elf_sound*)sound.get());
 }
+ELF_API void ELF_APIENTRY elfSetSoundPriority(elf_handle sound, int priority)
+{
+	if(!sound.get() || elf_get_object_type(sound.get()) != ELF_SOUND)
+	{
+		elf_script *script = elf_get_current_script();
+		if(script)
+		{
+			int line = elf_get_current_script_line();
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "[script \"%s\" %s]:%d: SetSoundPriority() -> invalid handle\n", elf_get_script_name(script), elf_get_script_file_path(script), line);
+		}
+		else
+		{
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "SetSoundPriority() -> invalid handle\n");
+		}
+		return;
+	}
+	elf_set_sound_priority((elf_sound*)sound.get(), priority);
+}
+ELF_API int ELF_APIENTRY elfGetSoundPriority(elf_handle sound)
+{
+	if(!sound.get() || elf_get_object_type(sound.get()) != ELF_SOUND)
+	{
+		elf_script *script = elf_get_current_script();
+		if(script)
+		{
+			int line = elf_get_current_script_line();
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "[script \"%s\" %s]:%d: GetSoundPriority() -> invalid handle\n", elf_get_script_name(script), elf_get_script_file_path(script), line);
+		}
+		else
+		{
+			elf_set_error_no_save(ELF_INVALID_HANDLE, "GetSoundPriority() -> invalid handle\n");
+		}
+		return 0;
+	}
+	return elf_get_sound_priority((elf_sound*)sound.get());
+}
 ELF_API elf_handle ELF_APIENTRY elfPlaySound(elf_handle sound, float volume)
 {
 	elf_handle handle;
@@ -15,10 +15,15 @@ elf_engine *eng = NULL;
 #include "resource.h"
 #include "str.h"
 #include "list.h"
+#include "array.h"
+#include "compress.h"
+#include "thread.h"
 #include "context.h"
 #include "engine.h"
 #include "frameplayer.h"
 #include "timer.h"
+#include "profiler.h"
+#include "pacer.h"
 #include "image.h"
 #include "texture.h"
 #include "material.h"
@@ -27,8 +32,12 @@ elf_engine *eng = NULL;
 #include "model.h"
 #include "entity.h"
 #include "light.h"
+#include "bvh.h"
+#include "cull.h"
 #include "scene.h"
 #include "pak.h"
+#include "loader.h"
+#include "workers.h"
 #include "postprocess.h"
 #include "script.h"
 #include "armature.h"
@@ -39,6 +48,7 @@ elf_engine *eng = NULL;
 #include "sst.h"
 #include "particles.h"
 #include "sprite.h"
+#include "bench.h"
 
 #ifdef ELF_PLAYER
 
@@ -58,7 +68,8 @@ int main()
 		config->start = elf_create_string("start.pak");
 	}
 
-	if(!elf_init(config->window_size[0], config->window_size[1], "BlendELF", !config->fullscreen == ELF_FALSE, config->log))
+	if((config->headless && !elf_init_headless(config->window_size[0], config->window_size[1], config->log)) ||
+		(!config->headless && !elf_init(config->window_size[0], config->window_size[1], "BlendELF", !config->fullscreen == ELF_FALSE, config->log)))
 	{
 		elf_set_error(ELF_CANT_INITIALIZE, "error: can't initialize engine\n");
 		elf_destroy_config(config);
@@ -67,6 +78,50 @@ int main()
 
 	elf_set_texture_anisotropy(config->texture_anisotropy);
 	elf_set_shadow_map_size(config->shadow_map_size);
+	elf_set_log_level(config->log_level);
+	elf_set_script_gc_mode(config->script_gc_mode);
+	elf_set_script_gc_budget(config->script_gc_budget);
+	elf_set_script_gc_step_size(config->script_gc_step_size);
+	elf_set_fixed_tick_rate(config->fixed_tick_rate);
+	elf_set_max_ticks_per_frame(config->max_ticks_per_frame);
+	elf_set_audio_stream_buffer_count(config->audio_stream_buffers);
+	elf_set_shader_cache_path(config->shader_cache);
+
+	if(config->pak_benchmark)
+	{
+		// compare the load times of the start pak saved with and without compression
+		elf_benchmark_pak(config->start);
+		elf_destroy_config(config);
+		elf_deinit();
+		return 0;
+	}
+
+	if(config->cull_benchmark)
+	{
+		// compare frustum culling one box at a time against the batched sse path
+		elf_benchmark_culling();
+		elf_destroy_config(config);
+		elf_deinit();
+		return 0;
+	}
+
+	if(config->skin_benchmark)
+	{
+		// compare skinning with a quaternion per bone against the blended matrix path
+		elf_benchmark_skinning();
+		elf_destroy_config(config);
+		elf_deinit();
+		return 0;
+	}
+
+	if(config->scene_benchmark)
+	{
+		// step and draw the generated scenes and write the timings as json
+		elf_benchmark_scenes(config->benchmark_ticks, config->benchmark_tick_rate, config->benchmark_report);
+		elf_destroy_config(config);
+		elf_deinit();
+		return 0;
+	}
 
 	script = elf_create_script_from_file("init.lua");
 	if(script)
@@ -167,7 +167,8 @@ extern "C" {
 #define ELF_SPRITE					0x0043
 #define ELF_VIDEO_MODE					0x0044
 #define ELF_GENERAL					0x0045
-#define ELF_OBJECT_TYPE_COUNT				0x0046	// <mdoc> NUMBER OF OBJECT TYPES
+#define ELF_SCENE_LOADER				0x0046
+#define ELF_OBJECT_TYPE_COUNT				0x0047	// <mdoc> NUMBER OF OBJECT TYPES
 
 #define ELF_PERSPECTIVE					0x0000	// <mdoc> CAMERA MODE <mdocc> The camera modes used by camera internal functions
 #define ELF_ORTHOGRAPHIC				0x0001
@@ -236,6 +237,17 @@ extern "C" {
 #define ELF_SELECTION_CHANGED				0x0006
 #define ELF_STATE_CHANGED				0x0007
 
+#define ELF_SCRIPT_GC_FULL				0x0001	// <mdoc> SCRIPT GC MODES <mdocc> The garbage collection modes used by elf.SetScriptGcMode
+#define ELF_SCRIPT_GC_INCREMENTAL			0x0002
+
+#define ELF_PACING_FIXED				0x0001	// <mdoc> FRAME PACING MODES <mdocc> The frame pacing modes used by elf.SetFramePacingMode
+#define ELF_PACING_ADAPTIVE				0x0002
+
+#define ELF_LOG_DEBUG					0x0001	// <mdoc> LOG LEVELS <mdocc> The log levels used by elf.SetLogLevel, messages below the set level are not written
+#define ELF_LOG_INFO					0x0002
+#define ELF_LOG_WARNING					0x0003
+#define ELF_LOG_ERROR					0x0004
+
 #define ELF_JOYSTICK_BUTTON_1				0x0000	// <mdoc> JOYSTICK BUTTONS <mdocc> The joystick buttons used by elf.GetJoystickButtonState
 #define ELF_JOYSTICK_BUTTON_2				0x0001
 #define ELF_JOYSTICK_BUTTON_3				0x0002
@@ -301,12 +313,16 @@ extern "C" {
 // !!>
 
 // <!!
+#define ELF_PAK_MAGIC					179532100
+#define ELF_PAK_MAGIC_V2				179532101
+#define ELF_PAK_MAGIC_V3				179532102
 #define ELF_ARMATURE_MAGIC				179532122
 #define ELF_CAMERA_MAGIC				179532111
 #define ELF_ENTITY_MAGIC				179532112
 #define ELF_LIGHT_MAGIC					179532113
 #define ELF_MATERIAL_MAGIC				179532109
 #define ELF_MODEL_MAGIC					179532110
+#define ELF_MODEL_MAGIC_V2				179532142
 #define ELF_PARTICLES_MAGIC				179532141
 #define ELF_SCENE_MAGIC					179532120
 #define ELF_SCRIPT_MAGIC				179532121
@@ -314,6 +330,19 @@ extern "C" {
 #define ELF_TEXTURE_MAGIC				179532108
 // !!>
 
+// <!!
+#define ELF_PAK_COMPRESSION_NONE			0x0000
+#define ELF_PAK_COMPRESSION_LZ				0x0001
+#define ELF_PAK_CHUNK_SIZE				65536
+#define ELF_LZ_HASH_BITS				12
+// !!>
+
+// <!!
+#define ELF_FRUSTUM_OUTSIDE				0x0000
+#define ELF_FRUSTUM_INTERSECT				0x0001
+#define ELF_FRUSTUM_INSIDE				0x0002
+// !!>
+
 typedef struct elf_vec2i				elf_vec2i;
 typedef struct elf_vec2f				elf_vec2f;
 typedef struct elf_vec3f				elf_vec3f;
@@ -321,11 +350,17 @@ typedef struct elf_vec4f				elf_vec4f;
 typedef struct elf_color				elf_color;
 
 typedef struct elf_general				elf_general;
+typedef struct elf_log_slot				elf_log_slot;
+typedef struct elf_logger				elf_logger;
+typedef struct elf_thread				elf_thread;
+typedef struct elf_mutex				elf_mutex;
+typedef struct elf_cond					elf_cond;
 typedef struct elf_config				elf_config;
 typedef struct elf_object				elf_object;
 typedef struct elf_resource				elf_resource;
 typedef struct elf_gui_object				elf_gui_object;
 typedef struct elf_list					elf_list;
+typedef struct elf_array				elf_array;
 typedef struct elf_key_event				elf_key_event;
 typedef struct elf_char_event				elf_char_event;
 typedef struct elf_context				elf_context;
@@ -344,8 +379,21 @@ typedef struct elf_model				elf_model;
 typedef struct elf_entity				elf_entity;
 typedef struct elf_light				elf_light;
 typedef struct elf_scene				elf_scene;
+typedef struct elf_bvh					elf_bvh;
+typedef struct elf_cull_set				elf_cull_set;
 typedef struct elf_pak_index				elf_pak_index;
 typedef struct elf_pak					elf_pak;
+typedef struct elf_pak_reader				elf_pak_reader;
+typedef struct elf_decoded_texture			elf_decoded_texture;
+typedef struct elf_decoded_model			elf_decoded_model;
+typedef struct elf_scene_loader				elf_scene_loader;
+typedef struct elf_workers				elf_workers;
+typedef struct elf_worker_task				elf_worker_task;
+typedef struct elf_worker_fence				elf_worker_fence;
+typedef struct elf_profile_scope			elf_profile_scope;
+typedef struct elf_profile_frame			elf_profile_frame;
+typedef struct elf_profiler				elf_profiler;
+typedef struct elf_frame_pacer				elf_frame_pacer;
 typedef struct elf_post_process				elf_post_process;
 typedef struct elf_script				elf_script;
 typedef struct elf_audio_device				elf_audio_device;
@@ -355,6 +403,7 @@ typedef struct elf_bone					elf_bone;
 typedef struct elf_armature				elf_armature;
 typedef struct elf_string				elf_string;
 typedef struct elf_font					elf_font;
+typedef struct elf_glyph					elf_glyph;
 typedef struct elf_area					elf_area;
 typedef struct elf_label				elf_label;
 typedef struct elf_button				elf_button;
@@ -373,8 +422,9 @@ typedef struct elf_physics_object			elf_physics_object;
 typedef struct elf_physics_world			elf_physics_world;
 typedef struct elf_joint				elf_joint;
 typedef struct elf_resources				elf_resources;
-typedef struct elf_particle				elf_particle;
 typedef struct elf_particles				elf_particles;
+typedef struct elf_particle_job				elf_particle_job;
+typedef struct elf_skin_job				elf_skin_job;
 typedef struct elf_frame_player				elf_frame_player;
 typedef struct elf_property				elf_property;
 typedef struct elf_server				elf_server;
@@ -438,6 +488,7 @@ int elf_get_object_type(elf_object *obj);	// <mdoc> OBJECT FUNCTIONS <mdocc> The
 int elf_get_object_ref_count(elf_object *obj);
 int elf_get_global_ref_count();
 int elf_get_global_obj_count();
+int elf_get_created_obj_count();
 unsigned char elf_is_actor(elf_object *obj);
 unsigned char elf_is_gui_object(elf_object *obj);
 
@@ -467,6 +518,15 @@ unsigned char elf_is_string_number(const char *str);
 unsigned char elf_is_string_positive_int(const char *str);
 int elf_rfind_char_from_string(const char *str, char chr);
 int elf_rfind_chars_from_string(const char *str, char *chrs);
+unsigned int elf_get_utf8_char(const char *str, int *pos);
+// !!>
+
+//////////////////////////////// COMPRESS ////////////////////////////////
+
+// <!!
+int elf_get_lz_bound(int size);
+int elf_lz_compress(const unsigned char *src, int src_size, unsigned char *dst, int dst_size);
+int elf_lz_decompress(const unsigned char *src, int src_size, unsigned char *dst, int dst_size);
 // !!>
 
 //////////////////////////////// LIST ////////////////////////////////
@@ -486,6 +546,21 @@ elf_object* elf_rnext_in_list(elf_list *list);
 void elf_seek_list(elf_list *list, elf_object *ptr);
 void elf_rseek_list(elf_list *list, elf_object *ptr);
 
+//////////////////////////////// ARRAY ////////////////////////////////
+
+// <!!
+elf_array* elf_create_array();
+void elf_destroy_array(elf_array *array);
+int elf_get_array_length(elf_array *array);
+void elf_append_to_array(elf_array *array, elf_object *obj);
+elf_object* elf_get_item_from_array(elf_array *array, int idx);
+void elf_set_array_item(elf_array *array, int idx, elf_object *obj);
+void elf_remove_array_item(elf_array *array, int idx);
+void elf_swap_remove_array_item(elf_array *array, int idx);
+unsigned char elf_remove_from_array(elf_array *array, elf_object *obj);
+void elf_truncate_array(elf_array *array, int length);
+// !!>
+
 //////////////////////////////// CONFIGURATION ////////////////////////////////
 
 // <!!
@@ -497,6 +572,7 @@ elf_config* elf_read_config(const char *file_path);	// <mdoc> CONFIGURATION FUNC
 int elf_get_config_window_width(elf_config *config);
 int elf_get_config_window_height(elf_config *config);
 unsigned char elf_get_config_fullscreen(elf_config *config);
+unsigned char elf_get_config_headless(elf_config *config);
 float elf_get_config_texture_anisotropy(elf_config *config);
 int elf_get_config_shadow_map_size(elf_config *config);
 const char* elf_get_config_start(elf_config *config);
@@ -505,12 +581,32 @@ const char* elf_get_config_log(elf_config *config);
 //////////////////////////////// LOG ////////////////////////////////
 
 // <!!
+elf_logger* elf_create_logger();
+void elf_destroy_logger(elf_logger *logger);
+
+void elf_lock_log(elf_logger *logger);
+void elf_unlock_log(elf_logger *logger);
+int elf_write_log_slots(elf_logger *logger);
+unsigned char elf_push_log_slot(elf_logger *logger, const char *text, int length);
+void elf_push_log_text(elf_logger *logger, const char *text);
+char* elf_format_log_string(const char *fmt, va_list list);
+
+void elf_start_log_writer(elf_logger *logger);
+void elf_stop_log_writer(elf_logger *logger);
+void elf_flush_log();
+void elf_write_log_slots_on_signal(elf_logger *logger);
+void elf_flush_log_on_signal(int sig);
+
 void elf_start_log(const char *text);
+void elf_log(int level, const char *fmt, ...);
 void elf_write_to_log(const char *fmt, ...);
 void elf_set_error(int code, const char *fmt, ...);
 void elf_set_error_no_save(int code, const char *fmt, ...);
 // !!>
 
+void elf_set_log_level(int level);	// <mdoc> LOG FUNCTIONS
+int elf_get_log_level();
+
 //////////////////////////////// CONTEXT ////////////////////////////////
 
 // <!!
@@ -528,6 +624,7 @@ void elf_destroy_context(elf_context *context);
 
 unsigned char elf_init_context(int width, int height,
 		const char *title, unsigned char fullscreen);
+unsigned char elf_init_context_headless(int width, int height, const char *title);
 void elf_close_window();
 
 unsigned char elf_resize_context(int width, int height);
@@ -544,6 +641,7 @@ const char* elf_get_title();
 int elf_get_multisamples();
 double elf_get_time();
 unsigned char elf_is_window_opened();
+unsigned char elf_is_headless();
 /* <!> */void elf_swap_buffers();
 elf_vec2i elf_get_mouse_position();
 elf_vec2i elf_get_mouse_force();
@@ -576,6 +674,7 @@ void elf_deinit_engine();
 // !!>
 
 unsigned char elf_init(int width, int height, const char *title, unsigned char fullscreen, const char *log);	// <mdoc> ENGINE FUNCTIONS
+unsigned char elf_init_headless(int width, int height, const char *log);
 unsigned char elf_init_with_config(const char *file_path);
 void elf_deinit();
 
@@ -601,6 +700,9 @@ void elf_set_f10_exit(unsigned char exit);
 unsigned char elf_get_f10_exit();
 
 elf_scene* elf_load_scene(const char *file_path);
+unsigned char elf_load_scene_async(const char *file_path);
+unsigned char elf_is_scene_loading();
+float elf_get_scene_load_progress();
 void elf_set_scene(elf_scene *scene);
 elf_scene* elf_get_scene();
 
@@ -618,6 +720,13 @@ int elf_get_fps_limit();
 void elf_set_tick_rate(float tick_rate);
 float elf_get_tick_rate();
 
+void elf_set_fixed_tick_rate(float tick_rate);
+float elf_get_fixed_tick_rate();
+void elf_set_max_ticks_per_frame(int max_ticks);
+int elf_get_max_ticks_per_frame();
+int elf_get_frame_ticks();
+float elf_get_tick_blend();
+
 void elf_set_speed(float speed);
 float elf_get_speed();
 
@@ -628,6 +737,16 @@ void elf_set_shadow_map_size(int size);
 int elf_get_shadow_map_size();
 
 int elf_get_polygons_rendered();
+int elf_get_draw_calls();
+int elf_get_state_changes();
+int elf_get_texture_memory();
+int elf_get_vertex_buffer_memory();
+
+void elf_set_shader_cache_path(const char *path);
+const char* elf_get_shader_cache_path();
+unsigned char elf_is_shader_binary_cache_supported();
+int elf_get_shader_cache_hits();
+int elf_get_shader_program_count();
 
 void elf_set_bloom(float threshold);
 void elf_disable_bloom();
@@ -723,6 +842,66 @@ elf_timer *elf_create_timer();	// <mdoc> TIMER FUNCTIONS
 void elf_start_timer(elf_timer *timer);
 double elf_get_elapsed_time(elf_timer *timer);
 
+//////////////////////////////// PROFILER ////////////////////////////////
+
+// <!!
+#ifdef ELF_PROFILE
+	#define ELF_PROFILE_BEGIN_FRAME()	elf_begin_profile_frame()
+	#define ELF_PROFILE_END_FRAME()		elf_end_profile_frame()
+	#define ELF_PROFILE_BEGIN(name)		elf_begin_profile_scope(name)
+	#define ELF_PROFILE_END()		elf_end_profile_scope()
+#else
+	#define ELF_PROFILE_BEGIN_FRAME()
+	#define ELF_PROFILE_END_FRAME()
+	#define ELF_PROFILE_BEGIN(name)
+	#define ELF_PROFILE_END()
+#endif
+
+elf_profiler* elf_create_profiler();
+void elf_destroy_profiler(elf_profiler *profiler);
+
+void elf_begin_profile_frame();
+void elf_end_profile_frame();
+void elf_begin_profile_scope(const char *name);
+void elf_end_profile_scope();
+
+elf_profile_frame* elf_get_profile_frame(int frame);
+elf_profile_scope* elf_get_profile_frame_scope(int frame, int idx);
+void elf_write_profile_trace_name(FILE *file, const char *name);
+// !!>
+
+unsigned char elf_is_profiler_available();	// <mdoc> PROFILER FUNCTIONS <mdocc> The profiler keeps the timings of the engine stages over the last frames. It is only available when built with ELF_PROFILE. Frames are counted back from the last finished frame, times are in milliseconds.
+void elf_set_profiler_enabled(unsigned char enabled);
+unsigned char elf_is_profiler_enabled();
+int elf_get_profile_frame_count();
+float elf_get_profile_frame_time(int frame);
+int elf_get_profile_slowest_frame();
+int elf_get_profile_scope_count(int frame);
+const char* elf_get_profile_scope_name(int frame, int idx);
+int elf_get_profile_scope_depth(int frame, int idx);
+float elf_get_profile_scope_start(int frame, int idx);
+float elf_get_profile_scope_time(int frame, int idx);
+float elf_get_profile_time(int frame, const char *name);
+unsigned char elf_save_profile_trace(const char *file_path);
+
+//////////////////////////////// PACER ////////////////////////////////
+
+// <!!
+elf_frame_pacer* elf_create_frame_pacer();
+void elf_destroy_frame_pacer(elf_frame_pacer *pacer);
+void elf_sleep(double time);
+void elf_add_frame_pacer_sample(elf_frame_pacer *pacer, double jitter);
+void elf_pace_frame(elf_frame_pacer *pacer, int fps_limit);
+// !!>
+
+void elf_set_frame_pacing_mode(int mode);	// <mdoc> FRAME PACING FUNCTIONS <mdocc> The frame pacer holds the frames to the fps limit set with elf.SetFpsLimit. Jitter is how far the frame intervals were off the limit over the last frames, times are in milliseconds.
+int elf_get_frame_pacing_mode();
+float elf_get_frame_pacing_jitter();
+float elf_get_frame_pacing_max_jitter();
+float elf_get_frame_work_time();
+float elf_get_frame_pacing_spin_time();
+int elf_get_late_frame_count();
+
 //////////////////////////////// IMAGE ////////////////////////////////
 
 elf_image* elf_create_image_from_file(const char *file_path);	// <mdoc> IMAGE FUNCTIONS
@@ -847,6 +1026,7 @@ void elf_set_property_bool(elf_property *property, unsigned char bval);
 
 // <!!
 void elf_init_actor(elf_actor *actor, unsigned char camera);
+void elf_sync_actor_transform(elf_actor *actor);
 void elf_update_actor(elf_actor *actor);
 void elf_actor_pre_draw(elf_actor *actor);
 void elf_actor_post_draw(elf_actor *actor);
@@ -977,6 +1157,7 @@ float* elf_get_camera_projection_matrix(elf_camera *camera);
 float* elf_get_camera_modelview_matrix(elf_camera *camera);
 void elf_set_camera(elf_camera *camera, gfx_shader_params *shader_params);
 unsigned char elf_aabb_inside_frustum(elf_camera *camera, float *min, float *max);
+int elf_classify_aabb_in_frustum(elf_camera *camera, const float *min, const float *max);
 unsigned char elf_sphere_inside_frustum(elf_camera *camera, float *pos, float radius);
 unsigned char elf_camera_inside_aabb(elf_camera *camera, float *min, float *max);
 unsigned char elf_camera_inside_sphere(elf_camera *camera, float *pos, float radius);
@@ -1019,6 +1200,8 @@ void elf_update_entity(elf_entity *entity);
 void elf_entity_pre_draw(elf_entity *entity);
 void elf_entity_post_draw(elf_entity *entity);
 void elf_destroy_entity(elf_entity *entity);
+void elf_rotate_entity_aabb(float *mat, float *center, float *extent, float *min, float *max);
+void elf_calc_entity_state_aabb(elf_entity *entity, float *position, float *orient, float *aabb_min, float *aabb_max);
 void elf_calc_entity_aabb(elf_entity *entity);
 void elf_calc_entity_bounding_volumes(elf_entity *entity, unsigned char new_model);
 // !!>
@@ -1066,6 +1249,7 @@ void elf_draw_entity_without_materials(elf_entity *entity, gfx_shader_params *sh
 void elf_draw_entity_bounding_box(elf_entity *entity, gfx_shader_params *shader_params);
 void elf_draw_entity_debug(elf_entity *entity, gfx_shader_params *shader_params);
 unsigned char elf_cull_entity(elf_entity *entity, elf_camera *camera);
+void elf_add_entity_to_cull_set(elf_cull_set *set, elf_entity *entity);
 // !!>
 
 unsigned char elf_get_entity_changed(elf_entity *entity);
@@ -1138,18 +1322,29 @@ elf_bone* elf_get_bone_from_armature_by_id(int id, elf_armature *armature);
 // <!!
 void elf_add_root_bone_to_armature(elf_armature *armature, elf_bone *bone);
 
+void elf_update_armature_pose(elf_armature *armature, float frame);
+void elf_skin_vertices(elf_armature *armature, float *weights, int *boneids, float *orig_vertices, float *orig_normals, float *vertices, float *normals, int first, int last);
+void elf_skin_vertices_with_quaternions(elf_armature *armature, float *weights, int *boneids, float *orig_vertices, float *orig_normals, float *vertices, float *normals, int first, int last);
+void elf_run_skin_job(void *data, int first, int last);
 void elf_deform_entity_with_armature(elf_armature *armature, elf_entity *entity, float frame);
 void elf_draw_armature_debug(elf_armature *armature, gfx_shader_params *shader_params);
+
+void elf_benchmark_skinning();
 // !!>
 
 //////////////////////////////// PARTICLES ////////////////////////////////
 
 // <!!
-elf_particle* elf_create_particle();
-void elf_destroy_particle(elf_particle *particle);
+void elf_alloc_particle_pool(elf_particles *particles);
+float elf_get_particles_random(elf_particles *particles, float min, float max);
+int elf_get_particles_random_index(elf_particles *particles, int count);
+void elf_init_new_particle(elf_particles *particles, int idx);
+void elf_swap_remove_particle(elf_particles *particles, int idx);
+void elf_integrate_particles(elf_particles *particles, float sync);
 void elf_particles_pre_draw(elf_particles *particles);
 void elf_particles_post_draw(elf_particles *particles);
-void elf_update_particles(elf_particles *particles, float sync);
+void elf_update_particles(elf_particles *particles);
+void elf_simulate_particles(elf_particles *particles, float sync);
 void elf_destroy_particles(elf_particles *particles);
 // !!>
 
@@ -1166,6 +1361,7 @@ void elf_set_particles_entity(elf_particles *particles, elf_entity *entity);
 void elf_set_particles_gravity(elf_particles *particles, float x, float y, float z);
 void elf_set_particles_spawn_delay(elf_particles *particles, float delay);
 void elf_set_particles_spawn(elf_particles *particles, unsigned char spawn);
+void elf_set_particles_random_seed(elf_particles *particles, int seed);
 
 void elf_set_particles_size(elf_particles *particles, float min, float max);
 void elf_set_particles_size_growth(elf_particles *particles, float min, float max);
@@ -1210,7 +1406,8 @@ elf_color elf_get_particles_color_min(elf_particles *particles);
 elf_color elf_get_particles_color_max(elf_particles *particles);
 
 // <!!
-void elf_draw_particles(elf_particles *particles, elf_camera *camera, gfx_shader_params *shader_params);
+void elf_write_particles_vertices(elf_particles *particles, int first, int last, float *inv_camera_pos, float *inv_camera_orient);
+void elf_draw_particles(elf_particles *particles, gfx_shader_params *shader_params);
 unsigned char elf_cull_particles(elf_particles *particles, elf_camera *camera);
 // !!>
 
@@ -1235,16 +1432,39 @@ unsigned char elf_get_sprite_face_camera(elf_sprite *sprite);
 
 // <!!
 unsigned char elf_cull_sprite(elf_sprite *sprite, elf_camera *camera);
+void elf_add_sprite_to_cull_set(elf_cull_set *set, elf_sprite *sprite);
 void elf_draw_sprite(elf_sprite *sprite, gfx_shader_params *shader_params);
 void elf_draw_sprite_without_materials(elf_sprite *sprite, gfx_shader_params *shader_params);
 void elf_draw_sprite_ambient(elf_sprite *sprite, gfx_shader_params *shader_params);
 void elf_draw_sprite_debug(elf_sprite *sprite, gfx_shader_params *shader_params);
 // !!>
 
+//////////////////////////////// BENCH ////////////////////////////////
+
+// <!!
+elf_model* elf_create_bench_model(elf_scene *scene, const char *name, int rings, int segments, int bone_count);
+elf_armature* elf_create_bench_armature(const char *name, int bone_count, int frame_count);
+void elf_get_bench_grid_position(int idx, int count, float spacing, float *position);
+elf_scene* elf_create_bench_scene(const char *name, int entity_count, int light_count,
+	int skinned_count, int particles_count, int scripted_count);
+unsigned char elf_save_bench_scene(const char *file_path, int entity_count, int light_count,
+	int skinned_count, int particles_count, int scripted_count);
+int elf_compare_bench_times(const void *a, const void *b);
+unsigned char elf_run_bench_scene(const char *file_path, int ticks, float tick_rate, FILE *report);
+void elf_benchmark_scenes(int ticks, float tick_rate, const char *report_path);
+// !!>
+
 //////////////////////////////// SCENE ////////////////////////////////
 
 // <!!
+void elf_run_scene_entity_syncs(void *data, int first, int last);
+void elf_run_scene_entity_pre_draws(void *data, int first, int last);
 void elf_update_scene(elf_scene *scene, float sync);
+void elf_set_actor_transform_state(elf_actor *actor, int state);
+void elf_set_scene_transform_states(elf_scene *scene, int state);
+void elf_save_scene_transforms(elf_scene *scene);
+void elf_update_scene_transforms(elf_scene *scene);
+void elf_reset_scene_transforms(elf_scene *scene);
 void elf_scene_pre_draw(elf_scene *scene);
 void elf_scene_post_draw(elf_scene *scene);
 void elf_destroy_scene(elf_scene *scene);
@@ -1253,6 +1473,7 @@ void elf_destroy_scene(elf_scene *scene);
 elf_scene* elf_create_scene(const char *name);
 elf_scene* elf_create_scene_from_file(const char *file_path);	// <mdoc> SCENE FUNCTIONS
 unsigned char elf_save_scene(elf_scene *scene, const char *file_path);
+unsigned char elf_save_scene_compressed(elf_scene *scene, const char *file_path);
 
 void elf_set_scene_ambient_color(elf_scene *scene, float r, float g, float b, float a);
 elf_color elf_get_scene_ambient_color(elf_scene *scene);
@@ -1343,15 +1564,59 @@ unsigned char elf_remove_sprite_by_object(elf_scene *scene, elf_sprite *sprite);
 
 unsigned char elf_remove_actor_by_object(elf_scene *scene, elf_actor *actor);
 
+int elf_warm_up_scene_shaders(elf_scene *scene);
+
 // <!!
+void elf_warm_up_material_shaders(elf_material *material, unsigned char *light_passes, unsigned char sprite);
+void elf_add_scene_particle_job(elf_scene *scene, elf_particles *particles, int first, int last);
+void elf_run_scene_particle_simulation(void *data, int first, int last);
+void elf_run_scene_particle_vertices(void *data, int first, int last);
+void elf_draw_scene_entity_lit(elf_scene *scene, elf_light *light, elf_entity *ent, elf_vec3f lpos);
 void elf_draw_scene(elf_scene *scene);
 void elf_draw_scene_debug(elf_scene *scene);
 // !!>
 
+//////////////////////////////// BVH ////////////////////////////////
+
+// <!!
+elf_bvh* elf_create_bvh();
+void elf_destroy_bvh(elf_bvh *bvh);
+
+void elf_get_bvh_entity_bounds(elf_entity *entity, float *min, float *max);
+int elf_insert_entity_to_bvh(elf_bvh *bvh, elf_entity *entity);
+void elf_remove_entity_from_bvh(elf_bvh *bvh, int leaf);
+void elf_move_entity_in_bvh(elf_bvh *bvh, int leaf, elf_entity *entity);
+
+int elf_query_bvh_frustum(elf_bvh *bvh, elf_camera *camera);
+int elf_query_bvh_sphere(elf_bvh *bvh, const float *pos, float radius);
+elf_entity* elf_get_bvh_result(elf_bvh *bvh, int idx);
+// !!>
+
+//////////////////////////////// CULL ////////////////////////////////
+
+// <!!
+elf_cull_set* elf_create_cull_set();
+void elf_destroy_cull_set(elf_cull_set *set);
+
+void elf_clear_cull_set(elf_cull_set *set);
+void elf_add_aabb_to_cull_set(elf_cull_set *set, elf_object *obj, const float *min, const float *max);
+void elf_add_sphere_to_cull_set(elf_cull_set *set, elf_object *obj, const float *pos, float radius);
+void elf_cull_set_in_frustum(elf_cull_set *set, elf_camera *camera);
+unsigned char elf_get_cull_set_visible(elf_cull_set *set, int idx);
+elf_object* elf_get_cull_set_object(elf_cull_set *set, int idx);
+
+void elf_benchmark_culling();
+// !!>
+
 //////////////////////////////// PAK ////////////////////////////////
 
 // <!!
 void elf_destroy_pak_index(elf_pak_index *index);
+unsigned int elf_get_pak_index_hash(const char *name, unsigned char type);
+unsigned char elf_map_pak_file(elf_pak *pak, const char *file_path);
+unsigned char elf_read_pak_file(elf_pak *pak, const char *file_path);
+void elf_unmap_pak_file(elf_pak *pak);
+void elf_add_pak_index_to_table(elf_pak *pak, elf_pak_index *index);
 elf_pak* elf_create_pak_from_file(const char *file_path);
 void elf_destroy_pak(elf_pak *pak);
 
@@ -1364,34 +1629,40 @@ unsigned char elf_get_pak_index_type(elf_pak_index *index);
 const char* elf_get_pak_index_name(elf_pak_index *index);
 int elf_get_pak_index_offset(elf_pak_index *index);
 
-int elf_get_actor_header_size_bytes(elf_actor *actor);
-int elf_get_armature_size_bytes(elf_armature *armature);
-int elf_get_camera_size_bytes(elf_camera *camera);
-int elf_get_entity_size_bytes(elf_entity *entity);
-int elf_get_light_size_bytes(elf_light *light);
-int elf_get_material_size_bytes(elf_material *material);
-int elf_get_model_size_bytes(elf_model *model);
-int elf_get_particles_size_bytes(elf_particles *particles);
-int elf_get_scene_size_bytes(elf_scene *scene);
-int elf_get_script_size_bytes(elf_script *script);
-int elf_get_sprite_size_bytes(elf_sprite *sprite);
-int elf_get_texture_size_bytes(elf_texture *texture);
-
-void elf_read_actor_header(elf_actor *actor, FILE *file, elf_scene *scene);
-elf_armature* elf_create_armature_from_pak(FILE *file, const char *name, elf_scene *scene);
-elf_camera* elf_create_camera_from_pak(FILE *file, const char *name, elf_scene *scene);
-elf_entity* elf_create_entity_from_pak(FILE *file, const char *name, elf_scene *scene);
-elf_light* elf_create_light_from_pak(FILE *file, const char *name, elf_scene *scene);
-elf_material* elf_create_material_from_pak(FILE *file, const char *name, elf_scene *scene);
-elf_model* elf_create_model_from_pak(FILE *file, const char *name, elf_scene *scene);
-elf_particles* elf_create_particles_from_pak(FILE *file, const char *name, elf_scene *scene);
-elf_script* elf_create_script_from_pak(FILE *file, const char *name, elf_scene *scene);
-elf_sprite* elf_create_sprite_from_pak(FILE *file, const char *name, elf_scene *scene);
-elf_texture *elf_create_texture_from_pak(FILE *file, const char *name, elf_scene *scene);
+unsigned char elf_decompress_pak_section(elf_pak *pak, elf_pak_index *index, elf_pak_reader *reader);
+unsigned char elf_seek_pak_index(elf_pak *pak, elf_pak_index *index, elf_pak_reader *reader);
+void elf_close_pak_reader(elf_pak_reader *reader);
+int elf_read_from_pak(void *ptr, int size, int count, elf_pak_reader *reader);
+const void* elf_map_from_pak(int size, elf_pak_reader *reader);
+const void* elf_map_block_from_pak(int size, elf_pak_reader *reader);
+
+void elf_read_actor_header(elf_actor *actor, elf_pak_reader *reader, elf_scene *scene);
+elf_armature* elf_create_armature_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene);
+elf_camera* elf_create_camera_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene);
+elf_entity* elf_create_entity_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene);
+elf_light* elf_create_light_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene);
+elf_material* elf_create_material_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene);
+elf_model* elf_create_model_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene);
+elf_particles* elf_create_particles_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene);
+elf_script* elf_create_script_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene);
+elf_sprite* elf_create_sprite_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene);
+elf_texture *elf_create_texture_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene);
 unsigned char elf_load_texture_data_from_pak(elf_texture *texture);
 
+void elf_decode_texture_from_pak(elf_pak_reader *reader, elf_decoded_texture *decoded);
+void elf_clear_decoded_texture(elf_decoded_texture *decoded);
+elf_texture* elf_create_texture_from_decoded(elf_decoded_texture *decoded, const char *name, elf_scene *scene);
+void elf_decode_model_from_pak(elf_pak_reader *reader, elf_decoded_model *decoded);
+void elf_decode_model_v2_from_pak(elf_pak_reader *reader, elf_decoded_model *decoded);
+void elf_clear_decoded_model(elf_decoded_model *decoded);
+elf_model* elf_create_model_from_decoded(elf_decoded_model *decoded, const char *name, elf_scene *scene);
+void elf_free_pak_decoded_data(elf_pak *pak);
+
+elf_scene* elf_create_empty_scene_from_pak(elf_pak *pak);
+void elf_load_pak_index_to_scene(elf_scene *scene, elf_pak_index *index, unsigned char *scene_read);
 elf_scene *elf_create_scene_from_pak(elf_pak *pak);
 
+void elf_write_block_to_file(const void *data, int size, FILE *file);
 void elf_write_actor_header(elf_actor *actor, FILE *file);
 void elf_write_armature_to_file(elf_armature *armature, FILE *file);
 void elf_write_camera_to_file(elf_camera *camera, FILE *file);
@@ -1404,7 +1675,57 @@ void elf_write_script_to_file(elf_script *script, FILE *file);
 void elf_write_sprite_to_file(elf_sprite *sprite, FILE *file);
 void elf_write_texture_to_file(elf_texture *texture, FILE *file);
 
-unsigned char elf_save_scene_to_pak(elf_scene *scene, const char *file_path);
+unsigned char elf_save_scene_to_pak(elf_scene *scene, const char *file_path, unsigned char compress);
+
+double elf_time_pak_load(const char *file_path, int *file_size, int *raw_size);
+void elf_benchmark_pak(const char *file_path);
+// !!>
+
+//////////////////////////////// SCENE LOADER ////////////////////////////////
+
+// <!!
+elf_scene_loader* elf_create_scene_loader(elf_pak *pak);
+void elf_destroy_scene_loader(elf_scene_loader *loader);
+void elf_stop_scene_loader(elf_scene_loader *loader);
+unsigned char elf_update_scene_loader(elf_scene_loader *loader);
+float elf_get_scene_loader_progress(elf_scene_loader *loader);
+// !!>
+
+//////////////////////////////// THREADS ////////////////////////////////
+
+// <!!
+elf_thread* elf_create_thread(void (*func)(void *arg), void *arg);
+void elf_wait_thread(elf_thread *thread);
+void elf_yield_thread();
+int elf_get_processor_count();
+
+elf_mutex* elf_create_mutex();
+void elf_destroy_mutex(elf_mutex *mutex);
+void elf_lock_mutex(elf_mutex *mutex);
+void elf_unlock_mutex(elf_mutex *mutex);
+
+elf_cond* elf_create_cond();
+void elf_destroy_cond(elf_cond *cond);
+void elf_wait_cond(elf_cond *cond, elf_mutex *mutex);
+void elf_broadcast_cond(elf_cond *cond);
+// !!>
+
+//////////////////////////////// WORKERS ////////////////////////////////
+
+// <!!
+unsigned char elf_run_worker_task_batch(elf_workers *workers, elf_worker_task *task, int slice);
+unsigned char elf_run_worker_jobs(elf_workers *workers, int idx);
+unsigned char elf_has_worker_batches(elf_workers *workers);
+elf_workers* elf_create_workers();
+void elf_destroy_workers(elf_workers *workers);
+
+int elf_get_worker_thread_count(elf_workers *workers);
+void elf_init_worker_fence(elf_worker_fence *fence);
+unsigned char elf_is_worker_fence_done(elf_worker_fence *fence);
+void elf_run_workers_async(elf_workers *workers, void (*func)(void *data, int first, int last), void *data, int count, int batch,
+	elf_worker_fence *after, elf_worker_fence *fence);
+void elf_wait_workers(elf_workers *workers, elf_worker_fence *fence);
+void elf_run_workers(elf_workers *workers, void (*func)(void *data, int first, int last), void *data, int count, int batch);
 // !!>
 
 //////////////////////////////// POST PROCESS ////////////////////////////////
@@ -1468,16 +1789,39 @@ void elf_deinit_scripting();
 
 int elf_get_current_script_line();
 elf_script* elf_get_current_script();
+
+unsigned char elf_compile_script(elf_script *script);
+void elf_release_script_function(elf_script *script);
+unsigned char elf_call_script(elf_script *script, int arg_count);
+unsigned char elf_run_actor_script(elf_script *script, int event);
 // !!>
 
 unsigned char elf_run_string(const char *str);
 unsigned char elf_run_script(elf_script *script);
 
+void elf_set_script_gc_mode(int mode);
+int elf_get_script_gc_mode();
+void elf_set_script_gc_budget(float budget);
+float elf_get_script_gc_budget();
+void elf_set_script_gc_step_size(int size);
+int elf_get_script_gc_step_size();
+float elf_get_script_memory();
+float elf_get_script_gc_time();
+int elf_get_script_gc_cycles();
+
 //////////////////////////////// AUDIO ////////////////////////////////
 
 // <!!
 elf_audio_device* elf_create_audio_device();
 void elf_destroy_audio_device(elf_audio_device *device);
+unsigned char elf_attach_audio_stream(elf_audio_device *device, elf_audio_source *source);
+void elf_detach_audio_stream(elf_audio_device *device, elf_audio_source *source);
+void elf_run_audio_commands(elf_audio_device *device);
+void elf_push_audio_command(int type, elf_audio_source *source, elf_sound *sound);
+void elf_update_audio_streams(elf_audio_device *device);
+unsigned char elf_update_audio_loads(elf_audio_device *device);
+void elf_start_audio_thread(elf_audio_device *device);
+void elf_stop_audio_thread(elf_audio_device *device);
 unsigned char elf_init_audio();
 void elf_update_audio();
 void elf_deinit_audio();
@@ -1486,20 +1830,56 @@ void elf_set_audio_volume(float volume);	// <mdoc> AUDIO FUNCTIONS
 float elf_get_audio_volume();
 void elf_set_audio_rolloff(float rolloff);
 float elf_get_audio_rolloff();
+void elf_set_audio_stream_buffer_count(int count);
+int elf_get_audio_stream_buffer_count();
+void elf_set_audio_cull_distance(float distance);
+float elf_get_audio_cull_distance();
+int elf_get_audio_voice_count();
+int elf_get_audio_active_voice_count();
+int elf_get_audio_stolen_voice_count();
+int elf_get_audio_culled_sound_count();
+int elf_get_audio_cached_sound_count();
 // <!!
 void elf_set_audio_listener_position(float x, float y, float z);
 void elf_set_audio_listener_orientation(float *params);
 // !!>
 
 // <!!
+unsigned int elf_get_sound_path_hash(const char *file_path);
+elf_sound* elf_get_cached_sound(const char *file_path);
+void elf_add_cached_sound(elf_sound *snd);
+void elf_remove_cached_sound(elf_sound *snd);
+
+unsigned char elf_is_audio_source_culled(elf_audio_source *source);
+unsigned char elf_acquire_audio_voice(elf_audio_source *source, unsigned char steal);
+void elf_release_audio_voice(elf_audio_source *source);
+unsigned char elf_start_audio_source(elf_audio_source *source, unsigned char steal);
+
 elf_sound* elf_create_sound();
 void elf_destroy_sound(elf_sound *sound);
 // !!>
 
+// <!!
+int elf_read_sound_data(elf_sound *snd, char *buf, int size);
+void elf_rewind_sound(elf_sound *snd);
+unsigned char elf_decode_sound(elf_sound *snd, int max_chunks);
+void elf_upload_sound(elf_sound *snd);
+elf_sound* elf_open_sound(const char *file_path, unsigned char streamed);
+// !!>
 elf_sound* elf_load_sound(const char *file_path);
+elf_sound* elf_load_sound_async(const char *file_path);
 elf_sound* elf_load_streamed_sound(const char *file_path);
+unsigned char elf_is_sound_loaded(elf_sound *sound);
+// <!!
+void elf_wait_sound_load(elf_sound *sound);
+// !!>
 int elf_get_sound_file_type(elf_sound *sound);
+void elf_set_sound_priority(elf_sound *sound, int priority);
+int elf_get_sound_priority(elf_sound *sound);
 
+// <!!
+elf_audio_source* elf_play_audio_source(elf_entity *entity, elf_sound *sound, float volume, unsigned char loop);
+// !!>
 elf_audio_source* elf_play_sound(elf_sound *sound, float volume);
 elf_audio_source* elf_play_entity_sound(elf_entity *entity, elf_sound *sound, float volume);
 elf_audio_source* elf_loop_sound(elf_sound *sound, float volume);
@@ -1529,7 +1909,7 @@ void elf_destroy_collision(elf_collision *collision);
 
 elf_physics_world* elf_create_physics_world();
 void elf_destroy_physics_world(elf_physics_world *world);
-void elf_update_physics_world(elf_physics_world *world, float time);
+void elf_update_physics_world(elf_physics_world *world, float time, unsigned char fixed);
 
 void elf_set_physics_world_gravity(elf_physics_world *world, float x, float y, float z);
 elf_vec3f elf_get_physics_world_gravity(elf_physics_world *world);
@@ -1618,6 +1998,11 @@ float elf_get_physics_object_restitution(elf_physics_object *object);
 // <!!
 elf_font* elf_create_font();
 void elf_destroy_font(elf_font *font);
+int elf_pack_font_glyphs(elf_glyph *glyphs, int count, int width, int *xs, int *ys);
+elf_glyph* elf_get_font_glyph(elf_font *font, unsigned int code);
+void elf_get_string_size(elf_font *font, const char *str, int *width, int *height);
+void elf_reserve_font_text(elf_font *font, int glyphs);
+elf_glyph* elf_get_next_font_glyph(elf_font *font, const char *str, int *pos, int x, int *ox, int *oy, int *gx, int *gy);
 // !!>
 
 elf_font* elf_create_font_from_file(const char *file_path, int size);	// <mdoc> FONT FUNCTIONS
@@ -1629,6 +2014,9 @@ int elf_get_string_width(elf_font *font, const char *str);
 int elf_get_string_height(elf_font *font, const char *str);
 
 /* <!> */ void elf_draw_string(elf_font *font, const char *str, int x, int y, gfx_shader_params *shader_params);
+/* <!> */ void elf_begin_font_text(elf_font *font);
+/* <!> */ void elf_add_font_text(elf_font *font, const char *str, int x, int y);
+/* <!> */ void elf_draw_font_text(elf_font *font, gfx_shader_params *shader_params);
 
 //////////////////////////////// GUI ////////////////////////////////
 
@@ -1645,9 +2033,18 @@ void elf_set_gui_object_color(elf_gui_object *object, float r, float g, float b,
 void elf_set_gui_object_visible(elf_gui_object *object, unsigned char visible);
 void elf_set_gui_object_script(elf_gui_object *object, elf_script *script);
 
+// <!!
+void elf_set_gui_object_dirty(elf_gui_object *object);
+void elf_clip_gui_area(elf_area *clip, int x, int y, int width, int height, elf_area *result);
+unsigned char elf_is_gui_area_overlapping(elf_area *a, elf_area *b);
+void elf_add_gui_quad(elf_gui *gui, gfx_texture *texture, elf_area *clip, float x, float y, float width, float height,
+	float tx, float ty, float twidth, float theight, elf_color *color);
+void elf_add_gui_text(elf_gui *gui, elf_font *font, const char *str, int x, int y, elf_color *color, elf_area *clip);
+// !!>
+
 // <!!
 void elf_destroy_label(elf_label *label);
-void elf_draw_label(elf_label *label, gfx_shader_params *shader_params);
+void elf_add_label_quads(elf_gui *gui, elf_label *label, elf_area *clip);
 void elf_recalc_label(elf_label *label);
 // !!>
 
@@ -1661,7 +2058,8 @@ void elf_set_label_text(elf_label *label, const char *text);
 
 // <!!
 void elf_destroy_button(elf_button *button);
-void elf_draw_button(elf_button *button, gfx_shader_params *shader_params);
+void elf_add_button_quads(elf_gui *gui, elf_button *button, elf_area *clip);
+void elf_change_button_state(elf_button *button, unsigned char state);
 void elf_recalc_button(elf_button *button);
 // !!>
 
@@ -1678,7 +2076,7 @@ void elf_set_button_on_texture(elf_button *button, elf_texture *on);
 
 // <!!
 void elf_destroy_picture(elf_picture *picture);
-void elf_draw_picture(elf_picture *picture, gfx_shader_params *shader_params);
+void elf_add_picture_quads(elf_gui *gui, elf_picture *picture, elf_area *clip);
 void elf_recalc_picture(elf_picture *picture);
 // !!>
 
@@ -1692,7 +2090,7 @@ void elf_set_picture_scale(elf_picture *picture, float x, float y);
 
 // <!!
 void elf_destroy_text_field(elf_text_field *text_field);
-void elf_draw_text_field(elf_text_field *text_field, elf_area *area, gfx_shader_params *shader_params);
+void elf_add_text_field_quads(elf_gui *gui, elf_text_field *text_field, elf_area *clip);
 void elf_recalc_text_field(elf_text_field *text_field);
 // !!>
 
@@ -1713,7 +2111,7 @@ void elf_set_text_field_text(elf_text_field *text_field, const char *text);
 
 // <!!
 void elf_destroy_slider(elf_slider *slider);
-void elf_draw_slider(elf_slider *slider, gfx_shader_params *shader_params);
+void elf_add_slider_quads(elf_gui *gui, elf_slider *slider, elf_area *clip);
 void elf_recalc_slider(elf_slider *slider);
 // !!>
 
@@ -1729,7 +2127,7 @@ void elf_set_slider_value(elf_slider *slider, float value);
 
 // <!!
 void elf_destroy_screen(elf_screen *screen);
-void elf_draw_screen(elf_screen *screen, elf_area *area, gfx_shader_params *shader_params);
+void elf_add_screen_quads(elf_gui *gui, elf_screen *screen, elf_area *clip);
 void elf_recalc_screen(elf_screen *screen);
 // !!>
 
@@ -1743,7 +2141,7 @@ void elf_release_focus_from_screen(elf_screen *screen);
 
 // <!!
 void elf_destroy_text_list(elf_text_list *text_list);
-void elf_draw_text_list(elf_text_list *text_list, elf_area *area, gfx_shader_params *shader_params);
+void elf_add_text_list_quads(elf_gui *gui, elf_text_list *text_list, elf_area *clip);
 void elf_recalc_text_list(elf_text_list *text_list);
 // !!>
 
@@ -1774,7 +2172,7 @@ void elf_set_text_list_selection(elf_text_list *text_list, int selection);
 
 // <!!
 void elf_destroy_check_box(elf_check_box *check_box);
-void elf_draw_check_box(elf_check_box *check_box, gfx_shader_params *shader_params);
+void elf_add_check_box_quads(elf_gui *gui, elf_check_box *check_box, elf_area *clip);
 void elf_recalc_check_box(elf_check_box *check_box);
 // !!>
 
@@ -1792,6 +2190,12 @@ void elf_set_check_box_state(elf_check_box *check_box, unsigned char state);
 
 // <!!
 void elf_destroy_gui(elf_gui *gui);
+void elf_add_gui_hit(elf_gui *gui, elf_gui_object *object, elf_area *area);
+void elf_add_gui_object_quads(elf_gui *gui, elf_gui_object *object, elf_area *clip, unsigned char draw);
+void elf_reserve_gui_buffers(elf_gui *gui, int quads);
+void elf_build_gui_draw_list(elf_gui *gui);
+unsigned char elf_is_gui_object_inside(elf_gui_object *object, elf_gui_object *parent);
+elf_gui_object* elf_trace_top_object(elf_gui *gui, unsigned char click);
 void elf_update_gui(elf_gui *gui, float step);
 void elf_draw_gui(elf_gui *gui);
 // !!>
@@ -2726,6 +2726,23 @@ fail:
 }
 
 
+static int _wrap_elfGetCreatedObjCount(lua_State* L) {
+  int SWIG_arg = 0;
+  int result;
+  
+  SWIG_check_num_args("GetCreatedObjCount",0,0)
+  result = (int)elfGetCreatedObjCount();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
 static int _wrap_elfIsActor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
@@ -3247,6 +3264,32 @@ fail:
 }
 
 
+static int _wrap_elfGetConfigHeadless(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  bool result;
+  
+  SWIG_check_num_args("GetConfigHeadless",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetConfigHeadless",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetConfigHeadless",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = (bool)elfGetConfigHeadless(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
 static int _wrap_elfGetConfigTextureAnisotropy(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
@@ -3351,6 +3394,42 @@ fail:
 }
 
 
+static int _wrap_elfSetLogLevel(lua_State* L) {
+  int SWIG_arg = 0;
+  int arg1 ;
+  
+  SWIG_check_num_args("SetLogLevel",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetLogLevel",1,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  elfSetLogLevel(arg1);
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetLogLevel(lua_State* L) {
+  int SWIG_arg = 0;
+  int result;
+  
+  SWIG_check_num_args("GetLogLevel",0,0)
+  result = (int)elfGetLogLevel();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
 static int _wrap_elfSetTitle(lua_State* L) {
   int SWIG_arg = 0;
   char *arg1 = (char *) 0 ;
@@ -3529,6 +3608,23 @@ fail:
 }
 
 
+static int _wrap_elfIsHeadless(lua_State* L) {
+  int SWIG_arg = 0;
+  bool result;
+  
+  SWIG_check_num_args("IsHeadless",0,0)
+  result = (bool)elfIsHeadless();
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
 static int _wrap_elfGetMousePosition(lua_State* L) {
   int SWIG_arg = 0;
   elf_vec2i result;
@@ -3822,6 +3918,32 @@ fail:
 }
 
 
+static int _wrap_elfInitHeadless(lua_State* L) {
+  int SWIG_arg = 0;
+  int arg1 ;
+  int arg2 ;
+  char *arg3 = (char *) 0 ;
+  bool result;
+  
+  SWIG_check_num_args("InitHeadless",3,3)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("InitHeadless",1,"int");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("InitHeadless",2,"int");
+  if(!lua_isstring(L,3)) SWIG_fail_arg("InitHeadless",3,"char const *");
+  arg1 = (int)lua_tonumber(L, 1);
+  arg2 = (int)lua_tonumber(L, 2);
+  arg3 = (char *)lua_tostring(L, 3);
+  result = (bool)elfInitHeadless(arg1,arg2,(char const *)arg3);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
 static int _wrap_elfInitWithConfig(lua_State* L) {
   int SWIG_arg = 0;
   char *arg1 = (char *) 0 ;
@@ -4108,6 +4230,60 @@ fail:
 }
 
 
+static int _wrap_elfLoadSceneAsync(lua_State* L) {
+  int SWIG_arg = 0;
+  char *arg1 = (char *) 0 ;
+  bool result;
+  
+  SWIG_check_num_args("LoadSceneAsync",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("LoadSceneAsync",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = (bool)elfLoadSceneAsync((char const *)arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfIsSceneLoading(lua_State* L) {
+  int SWIG_arg = 0;
+  bool result;
+  
+  SWIG_check_num_args("IsSceneLoading",0,0)
+  result = (bool)elfIsSceneLoading();
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetSceneLoadProgress(lua_State* L) {
+  int SWIG_arg = 0;
+  float result;
+  
+  SWIG_check_num_args("GetSceneLoadProgress",0,0)
+  result = (float)elfGetSceneLoadProgress();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
 static int _wrap_elfSetScene(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
@@ -4324,14 +4500,14 @@ fail:
 }
 
 
-static int _wrap_elfSetSpeed(lua_State* L) {
+static int _wrap_elfSetFixedTickRate(lua_State* L) {
   int SWIG_arg = 0;
   float arg1 ;
   
-  SWIG_check_num_args("SetSpeed",1,1)
-  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetSpeed",1,"float");
+  SWIG_check_num_args("SetFixedTickRate",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetFixedTickRate",1,"float");
   arg1 = (float)lua_tonumber(L, 1);
-  elfSetSpeed(arg1);
+  elfSetFixedTickRate(arg1);
   
   return SWIG_arg;
   
@@ -4343,12 +4519,12 @@ fail:
 }
 
 
-static int _wrap_elfGetSpeed(lua_State* L) {
+static int _wrap_elfGetFixedTickRate(lua_State* L) {
   int SWIG_arg = 0;
   float result;
   
-  SWIG_check_num_args("GetSpeed",0,0)
-  result = (float)elfGetSpeed();
+  SWIG_check_num_args("GetFixedTickRate",0,0)
+  result = (float)elfGetFixedTickRate();
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -4360,14 +4536,14 @@ fail:
 }
 
 
-static int _wrap_elfSetTextureAnisotropy(lua_State* L) {
+static int _wrap_elfSetMaxTicksPerFrame(lua_State* L) {
   int SWIG_arg = 0;
-  float arg1 ;
+  int arg1 ;
   
-  SWIG_check_num_args("SetTextureAnisotropy",1,1)
-  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetTextureAnisotropy",1,"float");
-  arg1 = (float)lua_tonumber(L, 1);
-  elfSetTextureAnisotropy(arg1);
+  SWIG_check_num_args("SetMaxTicksPerFrame",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetMaxTicksPerFrame",1,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  elfSetMaxTicksPerFrame(arg1);
   
   return SWIG_arg;
   
@@ -4379,12 +4555,12 @@ fail:
 }
 
 
-static int _wrap_elfGetTextureAnisotropy(lua_State* L) {
+static int _wrap_elfGetMaxTicksPerFrame(lua_State* L) {
   int SWIG_arg = 0;
-  float result;
+  int result;
   
-  SWIG_check_num_args("GetTextureAnisotropy",0,0)
-  result = (float)elfGetTextureAnisotropy();
+  SWIG_check_num_args("GetMaxTicksPerFrame",0,0)
+  result = (int)elfGetMaxTicksPerFrame();
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -4396,15 +4572,13 @@ fail:
 }
 
 
-static int _wrap_elfSetShadowMapSize(lua_State* L) {
+static int _wrap_elfGetFrameTicks(lua_State* L) {
   int SWIG_arg = 0;
-  int arg1 ;
-  
-  SWIG_check_num_args("SetShadowMapSize",1,1)
-  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetShadowMapSize",1,"int");
-  arg1 = (int)lua_tonumber(L, 1);
-  elfSetShadowMapSize(arg1);
+  int result;
   
+  SWIG_check_num_args("GetFrameTicks",0,0)
+  result = (int)elfGetFrameTicks();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -4415,12 +4589,12 @@ fail:
 }
 
 
-static int _wrap_elfGetShadowMapSize(lua_State* L) {
+static int _wrap_elfGetTickBlend(lua_State* L) {
   int SWIG_arg = 0;
-  int result;
+  float result;
   
-  SWIG_check_num_args("GetShadowMapSize",0,0)
-  result = (int)elfGetShadowMapSize();
+  SWIG_check_num_args("GetTickBlend",0,0)
+  result = (float)elfGetTickBlend();
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -4432,13 +4606,15 @@ fail:
 }
 
 
-static int _wrap_elfGetPolygonsRendered(lua_State* L) {
+static int _wrap_elfSetSpeed(lua_State* L) {
   int SWIG_arg = 0;
-  int result;
+  float arg1 ;
+  
+  SWIG_check_num_args("SetSpeed",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetSpeed",1,"float");
+  arg1 = (float)lua_tonumber(L, 1);
+  elfSetSpeed(arg1);
   
-  SWIG_check_num_args("GetPolygonsRendered",0,0)
-  result = (int)elfGetPolygonsRendered();
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -4449,15 +4625,13 @@ fail:
 }
 
 
-static int _wrap_elfSetBloom(lua_State* L) {
+static int _wrap_elfGetSpeed(lua_State* L) {
   int SWIG_arg = 0;
-  float arg1 ;
-  
-  SWIG_check_num_args("SetBloom",1,1)
-  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetBloom",1,"float");
-  arg1 = (float)lua_tonumber(L, 1);
-  elfSetBloom(arg1);
+  float result;
   
+  SWIG_check_num_args("GetSpeed",0,0)
+  result = (float)elfGetSpeed();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -4468,11 +4642,14 @@ fail:
 }
 
 
-static int _wrap_elfDisableBloom(lua_State* L) {
+static int _wrap_elfSetTextureAnisotropy(lua_State* L) {
   int SWIG_arg = 0;
+  float arg1 ;
   
-  SWIG_check_num_args("DisableBloom",0,0)
-  elfDisableBloom();
+  SWIG_check_num_args("SetTextureAnisotropy",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetTextureAnisotropy",1,"float");
+  arg1 = (float)lua_tonumber(L, 1);
+  elfSetTextureAnisotropy(arg1);
   
   return SWIG_arg;
   
@@ -4484,12 +4661,12 @@ fail:
 }
 
 
-static int _wrap_elfGetBloomThreshold(lua_State* L) {
+static int _wrap_elfGetTextureAnisotropy(lua_State* L) {
   int SWIG_arg = 0;
   float result;
   
-  SWIG_check_num_args("GetBloomThreshold",0,0)
-  result = (float)elfGetBloomThreshold();
+  SWIG_check_num_args("GetTextureAnisotropy",0,0)
+  result = (float)elfGetTextureAnisotropy();
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -4501,17 +4678,14 @@ fail:
 }
 
 
-static int _wrap_elfSetDof(lua_State* L) {
+static int _wrap_elfSetShadowMapSize(lua_State* L) {
   int SWIG_arg = 0;
-  float arg1 ;
-  float arg2 ;
+  int arg1 ;
   
-  SWIG_check_num_args("SetDof",2,2)
-  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetDof",1,"float");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetDof",2,"float");
-  arg1 = (float)lua_tonumber(L, 1);
-  arg2 = (float)lua_tonumber(L, 2);
-  elfSetDof(arg1,arg2);
+  SWIG_check_num_args("SetShadowMapSize",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetShadowMapSize",1,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  elfSetShadowMapSize(arg1);
   
   return SWIG_arg;
   
@@ -4523,12 +4697,13 @@ fail:
 }
 
 
-static int _wrap_elfDisableDof(lua_State* L) {
+static int _wrap_elfGetShadowMapSize(lua_State* L) {
   int SWIG_arg = 0;
+  int result;
   
-  SWIG_check_num_args("DisableDof",0,0)
-  elfDisableDof();
-  
+  SWIG_check_num_args("GetShadowMapSize",0,0)
+  result = (int)elfGetShadowMapSize();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -4539,12 +4714,12 @@ fail:
 }
 
 
-static int _wrap_elfGetDofFocalRange(lua_State* L) {
+static int _wrap_elfGetPolygonsRendered(lua_State* L) {
   int SWIG_arg = 0;
-  float result;
+  int result;
   
-  SWIG_check_num_args("GetDofFocalRange",0,0)
-  result = (float)elfGetDofFocalRange();
+  SWIG_check_num_args("GetPolygonsRendered",0,0)
+  result = (int)elfGetPolygonsRendered();
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -4556,12 +4731,12 @@ fail:
 }
 
 
-static int _wrap_elfGetDofFocalDistance(lua_State* L) {
+static int _wrap_elfGetDrawCalls(lua_State* L) {
   int SWIG_arg = 0;
-  float result;
+  int result;
   
-  SWIG_check_num_args("GetDofFocalDistance",0,0)
-  result = (float)elfGetDofFocalDistance();
+  SWIG_check_num_args("GetDrawCalls",0,0)
+  result = (int)elfGetDrawCalls();
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -4573,11 +4748,273 @@ fail:
 }
 
 
-static int _wrap_elfSetSsao(lua_State* L) {
+static int _wrap_elfGetStateChanges(lua_State* L) {
   int SWIG_arg = 0;
-  float arg1 ;
+  int result;
   
-  SWIG_check_num_args("SetSsao",1,1)
+  SWIG_check_num_args("GetStateChanges",0,0)
+  result = (int)elfGetStateChanges();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetTextureMemory(lua_State* L) {
+  int SWIG_arg = 0;
+  int result;
+  
+  SWIG_check_num_args("GetTextureMemory",0,0)
+  result = (int)elfGetTextureMemory();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetVertexBufferMemory(lua_State* L) {
+  int SWIG_arg = 0;
+  int result;
+  
+  SWIG_check_num_args("GetVertexBufferMemory",0,0)
+  result = (int)elfGetVertexBufferMemory();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfSetShaderCachePath(lua_State* L) {
+  int SWIG_arg = 0;
+  char *arg1 = (char *) 0 ;
+  
+  SWIG_check_num_args("SetShaderCachePath",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("SetShaderCachePath",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  elfSetShaderCachePath((char const *)arg1);
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetShaderCachePath(lua_State* L) {
+  int SWIG_arg = 0;
+  char *result = 0 ;
+  
+  SWIG_check_num_args("GetShaderCachePath",0,0)
+  result = (char *)elfGetShaderCachePath();
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfIsShaderBinaryCacheSupported(lua_State* L) {
+  int SWIG_arg = 0;
+  bool result;
+  
+  SWIG_check_num_args("IsShaderBinaryCacheSupported",0,0)
+  result = (bool)elfIsShaderBinaryCacheSupported();
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetShaderCacheHits(lua_State* L) {
+  int SWIG_arg = 0;
+  int result;
+  
+  SWIG_check_num_args("GetShaderCacheHits",0,0)
+  result = (int)elfGetShaderCacheHits();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetShaderProgramCount(lua_State* L) {
+  int SWIG_arg = 0;
+  int result;
+  
+  SWIG_check_num_args("GetShaderProgramCount",0,0)
+  result = (int)elfGetShaderProgramCount();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfSetBloom(lua_State* L) {
+  int SWIG_arg = 0;
+  float arg1 ;
+  
+  SWIG_check_num_args("SetBloom",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetBloom",1,"float");
+  arg1 = (float)lua_tonumber(L, 1);
+  elfSetBloom(arg1);
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfDisableBloom(lua_State* L) {
+  int SWIG_arg = 0;
+  
+  SWIG_check_num_args("DisableBloom",0,0)
+  elfDisableBloom();
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetBloomThreshold(lua_State* L) {
+  int SWIG_arg = 0;
+  float result;
+  
+  SWIG_check_num_args("GetBloomThreshold",0,0)
+  result = (float)elfGetBloomThreshold();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfSetDof(lua_State* L) {
+  int SWIG_arg = 0;
+  float arg1 ;
+  float arg2 ;
+  
+  SWIG_check_num_args("SetDof",2,2)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetDof",1,"float");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetDof",2,"float");
+  arg1 = (float)lua_tonumber(L, 1);
+  arg2 = (float)lua_tonumber(L, 2);
+  elfSetDof(arg1,arg2);
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfDisableDof(lua_State* L) {
+  int SWIG_arg = 0;
+  
+  SWIG_check_num_args("DisableDof",0,0)
+  elfDisableDof();
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetDofFocalRange(lua_State* L) {
+  int SWIG_arg = 0;
+  float result;
+  
+  SWIG_check_num_args("GetDofFocalRange",0,0)
+  result = (float)elfGetDofFocalRange();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetDofFocalDistance(lua_State* L) {
+  int SWIG_arg = 0;
+  float result;
+  
+  SWIG_check_num_args("GetDofFocalDistance",0,0)
+  result = (float)elfGetDofFocalDistance();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfSetSsao(lua_State* L) {
+  int SWIG_arg = 0;
+  float arg1 ;
+  
+  SWIG_check_num_args("SetSsao",1,1)
   if(!lua_isnumber(L,1)) SWIG_fail_arg("SetSsao",1,"float");
   arg1 = (float)lua_tonumber(L, 1);
   elfSetSsao(arg1);
@@ -5910,19 +6347,13 @@ fail:
 }
 
 
-static int _wrap_elfCreateTextureFromFile(lua_State* L) {
+static int _wrap_elfIsProfilerAvailable(lua_State* L) {
   int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("CreateTextureFromFile",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateTextureFromFile",1,"char const *");
-  arg1 = (char *)lua_tostring(L, 1);
-  result = elfCreateTextureFromFile((char const *)arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  SWIG_check_num_args("IsProfilerAvailable",0,0)
+  result = (bool)elfIsProfilerAvailable();
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -5933,22 +6364,896 @@ fail:
 }
 
 
-static int _wrap_elfGetTextureName(lua_State* L) {
+static int _wrap_elfSetProfilerEnabled(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle *argp1 ;
-  char *result = 0 ;
+  bool arg1 ;
+  
+  SWIG_check_num_args("SetProfilerEnabled",1,1)
+  if(!lua_isboolean(L,1)) SWIG_fail_arg("SetProfilerEnabled",1,"bool");
+  arg1 = (lua_toboolean(L, 1)!=0);
+  elfSetProfilerEnabled(arg1);
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfIsProfilerEnabled(lua_State* L) {
+  int SWIG_arg = 0;
+  bool result;
+  
+  SWIG_check_num_args("IsProfilerEnabled",0,0)
+  result = (bool)elfIsProfilerEnabled();
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetProfileFrameCount(lua_State* L) {
+  int SWIG_arg = 0;
+  int result;
+  
+  SWIG_check_num_args("GetProfileFrameCount",0,0)
+  result = (int)elfGetProfileFrameCount();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetProfileFrameTime(lua_State* L) {
+  int SWIG_arg = 0;
+  int arg1 ;
+  float result;
+  
+  SWIG_check_num_args("GetProfileFrameTime",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("GetProfileFrameTime",1,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  result = (float)elfGetProfileFrameTime(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetProfileSlowestFrame(lua_State* L) {
+  int SWIG_arg = 0;
+  int result;
+  
+  SWIG_check_num_args("GetProfileSlowestFrame",0,0)
+  result = (int)elfGetProfileSlowestFrame();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetProfileScopeCount(lua_State* L) {
+  int SWIG_arg = 0;
+  int arg1 ;
+  int result;
+  
+  SWIG_check_num_args("GetProfileScopeCount",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("GetProfileScopeCount",1,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  result = (int)elfGetProfileScopeCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetProfileScopeName(lua_State* L) {
+  int SWIG_arg = 0;
+  int arg1 ;
+  int arg2 ;
+  char *result = 0 ;
+  
+  SWIG_check_num_args("GetProfileScopeName",2,2)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("GetProfileScopeName",1,"int");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetProfileScopeName",2,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  arg2 = (int)lua_tonumber(L, 2);
+  result = (char *)elfGetProfileScopeName(arg1,arg2);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetProfileScopeDepth(lua_State* L) {
+  int SWIG_arg = 0;
+  int arg1 ;
+  int arg2 ;
+  int result;
+  
+  SWIG_check_num_args("GetProfileScopeDepth",2,2)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("GetProfileScopeDepth",1,"int");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetProfileScopeDepth",2,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  arg2 = (int)lua_tonumber(L, 2);
+  result = (int)elfGetProfileScopeDepth(arg1,arg2);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetProfileScopeStart(lua_State* L) {
+  int SWIG_arg = 0;
+  int arg1 ;
+  int arg2 ;
+  float result;
+  
+  SWIG_check_num_args("GetProfileScopeStart",2,2)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("GetProfileScopeStart",1,"int");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetProfileScopeStart",2,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  arg2 = (int)lua_tonumber(L, 2);
+  result = (float)elfGetProfileScopeStart(arg1,arg2);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetProfileScopeTime(lua_State* L) {
+  int SWIG_arg = 0;
+  int arg1 ;
+  int arg2 ;
+  float result;
+  
+  SWIG_check_num_args("GetProfileScopeTime",2,2)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("GetProfileScopeTime",1,"int");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetProfileScopeTime",2,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  arg2 = (int)lua_tonumber(L, 2);
+  result = (float)elfGetProfileScopeTime(arg1,arg2);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetProfileTime(lua_State* L) {
+  int SWIG_arg = 0;
+  int arg1 ;
+  char *arg2 = (char *) 0 ;
+  float result;
+  
+  SWIG_check_num_args("GetProfileTime",2,2)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("GetProfileTime",1,"int");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetProfileTime",2,"char const *");
+  arg1 = (int)lua_tonumber(L, 1);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = (float)elfGetProfileTime(arg1,(char const *)arg2);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfSaveProfileTrace(lua_State* L) {
+  int SWIG_arg = 0;
+  char *arg1 = (char *) 0 ;
+  bool result;
+  
+  SWIG_check_num_args("SaveProfileTrace",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("SaveProfileTrace",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = (bool)elfSaveProfileTrace((char const *)arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfSetFramePacingMode(lua_State* L) {
+  int SWIG_arg = 0;
+  int arg1 ;
+  
+  SWIG_check_num_args("SetFramePacingMode",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetFramePacingMode",1,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  elfSetFramePacingMode(arg1);
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetFramePacingMode(lua_State* L) {
+  int SWIG_arg = 0;
+  int result;
+  
+  SWIG_check_num_args("GetFramePacingMode",0,0)
+  result = (int)elfGetFramePacingMode();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetFramePacingJitter(lua_State* L) {
+  int SWIG_arg = 0;
+  float result;
+  
+  SWIG_check_num_args("GetFramePacingJitter",0,0)
+  result = (float)elfGetFramePacingJitter();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetFramePacingMaxJitter(lua_State* L) {
+  int SWIG_arg = 0;
+  float result;
+  
+  SWIG_check_num_args("GetFramePacingMaxJitter",0,0)
+  result = (float)elfGetFramePacingMaxJitter();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetFrameWorkTime(lua_State* L) {
+  int SWIG_arg = 0;
+  float result;
+  
+  SWIG_check_num_args("GetFrameWorkTime",0,0)
+  result = (float)elfGetFrameWorkTime();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetFramePacingSpinTime(lua_State* L) {
+  int SWIG_arg = 0;
+  float result;
+  
+  SWIG_check_num_args("GetFramePacingSpinTime",0,0)
+  result = (float)elfGetFramePacingSpinTime();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetLateFrameCount(lua_State* L) {
+  int SWIG_arg = 0;
+  int result;
+  
+  SWIG_check_num_args("GetLateFrameCount",0,0)
+  result = (int)elfGetLateFrameCount();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfCreateTextureFromFile(lua_State* L) {
+  int SWIG_arg = 0;
+  char *arg1 = (char *) 0 ;
+  elf_handle result;
+  
+  SWIG_check_num_args("CreateTextureFromFile",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateTextureFromFile",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = elfCreateTextureFromFile((char const *)arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetTextureName(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  char *result = 0 ;
+  
+  SWIG_check_num_args("GetTextureName",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureName",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetTextureName",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = (char *)elfGetTextureName(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetTextureFilePath(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  char *result = 0 ;
+  
+  SWIG_check_num_args("GetTextureFilePath",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureFilePath",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetTextureFilePath",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = (char *)elfGetTextureFilePath(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetTextureWidth(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  int result;
+  
+  SWIG_check_num_args("GetTextureWidth",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureWidth",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetTextureWidth",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = (int)elfGetTextureWidth(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetTextureHeight(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  int result;
+  
+  SWIG_check_num_args("GetTextureHeight",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureHeight",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetTextureHeight",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = (int)elfGetTextureHeight(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetTextureFormat(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  int result;
+  
+  SWIG_check_num_args("GetTextureFormat",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureFormat",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetTextureFormat",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = (int)elfGetTextureFormat(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetTextureDataFormat(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  int result;
+  
+  SWIG_check_num_args("GetTextureDataFormat",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureDataFormat",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetTextureDataFormat",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = (int)elfGetTextureDataFormat(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfCreateMaterial(lua_State* L) {
+  int SWIG_arg = 0;
+  char *arg1 = (char *) 0 ;
+  elf_handle result;
+  
+  SWIG_check_num_args("CreateMaterial",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateMaterial",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = elfCreateMaterial((char const *)arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfSetMaterialDiffuseColor(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
+  elf_handle *argp1 ;
+  
+  SWIG_check_num_args("SetMaterialDiffuseColor",5,5)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialDiffuseColor",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetMaterialDiffuseColor",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetMaterialDiffuseColor",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetMaterialDiffuseColor",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetMaterialDiffuseColor",5,"float");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetMaterialDiffuseColor",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  elfSetMaterialDiffuseColor(arg1,arg2,arg3,arg4,arg5);
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfSetMaterialSpecularColor(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
+  elf_handle *argp1 ;
+  
+  SWIG_check_num_args("SetMaterialSpecularColor",5,5)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialSpecularColor",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetMaterialSpecularColor",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetMaterialSpecularColor",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetMaterialSpecularColor",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetMaterialSpecularColor",5,"float");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetMaterialSpecularColor",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  elfSetMaterialSpecularColor(arg1,arg2,arg3,arg4,arg5);
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfSetMaterialAmbientColor(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
+  elf_handle *argp1 ;
+  
+  SWIG_check_num_args("SetMaterialAmbientColor",5,5)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialAmbientColor",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetMaterialAmbientColor",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetMaterialAmbientColor",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetMaterialAmbientColor",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetMaterialAmbientColor",5,"float");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetMaterialAmbientColor",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  elfSetMaterialAmbientColor(arg1,arg2,arg3,arg4,arg5);
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfSetMaterialSpecularPower(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  float arg2 ;
+  elf_handle *argp1 ;
+  
+  SWIG_check_num_args("SetMaterialSpecularPower",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialSpecularPower",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetMaterialSpecularPower",2,"float");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetMaterialSpecularPower",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  arg2 = (float)lua_tonumber(L, 2);
+  elfSetMaterialSpecularPower(arg1,arg2);
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfSetMaterialLighting(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  bool arg2 ;
+  elf_handle *argp1 ;
+  
+  SWIG_check_num_args("SetMaterialLighting",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialLighting",1,"handle");
+  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetMaterialLighting",2,"bool");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetMaterialLighting",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  arg2 = (lua_toboolean(L, 2)!=0);
+  elfSetMaterialLighting(arg1,arg2);
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetMaterialName(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  char *result = 0 ;
+  
+  SWIG_check_num_args("GetMaterialName",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialName",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetMaterialName",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = (char *)elfGetMaterialName(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetMaterialFilePath(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  char *result = 0 ;
+  
+  SWIG_check_num_args("GetMaterialFilePath",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialFilePath",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetMaterialFilePath",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = (char *)elfGetMaterialFilePath(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetMaterialDiffuseColor(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  elf_color result;
+  
+  SWIG_check_num_args("GetMaterialDiffuseColor",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialDiffuseColor",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetMaterialDiffuseColor",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = elfGetMaterialDiffuseColor(arg1);
+  {
+    elf_color * resultptr = new elf_color((const elf_color &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
+  }
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetMaterialSpecularColor(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  elf_color result;
+  
+  SWIG_check_num_args("GetMaterialSpecularColor",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialSpecularColor",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetMaterialSpecularColor",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = elfGetMaterialSpecularColor(arg1);
+  {
+    elf_color * resultptr = new elf_color((const elf_color &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
+  }
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetMaterialAmbientColor(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  elf_color result;
+  
+  SWIG_check_num_args("GetMaterialAmbientColor",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialAmbientColor",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetMaterialAmbientColor",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = elfGetMaterialAmbientColor(arg1);
+  {
+    elf_color * resultptr = new elf_color((const elf_color &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
+  }
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetMaterialSpecularPower(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("GetTextureName",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureName",1,"handle");
+  SWIG_check_num_args("GetMaterialSpecularPower",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialSpecularPower",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetTextureName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetMaterialSpecularPower",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetTextureName(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  result = (float)elfGetMaterialSpecularPower(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -5959,22 +7264,22 @@ fail:
 }
 
 
-static int _wrap_elfGetTextureFilePath(lua_State* L) {
+static int _wrap_elfGetMaterialLighting(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  char *result = 0 ;
+  bool result;
   
-  SWIG_check_num_args("GetTextureFilePath",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureFilePath",1,"handle");
+  SWIG_check_num_args("GetMaterialLighting",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialLighting",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetTextureFilePath",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetMaterialLighting",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetTextureFilePath(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  result = (bool)elfGetMaterialLighting(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -5985,22 +7290,30 @@ fail:
 }
 
 
-static int _wrap_elfGetTextureWidth(lua_State* L) {
+static int _wrap_elfSetMaterialDiffuseMap(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  int result;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("GetTextureWidth",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureWidth",1,"handle");
+  SWIG_check_num_args("SetMaterialDiffuseMap",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialDiffuseMap",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetMaterialDiffuseMap",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetTextureWidth",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetMaterialDiffuseMap",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetTextureWidth(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetMaterialDiffuseMap",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfSetMaterialDiffuseMap(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6011,22 +7324,30 @@ fail:
 }
 
 
-static int _wrap_elfGetTextureHeight(lua_State* L) {
+static int _wrap_elfSetMaterialNormalMap(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  int result;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("GetTextureHeight",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureHeight",1,"handle");
+  SWIG_check_num_args("SetMaterialNormalMap",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialNormalMap",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetMaterialNormalMap",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetTextureHeight",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetMaterialNormalMap",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetTextureHeight(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetMaterialNormalMap",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfSetMaterialNormalMap(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6037,22 +7358,30 @@ fail:
 }
 
 
-static int _wrap_elfGetTextureFormat(lua_State* L) {
+static int _wrap_elfSetMaterialHeightMap(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  int result;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("GetTextureFormat",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureFormat",1,"handle");
+  SWIG_check_num_args("SetMaterialHeightMap",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialHeightMap",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetMaterialHeightMap",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetTextureFormat",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetMaterialHeightMap",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetTextureFormat(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetMaterialHeightMap",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfSetMaterialHeightMap(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6063,22 +7392,30 @@ fail:
 }
 
 
-static int _wrap_elfGetTextureDataFormat(lua_State* L) {
+static int _wrap_elfSetMaterialSpecularMap(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  int result;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("GetTextureDataFormat",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureDataFormat",1,"handle");
+  SWIG_check_num_args("SetMaterialSpecularMap",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialSpecularMap",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetMaterialSpecularMap",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetTextureDataFormat",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetMaterialSpecularMap",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetTextureDataFormat(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetMaterialSpecularMap",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfSetMaterialSpecularMap(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6089,19 +7426,30 @@ fail:
 }
 
 
-static int _wrap_elfCreateMaterial(lua_State* L) {
+static int _wrap_elfSetMaterialLightMap(lua_State* L) {
   int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  elf_handle result;
+  elf_handle arg1 ;
+  elf_handle arg2 ;
+  elf_handle *argp1 ;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("CreateMaterial",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateMaterial",1,"char const *");
-  arg1 = (char *)lua_tostring(L, 1);
-  result = elfCreateMaterial((char const *)arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  SWIG_check_num_args("SetMaterialLightMap",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialLightMap",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetMaterialLightMap",2,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetMaterialLightMap",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetMaterialLightMap",2,SWIGTYPE_p_elf_handle);
   }
+  arg2 = *argp2;
+  
+  elfSetMaterialLightMap(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6112,33 +7460,25 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialDiffuseColor(lua_State* L) {
+static int _wrap_elfGetMaterialDiffuseMap(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
-  float arg5 ;
   elf_handle *argp1 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetMaterialDiffuseColor",5,5)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialDiffuseColor",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetMaterialDiffuseColor",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetMaterialDiffuseColor",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetMaterialDiffuseColor",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetMaterialDiffuseColor",5,"float");
+  SWIG_check_num_args("GetMaterialDiffuseMap",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialDiffuseMap",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialDiffuseColor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetMaterialDiffuseMap",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  elfSetMaterialDiffuseColor(arg1,arg2,arg3,arg4,arg5);
-  
+  result = elfGetMaterialDiffuseMap(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6149,33 +7489,25 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialSpecularColor(lua_State* L) {
+static int _wrap_elfGetMaterialNormalMap(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
-  float arg5 ;
   elf_handle *argp1 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetMaterialSpecularColor",5,5)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialSpecularColor",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetMaterialSpecularColor",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetMaterialSpecularColor",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetMaterialSpecularColor",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetMaterialSpecularColor",5,"float");
+  SWIG_check_num_args("GetMaterialNormalMap",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialNormalMap",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialSpecularColor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetMaterialNormalMap",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  elfSetMaterialSpecularColor(arg1,arg2,arg3,arg4,arg5);
-  
+  result = elfGetMaterialNormalMap(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6186,33 +7518,25 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialAmbientColor(lua_State* L) {
+static int _wrap_elfGetMaterialHeightMap(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
-  float arg5 ;
   elf_handle *argp1 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetMaterialAmbientColor",5,5)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialAmbientColor",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetMaterialAmbientColor",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetMaterialAmbientColor",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetMaterialAmbientColor",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetMaterialAmbientColor",5,"float");
+  SWIG_check_num_args("GetMaterialHeightMap",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialHeightMap",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialAmbientColor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetMaterialHeightMap",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  elfSetMaterialAmbientColor(arg1,arg2,arg3,arg4,arg5);
-  
+  result = elfGetMaterialHeightMap(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6223,24 +7547,25 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialSpecularPower(lua_State* L) {
+static int _wrap_elfGetMaterialSpecularMap(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
   elf_handle *argp1 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetMaterialSpecularPower",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialSpecularPower",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetMaterialSpecularPower",2,"float");
+  SWIG_check_num_args("GetMaterialSpecularMap",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialSpecularMap",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialSpecularPower",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetMaterialSpecularMap",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  elfSetMaterialSpecularPower(arg1,arg2);
-  
+  result = elfGetMaterialSpecularMap(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6251,24 +7576,25 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialLighting(lua_State* L) {
+static int _wrap_elfGetMaterialLightMap(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  bool arg2 ;
   elf_handle *argp1 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetMaterialLighting",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialLighting",1,"handle");
-  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetMaterialLighting",2,"bool");
+  SWIG_check_num_args("GetMaterialLightMap",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialLightMap",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialLighting",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetMaterialLightMap",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (lua_toboolean(L, 2)!=0);
-  elfSetMaterialLighting(arg1,arg2);
-  
+  result = elfGetMaterialLightMap(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6279,22 +7605,24 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialName(lua_State* L) {
+static int _wrap_elfSetMaterialParallaxScale(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
   elf_handle *argp1 ;
-  char *result = 0 ;
   
-  SWIG_check_num_args("GetMaterialName",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialName",1,"handle");
+  SWIG_check_num_args("SetMaterialParallaxScale",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialParallaxScale",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetMaterialParallaxScale",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetMaterialParallaxScale",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetMaterialName(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  elfSetMaterialParallaxScale(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6305,22 +7633,24 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialFilePath(lua_State* L) {
+static int _wrap_elfSetMaterialAlphaTest(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  bool arg2 ;
   elf_handle *argp1 ;
-  char *result = 0 ;
   
-  SWIG_check_num_args("GetMaterialFilePath",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialFilePath",1,"handle");
+  SWIG_check_num_args("SetMaterialAlphaTest",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialAlphaTest",1,"handle");
+  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetMaterialAlphaTest",2,"bool");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialFilePath",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetMaterialAlphaTest",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetMaterialFilePath(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  arg2 = (lua_toboolean(L, 2)!=0);
+  elfSetMaterialAlphaTest(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6331,25 +7661,24 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialDiffuseColor(lua_State* L) {
+static int _wrap_elfSetMaterialAlphaThreshold(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
   elf_handle *argp1 ;
-  elf_color result;
   
-  SWIG_check_num_args("GetMaterialDiffuseColor",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialDiffuseColor",1,"handle");
+  SWIG_check_num_args("SetMaterialAlphaThreshold",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialAlphaThreshold",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetMaterialAlphaThreshold",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialDiffuseColor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetMaterialAlphaThreshold",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetMaterialDiffuseColor(arg1);
-  {
-    elf_color * resultptr = new elf_color((const elf_color &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
-  }
+  arg2 = (float)lua_tonumber(L, 2);
+  elfSetMaterialAlphaThreshold(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6360,25 +7689,22 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialSpecularColor(lua_State* L) {
+static int _wrap_elfGetMaterialParallaxScale(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_color result;
+  float result;
   
-  SWIG_check_num_args("GetMaterialSpecularColor",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialSpecularColor",1,"handle");
+  SWIG_check_num_args("GetMaterialParallaxScale",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialParallaxScale",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialSpecularColor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetMaterialParallaxScale",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetMaterialSpecularColor(arg1);
-  {
-    elf_color * resultptr = new elf_color((const elf_color &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
-  }
+  result = (float)elfGetMaterialParallaxScale(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6389,25 +7715,22 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialAmbientColor(lua_State* L) {
+static int _wrap_elfGetMaterialAlphaTest(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_color result;
+  bool result;
   
-  SWIG_check_num_args("GetMaterialAmbientColor",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialAmbientColor",1,"handle");
+  SWIG_check_num_args("GetMaterialAlphaTest",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialAlphaTest",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialAmbientColor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetMaterialAlphaTest",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetMaterialAmbientColor(arg1);
-  {
-    elf_color * resultptr = new elf_color((const elf_color &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
-  }
+  result = (bool)elfGetMaterialAlphaTest(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6418,21 +7741,21 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialSpecularPower(lua_State* L) {
+static int _wrap_elfGetMaterialAlphaThreshold(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
   float result;
   
-  SWIG_check_num_args("GetMaterialSpecularPower",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialSpecularPower",1,"handle");
+  SWIG_check_num_args("GetMaterialAlphaThreshold",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialAlphaThreshold",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialSpecularPower",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetMaterialAlphaThreshold",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetMaterialSpecularPower(arg1);
+  result = (float)elfGetMaterialAlphaThreshold(arg1);
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -6444,22 +7767,30 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialLighting(lua_State* L) {
+static int _wrap_elfAddPointToBezierCurve(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  bool result;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("GetMaterialLighting",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialLighting",1,"handle");
+  SWIG_check_num_args("AddPointToBezierCurve",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddPointToBezierCurve",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddPointToBezierCurve",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialLighting",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddPointToBezierCurve",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfGetMaterialLighting(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("AddPointToBezierCurve",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfAddPointToBezierCurve(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6470,30 +7801,31 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialDiffuseMap(lua_State* L) {
+static int _wrap_elfAddCurveToIpo(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle arg2 ;
   elf_handle *argp1 ;
   elf_handle *argp2 ;
+  bool result;
   
-  SWIG_check_num_args("SetMaterialDiffuseMap",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialDiffuseMap",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetMaterialDiffuseMap",2,"handle");
+  SWIG_check_num_args("AddCurveToIpo",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddCurveToIpo",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddCurveToIpo",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialDiffuseMap",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddCurveToIpo",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialDiffuseMap",2,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddCurveToIpo",2,SWIGTYPE_p_elf_handle);
   }
   arg2 = *argp2;
   
-  elfSetMaterialDiffuseMap(arg1,arg2);
-  
+  result = (bool)elfAddCurveToIpo(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6504,30 +7836,28 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialNormalMap(lua_State* L) {
+static int _wrap_elfGetIpoLoc(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  float arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  elf_vec3f result;
   
-  SWIG_check_num_args("SetMaterialNormalMap",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialNormalMap",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetMaterialNormalMap",2,"handle");
+  SWIG_check_num_args("GetIpoLoc",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetIpoLoc",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetIpoLoc",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialNormalMap",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetIpoLoc",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialNormalMap",2,SWIGTYPE_p_elf_handle);
+  arg2 = (float)lua_tonumber(L, 2);
+  result = elfGetIpoLoc(arg1,arg2);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  elfSetMaterialNormalMap(arg1,arg2);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6538,30 +7868,28 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialHeightMap(lua_State* L) {
+static int _wrap_elfGetIpoRot(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  float arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  elf_vec3f result;
   
-  SWIG_check_num_args("SetMaterialHeightMap",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialHeightMap",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetMaterialHeightMap",2,"handle");
+  SWIG_check_num_args("GetIpoRot",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetIpoRot",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetIpoRot",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialHeightMap",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetIpoRot",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialHeightMap",2,SWIGTYPE_p_elf_handle);
+  arg2 = (float)lua_tonumber(L, 2);
+  result = elfGetIpoRot(arg1,arg2);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  elfSetMaterialHeightMap(arg1,arg2);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6572,30 +7900,28 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialSpecularMap(lua_State* L) {
+static int _wrap_elfGetIpoScale(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  float arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  elf_vec3f result;
   
-  SWIG_check_num_args("SetMaterialSpecularMap",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialSpecularMap",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetMaterialSpecularMap",2,"handle");
+  SWIG_check_num_args("GetIpoScale",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetIpoScale",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetIpoScale",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialSpecularMap",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetIpoScale",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialSpecularMap",2,SWIGTYPE_p_elf_handle);
+  arg2 = (float)lua_tonumber(L, 2);
+  result = elfGetIpoScale(arg1,arg2);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  elfSetMaterialSpecularMap(arg1,arg2);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6606,30 +7932,51 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialLightMap(lua_State* L) {
+static int _wrap_elfGetIpoQua(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  float arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  elf_vec4f result;
   
-  SWIG_check_num_args("SetMaterialLightMap",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialLightMap",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetMaterialLightMap",2,"handle");
+  SWIG_check_num_args("GetIpoQua",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetIpoQua",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetIpoQua",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialLightMap",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetIpoQua",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
+  arg2 = (float)lua_tonumber(L, 2);
+  result = elfGetIpoQua(arg1,arg2);
+  {
+    elf_vec4f * resultptr = new elf_vec4f((const elf_vec4f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec4f,1); SWIG_arg++;
+  }
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfCreateProperty(lua_State* L) {
+  int SWIG_arg = 0;
+  char *arg1 = (char *) 0 ;
+  elf_handle result;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialLightMap",2,SWIGTYPE_p_elf_handle);
+  SWIG_check_num_args("CreateProperty",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateProperty",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = elfCreateProperty((char const *)arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  elfSetMaterialLightMap(arg1,arg2);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6640,25 +7987,22 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialDiffuseMap(lua_State* L) {
+static int _wrap_elfGetPropertyType(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  int result;
   
-  SWIG_check_num_args("GetMaterialDiffuseMap",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialDiffuseMap",1,"handle");
+  SWIG_check_num_args("GetPropertyType",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetPropertyType",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialDiffuseMap",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetPropertyType",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetMaterialDiffuseMap(arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (int)elfGetPropertyType(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6669,25 +8013,22 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialNormalMap(lua_State* L) {
+static int _wrap_elfGetPropertyInt(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  int result;
   
-  SWIG_check_num_args("GetMaterialNormalMap",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialNormalMap",1,"handle");
+  SWIG_check_num_args("GetPropertyInt",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetPropertyInt",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialNormalMap",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetPropertyInt",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetMaterialNormalMap(arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (int)elfGetPropertyInt(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6698,25 +8039,22 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialHeightMap(lua_State* L) {
+static int _wrap_elfGetPropertyFloat(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  float result;
   
-  SWIG_check_num_args("GetMaterialHeightMap",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialHeightMap",1,"handle");
+  SWIG_check_num_args("GetPropertyFloat",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetPropertyFloat",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialHeightMap",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetPropertyFloat",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetMaterialHeightMap(arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (float)elfGetPropertyFloat(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6727,25 +8065,22 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialSpecularMap(lua_State* L) {
+static int _wrap_elfGetPropertyString(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  char *result = 0 ;
   
-  SWIG_check_num_args("GetMaterialSpecularMap",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialSpecularMap",1,"handle");
+  SWIG_check_num_args("GetPropertyString",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetPropertyString",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialSpecularMap",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetPropertyString",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetMaterialSpecularMap(arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (char *)elfGetPropertyString(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6756,25 +8091,22 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialLightMap(lua_State* L) {
+static int _wrap_elfGetPropertyBool(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("GetMaterialLightMap",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialLightMap",1,"handle");
+  SWIG_check_num_args("GetPropertyBool",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetPropertyBool",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialLightMap",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetPropertyBool",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetMaterialLightMap(arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (bool)elfGetPropertyBool(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6785,23 +8117,23 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialParallaxScale(lua_State* L) {
+static int _wrap_elfSetPropertyInt(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
+  int arg2 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetMaterialParallaxScale",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialParallaxScale",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetMaterialParallaxScale",2,"float");
+  SWIG_check_num_args("SetPropertyInt",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetPropertyInt",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetPropertyInt",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialParallaxScale",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetPropertyInt",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  elfSetMaterialParallaxScale(arg1,arg2);
+  arg2 = (int)lua_tonumber(L, 2);
+  elfSetPropertyInt(arg1,arg2);
   
   return SWIG_arg;
   
@@ -6813,23 +8145,23 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialAlphaTest(lua_State* L) {
+static int _wrap_elfSetPropertyFloat(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  bool arg2 ;
+  float arg2 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetMaterialAlphaTest",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialAlphaTest",1,"handle");
-  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetMaterialAlphaTest",2,"bool");
+  SWIG_check_num_args("SetPropertyFloat",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetPropertyFloat",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetPropertyFloat",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialAlphaTest",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetPropertyFloat",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (lua_toboolean(L, 2)!=0);
-  elfSetMaterialAlphaTest(arg1,arg2);
+  arg2 = (float)lua_tonumber(L, 2);
+  elfSetPropertyFloat(arg1,arg2);
   
   return SWIG_arg;
   
@@ -6841,23 +8173,23 @@ fail:
 }
 
 
-static int _wrap_elfSetMaterialAlphaThreshold(lua_State* L) {
+static int _wrap_elfSetPropertyString(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetMaterialAlphaThreshold",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetMaterialAlphaThreshold",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetMaterialAlphaThreshold",2,"float");
+  SWIG_check_num_args("SetPropertyString",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetPropertyString",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("SetPropertyString",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetMaterialAlphaThreshold",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetPropertyString",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  elfSetMaterialAlphaThreshold(arg1,arg2);
+  arg2 = (char *)lua_tostring(L, 2);
+  elfSetPropertyString(arg1,(char const *)arg2);
   
   return SWIG_arg;
   
@@ -6869,22 +8201,24 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialParallaxScale(lua_State* L) {
+static int _wrap_elfSetPropertyBool(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  bool arg2 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetMaterialParallaxScale",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialParallaxScale",1,"handle");
+  SWIG_check_num_args("SetPropertyBool",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetPropertyBool",1,"handle");
+  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetPropertyBool",2,"bool");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialParallaxScale",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetPropertyBool",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetMaterialParallaxScale(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (lua_toboolean(L, 2)!=0);
+  elfSetPropertyBool(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6895,22 +8229,22 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialAlphaTest(lua_State* L) {
+static int _wrap_elfGetActorName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  bool result;
+  char *result = 0 ;
   
-  SWIG_check_num_args("GetMaterialAlphaTest",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialAlphaTest",1,"handle");
+  SWIG_check_num_args("GetActorName",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorName",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialAlphaTest",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfGetMaterialAlphaTest(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = (char *)elfGetActorName(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6921,22 +8255,22 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialAlphaThreshold(lua_State* L) {
+static int _wrap_elfGetActorFilePath(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  float result;
+  char *result = 0 ;
   
-  SWIG_check_num_args("GetMaterialAlphaThreshold",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialAlphaThreshold",1,"handle");
+  SWIG_check_num_args("GetActorFilePath",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorFilePath",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialAlphaThreshold",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorFilePath",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetMaterialAlphaThreshold(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  result = (char *)elfGetActorFilePath(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6947,30 +8281,25 @@ fail:
 }
 
 
-static int _wrap_elfAddPointToBezierCurve(lua_State* L) {
+static int _wrap_elfGetActorScript(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  elf_handle result;
   
-  SWIG_check_num_args("AddPointToBezierCurve",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddPointToBezierCurve",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddPointToBezierCurve",2,"handle");
+  SWIG_check_num_args("GetActorScript",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorScript",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddPointToBezierCurve",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorScript",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddPointToBezierCurve",2,SWIGTYPE_p_elf_handle);
+  result = elfGetActorScript(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  elfAddPointToBezierCurve(arg1,arg2);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -6981,31 +8310,24 @@ fail:
 }
 
 
-static int _wrap_elfAddCurveToIpo(lua_State* L) {
+static int _wrap_elfSetActorName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
-  bool result;
   
-  SWIG_check_num_args("AddCurveToIpo",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddCurveToIpo",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddCurveToIpo",2,"handle");
+  SWIG_check_num_args("SetActorName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("SetActorName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddCurveToIpo",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
+  arg2 = (char *)lua_tostring(L, 2);
+  elfSetActorName(arg1,(char const *)arg2);
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddCurveToIpo",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
-  
-  result = (bool)elfAddCurveToIpo(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7016,28 +8338,30 @@ fail:
 }
 
 
-static int _wrap_elfGetIpoLoc(lua_State* L) {
+static int _wrap_elfSetActorScript(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("GetIpoLoc",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetIpoLoc",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetIpoLoc",2,"float");
+  SWIG_check_num_args("SetActorScript",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorScript",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetActorScript",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetIpoLoc",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorScript",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  result = elfGetIpoLoc(arg1,arg2);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetActorScript",2,SWIGTYPE_p_elf_handle);
   }
+  arg2 = *argp2;
+  
+  elfSetActorScript(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7048,28 +8372,30 @@ fail:
 }
 
 
-static int _wrap_elfGetIpoRot(lua_State* L) {
+static int _wrap_elfSetActorPosition(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
   
-  SWIG_check_num_args("GetIpoRot",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetIpoRot",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetIpoRot",2,"float");
+  SWIG_check_num_args("SetActorPosition",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorPosition",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorPosition",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorPosition",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorPosition",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetIpoRot",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorPosition",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (float)lua_tonumber(L, 2);
-  result = elfGetIpoRot(arg1,arg2);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetActorPosition(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7080,28 +8406,30 @@ fail:
 }
 
 
-static int _wrap_elfGetIpoScale(lua_State* L) {
+static int _wrap_elfSetActorRotation(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
   
-  SWIG_check_num_args("GetIpoScale",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetIpoScale",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetIpoScale",2,"float");
+  SWIG_check_num_args("SetActorRotation",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorRotation",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorRotation",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorRotation",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorRotation",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetIpoScale",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorRotation",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (float)lua_tonumber(L, 2);
-  result = elfGetIpoScale(arg1,arg2);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetActorRotation(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7112,51 +8440,33 @@ fail:
 }
 
 
-static int _wrap_elfGetIpoQua(lua_State* L) {
+static int _wrap_elfSetActorOrientation(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
   elf_handle *argp1 ;
-  elf_vec4f result;
   
-  SWIG_check_num_args("GetIpoQua",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetIpoQua",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetIpoQua",2,"float");
+  SWIG_check_num_args("SetActorOrientation",5,5)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorOrientation",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorOrientation",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorOrientation",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorOrientation",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetActorOrientation",5,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetIpoQua",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorOrientation",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (float)lua_tonumber(L, 2);
-  result = elfGetIpoQua(arg1,arg2);
-  {
-    elf_vec4f * resultptr = new elf_vec4f((const elf_vec4f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec4f,1); SWIG_arg++;
-  }
-  return SWIG_arg;
-  
-  if(0) SWIG_fail;
-  
-fail:
-  lua_error(L);
-  return SWIG_arg;
-}
-
-
-static int _wrap_elfCreateProperty(lua_State* L) {
-  int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  elf_handle result;
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  elfSetActorOrientation(arg1,arg2,arg3,arg4,arg5);
   
-  SWIG_check_num_args("CreateProperty",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateProperty",1,"char const *");
-  arg1 = (char *)lua_tostring(L, 1);
-  result = elfCreateProperty((char const *)arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7167,22 +8477,30 @@ fail:
 }
 
 
-static int _wrap_elfGetPropertyType(lua_State* L) {
+static int _wrap_elfRotateActor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  int result;
   
-  SWIG_check_num_args("GetPropertyType",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetPropertyType",1,"handle");
+  SWIG_check_num_args("RotateActor",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RotateActor",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("RotateActor",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("RotateActor",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("RotateActor",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetPropertyType",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RotateActor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetPropertyType(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfRotateActor(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7193,22 +8511,30 @@ fail:
 }
 
 
-static int _wrap_elfGetPropertyInt(lua_State* L) {
+static int _wrap_elfRotateActorLocal(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  int result;
   
-  SWIG_check_num_args("GetPropertyInt",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetPropertyInt",1,"handle");
+  SWIG_check_num_args("RotateActorLocal",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RotateActorLocal",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("RotateActorLocal",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("RotateActorLocal",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("RotateActorLocal",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetPropertyInt",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RotateActorLocal",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetPropertyInt(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfRotateActorLocal(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7219,22 +8545,30 @@ fail:
 }
 
 
-static int _wrap_elfGetPropertyFloat(lua_State* L) {
+static int _wrap_elfMoveActor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetPropertyFloat",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetPropertyFloat",1,"handle");
+  SWIG_check_num_args("MoveActor",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("MoveActor",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("MoveActor",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("MoveActor",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("MoveActor",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetPropertyFloat",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("MoveActor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetPropertyFloat(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfMoveActor(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7245,22 +8579,30 @@ fail:
 }
 
 
-static int _wrap_elfGetPropertyString(lua_State* L) {
+static int _wrap_elfMoveActorLocal(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  char *result = 0 ;
   
-  SWIG_check_num_args("GetPropertyString",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetPropertyString",1,"handle");
+  SWIG_check_num_args("MoveActorLocal",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("MoveActorLocal",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("MoveActorLocal",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("MoveActorLocal",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("MoveActorLocal",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetPropertyString",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("MoveActorLocal",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetPropertyString(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfMoveActorLocal(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7271,22 +8613,25 @@ fail:
 }
 
 
-static int _wrap_elfGetPropertyBool(lua_State* L) {
+static int _wrap_elfGetActorPosition(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  bool result;
+  elf_vec3f result;
   
-  SWIG_check_num_args("GetPropertyBool",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetPropertyBool",1,"handle");
+  SWIG_check_num_args("GetActorPosition",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorPosition",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetPropertyBool",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorPosition",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfGetPropertyBool(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = elfGetActorPosition(arg1);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7297,24 +8642,25 @@ fail:
 }
 
 
-static int _wrap_elfSetPropertyInt(lua_State* L) {
+static int _wrap_elfGetActorRotation(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
   elf_handle *argp1 ;
+  elf_vec3f result;
   
-  SWIG_check_num_args("SetPropertyInt",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetPropertyInt",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetPropertyInt",2,"int");
+  SWIG_check_num_args("GetActorRotation",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorRotation",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetPropertyInt",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorRotation",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  elfSetPropertyInt(arg1,arg2);
-  
+  result = elfGetActorRotation(arg1);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7325,24 +8671,25 @@ fail:
 }
 
 
-static int _wrap_elfSetPropertyFloat(lua_State* L) {
+static int _wrap_elfGetActorOrientation(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
   elf_handle *argp1 ;
+  elf_vec4f result;
   
-  SWIG_check_num_args("SetPropertyFloat",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetPropertyFloat",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetPropertyFloat",2,"float");
+  SWIG_check_num_args("GetActorOrientation",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorOrientation",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetPropertyFloat",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorOrientation",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  elfSetPropertyFloat(arg1,arg2);
-  
+  result = elfGetActorOrientation(arg1);
+  {
+    elf_vec4f * resultptr = new elf_vec4f((const elf_vec4f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec4f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7353,23 +8700,29 @@ fail:
 }
 
 
-static int _wrap_elfSetPropertyString(lua_State* L) {
+static int _wrap_elfSetActorBoundingLengths(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetPropertyString",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetPropertyString",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("SetPropertyString",2,"char const *");
+  SWIG_check_num_args("SetActorBoundingLengths",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorBoundingLengths",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorBoundingLengths",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorBoundingLengths",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorBoundingLengths",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetPropertyString",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorBoundingLengths",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  elfSetPropertyString(arg1,(char const *)arg2);
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetActorBoundingLengths(arg1,arg2,arg3,arg4);
   
   return SWIG_arg;
   
@@ -7381,23 +8734,29 @@ fail:
 }
 
 
-static int _wrap_elfSetPropertyBool(lua_State* L) {
+static int _wrap_elfSetActorBoundingOffset(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  bool arg2 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetPropertyBool",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetPropertyBool",1,"handle");
-  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetPropertyBool",2,"bool");
+  SWIG_check_num_args("SetActorBoundingOffset",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorBoundingOffset",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorBoundingOffset",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorBoundingOffset",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorBoundingOffset",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetPropertyBool",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorBoundingOffset",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (lua_toboolean(L, 2)!=0);
-  elfSetPropertyBool(arg1,arg2);
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetActorBoundingOffset(arg1,arg2,arg3,arg4);
   
   return SWIG_arg;
   
@@ -7409,22 +8768,27 @@ fail:
 }
 
 
-static int _wrap_elfGetActorName(lua_State* L) {
+static int _wrap_elfSetActorPhysics(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
+  float arg3 ;
   elf_handle *argp1 ;
-  char *result = 0 ;
   
-  SWIG_check_num_args("GetActorName",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorName",1,"handle");
+  SWIG_check_num_args("SetActorPhysics",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorPhysics",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorPhysics",2,"int");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorPhysics",3,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorPhysics",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetActorName(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  elfSetActorPhysics(arg1,arg2,arg3);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7435,22 +8799,22 @@ fail:
 }
 
 
-static int _wrap_elfGetActorFilePath(lua_State* L) {
+static int _wrap_elfIsActorPhysics(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  char *result = 0 ;
+  bool result;
   
-  SWIG_check_num_args("GetActorFilePath",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorFilePath",1,"handle");
+  SWIG_check_num_args("IsActorPhysics",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsActorPhysics",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorFilePath",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("IsActorPhysics",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetActorFilePath(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  result = (bool)elfIsActorPhysics(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7461,25 +8825,21 @@ fail:
 }
 
 
-static int _wrap_elfGetActorScript(lua_State* L) {
+static int _wrap_elfDisableActorPhysics(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_handle result;
   
-  SWIG_check_num_args("GetActorScript",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorScript",1,"handle");
+  SWIG_check_num_args("DisableActorPhysics",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("DisableActorPhysics",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorScript",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("DisableActorPhysics",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetActorScript(arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  elfDisableActorPhysics(arg1);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7490,23 +8850,26 @@ fail:
 }
 
 
-static int _wrap_elfSetActorName(lua_State* L) {
+static int _wrap_elfSetActorDamping(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  float arg2 ;
+  float arg3 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetActorName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("SetActorName",2,"char const *");
+  SWIG_check_num_args("SetActorDamping",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorDamping",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorDamping",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorDamping",3,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorDamping",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  elfSetActorName(arg1,(char const *)arg2);
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  elfSetActorDamping(arg1,arg2,arg3);
   
   return SWIG_arg;
   
@@ -7518,29 +8881,26 @@ fail:
 }
 
 
-static int _wrap_elfSetActorScript(lua_State* L) {
+static int _wrap_elfSetActorSleepThresholds(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  float arg2 ;
+  float arg3 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
   
-  SWIG_check_num_args("SetActorScript",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorScript",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetActorScript",2,"handle");
+  SWIG_check_num_args("SetActorSleepThresholds",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorSleepThresholds",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorSleepThresholds",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorSleepThresholds",3,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorScript",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorSleepThresholds",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorScript",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
-  
-  elfSetActorScript(arg1,arg2);
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  elfSetActorSleepThresholds(arg1,arg2,arg3);
   
   return SWIG_arg;
   
@@ -7552,29 +8912,23 @@ fail:
 }
 
 
-static int _wrap_elfSetActorPosition(lua_State* L) {
+static int _wrap_elfSetActorRestitution(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetActorPosition",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorPosition",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorPosition",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorPosition",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorPosition",4,"float");
+  SWIG_check_num_args("SetActorRestitution",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorRestitution",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorRestitution",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorPosition",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorRestitution",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetActorPosition(arg1,arg2,arg3,arg4);
+  elfSetActorRestitution(arg1,arg2);
   
   return SWIG_arg;
   
@@ -7586,7 +8940,7 @@ fail:
 }
 
 
-static int _wrap_elfSetActorRotation(lua_State* L) {
+static int _wrap_elfSetActorAnisotropicFriction(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   float arg2 ;
@@ -7594,21 +8948,21 @@ static int _wrap_elfSetActorRotation(lua_State* L) {
   float arg4 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetActorRotation",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorRotation",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorRotation",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorRotation",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorRotation",4,"float");
+  SWIG_check_num_args("SetActorAnisotropicFriction",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorAnisotropicFriction",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorAnisotropicFriction",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorAnisotropicFriction",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorAnisotropicFriction",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorRotation",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorAnisotropicFriction",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (float)lua_tonumber(L, 2);
   arg3 = (float)lua_tonumber(L, 3);
   arg4 = (float)lua_tonumber(L, 4);
-  elfSetActorRotation(arg1,arg2,arg3,arg4);
+  elfSetActorAnisotropicFriction(arg1,arg2,arg3,arg4);
   
   return SWIG_arg;
   
@@ -7620,32 +8974,29 @@ fail:
 }
 
 
-static int _wrap_elfSetActorOrientation(lua_State* L) {
+static int _wrap_elfSetActorLinearFactor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   float arg2 ;
   float arg3 ;
   float arg4 ;
-  float arg5 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetActorOrientation",5,5)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorOrientation",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorOrientation",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorOrientation",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorOrientation",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetActorOrientation",5,"float");
+  SWIG_check_num_args("SetActorLinearFactor",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorLinearFactor",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorLinearFactor",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorLinearFactor",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorLinearFactor",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorOrientation",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorLinearFactor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (float)lua_tonumber(L, 2);
   arg3 = (float)lua_tonumber(L, 3);
   arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  elfSetActorOrientation(arg1,arg2,arg3,arg4,arg5);
+  elfSetActorLinearFactor(arg1,arg2,arg3,arg4);
   
   return SWIG_arg;
   
@@ -7657,7 +9008,7 @@ fail:
 }
 
 
-static int _wrap_elfRotateActor(lua_State* L) {
+static int _wrap_elfSetActorAngularFactor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   float arg2 ;
@@ -7665,21 +9016,21 @@ static int _wrap_elfRotateActor(lua_State* L) {
   float arg4 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("RotateActor",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RotateActor",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("RotateActor",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("RotateActor",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("RotateActor",4,"float");
+  SWIG_check_num_args("SetActorAngularFactor",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorAngularFactor",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorAngularFactor",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorAngularFactor",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorAngularFactor",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RotateActor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorAngularFactor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (float)lua_tonumber(L, 2);
   arg3 = (float)lua_tonumber(L, 3);
   arg4 = (float)lua_tonumber(L, 4);
-  elfRotateActor(arg1,arg2,arg3,arg4);
+  elfSetActorAngularFactor(arg1,arg2,arg3,arg4);
   
   return SWIG_arg;
   
@@ -7691,7 +9042,7 @@ fail:
 }
 
 
-static int _wrap_elfRotateActorLocal(lua_State* L) {
+static int _wrap_elfAddForceToActor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   float arg2 ;
@@ -7699,21 +9050,21 @@ static int _wrap_elfRotateActorLocal(lua_State* L) {
   float arg4 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("RotateActorLocal",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RotateActorLocal",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("RotateActorLocal",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("RotateActorLocal",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("RotateActorLocal",4,"float");
+  SWIG_check_num_args("AddForceToActor",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddForceToActor",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("AddForceToActor",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("AddForceToActor",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("AddForceToActor",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RotateActorLocal",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddForceToActor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (float)lua_tonumber(L, 2);
   arg3 = (float)lua_tonumber(L, 3);
   arg4 = (float)lua_tonumber(L, 4);
-  elfRotateActorLocal(arg1,arg2,arg3,arg4);
+  elfAddForceToActor(arg1,arg2,arg3,arg4);
   
   return SWIG_arg;
   
@@ -7725,7 +9076,7 @@ fail:
 }
 
 
-static int _wrap_elfMoveActor(lua_State* L) {
+static int _wrap_elfAddTorqueToActor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   float arg2 ;
@@ -7733,21 +9084,21 @@ static int _wrap_elfMoveActor(lua_State* L) {
   float arg4 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("MoveActor",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("MoveActor",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("MoveActor",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("MoveActor",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("MoveActor",4,"float");
+  SWIG_check_num_args("AddTorqueToActor",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddTorqueToActor",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("AddTorqueToActor",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("AddTorqueToActor",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("AddTorqueToActor",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("MoveActor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddTorqueToActor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (float)lua_tonumber(L, 2);
   arg3 = (float)lua_tonumber(L, 3);
   arg4 = (float)lua_tonumber(L, 4);
-  elfMoveActor(arg1,arg2,arg3,arg4);
+  elfAddTorqueToActor(arg1,arg2,arg3,arg4);
   
   return SWIG_arg;
   
@@ -7759,7 +9110,7 @@ fail:
 }
 
 
-static int _wrap_elfMoveActorLocal(lua_State* L) {
+static int _wrap_elfSetActorLinearVelocity(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   float arg2 ;
@@ -7767,21 +9118,21 @@ static int _wrap_elfMoveActorLocal(lua_State* L) {
   float arg4 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("MoveActorLocal",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("MoveActorLocal",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("MoveActorLocal",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("MoveActorLocal",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("MoveActorLocal",4,"float");
+  SWIG_check_num_args("SetActorLinearVelocity",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorLinearVelocity",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorLinearVelocity",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorLinearVelocity",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorLinearVelocity",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("MoveActorLocal",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorLinearVelocity",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (float)lua_tonumber(L, 2);
   arg3 = (float)lua_tonumber(L, 3);
   arg4 = (float)lua_tonumber(L, 4);
-  elfMoveActorLocal(arg1,arg2,arg3,arg4);
+  elfSetActorLinearVelocity(arg1,arg2,arg3,arg4);
   
   return SWIG_arg;
   
@@ -7793,25 +9144,30 @@ fail:
 }
 
 
-static int _wrap_elfGetActorPosition(lua_State* L) {
+static int _wrap_elfSetActorAngularVelocity(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
   
-  SWIG_check_num_args("GetActorPosition",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorPosition",1,"handle");
+  SWIG_check_num_args("SetActorAngularVelocity",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorAngularVelocity",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorAngularVelocity",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorAngularVelocity",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorAngularVelocity",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorPosition",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorAngularVelocity",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetActorPosition(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetActorAngularVelocity(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7822,21 +9178,21 @@ fail:
 }
 
 
-static int _wrap_elfGetActorRotation(lua_State* L) {
+static int _wrap_elfGetActorBoundingLengths(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
   elf_vec3f result;
   
-  SWIG_check_num_args("GetActorRotation",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorRotation",1,"handle");
+  SWIG_check_num_args("GetActorBoundingLengths",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorBoundingLengths",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorRotation",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorBoundingLengths",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetActorRotation(arg1);
+  result = elfGetActorBoundingLengths(arg1);
   {
     elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
     SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
@@ -7851,24 +9207,24 @@ fail:
 }
 
 
-static int _wrap_elfGetActorOrientation(lua_State* L) {
+static int _wrap_elfGetActorBoundingOffset(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec4f result;
+  elf_vec3f result;
   
-  SWIG_check_num_args("GetActorOrientation",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorOrientation",1,"handle");
+  SWIG_check_num_args("GetActorBoundingOffset",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorBoundingOffset",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorOrientation",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorBoundingOffset",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetActorOrientation(arg1);
+  result = elfGetActorBoundingOffset(arg1);
   {
-    elf_vec4f * resultptr = new elf_vec4f((const elf_vec4f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec4f,1); SWIG_arg++;
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
   }
   return SWIG_arg;
   
@@ -7880,30 +9236,22 @@ fail:
 }
 
 
-static int _wrap_elfSetActorBoundingLengths(lua_State* L) {
+static int _wrap_elfGetActorShape(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  int result;
   
-  SWIG_check_num_args("SetActorBoundingLengths",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorBoundingLengths",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorBoundingLengths",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorBoundingLengths",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorBoundingLengths",4,"float");
+  SWIG_check_num_args("GetActorShape",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorShape",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorBoundingLengths",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorShape",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetActorBoundingLengths(arg1,arg2,arg3,arg4);
-  
+  result = (int)elfGetActorShape(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7914,30 +9262,22 @@ fail:
 }
 
 
-static int _wrap_elfSetActorBoundingOffset(lua_State* L) {
+static int _wrap_elfGetActorMass(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetActorBoundingOffset",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorBoundingOffset",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorBoundingOffset",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorBoundingOffset",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorBoundingOffset",4,"float");
+  SWIG_check_num_args("GetActorMass",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorMass",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorBoundingOffset",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorMass",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetActorBoundingOffset(arg1,arg2,arg3,arg4);
-  
+  result = (float)elfGetActorMass(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7948,27 +9288,22 @@ fail:
 }
 
 
-static int _wrap_elfSetActorPhysics(lua_State* L) {
+static int _wrap_elfGetActorLinearDamping(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
-  float arg3 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetActorPhysics",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorPhysics",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorPhysics",2,"int");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorPhysics",3,"float");
+  SWIG_check_num_args("GetActorLinearDamping",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorLinearDamping",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorPhysics",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorLinearDamping",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  elfSetActorPhysics(arg1,arg2,arg3);
-  
+  result = (float)elfGetActorLinearDamping(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -7979,22 +9314,22 @@ fail:
 }
 
 
-static int _wrap_elfIsActorPhysics(lua_State* L) {
+static int _wrap_elfGetActorAngularDamping(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  bool result;
+  float result;
   
-  SWIG_check_num_args("IsActorPhysics",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsActorPhysics",1,"handle");
+  SWIG_check_num_args("GetActorAngularDamping",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorAngularDamping",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("IsActorPhysics",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorAngularDamping",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfIsActorPhysics(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = (float)elfGetActorAngularDamping(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8005,21 +9340,22 @@ fail:
 }
 
 
-static int _wrap_elfDisableActorPhysics(lua_State* L) {
+static int _wrap_elfGetActorLinearSleepThreshold(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("DisableActorPhysics",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("DisableActorPhysics",1,"handle");
+  SWIG_check_num_args("GetActorLinearSleepThreshold",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorLinearSleepThreshold",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("DisableActorPhysics",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorLinearSleepThreshold",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  elfDisableActorPhysics(arg1);
-  
+  result = (float)elfGetActorLinearSleepThreshold(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8030,27 +9366,22 @@ fail:
 }
 
 
-static int _wrap_elfSetActorDamping(lua_State* L) {
+static int _wrap_elfGetActorAngularSleepThreshold(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetActorDamping",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorDamping",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorDamping",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorDamping",3,"float");
+  SWIG_check_num_args("GetActorAngularSleepThreshold",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorAngularSleepThreshold",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorDamping",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorAngularSleepThreshold",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  elfSetActorDamping(arg1,arg2,arg3);
-  
+  result = (float)elfGetActorAngularSleepThreshold(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8061,27 +9392,22 @@ fail:
 }
 
 
-static int _wrap_elfSetActorSleepThresholds(lua_State* L) {
+static int _wrap_elfGetActorRestitution(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetActorSleepThresholds",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorSleepThresholds",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorSleepThresholds",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorSleepThresholds",3,"float");
+  SWIG_check_num_args("GetActorRestitution",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorRestitution",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorSleepThresholds",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorRestitution",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  elfSetActorSleepThresholds(arg1,arg2,arg3);
-  
+  result = (float)elfGetActorRestitution(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8092,24 +9418,25 @@ fail:
 }
 
 
-static int _wrap_elfSetActorRestitution(lua_State* L) {
+static int _wrap_elfGetActorAnisotropicFriction(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
   elf_handle *argp1 ;
+  elf_vec3f result;
   
-  SWIG_check_num_args("SetActorRestitution",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorRestitution",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorRestitution",2,"float");
+  SWIG_check_num_args("GetActorAnisotropicFriction",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorAnisotropicFriction",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorRestitution",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorAnisotropicFriction",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  elfSetActorRestitution(arg1,arg2);
-  
+  result = elfGetActorAnisotropicFriction(arg1);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8120,30 +9447,25 @@ fail:
 }
 
 
-static int _wrap_elfSetActorAnisotropicFriction(lua_State* L) {
+static int _wrap_elfGetActorLinearFactor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  elf_vec3f result;
   
-  SWIG_check_num_args("SetActorAnisotropicFriction",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorAnisotropicFriction",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorAnisotropicFriction",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorAnisotropicFriction",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorAnisotropicFriction",4,"float");
+  SWIG_check_num_args("GetActorLinearFactor",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorLinearFactor",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorAnisotropicFriction",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorLinearFactor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetActorAnisotropicFriction(arg1,arg2,arg3,arg4);
-  
+  result = elfGetActorLinearFactor(arg1);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8154,30 +9476,25 @@ fail:
 }
 
 
-static int _wrap_elfSetActorLinearFactor(lua_State* L) {
+static int _wrap_elfGetActorAngularFactor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  elf_vec3f result;
   
-  SWIG_check_num_args("SetActorLinearFactor",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorLinearFactor",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorLinearFactor",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorLinearFactor",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorLinearFactor",4,"float");
+  SWIG_check_num_args("GetActorAngularFactor",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorAngularFactor",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorLinearFactor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorAngularFactor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetActorLinearFactor(arg1,arg2,arg3,arg4);
-  
+  result = elfGetActorAngularFactor(arg1);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8188,30 +9505,25 @@ fail:
 }
 
 
-static int _wrap_elfSetActorAngularFactor(lua_State* L) {
+static int _wrap_elfGetActorLinearVelocity(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  elf_vec3f result;
   
-  SWIG_check_num_args("SetActorAngularFactor",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorAngularFactor",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorAngularFactor",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorAngularFactor",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorAngularFactor",4,"float");
+  SWIG_check_num_args("GetActorLinearVelocity",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorLinearVelocity",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorAngularFactor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorLinearVelocity",1,SWIGTYPE_p_elf_handle);
   }
-  arg1 = *argp1;
-  
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetActorAngularFactor(arg1,arg2,arg3,arg4);
+  arg1 = *argp1;
   
+  result = elfGetActorLinearVelocity(arg1);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8222,30 +9534,25 @@ fail:
 }
 
 
-static int _wrap_elfAddForceToActor(lua_State* L) {
+static int _wrap_elfGetActorAngularVelocity(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  elf_vec3f result;
   
-  SWIG_check_num_args("AddForceToActor",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddForceToActor",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("AddForceToActor",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("AddForceToActor",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("AddForceToActor",4,"float");
+  SWIG_check_num_args("GetActorAngularVelocity",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorAngularVelocity",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddForceToActor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorAngularVelocity",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfAddForceToActor(arg1,arg2,arg3,arg4);
-  
+  result = elfGetActorAngularVelocity(arg1);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8256,30 +9563,55 @@ fail:
 }
 
 
-static int _wrap_elfAddTorqueToActor(lua_State* L) {
+static int _wrap_elfAddHingeJointToActor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
+  elf_handle arg2 ;
+  char *arg3 = (char *) 0 ;
   float arg4 ;
+  float arg5 ;
+  float arg6 ;
+  float arg7 ;
+  float arg8 ;
+  float arg9 ;
   elf_handle *argp1 ;
+  elf_handle *argp2 ;
+  elf_handle result;
   
-  SWIG_check_num_args("AddTorqueToActor",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddTorqueToActor",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("AddTorqueToActor",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("AddTorqueToActor",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("AddTorqueToActor",4,"float");
+  SWIG_check_num_args("AddHingeJointToActor",9,9)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddHingeJointToActor",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddHingeJointToActor",2,"handle");
+  if(!lua_isstring(L,3)) SWIG_fail_arg("AddHingeJointToActor",3,"char const *");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("AddHingeJointToActor",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("AddHingeJointToActor",5,"float");
+  if(!lua_isnumber(L,6)) SWIG_fail_arg("AddHingeJointToActor",6,"float");
+  if(!lua_isnumber(L,7)) SWIG_fail_arg("AddHingeJointToActor",7,"float");
+  if(!lua_isnumber(L,8)) SWIG_fail_arg("AddHingeJointToActor",8,"float");
+  if(!lua_isnumber(L,9)) SWIG_fail_arg("AddHingeJointToActor",9,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddTorqueToActor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddHingeJointToActor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfAddTorqueToActor(arg1,arg2,arg3,arg4);
   
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("AddHingeJointToActor",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  arg3 = (char *)lua_tostring(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  arg6 = (float)lua_tonumber(L, 6);
+  arg7 = (float)lua_tonumber(L, 7);
+  arg8 = (float)lua_tonumber(L, 8);
+  arg9 = (float)lua_tonumber(L, 9);
+  result = elfAddHingeJointToActor(arg1,arg2,(char const *)arg3,arg4,arg5,arg6,arg7,arg8,arg9);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8290,30 +9622,46 @@ fail:
 }
 
 
-static int _wrap_elfSetActorLinearVelocity(lua_State* L) {
+static int _wrap_elfAddBallJointToActor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
+  elf_handle arg2 ;
+  char *arg3 = (char *) 0 ;
   float arg4 ;
+  float arg5 ;
+  float arg6 ;
   elf_handle *argp1 ;
+  elf_handle *argp2 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetActorLinearVelocity",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorLinearVelocity",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorLinearVelocity",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorLinearVelocity",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorLinearVelocity",4,"float");
+  SWIG_check_num_args("AddBallJointToActor",6,6)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddBallJointToActor",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddBallJointToActor",2,"handle");
+  if(!lua_isstring(L,3)) SWIG_fail_arg("AddBallJointToActor",3,"char const *");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("AddBallJointToActor",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("AddBallJointToActor",5,"float");
+  if(!lua_isnumber(L,6)) SWIG_fail_arg("AddBallJointToActor",6,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorLinearVelocity",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddBallJointToActor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetActorLinearVelocity(arg1,arg2,arg3,arg4);
   
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("AddBallJointToActor",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  arg3 = (char *)lua_tostring(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  arg6 = (float)lua_tonumber(L, 6);
+  result = elfAddBallJointToActor(arg1,arg2,(char const *)arg3,arg4,arg5,arg6);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8324,30 +9672,55 @@ fail:
 }
 
 
-static int _wrap_elfSetActorAngularVelocity(lua_State* L) {
+static int _wrap_elfAddConeTwistJointToActor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
+  elf_handle arg2 ;
+  char *arg3 = (char *) 0 ;
   float arg4 ;
+  float arg5 ;
+  float arg6 ;
+  float arg7 ;
+  float arg8 ;
+  float arg9 ;
   elf_handle *argp1 ;
+  elf_handle *argp2 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetActorAngularVelocity",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorAngularVelocity",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorAngularVelocity",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetActorAngularVelocity",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetActorAngularVelocity",4,"float");
+  SWIG_check_num_args("AddConeTwistJointToActor",9,9)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddConeTwistJointToActor",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddConeTwistJointToActor",2,"handle");
+  if(!lua_isstring(L,3)) SWIG_fail_arg("AddConeTwistJointToActor",3,"char const *");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("AddConeTwistJointToActor",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("AddConeTwistJointToActor",5,"float");
+  if(!lua_isnumber(L,6)) SWIG_fail_arg("AddConeTwistJointToActor",6,"float");
+  if(!lua_isnumber(L,7)) SWIG_fail_arg("AddConeTwistJointToActor",7,"float");
+  if(!lua_isnumber(L,8)) SWIG_fail_arg("AddConeTwistJointToActor",8,"float");
+  if(!lua_isnumber(L,9)) SWIG_fail_arg("AddConeTwistJointToActor",9,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorAngularVelocity",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddConeTwistJointToActor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetActorAngularVelocity(arg1,arg2,arg3,arg4);
   
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("AddConeTwistJointToActor",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  arg3 = (char *)lua_tostring(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  arg6 = (float)lua_tonumber(L, 6);
+  arg7 = (float)lua_tonumber(L, 7);
+  arg8 = (float)lua_tonumber(L, 8);
+  arg9 = (float)lua_tonumber(L, 9);
+  result = elfAddConeTwistJointToActor(arg1,arg2,(char const *)arg3,arg4,arg5,arg6,arg7,arg8,arg9);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8358,24 +9731,27 @@ fail:
 }
 
 
-static int _wrap_elfGetActorBoundingLengths(lua_State* L) {
+static int _wrap_elfGetActorJointByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetActorBoundingLengths",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorBoundingLengths",1,"handle");
+  SWIG_check_num_args("GetActorJointByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorJointByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetActorJointByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorBoundingLengths",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorJointByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetActorBoundingLengths(arg1);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetActorJointByName(arg1,(char const *)arg2);
   {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
   return SWIG_arg;
   
@@ -8387,24 +9763,27 @@ fail:
 }
 
 
-static int _wrap_elfGetActorBoundingOffset(lua_State* L) {
+static int _wrap_elfGetActorJointByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetActorBoundingOffset",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorBoundingOffset",1,"handle");
+  SWIG_check_num_args("GetActorJointByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorJointByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetActorJointByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorBoundingOffset",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorJointByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetActorBoundingOffset(arg1);
+  arg2 = (int)lua_tonumber(L, 2);
+  result = elfGetActorJointByIndex(arg1,arg2);
   {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
   return SWIG_arg;
   
@@ -8416,22 +9795,25 @@ fail:
 }
 
 
-static int _wrap_elfGetActorShape(lua_State* L) {
+static int _wrap_elfRemoveActorJointByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  int result;
+  bool result;
   
-  SWIG_check_num_args("GetActorShape",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorShape",1,"handle");
+  SWIG_check_num_args("RemoveActorJointByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorJointByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveActorJointByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorShape",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveActorJointByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetActorShape(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (char *)lua_tostring(L, 2);
+  result = (bool)elfRemoveActorJointByName(arg1,(char const *)arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8442,22 +9824,25 @@ fail:
 }
 
 
-static int _wrap_elfGetActorMass(lua_State* L) {
+static int _wrap_elfRemoveActorJointByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  float result;
+  bool result;
   
-  SWIG_check_num_args("GetActorMass",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorMass",1,"handle");
+  SWIG_check_num_args("RemoveActorJointByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorJointByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveActorJointByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorMass",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveActorJointByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetActorMass(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  result = (bool)elfRemoveActorJointByIndex(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8468,22 +9853,31 @@ fail:
 }
 
 
-static int _wrap_elfGetActorLinearDamping(lua_State* L) {
+static int _wrap_elfRemoveActorJointByObject(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  float result;
+  elf_handle *argp2 ;
+  bool result;
   
-  SWIG_check_num_args("GetActorLinearDamping",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorLinearDamping",1,"handle");
+  SWIG_check_num_args("RemoveActorJointByObject",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorJointByObject",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveActorJointByObject",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorLinearDamping",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveActorJointByObject",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetActorLinearDamping(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("RemoveActorJointByObject",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  result = (bool)elfRemoveActorJointByObject(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8494,22 +9888,24 @@ fail:
 }
 
 
-static int _wrap_elfGetActorAngularDamping(lua_State* L) {
+static int _wrap_elfSetActorIpoFrame(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetActorAngularDamping",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorAngularDamping",1,"handle");
+  SWIG_check_num_args("SetActorIpoFrame",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorIpoFrame",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorIpoFrame",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorAngularDamping",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorIpoFrame",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetActorAngularDamping(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  elfSetActorIpoFrame(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8520,22 +9916,30 @@ fail:
 }
 
 
-static int _wrap_elfGetActorLinearSleepThreshold(lua_State* L) {
+static int _wrap_elfPlayActorIpo(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetActorLinearSleepThreshold",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorLinearSleepThreshold",1,"handle");
+  SWIG_check_num_args("PlayActorIpo",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("PlayActorIpo",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("PlayActorIpo",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("PlayActorIpo",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("PlayActorIpo",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorLinearSleepThreshold",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("PlayActorIpo",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetActorLinearSleepThreshold(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfPlayActorIpo(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8546,22 +9950,30 @@ fail:
 }
 
 
-static int _wrap_elfGetActorAngularSleepThreshold(lua_State* L) {
+static int _wrap_elfLoopActorIpo(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetActorAngularSleepThreshold",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorAngularSleepThreshold",1,"handle");
+  SWIG_check_num_args("LoopActorIpo",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("LoopActorIpo",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("LoopActorIpo",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("LoopActorIpo",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("LoopActorIpo",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorAngularSleepThreshold",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("LoopActorIpo",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetActorAngularSleepThreshold(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfLoopActorIpo(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8572,22 +9984,21 @@ fail:
 }
 
 
-static int _wrap_elfGetActorRestitution(lua_State* L) {
+static int _wrap_elfStopActorIpo(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetActorRestitution",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorRestitution",1,"handle");
+  SWIG_check_num_args("StopActorIpo",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("StopActorIpo",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorRestitution",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("StopActorIpo",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetActorRestitution(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  elfStopActorIpo(arg1);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8598,25 +10009,21 @@ fail:
 }
 
 
-static int _wrap_elfGetActorAnisotropicFriction(lua_State* L) {
+static int _wrap_elfPauseActorIpo(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
   
-  SWIG_check_num_args("GetActorAnisotropicFriction",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorAnisotropicFriction",1,"handle");
+  SWIG_check_num_args("PauseActorIpo",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("PauseActorIpo",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorAnisotropicFriction",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("PauseActorIpo",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetActorAnisotropicFriction(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  elfPauseActorIpo(arg1);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8627,25 +10034,21 @@ fail:
 }
 
 
-static int _wrap_elfGetActorLinearFactor(lua_State* L) {
+static int _wrap_elfResumeActorIpo(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
   
-  SWIG_check_num_args("GetActorLinearFactor",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorLinearFactor",1,"handle");
+  SWIG_check_num_args("ResumeActorIpo",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("ResumeActorIpo",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorLinearFactor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("ResumeActorIpo",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetActorLinearFactor(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  elfResumeActorIpo(arg1);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8656,25 +10059,22 @@ fail:
 }
 
 
-static int _wrap_elfGetActorAngularFactor(lua_State* L) {
+static int _wrap_elfGetActorIpoStart(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
+  float result;
   
-  SWIG_check_num_args("GetActorAngularFactor",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorAngularFactor",1,"handle");
+  SWIG_check_num_args("GetActorIpoStart",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorIpoStart",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorAngularFactor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorIpoStart",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetActorAngularFactor(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  result = (float)elfGetActorIpoStart(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8685,25 +10085,22 @@ fail:
 }
 
 
-static int _wrap_elfGetActorLinearVelocity(lua_State* L) {
+static int _wrap_elfGetActorIpoEnd(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
+  float result;
   
-  SWIG_check_num_args("GetActorLinearVelocity",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorLinearVelocity",1,"handle");
+  SWIG_check_num_args("GetActorIpoEnd",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorIpoEnd",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorLinearVelocity",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorIpoEnd",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetActorLinearVelocity(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  result = (float)elfGetActorIpoEnd(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8714,25 +10111,22 @@ fail:
 }
 
 
-static int _wrap_elfGetActorAngularVelocity(lua_State* L) {
+static int _wrap_elfGetActorIpoSpeed(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
+  float result;
   
-  SWIG_check_num_args("GetActorAngularVelocity",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorAngularVelocity",1,"handle");
+  SWIG_check_num_args("GetActorIpoSpeed",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorIpoSpeed",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorAngularVelocity",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorIpoSpeed",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetActorAngularVelocity(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  result = (float)elfGetActorIpoSpeed(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8743,55 +10137,22 @@ fail:
 }
 
 
-static int _wrap_elfAddHingeJointToActor(lua_State* L) {
+static int _wrap_elfGetActorIpoFrame(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
-  char *arg3 = (char *) 0 ;
-  float arg4 ;
-  float arg5 ;
-  float arg6 ;
-  float arg7 ;
-  float arg8 ;
-  float arg9 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
-  elf_handle result;
+  float result;
   
-  SWIG_check_num_args("AddHingeJointToActor",9,9)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddHingeJointToActor",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddHingeJointToActor",2,"handle");
-  if(!lua_isstring(L,3)) SWIG_fail_arg("AddHingeJointToActor",3,"char const *");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("AddHingeJointToActor",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("AddHingeJointToActor",5,"float");
-  if(!lua_isnumber(L,6)) SWIG_fail_arg("AddHingeJointToActor",6,"float");
-  if(!lua_isnumber(L,7)) SWIG_fail_arg("AddHingeJointToActor",7,"float");
-  if(!lua_isnumber(L,8)) SWIG_fail_arg("AddHingeJointToActor",8,"float");
-  if(!lua_isnumber(L,9)) SWIG_fail_arg("AddHingeJointToActor",9,"float");
+  SWIG_check_num_args("GetActorIpoFrame",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorIpoFrame",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddHingeJointToActor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorIpoFrame",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddHingeJointToActor",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
-  
-  arg3 = (char *)lua_tostring(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  arg6 = (float)lua_tonumber(L, 6);
-  arg7 = (float)lua_tonumber(L, 7);
-  arg8 = (float)lua_tonumber(L, 8);
-  arg9 = (float)lua_tonumber(L, 9);
-  result = elfAddHingeJointToActor(arg1,arg2,(char const *)arg3,arg4,arg5,arg6,arg7,arg8,arg9);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (float)elfGetActorIpoFrame(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8802,46 +10163,22 @@ fail:
 }
 
 
-static int _wrap_elfAddBallJointToActor(lua_State* L) {
+static int _wrap_elfIsActorIpoPlaying(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
-  char *arg3 = (char *) 0 ;
-  float arg4 ;
-  float arg5 ;
-  float arg6 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
-  elf_handle result;
-  
-  SWIG_check_num_args("AddBallJointToActor",6,6)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddBallJointToActor",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddBallJointToActor",2,"handle");
-  if(!lua_isstring(L,3)) SWIG_fail_arg("AddBallJointToActor",3,"char const *");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("AddBallJointToActor",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("AddBallJointToActor",5,"float");
-  if(!lua_isnumber(L,6)) SWIG_fail_arg("AddBallJointToActor",6,"float");
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddBallJointToActor",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
-  
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddBallJointToActor",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
+  bool result;
   
-  arg3 = (char *)lua_tostring(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  arg6 = (float)lua_tonumber(L, 6);
-  result = elfAddBallJointToActor(arg1,arg2,(char const *)arg3,arg4,arg5,arg6);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  SWIG_check_num_args("IsActorIpoPlaying",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsActorIpoPlaying",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("IsActorIpoPlaying",1,SWIGTYPE_p_elf_handle);
   }
+  arg1 = *argp1;
+  
+  result = (bool)elfIsActorIpoPlaying(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8852,55 +10189,22 @@ fail:
 }
 
 
-static int _wrap_elfAddConeTwistJointToActor(lua_State* L) {
+static int _wrap_elfIsActorIpoPaused(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
-  char *arg3 = (char *) 0 ;
-  float arg4 ;
-  float arg5 ;
-  float arg6 ;
-  float arg7 ;
-  float arg8 ;
-  float arg9 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("AddConeTwistJointToActor",9,9)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddConeTwistJointToActor",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddConeTwistJointToActor",2,"handle");
-  if(!lua_isstring(L,3)) SWIG_fail_arg("AddConeTwistJointToActor",3,"char const *");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("AddConeTwistJointToActor",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("AddConeTwistJointToActor",5,"float");
-  if(!lua_isnumber(L,6)) SWIG_fail_arg("AddConeTwistJointToActor",6,"float");
-  if(!lua_isnumber(L,7)) SWIG_fail_arg("AddConeTwistJointToActor",7,"float");
-  if(!lua_isnumber(L,8)) SWIG_fail_arg("AddConeTwistJointToActor",8,"float");
-  if(!lua_isnumber(L,9)) SWIG_fail_arg("AddConeTwistJointToActor",9,"float");
+  SWIG_check_num_args("IsActorIpoPaused",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsActorIpoPaused",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddConeTwistJointToActor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("IsActorIpoPaused",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddConeTwistJointToActor",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
-  
-  arg3 = (char *)lua_tostring(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  arg6 = (float)lua_tonumber(L, 6);
-  arg7 = (float)lua_tonumber(L, 7);
-  arg8 = (float)lua_tonumber(L, 8);
-  arg9 = (float)lua_tonumber(L, 9);
-  result = elfAddConeTwistJointToActor(arg1,arg2,(char const *)arg3,arg4,arg5,arg6,arg7,arg8,arg9);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (bool)elfIsActorIpoPaused(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8911,28 +10215,22 @@ fail:
 }
 
 
-static int _wrap_elfGetActorJointByName(lua_State* L) {
+static int _wrap_elfGetActorCollisionCount(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  int result;
   
-  SWIG_check_num_args("GetActorJointByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorJointByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetActorJointByName",2,"char const *");
+  SWIG_check_num_args("GetActorCollisionCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorCollisionCount",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorJointByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorCollisionCount",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetActorJointByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (int)elfGetActorCollisionCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -8943,24 +10241,24 @@ fail:
 }
 
 
-static int _wrap_elfGetActorJointByIndex(lua_State* L) {
+static int _wrap_elfGetActorCollision(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   int arg2 ;
   elf_handle *argp1 ;
   elf_handle result;
   
-  SWIG_check_num_args("GetActorJointByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorJointByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetActorJointByIndex",2,"int");
+  SWIG_check_num_args("GetActorCollision",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorCollision",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetActorCollision",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorJointByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorCollision",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (int)lua_tonumber(L, 2);
-  result = elfGetActorJointByIndex(arg1,arg2);
+  result = elfGetActorCollision(arg1,arg2);
   {
     elf_handle * resultptr = new elf_handle((const elf_handle &) result);
     SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
@@ -8975,25 +10273,22 @@ fail:
 }
 
 
-static int _wrap_elfRemoveActorJointByName(lua_State* L) {
+static int _wrap_elfGetActorPropertyCount(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  bool result;
+  int result;
   
-  SWIG_check_num_args("RemoveActorJointByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorJointByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveActorJointByName",2,"char const *");
+  SWIG_check_num_args("GetActorPropertyCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorPropertyCount",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveActorJointByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorPropertyCount",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = (bool)elfRemoveActorJointByName(arg1,(char const *)arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = (int)elfGetActorPropertyCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9004,25 +10299,30 @@ fail:
 }
 
 
-static int _wrap_elfRemoveActorJointByIndex(lua_State* L) {
+static int _wrap_elfAddPropertyToActor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  bool result;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("RemoveActorJointByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorJointByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveActorJointByIndex",2,"int");
+  SWIG_check_num_args("AddPropertyToActor",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddPropertyToActor",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddPropertyToActor",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveActorJointByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddPropertyToActor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = (bool)elfRemoveActorJointByIndex(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("AddPropertyToActor",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfAddPropertyToActor(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9033,31 +10333,28 @@ fail:
 }
 
 
-static int _wrap_elfRemoveActorJointByObject(lua_State* L) {
+static int _wrap_elfGetActorPropertyByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
-  bool result;
+  elf_handle result;
   
-  SWIG_check_num_args("RemoveActorJointByObject",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorJointByObject",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveActorJointByObject",2,"handle");
+  SWIG_check_num_args("GetActorPropertyByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorPropertyByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetActorPropertyByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveActorJointByObject",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorPropertyByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveActorJointByObject",2,SWIGTYPE_p_elf_handle);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetActorPropertyByName(arg1,(char const *)arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  result = (bool)elfRemoveActorJointByObject(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9068,24 +10365,28 @@ fail:
 }
 
 
-static int _wrap_elfSetActorIpoFrame(lua_State* L) {
+static int _wrap_elfGetActorPropertyByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
+  int arg2 ;
   elf_handle *argp1 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetActorIpoFrame",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorIpoFrame",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetActorIpoFrame",2,"float");
+  SWIG_check_num_args("GetActorPropertyByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorPropertyByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetActorPropertyByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorIpoFrame",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorPropertyByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  elfSetActorIpoFrame(arg1,arg2);
-  
+  arg2 = (int)lua_tonumber(L, 2);
+  result = elfGetActorPropertyByIndex(arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9096,30 +10397,25 @@ fail:
 }
 
 
-static int _wrap_elfPlayActorIpo(lua_State* L) {
+static int _wrap_elfRemoveActorPropertyByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
+  bool result;
   
-  SWIG_check_num_args("PlayActorIpo",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("PlayActorIpo",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("PlayActorIpo",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("PlayActorIpo",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("PlayActorIpo",4,"float");
+  SWIG_check_num_args("RemoveActorPropertyByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorPropertyByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveActorPropertyByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("PlayActorIpo",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveActorPropertyByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfPlayActorIpo(arg1,arg2,arg3,arg4);
-  
+  arg2 = (char *)lua_tostring(L, 2);
+  result = (bool)elfRemoveActorPropertyByName(arg1,(char const *)arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9130,30 +10426,25 @@ fail:
 }
 
 
-static int _wrap_elfLoopActorIpo(lua_State* L) {
+static int _wrap_elfRemoveActorPropertyByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
+  int arg2 ;
   elf_handle *argp1 ;
+  bool result;
   
-  SWIG_check_num_args("LoopActorIpo",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("LoopActorIpo",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("LoopActorIpo",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("LoopActorIpo",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("LoopActorIpo",4,"float");
+  SWIG_check_num_args("RemoveActorPropertyByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorPropertyByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveActorPropertyByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("LoopActorIpo",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveActorPropertyByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfLoopActorIpo(arg1,arg2,arg3,arg4);
-  
+  arg2 = (int)lua_tonumber(L, 2);
+  result = (bool)elfRemoveActorPropertyByIndex(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9164,21 +10455,31 @@ fail:
 }
 
 
-static int _wrap_elfStopActorIpo(lua_State* L) {
+static int _wrap_elfRemoveActorPropertyByObject(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
+  elf_handle *argp2 ;
+  bool result;
   
-  SWIG_check_num_args("StopActorIpo",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("StopActorIpo",1,"handle");
+  SWIG_check_num_args("RemoveActorPropertyByObject",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorPropertyByObject",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveActorPropertyByObject",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("StopActorIpo",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveActorPropertyByObject",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  elfStopActorIpo(arg1);
   
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("RemoveActorPropertyByObject",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  result = (bool)elfRemoveActorPropertyByObject(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9189,20 +10490,20 @@ fail:
 }
 
 
-static int _wrap_elfPauseActorIpo(lua_State* L) {
+static int _wrap_elfRemoveActorProperties(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("PauseActorIpo",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("PauseActorIpo",1,"handle");
+  SWIG_check_num_args("RemoveActorProperties",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorProperties",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("PauseActorIpo",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveActorProperties",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  elfPauseActorIpo(arg1);
+  elfRemoveActorProperties(arg1);
   
   return SWIG_arg;
   
@@ -9214,20 +10515,23 @@ fail:
 }
 
 
-static int _wrap_elfResumeActorIpo(lua_State* L) {
+static int _wrap_elfSetActorSelected(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  bool arg2 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("ResumeActorIpo",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("ResumeActorIpo",1,"handle");
+  SWIG_check_num_args("SetActorSelected",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorSelected",1,"handle");
+  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetActorSelected",2,"bool");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("ResumeActorIpo",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetActorSelected",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  elfResumeActorIpo(arg1);
+  arg2 = (lua_toboolean(L, 2)!=0);
+  elfSetActorSelected(arg1,arg2);
   
   return SWIG_arg;
   
@@ -9239,22 +10543,22 @@ fail:
 }
 
 
-static int _wrap_elfGetActorIpoStart(lua_State* L) {
+static int _wrap_elfGetActorSelected(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  float result;
+  bool result;
   
-  SWIG_check_num_args("GetActorIpoStart",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorIpoStart",1,"handle");
+  SWIG_check_num_args("GetActorSelected",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorSelected",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorIpoStart",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorSelected",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetActorIpoStart(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  result = (bool)elfGetActorSelected(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9265,22 +10569,19 @@ fail:
 }
 
 
-static int _wrap_elfGetActorIpoEnd(lua_State* L) {
+static int _wrap_elfCreateCamera(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle *argp1 ;
-  float result;
-  
-  SWIG_check_num_args("GetActorIpoEnd",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorIpoEnd",1,"handle");
+  char *arg1 = (char *) 0 ;
+  elf_handle result;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorIpoEnd",1,SWIGTYPE_p_elf_handle);
+  SWIG_check_num_args("CreateCamera",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateCamera",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = elfCreateCamera((char const *)arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg1 = *argp1;
-  
-  result = (float)elfGetActorIpoEnd(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9291,22 +10592,33 @@ fail:
 }
 
 
-static int _wrap_elfGetActorIpoSpeed(lua_State* L) {
+static int _wrap_elfSetCameraViewport(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
+  int arg3 ;
+  int arg4 ;
+  int arg5 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetActorIpoSpeed",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorIpoSpeed",1,"handle");
+  SWIG_check_num_args("SetCameraViewport",5,5)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetCameraViewport",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetCameraViewport",2,"int");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetCameraViewport",3,"int");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetCameraViewport",4,"int");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetCameraViewport",5,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorIpoSpeed",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetCameraViewport",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetActorIpoSpeed(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  arg3 = (int)lua_tonumber(L, 3);
+  arg4 = (int)lua_tonumber(L, 4);
+  arg5 = (int)lua_tonumber(L, 5);
+  elfSetCameraViewport(arg1,arg2,arg3,arg4,arg5);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9317,22 +10629,33 @@ fail:
 }
 
 
-static int _wrap_elfGetActorIpoFrame(lua_State* L) {
+static int _wrap_elfSetCameraPerspective(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetActorIpoFrame",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorIpoFrame",1,"handle");
+  SWIG_check_num_args("SetCameraPerspective",5,5)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetCameraPerspective",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetCameraPerspective",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetCameraPerspective",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetCameraPerspective",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetCameraPerspective",5,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorIpoFrame",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetCameraPerspective",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetActorIpoFrame(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  elfSetCameraPerspective(arg1,arg2,arg3,arg4,arg5);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9343,22 +10666,39 @@ fail:
 }
 
 
-static int _wrap_elfIsActorIpoPlaying(lua_State* L) {
+static int _wrap_elfSetCameraOrthographic(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
+  int arg3 ;
+  int arg4 ;
+  int arg5 ;
+  float arg6 ;
+  float arg7 ;
   elf_handle *argp1 ;
-  bool result;
   
-  SWIG_check_num_args("IsActorIpoPlaying",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsActorIpoPlaying",1,"handle");
+  SWIG_check_num_args("SetCameraOrthographic",7,7)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetCameraOrthographic",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetCameraOrthographic",2,"int");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetCameraOrthographic",3,"int");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetCameraOrthographic",4,"int");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetCameraOrthographic",5,"int");
+  if(!lua_isnumber(L,6)) SWIG_fail_arg("SetCameraOrthographic",6,"float");
+  if(!lua_isnumber(L,7)) SWIG_fail_arg("SetCameraOrthographic",7,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("IsActorIpoPlaying",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetCameraOrthographic",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfIsActorIpoPlaying(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  arg3 = (int)lua_tonumber(L, 3);
+  arg4 = (int)lua_tonumber(L, 4);
+  arg5 = (int)lua_tonumber(L, 5);
+  arg6 = (float)lua_tonumber(L, 6);
+  arg7 = (float)lua_tonumber(L, 7);
+  elfSetCameraOrthographic(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9369,22 +10709,25 @@ fail:
 }
 
 
-static int _wrap_elfIsActorIpoPaused(lua_State* L) {
+static int _wrap_elfGetCameraViewportSize(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  bool result;
+  elf_vec2i result;
   
-  SWIG_check_num_args("IsActorIpoPaused",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsActorIpoPaused",1,"handle");
+  SWIG_check_num_args("GetCameraViewportSize",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraViewportSize",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("IsActorIpoPaused",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetCameraViewportSize",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfIsActorIpoPaused(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = elfGetCameraViewportSize(arg1);
+  {
+    elf_vec2i * resultptr = new elf_vec2i((const elf_vec2i &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec2i,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9395,22 +10738,25 @@ fail:
 }
 
 
-static int _wrap_elfGetActorCollisionCount(lua_State* L) {
+static int _wrap_elfGetCameraViewportOffset(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  int result;
+  elf_vec2i result;
   
-  SWIG_check_num_args("GetActorCollisionCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorCollisionCount",1,"handle");
+  SWIG_check_num_args("GetCameraViewportOffset",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraViewportOffset",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorCollisionCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetCameraViewportOffset",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetActorCollisionCount(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  result = elfGetCameraViewportOffset(arg1);
+  {
+    elf_vec2i * resultptr = new elf_vec2i((const elf_vec2i &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec2i,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9421,28 +10767,22 @@ fail:
 }
 
 
-static int _wrap_elfGetActorCollision(lua_State* L) {
+static int _wrap_elfGetCameraFov(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  float result;
   
-  SWIG_check_num_args("GetActorCollision",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorCollision",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetActorCollision",2,"int");
+  SWIG_check_num_args("GetCameraFov",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraFov",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorCollision",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetCameraFov",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = elfGetActorCollision(arg1,arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (float)elfGetCameraFov(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9453,21 +10793,21 @@ fail:
 }
 
 
-static int _wrap_elfGetActorPropertyCount(lua_State* L) {
+static int _wrap_elfGetCameraAspect(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  int result;
+  float result;
   
-  SWIG_check_num_args("GetActorPropertyCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorPropertyCount",1,"handle");
+  SWIG_check_num_args("GetCameraAspect",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraAspect",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorPropertyCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetCameraAspect",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetActorPropertyCount(arg1);
+  result = (float)elfGetCameraAspect(arg1);
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -9479,30 +10819,25 @@ fail:
 }
 
 
-static int _wrap_elfAddPropertyToActor(lua_State* L) {
+static int _wrap_elfGetCameraClip(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  elf_vec2f result;
   
-  SWIG_check_num_args("AddPropertyToActor",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddPropertyToActor",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddPropertyToActor",2,"handle");
+  SWIG_check_num_args("GetCameraClip",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraClip",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddPropertyToActor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetCameraClip",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddPropertyToActor",2,SWIGTYPE_p_elf_handle);
+  result = elfGetCameraClip(arg1);
+  {
+    elf_vec2f * resultptr = new elf_vec2f((const elf_vec2f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec2f,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  elfAddPropertyToActor(arg1,arg2);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9513,27 +10848,24 @@ fail:
 }
 
 
-static int _wrap_elfGetActorPropertyByName(lua_State* L) {
+static int _wrap_elfGetCameraFarPlaneSize(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  elf_vec2f result;
   
-  SWIG_check_num_args("GetActorPropertyByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorPropertyByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetActorPropertyByName",2,"char const *");
+  SWIG_check_num_args("GetCameraFarPlaneSize",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraFarPlaneSize",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorPropertyByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetCameraFarPlaneSize",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetActorPropertyByName(arg1,(char const *)arg2);
+  result = elfGetCameraFarPlaneSize(arg1);
   {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+    elf_vec2f * resultptr = new elf_vec2f((const elf_vec2f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec2f,1); SWIG_arg++;
   }
   return SWIG_arg;
   
@@ -9545,27 +10877,33 @@ fail:
 }
 
 
-static int _wrap_elfGetActorPropertyByIndex(lua_State* L) {
+static int _wrap_elfUnProjectCameraPoint(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  elf_vec3f result;
   
-  SWIG_check_num_args("GetActorPropertyByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorPropertyByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetActorPropertyByIndex",2,"int");
+  SWIG_check_num_args("UnProjectCameraPoint",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("UnProjectCameraPoint",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("UnProjectCameraPoint",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("UnProjectCameraPoint",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("UnProjectCameraPoint",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorPropertyByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("UnProjectCameraPoint",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = elfGetActorPropertyByIndex(arg1,arg2);
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  result = elfUnProjectCameraPoint(arg1,arg2,arg3,arg4);
   {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
   }
   return SWIG_arg;
   
@@ -9577,25 +10915,22 @@ fail:
 }
 
 
-static int _wrap_elfRemoveActorPropertyByName(lua_State* L) {
+static int _wrap_elfGetModelName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  bool result;
+  char *result = 0 ;
   
-  SWIG_check_num_args("RemoveActorPropertyByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorPropertyByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveActorPropertyByName",2,"char const *");
+  SWIG_check_num_args("GetModelName",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelName",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveActorPropertyByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetModelName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = (bool)elfRemoveActorPropertyByName(arg1,(char const *)arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = (char *)elfGetModelName(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9606,25 +10941,22 @@ fail:
 }
 
 
-static int _wrap_elfRemoveActorPropertyByIndex(lua_State* L) {
+static int _wrap_elfGetModelFilePath(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
   elf_handle *argp1 ;
-  bool result;
+  char *result = 0 ;
   
-  SWIG_check_num_args("RemoveActorPropertyByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorPropertyByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveActorPropertyByIndex",2,"int");
+  SWIG_check_num_args("GetModelFilePath",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelFilePath",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveActorPropertyByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetModelFilePath",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = (bool)elfRemoveActorPropertyByIndex(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = (char *)elfGetModelFilePath(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9635,31 +10967,22 @@ fail:
 }
 
 
-static int _wrap_elfRemoveActorPropertyByObject(lua_State* L) {
+static int _wrap_elfGetModelVerticeCount(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
-  bool result;
+  int result;
   
-  SWIG_check_num_args("RemoveActorPropertyByObject",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorPropertyByObject",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveActorPropertyByObject",2,"handle");
+  SWIG_check_num_args("GetModelVerticeCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelVerticeCount",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveActorPropertyByObject",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetModelVerticeCount",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveActorPropertyByObject",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
-  
-  result = (bool)elfRemoveActorPropertyByObject(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = (int)elfGetModelVerticeCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9670,21 +10993,22 @@ fail:
 }
 
 
-static int _wrap_elfRemoveActorProperties(lua_State* L) {
+static int _wrap_elfGetModelIndiceCount(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
+  int result;
   
-  SWIG_check_num_args("RemoveActorProperties",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorProperties",1,"handle");
+  SWIG_check_num_args("GetModelIndiceCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelIndiceCount",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveActorProperties",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetModelIndiceCount",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  elfRemoveActorProperties(arg1);
-  
+  result = (int)elfGetModelIndiceCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9695,24 +11019,25 @@ fail:
 }
 
 
-static int _wrap_elfSetActorSelected(lua_State* L) {
+static int _wrap_elfGetModelBoundingBoxMin(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  bool arg2 ;
   elf_handle *argp1 ;
+  elf_vec3f result;
   
-  SWIG_check_num_args("SetActorSelected",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetActorSelected",1,"handle");
-  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetActorSelected",2,"bool");
+  SWIG_check_num_args("GetModelBoundingBoxMin",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelBoundingBoxMin",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetActorSelected",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetModelBoundingBoxMin",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (lua_toboolean(L, 2)!=0);
-  elfSetActorSelected(arg1,arg2);
-  
+  result = elfGetModelBoundingBoxMin(arg1);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9723,22 +11048,25 @@ fail:
 }
 
 
-static int _wrap_elfGetActorSelected(lua_State* L) {
+static int _wrap_elfGetModelBoundingBoxMax(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  bool result;
+  elf_vec3f result;
   
-  SWIG_check_num_args("GetActorSelected",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorSelected",1,"handle");
+  SWIG_check_num_args("GetModelBoundingBoxMax",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelBoundingBoxMax",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorSelected",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetModelBoundingBoxMax",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfGetActorSelected(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = elfGetModelBoundingBoxMax(arg1);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9749,15 +11077,15 @@ fail:
 }
 
 
-static int _wrap_elfCreateCamera(lua_State* L) {
+static int _wrap_elfCreateEntity(lua_State* L) {
   int SWIG_arg = 0;
   char *arg1 = (char *) 0 ;
   elf_handle result;
   
-  SWIG_check_num_args("CreateCamera",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateCamera",1,"char const *");
+  SWIG_check_num_args("CreateEntity",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateEntity",1,"char const *");
   arg1 = (char *)lua_tostring(L, 1);
-  result = elfCreateCamera((char const *)arg1);
+  result = elfCreateEntity((char const *)arg1);
   {
     elf_handle * resultptr = new elf_handle((const elf_handle &) result);
     SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
@@ -9772,32 +11100,29 @@ fail:
 }
 
 
-static int _wrap_elfSetCameraViewport(lua_State* L) {
+static int _wrap_elfSetEntityScale(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
-  int arg3 ;
-  int arg4 ;
-  int arg5 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetCameraViewport",5,5)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetCameraViewport",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetCameraViewport",2,"int");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetCameraViewport",3,"int");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetCameraViewport",4,"int");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetCameraViewport",5,"int");
+  SWIG_check_num_args("SetEntityScale",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityScale",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetEntityScale",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetEntityScale",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetEntityScale",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetCameraViewport",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetEntityScale",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  arg3 = (int)lua_tonumber(L, 3);
-  arg4 = (int)lua_tonumber(L, 4);
-  arg5 = (int)lua_tonumber(L, 5);
-  elfSetCameraViewport(arg1,arg2,arg3,arg4,arg5);
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetEntityScale(arg1,arg2,arg3,arg4);
   
   return SWIG_arg;
   
@@ -9809,33 +11134,25 @@ fail:
 }
 
 
-static int _wrap_elfSetCameraPerspective(lua_State* L) {
+static int _wrap_elfGetEntityScale(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
-  float arg5 ;
   elf_handle *argp1 ;
+  elf_vec3f result;
   
-  SWIG_check_num_args("SetCameraPerspective",5,5)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetCameraPerspective",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetCameraPerspective",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetCameraPerspective",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetCameraPerspective",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetCameraPerspective",5,"float");
+  SWIG_check_num_args("GetEntityScale",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityScale",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetCameraPerspective",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetEntityScale",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  elfSetCameraPerspective(arg1,arg2,arg3,arg4,arg5);
-  
+  result = elfGetEntityScale(arg1);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9846,38 +11163,29 @@ fail:
 }
 
 
-static int _wrap_elfSetCameraOrthographic(lua_State* L) {
+static int _wrap_elfSetEntityModel(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
-  int arg3 ;
-  int arg4 ;
-  int arg5 ;
-  float arg6 ;
-  float arg7 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("SetCameraOrthographic",7,7)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetCameraOrthographic",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetCameraOrthographic",2,"int");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetCameraOrthographic",3,"int");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetCameraOrthographic",4,"int");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetCameraOrthographic",5,"int");
-  if(!lua_isnumber(L,6)) SWIG_fail_arg("SetCameraOrthographic",6,"float");
-  if(!lua_isnumber(L,7)) SWIG_fail_arg("SetCameraOrthographic",7,"float");
+  SWIG_check_num_args("SetEntityModel",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityModel",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetEntityModel",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetCameraOrthographic",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetEntityModel",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  arg3 = (int)lua_tonumber(L, 3);
-  arg4 = (int)lua_tonumber(L, 4);
-  arg5 = (int)lua_tonumber(L, 5);
-  arg6 = (float)lua_tonumber(L, 6);
-  arg7 = (float)lua_tonumber(L, 7);
-  elfSetCameraOrthographic(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetEntityModel",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfSetEntityModel(arg1,arg2);
   
   return SWIG_arg;
   
@@ -9889,25 +11197,51 @@ fail:
 }
 
 
-static int _wrap_elfGetCameraViewportSize(lua_State* L) {
+static int _wrap_elfGetEntityModel(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec2i result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetCameraViewportSize",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraViewportSize",1,"handle");
+  SWIG_check_num_args("GetEntityModel",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityModel",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetEntityModel",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = elfGetEntityModel(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetEntityMaterialCount(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  int result;
+  
+  SWIG_check_num_args("GetEntityMaterialCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityMaterialCount",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetCameraViewportSize",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetEntityMaterialCount",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetCameraViewportSize(arg1);
-  {
-    elf_vec2i * resultptr = new elf_vec2i((const elf_vec2i &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec2i,1); SWIG_arg++;
-  }
+  result = (int)elfGetEntityMaterialCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9918,25 +11252,30 @@ fail:
 }
 
 
-static int _wrap_elfGetCameraViewportOffset(lua_State* L) {
+static int _wrap_elfAddEntityMaterial(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_vec2i result;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("GetCameraViewportOffset",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraViewportOffset",1,"handle");
+  SWIG_check_num_args("AddEntityMaterial",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddEntityMaterial",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddEntityMaterial",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetCameraViewportOffset",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddEntityMaterial",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetCameraViewportOffset(arg1);
-  {
-    elf_vec2i * resultptr = new elf_vec2i((const elf_vec2i &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec2i,1); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("AddEntityMaterial",2,SWIGTYPE_p_elf_handle);
   }
+  arg2 = *argp2;
+  
+  elfAddEntityMaterial(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9947,22 +11286,33 @@ fail:
 }
 
 
-static int _wrap_elfGetCameraFov(lua_State* L) {
+static int _wrap_elfSetEntityMaterial(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
+  elf_handle arg3 ;
   elf_handle *argp1 ;
-  float result;
+  elf_handle *argp3 ;
   
-  SWIG_check_num_args("GetCameraFov",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraFov",1,"handle");
+  SWIG_check_num_args("SetEntityMaterial",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityMaterial",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetEntityMaterial",2,"int");
+  if(!lua_isuserdata(L,3)) SWIG_fail_arg("SetEntityMaterial",3,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetCameraFov",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetEntityMaterial",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetCameraFov(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,3,(void**)&argp3,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetEntityMaterial",3,SWIGTYPE_p_elf_handle);
+  }
+  arg3 = *argp3;
+  
+  elfSetEntityMaterial(arg1,arg2,arg3);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9973,22 +11323,28 @@ fail:
 }
 
 
-static int _wrap_elfGetCameraAspect(lua_State* L) {
+static int _wrap_elfGetEntityMaterial(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  float result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetCameraAspect",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraAspect",1,"handle");
+  SWIG_check_num_args("GetEntityMaterial",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityMaterial",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetEntityMaterial",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetCameraAspect",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetEntityMaterial",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetCameraAspect(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  result = elfGetEntityMaterial(arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -9999,25 +11355,24 @@ fail:
 }
 
 
-static int _wrap_elfGetCameraClip(lua_State* L) {
+static int _wrap_elfSetEntityVisible(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  bool arg2 ;
   elf_handle *argp1 ;
-  elf_vec2f result;
   
-  SWIG_check_num_args("GetCameraClip",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraClip",1,"handle");
+  SWIG_check_num_args("SetEntityVisible",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityVisible",1,"handle");
+  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetEntityVisible",2,"bool");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetCameraClip",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetEntityVisible",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetCameraClip(arg1);
-  {
-    elf_vec2f * resultptr = new elf_vec2f((const elf_vec2f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec2f,1); SWIG_arg++;
-  }
+  arg2 = (lua_toboolean(L, 2)!=0);
+  elfSetEntityVisible(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10028,25 +11383,22 @@ fail:
 }
 
 
-static int _wrap_elfGetCameraFarPlaneSize(lua_State* L) {
+static int _wrap_elfGetEntityVisible(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec2f result;
+  bool result;
   
-  SWIG_check_num_args("GetCameraFarPlaneSize",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraFarPlaneSize",1,"handle");
+  SWIG_check_num_args("GetEntityVisible",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityVisible",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetCameraFarPlaneSize",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetEntityVisible",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetCameraFarPlaneSize(arg1);
-  {
-    elf_vec2f * resultptr = new elf_vec2f((const elf_vec2f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec2f,1); SWIG_arg++;
-  }
+  result = (bool)elfGetEntityVisible(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10057,34 +11409,27 @@ fail:
 }
 
 
-static int _wrap_elfUnProjectCameraPoint(lua_State* L) {
+static int _wrap_elfSetEntityPhysics(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
+  int arg2 ;
   float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
   
-  SWIG_check_num_args("UnProjectCameraPoint",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("UnProjectCameraPoint",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("UnProjectCameraPoint",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("UnProjectCameraPoint",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("UnProjectCameraPoint",4,"float");
+  SWIG_check_num_args("SetEntityPhysics",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityPhysics",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetEntityPhysics",2,"int");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetEntityPhysics",3,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("UnProjectCameraPoint",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetEntityPhysics",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
+  arg2 = (int)lua_tonumber(L, 2);
   arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  result = elfUnProjectCameraPoint(arg1,arg2,arg3,arg4);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  elfSetEntityPhysics(arg1,arg2,arg3);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10095,22 +11440,21 @@ fail:
 }
 
 
-static int _wrap_elfGetModelName(lua_State* L) {
+static int _wrap_elfDisableEntityPhysics(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  char *result = 0 ;
   
-  SWIG_check_num_args("GetModelName",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelName",1,"handle");
+  SWIG_check_num_args("DisableEntityPhysics",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("DisableEntityPhysics",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetModelName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("DisableEntityPhysics",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetModelName(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  elfDisableEntityPhysics(arg1);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10121,22 +11465,30 @@ fail:
 }
 
 
-static int _wrap_elfGetModelFilePath(lua_State* L) {
+static int _wrap_elfSetEntityArmature(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  char *result = 0 ;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("GetModelFilePath",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelFilePath",1,"handle");
+  SWIG_check_num_args("SetEntityArmature",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityArmature",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetEntityArmature",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetModelFilePath",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetEntityArmature",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetModelFilePath(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetEntityArmature",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfSetEntityArmature(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10147,22 +11499,24 @@ fail:
 }
 
 
-static int _wrap_elfGetModelVerticeCount(lua_State* L) {
+static int _wrap_elfSetEntityArmatureFrame(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
   elf_handle *argp1 ;
-  int result;
   
-  SWIG_check_num_args("GetModelVerticeCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelVerticeCount",1,"handle");
+  SWIG_check_num_args("SetEntityArmatureFrame",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityArmatureFrame",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetEntityArmatureFrame",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetModelVerticeCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetEntityArmatureFrame",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetModelVerticeCount(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  elfSetEntityArmatureFrame(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10173,22 +11527,30 @@ fail:
 }
 
 
-static int _wrap_elfGetModelIndiceCount(lua_State* L) {
+static int _wrap_elfPlayEntityArmature(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  int result;
   
-  SWIG_check_num_args("GetModelIndiceCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelIndiceCount",1,"handle");
+  SWIG_check_num_args("PlayEntityArmature",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("PlayEntityArmature",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("PlayEntityArmature",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("PlayEntityArmature",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("PlayEntityArmature",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetModelIndiceCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("PlayEntityArmature",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetModelIndiceCount(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfPlayEntityArmature(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10199,25 +11561,30 @@ fail:
 }
 
 
-static int _wrap_elfGetModelBoundingBoxMin(lua_State* L) {
+static int _wrap_elfLoopEntityArmature(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
   
-  SWIG_check_num_args("GetModelBoundingBoxMin",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelBoundingBoxMin",1,"handle");
+  SWIG_check_num_args("LoopEntityArmature",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("LoopEntityArmature",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("LoopEntityArmature",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("LoopEntityArmature",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("LoopEntityArmature",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetModelBoundingBoxMin",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("LoopEntityArmature",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetModelBoundingBoxMin(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfLoopEntityArmature(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10228,25 +11595,21 @@ fail:
 }
 
 
-static int _wrap_elfGetModelBoundingBoxMax(lua_State* L) {
+static int _wrap_elfStopEntityArmature(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
   
-  SWIG_check_num_args("GetModelBoundingBoxMax",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelBoundingBoxMax",1,"handle");
+  SWIG_check_num_args("StopEntityArmature",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("StopEntityArmature",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetModelBoundingBoxMax",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("StopEntityArmature",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetModelBoundingBoxMax(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  elfStopEntityArmature(arg1);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10257,19 +11620,21 @@ fail:
 }
 
 
-static int _wrap_elfCreateEntity(lua_State* L) {
+static int _wrap_elfPauseEntityArmature(lua_State* L) {
   int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  elf_handle result;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
   
-  SWIG_check_num_args("CreateEntity",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateEntity",1,"char const *");
-  arg1 = (char *)lua_tostring(L, 1);
-  result = elfCreateEntity((char const *)arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  SWIG_check_num_args("PauseEntityArmature",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("PauseEntityArmature",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("PauseEntityArmature",1,SWIGTYPE_p_elf_handle);
   }
+  arg1 = *argp1;
+  
+  elfPauseEntityArmature(arg1);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10280,29 +11645,20 @@ fail:
 }
 
 
-static int _wrap_elfSetEntityScale(lua_State* L) {
+static int _wrap_elfResumeEntityArmature(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetEntityScale",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityScale",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetEntityScale",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetEntityScale",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetEntityScale",4,"float");
+  SWIG_check_num_args("ResumeEntityArmature",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("ResumeEntityArmature",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetEntityScale",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("ResumeEntityArmature",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetEntityScale(arg1,arg2,arg3,arg4);
+  elfResumeEntityArmature(arg1);
   
   return SWIG_arg;
   
@@ -10314,25 +11670,22 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityScale(lua_State* L) {
+static int _wrap_elfGetEntityArmatureStart(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
+  float result;
   
-  SWIG_check_num_args("GetEntityScale",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityScale",1,"handle");
+  SWIG_check_num_args("GetEntityArmatureStart",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityArmatureStart",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityScale",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetEntityArmatureStart",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetEntityScale(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  result = (float)elfGetEntityArmatureStart(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10343,30 +11696,22 @@ fail:
 }
 
 
-static int _wrap_elfSetEntityModel(lua_State* L) {
+static int _wrap_elfGetEntityArmatureEnd(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  float result;
   
-  SWIG_check_num_args("SetEntityModel",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityModel",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetEntityModel",2,"handle");
+  SWIG_check_num_args("GetEntityArmatureEnd",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityArmatureEnd",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetEntityModel",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetEntityArmatureEnd",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetEntityModel",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
-  
-  elfSetEntityModel(arg1,arg2);
-  
+  result = (float)elfGetEntityArmatureEnd(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10377,25 +11722,22 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityModel(lua_State* L) {
+static int _wrap_elfGetEntityArmatureSpeed(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  float result;
   
-  SWIG_check_num_args("GetEntityModel",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityModel",1,"handle");
+  SWIG_check_num_args("GetEntityArmatureSpeed",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityArmatureSpeed",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityModel",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetEntityArmatureSpeed",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetEntityModel(arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (float)elfGetEntityArmatureSpeed(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10406,21 +11748,21 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityMaterialCount(lua_State* L) {
+static int _wrap_elfGetEntityArmatureFrame(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  int result;
+  float result;
   
-  SWIG_check_num_args("GetEntityMaterialCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityMaterialCount",1,"handle");
+  SWIG_check_num_args("GetEntityArmatureFrame",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityArmatureFrame",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityMaterialCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetEntityArmatureFrame",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetEntityMaterialCount(arg1);
+  result = (float)elfGetEntityArmatureFrame(arg1);
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -10432,30 +11774,22 @@ fail:
 }
 
 
-static int _wrap_elfAddEntityMaterial(lua_State* L) {
+static int _wrap_elfIsEntityArmaturePlaying(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  bool result;
   
-  SWIG_check_num_args("AddEntityMaterial",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddEntityMaterial",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddEntityMaterial",2,"handle");
+  SWIG_check_num_args("IsEntityArmaturePlaying",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsEntityArmaturePlaying",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddEntityMaterial",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("IsEntityArmaturePlaying",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddEntityMaterial",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
-  
-  elfAddEntityMaterial(arg1,arg2);
-  
+  result = (bool)elfIsEntityArmaturePlaying(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10466,33 +11800,22 @@ fail:
 }
 
 
-static int _wrap_elfSetEntityMaterial(lua_State* L) {
+static int _wrap_elfIsEntityArmaturePaused(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
-  elf_handle arg3 ;
   elf_handle *argp1 ;
-  elf_handle *argp3 ;
+  bool result;
   
-  SWIG_check_num_args("SetEntityMaterial",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityMaterial",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetEntityMaterial",2,"int");
-  if(!lua_isuserdata(L,3)) SWIG_fail_arg("SetEntityMaterial",3,"handle");
+  SWIG_check_num_args("IsEntityArmaturePaused",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsEntityArmaturePaused",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetEntityMaterial",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("IsEntityArmaturePaused",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,3,(void**)&argp3,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetEntityMaterial",3,SWIGTYPE_p_elf_handle);
-  }
-  arg3 = *argp3;
-  
-  elfSetEntityMaterial(arg1,arg2,arg3);
-  
+  result = (bool)elfIsEntityArmaturePaused(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10503,24 +11826,21 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityMaterial(lua_State* L) {
+static int _wrap_elfGetEntityArmature(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
   elf_handle *argp1 ;
   elf_handle result;
   
-  SWIG_check_num_args("GetEntityMaterial",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityMaterial",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetEntityMaterial",2,"int");
+  SWIG_check_num_args("GetEntityArmature",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityArmature",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityMaterial",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetEntityArmature",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = elfGetEntityMaterial(arg1,arg2);
+  result = elfGetEntityArmature(arg1);
   {
     elf_handle * resultptr = new elf_handle((const elf_handle &) result);
     SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
@@ -10535,24 +11855,45 @@ fail:
 }
 
 
-static int _wrap_elfSetEntityVisible(lua_State* L) {
+static int _wrap_elfGetEntityChanged(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  bool arg2 ;
   elf_handle *argp1 ;
+  bool result;
   
-  SWIG_check_num_args("SetEntityVisible",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityVisible",1,"handle");
-  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetEntityVisible",2,"bool");
+  SWIG_check_num_args("GetEntityChanged",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityChanged",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetEntityVisible",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetEntityChanged",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (lua_toboolean(L, 2)!=0);
-  elfSetEntityVisible(arg1,arg2);
+  result = (bool)elfGetEntityChanged(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfCreateLight(lua_State* L) {
+  int SWIG_arg = 0;
+  char *arg1 = (char *) 0 ;
+  elf_handle result;
   
+  SWIG_check_num_args("CreateLight",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateLight",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = elfCreateLight((char const *)arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10563,22 +11904,22 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityVisible(lua_State* L) {
+static int _wrap_elfGetLightType(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  bool result;
+  int result;
   
-  SWIG_check_num_args("GetEntityVisible",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityVisible",1,"handle");
+  SWIG_check_num_args("GetLightType",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightType",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityVisible",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetLightType",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfGetEntityVisible(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = (int)elfGetLightType(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10589,27 +11930,25 @@ fail:
 }
 
 
-static int _wrap_elfSetEntityPhysics(lua_State* L) {
+static int _wrap_elfGetLightColor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
-  float arg3 ;
   elf_handle *argp1 ;
+  elf_color result;
   
-  SWIG_check_num_args("SetEntityPhysics",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityPhysics",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetEntityPhysics",2,"int");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetEntityPhysics",3,"float");
+  SWIG_check_num_args("GetLightColor",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightColor",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetEntityPhysics",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetLightColor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  elfSetEntityPhysics(arg1,arg2,arg3);
-  
+  result = elfGetLightColor(arg1);
+  {
+    elf_color * resultptr = new elf_color((const elf_color &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10620,21 +11959,22 @@ fail:
 }
 
 
-static int _wrap_elfDisableEntityPhysics(lua_State* L) {
+static int _wrap_elfGetLightDistance(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("DisableEntityPhysics",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("DisableEntityPhysics",1,"handle");
+  SWIG_check_num_args("GetLightDistance",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightDistance",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("DisableEntityPhysics",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetLightDistance",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  elfDisableEntityPhysics(arg1);
-  
+  result = (float)elfGetLightDistance(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10645,30 +11985,22 @@ fail:
 }
 
 
-static int _wrap_elfSetEntityArmature(lua_State* L) {
+static int _wrap_elfGetLightFadeSpeed(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  float result;
   
-  SWIG_check_num_args("SetEntityArmature",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityArmature",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetEntityArmature",2,"handle");
+  SWIG_check_num_args("GetLightFadeSpeed",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightFadeSpeed",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetEntityArmature",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetLightFadeSpeed",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetEntityArmature",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
-  
-  elfSetEntityArmature(arg1,arg2);
-  
+  result = (float)elfGetLightFadeSpeed(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10679,24 +12011,22 @@ fail:
 }
 
 
-static int _wrap_elfSetEntityArmatureFrame(lua_State* L) {
+static int _wrap_elfGetLightShadowCaster(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
   elf_handle *argp1 ;
+  bool result;
   
-  SWIG_check_num_args("SetEntityArmatureFrame",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetEntityArmatureFrame",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetEntityArmatureFrame",2,"float");
+  SWIG_check_num_args("GetLightShadowCaster",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightShadowCaster",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetEntityArmatureFrame",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetLightShadowCaster",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  elfSetEntityArmatureFrame(arg1,arg2);
-  
+  result = (bool)elfGetLightShadowCaster(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10707,30 +12037,22 @@ fail:
 }
 
 
-static int _wrap_elfPlayEntityArmature(lua_State* L) {
+static int _wrap_elfGetLightVisible(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  bool result;
   
-  SWIG_check_num_args("PlayEntityArmature",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("PlayEntityArmature",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("PlayEntityArmature",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("PlayEntityArmature",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("PlayEntityArmature",4,"float");
+  SWIG_check_num_args("GetLightVisible",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightVisible",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("PlayEntityArmature",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetLightVisible",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfPlayEntityArmature(arg1,arg2,arg3,arg4);
-  
+  result = (bool)elfGetLightVisible(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10741,30 +12063,25 @@ fail:
 }
 
 
-static int _wrap_elfLoopEntityArmature(lua_State* L) {
+static int _wrap_elfGetLightCone(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  elf_vec2f result;
   
-  SWIG_check_num_args("LoopEntityArmature",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("LoopEntityArmature",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("LoopEntityArmature",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("LoopEntityArmature",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("LoopEntityArmature",4,"float");
+  SWIG_check_num_args("GetLightCone",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightCone",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("LoopEntityArmature",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetLightCone",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfLoopEntityArmature(arg1,arg2,arg3,arg4);
-  
+  result = elfGetLightCone(arg1);
+  {
+    elf_vec2f * resultptr = new elf_vec2f((const elf_vec2f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec2f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10775,21 +12092,22 @@ fail:
 }
 
 
-static int _wrap_elfStopEntityArmature(lua_State* L) {
+static int _wrap_elfIsLightShaft(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
+  bool result;
   
-  SWIG_check_num_args("StopEntityArmature",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("StopEntityArmature",1,"handle");
+  SWIG_check_num_args("IsLightShaft",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsLightShaft",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("StopEntityArmature",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("IsLightShaft",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  elfStopEntityArmature(arg1);
-  
+  result = (bool)elfIsLightShaft(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10800,21 +12118,22 @@ fail:
 }
 
 
-static int _wrap_elfPauseEntityArmature(lua_State* L) {
+static int _wrap_elfGetLightShaftSize(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("PauseEntityArmature",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("PauseEntityArmature",1,"handle");
+  SWIG_check_num_args("GetLightShaftSize",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightShaftSize",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("PauseEntityArmature",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetLightShaftSize",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  elfPauseEntityArmature(arg1);
-  
+  result = (float)elfGetLightShaftSize(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10825,21 +12144,22 @@ fail:
 }
 
 
-static int _wrap_elfResumeEntityArmature(lua_State* L) {
+static int _wrap_elfGetLightShaftIntensity(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("ResumeEntityArmature",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("ResumeEntityArmature",1,"handle");
+  SWIG_check_num_args("GetLightShaftIntensity",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightShaftIntensity",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("ResumeEntityArmature",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetLightShaftIntensity",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  elfResumeEntityArmature(arg1);
-  
+  result = (float)elfGetLightShaftIntensity(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10850,21 +12170,21 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityArmatureStart(lua_State* L) {
+static int _wrap_elfGetLightShaftFadeOff(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
   float result;
   
-  SWIG_check_num_args("GetEntityArmatureStart",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityArmatureStart",1,"handle");
+  SWIG_check_num_args("GetLightShaftFadeOff",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightShaftFadeOff",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityArmatureStart",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetLightShaftFadeOff",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetEntityArmatureStart(arg1);
+  result = (float)elfGetLightShaftFadeOff(arg1);
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -10876,22 +12196,24 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityArmatureEnd(lua_State* L) {
+static int _wrap_elfSetLightType(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetEntityArmatureEnd",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityArmatureEnd",1,"handle");
+  SWIG_check_num_args("SetLightType",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightType",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetLightType",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityArmatureEnd",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetLightType",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetEntityArmatureEnd(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  elfSetLightType(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10902,22 +12224,33 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityArmatureSpeed(lua_State* L) {
+static int _wrap_elfSetLightColor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetEntityArmatureSpeed",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityArmatureSpeed",1,"handle");
+  SWIG_check_num_args("SetLightColor",5,5)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightColor",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetLightColor",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetLightColor",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetLightColor",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetLightColor",5,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityArmatureSpeed",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetLightColor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetEntityArmatureSpeed(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  elfSetLightColor(arg1,arg2,arg3,arg4,arg5);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10928,22 +12261,24 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityArmatureFrame(lua_State* L) {
+static int _wrap_elfSetLightDistance(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetEntityArmatureFrame",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityArmatureFrame",1,"handle");
+  SWIG_check_num_args("SetLightDistance",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightDistance",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetLightDistance",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityArmatureFrame",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetLightDistance",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetEntityArmatureFrame(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  elfSetLightDistance(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10954,22 +12289,24 @@ fail:
 }
 
 
-static int _wrap_elfIsEntityArmaturePlaying(lua_State* L) {
+static int _wrap_elfSetLightFadeSpeed(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
   elf_handle *argp1 ;
-  bool result;
   
-  SWIG_check_num_args("IsEntityArmaturePlaying",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsEntityArmaturePlaying",1,"handle");
+  SWIG_check_num_args("SetLightFadeSpeed",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightFadeSpeed",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetLightFadeSpeed",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("IsEntityArmaturePlaying",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetLightFadeSpeed",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfIsEntityArmaturePlaying(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  elfSetLightFadeSpeed(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -10980,22 +12317,24 @@ fail:
 }
 
 
-static int _wrap_elfIsEntityArmaturePaused(lua_State* L) {
+static int _wrap_elfSetLightShadowCaster(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  bool arg2 ;
   elf_handle *argp1 ;
-  bool result;
   
-  SWIG_check_num_args("IsEntityArmaturePaused",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsEntityArmaturePaused",1,"handle");
+  SWIG_check_num_args("SetLightShadowCaster",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightShadowCaster",1,"handle");
+  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetLightShadowCaster",2,"bool");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("IsEntityArmaturePaused",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetLightShadowCaster",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfIsEntityArmaturePaused(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  arg2 = (lua_toboolean(L, 2)!=0);
+  elfSetLightShadowCaster(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11006,25 +12345,24 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityArmature(lua_State* L) {
+static int _wrap_elfSetLightVisible(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  bool arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
   
-  SWIG_check_num_args("GetEntityArmature",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityArmature",1,"handle");
+  SWIG_check_num_args("SetLightVisible",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightVisible",1,"handle");
+  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetLightVisible",2,"bool");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityArmature",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetLightVisible",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetEntityArmature(arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (lua_toboolean(L, 2)!=0);
+  elfSetLightVisible(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11035,22 +12373,27 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityChanged(lua_State* L) {
+static int _wrap_elfSetLightCone(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
   elf_handle *argp1 ;
-  bool result;
   
-  SWIG_check_num_args("GetEntityChanged",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityChanged",1,"handle");
+  SWIG_check_num_args("SetLightCone",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightCone",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetLightCone",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetLightCone",3,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityChanged",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetLightCone",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfGetEntityChanged(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  elfSetLightCone(arg1,arg2,arg3);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11061,19 +12404,30 @@ fail:
 }
 
 
-static int _wrap_elfCreateLight(lua_State* L) {
+static int _wrap_elfSetLightShaft(lua_State* L) {
   int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  elf_handle result;
+  elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  elf_handle *argp1 ;
   
-  SWIG_check_num_args("CreateLight",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateLight",1,"char const *");
-  arg1 = (char *)lua_tostring(L, 1);
-  result = elfCreateLight((char const *)arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  SWIG_check_num_args("SetLightShaft",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightShaft",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetLightShaft",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetLightShaft",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetLightShaft",4,"float");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetLightShaft",1,SWIGTYPE_p_elf_handle);
   }
+  arg1 = *argp1;
+  
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetLightShaft(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11084,22 +12438,21 @@ fail:
 }
 
 
-static int _wrap_elfGetLightType(lua_State* L) {
+static int _wrap_elfDisableLightShaft(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  int result;
   
-  SWIG_check_num_args("GetLightType",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightType",1,"handle");
+  SWIG_check_num_args("DisableLightShaft",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("DisableLightShaft",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetLightType",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("DisableLightShaft",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetLightType(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  elfDisableLightShaft(arg1);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11110,24 +12463,24 @@ fail:
 }
 
 
-static int _wrap_elfGetLightColor(lua_State* L) {
+static int _wrap_elfGetBoneArmature(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_color result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetLightColor",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightColor",1,"handle");
+  SWIG_check_num_args("GetBoneArmature",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneArmature",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetLightColor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetBoneArmature",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetLightColor(arg1);
+  result = elfGetBoneArmature(arg1);
   {
-    elf_color * resultptr = new elf_color((const elf_color &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
   return SWIG_arg;
   
@@ -11139,22 +12492,25 @@ fail:
 }
 
 
-static int _wrap_elfGetLightDistance(lua_State* L) {
+static int _wrap_elfGetBoneParent(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  float result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetLightDistance",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightDistance",1,"handle");
+  SWIG_check_num_args("GetBoneParent",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneParent",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetLightDistance",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetBoneParent",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetLightDistance(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  result = elfGetBoneParent(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11165,22 +12521,28 @@ fail:
 }
 
 
-static int _wrap_elfGetLightFadeSpeed(lua_State* L) {
+static int _wrap_elfGetBoneChildByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  float result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetLightFadeSpeed",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightFadeSpeed",1,"handle");
+  SWIG_check_num_args("GetBoneChildByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneChildByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetBoneChildByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetLightFadeSpeed",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetBoneChildByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetLightFadeSpeed(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetBoneChildByName(arg1,(char const *)arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11191,22 +12553,28 @@ fail:
 }
 
 
-static int _wrap_elfGetLightShadowCaster(lua_State* L) {
+static int _wrap_elfGetBoneChildById(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  bool result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetLightShadowCaster",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightShadowCaster",1,"handle");
+  SWIG_check_num_args("GetBoneChildById",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneChildById",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetBoneChildById",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetLightShadowCaster",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetBoneChildById",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfGetLightShadowCaster(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  result = elfGetBoneChildById(arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11217,22 +12585,28 @@ fail:
 }
 
 
-static int _wrap_elfGetLightVisible(lua_State* L) {
+static int _wrap_elfGetBoneChildByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  bool result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetLightVisible",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightVisible",1,"handle");
+  SWIG_check_num_args("GetBoneChildByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneChildByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetBoneChildByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetLightVisible",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetBoneChildByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfGetLightVisible(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  result = elfGetBoneChildByIndex(arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11243,24 +12617,24 @@ fail:
 }
 
 
-static int _wrap_elfGetLightCone(lua_State* L) {
+static int _wrap_elfGetBonePosition(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec2f result;
+  elf_vec3f result;
   
-  SWIG_check_num_args("GetLightCone",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightCone",1,"handle");
+  SWIG_check_num_args("GetBonePosition",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBonePosition",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetLightCone",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetBonePosition",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetLightCone(arg1);
+  result = elfGetBonePosition(arg1);
   {
-    elf_vec2f * resultptr = new elf_vec2f((const elf_vec2f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec2f,1); SWIG_arg++;
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
   }
   return SWIG_arg;
   
@@ -11272,22 +12646,25 @@ fail:
 }
 
 
-static int _wrap_elfIsLightShaft(lua_State* L) {
+static int _wrap_elfGetBoneRotation(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  bool result;
+  elf_vec3f result;
   
-  SWIG_check_num_args("IsLightShaft",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsLightShaft",1,"handle");
+  SWIG_check_num_args("GetBoneRotation",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneRotation",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("IsLightShaft",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetBoneRotation",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfIsLightShaft(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = elfGetBoneRotation(arg1);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11298,22 +12675,25 @@ fail:
 }
 
 
-static int _wrap_elfGetLightShaftSize(lua_State* L) {
+static int _wrap_elfGetBoneOrientation(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  float result;
+  elf_vec4f result;
   
-  SWIG_check_num_args("GetLightShaftSize",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightShaftSize",1,"handle");
+  SWIG_check_num_args("GetBoneOrientation",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneOrientation",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetLightShaftSize",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetBoneOrientation",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetLightShaftSize(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  result = elfGetBoneOrientation(arg1);
+  {
+    elf_vec4f * resultptr = new elf_vec4f((const elf_vec4f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec4f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11324,22 +12704,19 @@ fail:
 }
 
 
-static int _wrap_elfGetLightShaftIntensity(lua_State* L) {
+static int _wrap_elfCreateArmature(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle *argp1 ;
-  float result;
-  
-  SWIG_check_num_args("GetLightShaftIntensity",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightShaftIntensity",1,"handle");
+  char *arg1 = (char *) 0 ;
+  elf_handle result;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetLightShaftIntensity",1,SWIGTYPE_p_elf_handle);
+  SWIG_check_num_args("CreateArmature",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateArmature",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = elfCreateArmature((char const *)arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg1 = *argp1;
-  
-  result = (float)elfGetLightShaftIntensity(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11350,22 +12727,28 @@ fail:
 }
 
 
-static int _wrap_elfGetLightShaftFadeOff(lua_State* L) {
+static int _wrap_elfGetBoneFromArmatureByName(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle *argp1 ;
-  float result;
+  char *arg1 = (char *) 0 ;
+  elf_handle arg2 ;
+  elf_handle *argp2 ;
+  elf_handle result;
   
-  SWIG_check_num_args("GetLightShaftFadeOff",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightShaftFadeOff",1,"handle");
+  SWIG_check_num_args("GetBoneFromArmatureByName",2,2)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("GetBoneFromArmatureByName",1,"char const *");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("GetBoneFromArmatureByName",2,"handle");
+  arg1 = (char *)lua_tostring(L, 1);
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetLightShaftFadeOff",1,SWIGTYPE_p_elf_handle);
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetBoneFromArmatureByName",2,SWIGTYPE_p_elf_handle);
   }
-  arg1 = *argp1;
+  arg2 = *argp2;
   
-  result = (float)elfGetLightShaftFadeOff(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  result = elfGetBoneFromArmatureByName((char const *)arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11376,24 +12759,28 @@ fail:
 }
 
 
-static int _wrap_elfSetLightType(lua_State* L) {
+static int _wrap_elfGetBoneFromArmatureById(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  int arg2 ;
-  elf_handle *argp1 ;
-  
-  SWIG_check_num_args("SetLightType",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightType",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetLightType",2,"int");
+  int arg1 ;
+  elf_handle arg2 ;
+  elf_handle *argp2 ;
+  elf_handle result;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetLightType",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
+  SWIG_check_num_args("GetBoneFromArmatureById",2,2)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("GetBoneFromArmatureById",1,"int");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("GetBoneFromArmatureById",2,"handle");
+  arg1 = (int)lua_tonumber(L, 1);
   
-  arg2 = (int)lua_tonumber(L, 2);
-  elfSetLightType(arg1,arg2);
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetBoneFromArmatureById",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
   
+  result = elfGetBoneFromArmatureById(arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11404,33 +12791,22 @@ fail:
 }
 
 
-static int _wrap_elfSetLightColor(lua_State* L) {
+static int _wrap_elfCreateParticles(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
-  float arg5 ;
-  elf_handle *argp1 ;
-  
-  SWIG_check_num_args("SetLightColor",5,5)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightColor",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetLightColor",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetLightColor",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetLightColor",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetLightColor",5,"float");
+  char *arg1 = (char *) 0 ;
+  int arg2 ;
+  elf_handle result;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetLightColor",1,SWIGTYPE_p_elf_handle);
+  SWIG_check_num_args("CreateParticles",2,2)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateParticles",1,"char const *");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("CreateParticles",2,"int");
+  arg1 = (char *)lua_tostring(L, 1);
+  arg2 = (int)lua_tonumber(L, 2);
+  result = elfCreateParticles((char const *)arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg1 = *argp1;
-  
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  elfSetLightColor(arg1,arg2,arg3,arg4,arg5);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11441,24 +12817,22 @@ fail:
 }
 
 
-static int _wrap_elfSetLightDistance(lua_State* L) {
+static int _wrap_elfGetParticlesName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
   elf_handle *argp1 ;
+  char *result = 0 ;
   
-  SWIG_check_num_args("SetLightDistance",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightDistance",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetLightDistance",2,"float");
+  SWIG_check_num_args("GetParticlesName",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesName",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetLightDistance",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  elfSetLightDistance(arg1,arg2);
-  
+  result = (char *)elfGetParticlesName(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11469,24 +12843,22 @@ fail:
 }
 
 
-static int _wrap_elfSetLightFadeSpeed(lua_State* L) {
+static int _wrap_elfGetParticlesFilePath(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
   elf_handle *argp1 ;
+  char *result = 0 ;
   
-  SWIG_check_num_args("SetLightFadeSpeed",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightFadeSpeed",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetLightFadeSpeed",2,"float");
+  SWIG_check_num_args("GetParticlesFilePath",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesFilePath",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetLightFadeSpeed",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesFilePath",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  elfSetLightFadeSpeed(arg1,arg2);
-  
+  result = (char *)elfGetParticlesFilePath(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11497,23 +12869,23 @@ fail:
 }
 
 
-static int _wrap_elfSetLightShadowCaster(lua_State* L) {
+static int _wrap_elfSetParticlesMaxCount(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  bool arg2 ;
+  int arg2 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetLightShadowCaster",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightShadowCaster",1,"handle");
-  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetLightShadowCaster",2,"bool");
+  SWIG_check_num_args("SetParticlesMaxCount",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesMaxCount",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesMaxCount",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetLightShadowCaster",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesMaxCount",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (lua_toboolean(L, 2)!=0);
-  elfSetLightShadowCaster(arg1,arg2);
+  arg2 = (int)lua_tonumber(L, 2);
+  elfSetParticlesMaxCount(arg1,arg2);
   
   return SWIG_arg;
   
@@ -11525,23 +12897,23 @@ fail:
 }
 
 
-static int _wrap_elfSetLightVisible(lua_State* L) {
+static int _wrap_elfSetParticlesDrawMode(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  bool arg2 ;
+  int arg2 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetLightVisible",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightVisible",1,"handle");
-  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetLightVisible",2,"bool");
+  SWIG_check_num_args("SetParticlesDrawMode",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesDrawMode",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesDrawMode",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetLightVisible",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesDrawMode",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (lua_toboolean(L, 2)!=0);
-  elfSetLightVisible(arg1,arg2);
+  arg2 = (int)lua_tonumber(L, 2);
+  elfSetParticlesDrawMode(arg1,arg2);
   
   return SWIG_arg;
   
@@ -11553,26 +12925,29 @@ fail:
 }
 
 
-static int _wrap_elfSetLightCone(lua_State* L) {
+static int _wrap_elfSetParticlesTexture(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("SetLightCone",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightCone",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetLightCone",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetLightCone",3,"float");
+  SWIG_check_num_args("SetParticlesTexture",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesTexture",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetParticlesTexture",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetLightCone",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesTexture",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  elfSetLightCone(arg1,arg2,arg3);
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetParticlesTexture",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfSetParticlesTexture(arg1,arg2);
   
   return SWIG_arg;
   
@@ -11584,29 +12959,29 @@ fail:
 }
 
 
-static int _wrap_elfSetLightShaft(lua_State* L) {
+static int _wrap_elfSetParticlesModel(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("SetLightShaft",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetLightShaft",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetLightShaft",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetLightShaft",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetLightShaft",4,"float");
+  SWIG_check_num_args("SetParticlesModel",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesModel",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetParticlesModel",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetLightShaft",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesModel",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetLightShaft(arg1,arg2,arg3,arg4);
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetParticlesModel",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfSetParticlesModel(arg1,arg2);
   
   return SWIG_arg;
   
@@ -11618,20 +12993,29 @@ fail:
 }
 
 
-static int _wrap_elfDisableLightShaft(lua_State* L) {
+static int _wrap_elfSetParticlesEntity(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("DisableLightShaft",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("DisableLightShaft",1,"handle");
+  SWIG_check_num_args("SetParticlesEntity",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesEntity",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetParticlesEntity",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("DisableLightShaft",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesEntity",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  elfDisableLightShaft(arg1);
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetParticlesEntity",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfSetParticlesEntity(arg1,arg2);
   
   return SWIG_arg;
   
@@ -11643,25 +13027,30 @@ fail:
 }
 
 
-static int _wrap_elfGetBoneArmature(lua_State* L) {
+static int _wrap_elfSetParticlesGravity(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  elf_handle result;
   
-  SWIG_check_num_args("GetBoneArmature",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneArmature",1,"handle");
+  SWIG_check_num_args("SetParticlesGravity",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesGravity",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesGravity",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesGravity",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesGravity",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetBoneArmature",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesGravity",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetBoneArmature(arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetParticlesGravity(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11672,25 +13061,24 @@ fail:
 }
 
 
-static int _wrap_elfGetBoneParent(lua_State* L) {
+static int _wrap_elfSetParticlesSpawnDelay(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
   
-  SWIG_check_num_args("GetBoneParent",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneParent",1,"handle");
+  SWIG_check_num_args("SetParticlesSpawnDelay",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesSpawnDelay",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesSpawnDelay",2,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetBoneParent",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesSpawnDelay",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetBoneParent(arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (float)lua_tonumber(L, 2);
+  elfSetParticlesSpawnDelay(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11701,28 +13089,24 @@ fail:
 }
 
 
-static int _wrap_elfGetBoneChildByName(lua_State* L) {
+static int _wrap_elfSetParticlesSpawn(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  bool arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
   
-  SWIG_check_num_args("GetBoneChildByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneChildByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetBoneChildByName",2,"char const *");
+  SWIG_check_num_args("SetParticlesSpawn",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesSpawn",1,"handle");
+  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetParticlesSpawn",2,"bool");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetBoneChildByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesSpawn",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetBoneChildByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (lua_toboolean(L, 2)!=0);
+  elfSetParticlesSpawn(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11733,28 +13117,24 @@ fail:
 }
 
 
-static int _wrap_elfGetBoneChildById(lua_State* L) {
+static int _wrap_elfSetParticlesRandomSeed(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   int arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
   
-  SWIG_check_num_args("GetBoneChildById",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneChildById",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetBoneChildById",2,"int");
+  SWIG_check_num_args("SetParticlesRandomSeed",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesRandomSeed",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesRandomSeed",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetBoneChildById",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesRandomSeed",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (int)lua_tonumber(L, 2);
-  result = elfGetBoneChildById(arg1,arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  elfSetParticlesRandomSeed(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11765,28 +13145,27 @@ fail:
 }
 
 
-static int _wrap_elfGetBoneChildByIndex(lua_State* L) {
+static int _wrap_elfSetParticlesSize(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
+  float arg2 ;
+  float arg3 ;
   elf_handle *argp1 ;
-  elf_handle result;
   
-  SWIG_check_num_args("GetBoneChildByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneChildByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetBoneChildByIndex",2,"int");
+  SWIG_check_num_args("SetParticlesSize",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesSize",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesSize",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesSize",3,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetBoneChildByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesSize",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = elfGetBoneChildByIndex(arg1,arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  elfSetParticlesSize(arg1,arg2,arg3);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11797,25 +13176,27 @@ fail:
 }
 
 
-static int _wrap_elfGetBonePosition(lua_State* L) {
+static int _wrap_elfSetParticlesSizeGrowth(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
   
-  SWIG_check_num_args("GetBonePosition",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBonePosition",1,"handle");
+  SWIG_check_num_args("SetParticlesSizeGrowth",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesSizeGrowth",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesSizeGrowth",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesSizeGrowth",3,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetBonePosition",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesSizeGrowth",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetBonePosition(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  elfSetParticlesSizeGrowth(arg1,arg2,arg3);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11826,25 +13207,27 @@ fail:
 }
 
 
-static int _wrap_elfGetBoneRotation(lua_State* L) {
+static int _wrap_elfSetParticlesRotation(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
   
-  SWIG_check_num_args("GetBoneRotation",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneRotation",1,"handle");
+  SWIG_check_num_args("SetParticlesRotation",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesRotation",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesRotation",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesRotation",3,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetBoneRotation",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesRotation",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetBoneRotation(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  elfSetParticlesRotation(arg1,arg2,arg3);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11855,25 +13238,27 @@ fail:
 }
 
 
-static int _wrap_elfGetBoneOrientation(lua_State* L) {
+static int _wrap_elfSetParticlesRotationGrowth(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
   elf_handle *argp1 ;
-  elf_vec4f result;
   
-  SWIG_check_num_args("GetBoneOrientation",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetBoneOrientation",1,"handle");
+  SWIG_check_num_args("SetParticlesRotationGrowth",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesRotationGrowth",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesRotationGrowth",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesRotationGrowth",3,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetBoneOrientation",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesRotationGrowth",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetBoneOrientation(arg1);
-  {
-    elf_vec4f * resultptr = new elf_vec4f((const elf_vec4f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec4f,1); SWIG_arg++;
-  }
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  elfSetParticlesRotationGrowth(arg1,arg2,arg3);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11884,19 +13269,27 @@ fail:
 }
 
 
-static int _wrap_elfCreateArmature(lua_State* L) {
+static int _wrap_elfSetParticlesLifeSpan(lua_State* L) {
   int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  elf_handle result;
+  elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  elf_handle *argp1 ;
   
-  SWIG_check_num_args("CreateArmature",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateArmature",1,"char const *");
-  arg1 = (char *)lua_tostring(L, 1);
-  result = elfCreateArmature((char const *)arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  SWIG_check_num_args("SetParticlesLifeSpan",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesLifeSpan",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesLifeSpan",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesLifeSpan",3,"float");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetParticlesLifeSpan",1,SWIGTYPE_p_elf_handle);
   }
+  arg1 = *argp1;
+  
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  elfSetParticlesLifeSpan(arg1,arg2,arg3);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11907,28 +13300,27 @@ fail:
 }
 
 
-static int _wrap_elfGetBoneFromArmatureByName(lua_State* L) {
+static int _wrap_elfSetParticlesFadeSpeed(lua_State* L) {
   int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  elf_handle arg2 ;
-  elf_handle *argp2 ;
-  elf_handle result;
+  elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  elf_handle *argp1 ;
   
-  SWIG_check_num_args("GetBoneFromArmatureByName",2,2)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("GetBoneFromArmatureByName",1,"char const *");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("GetBoneFromArmatureByName",2,"handle");
-  arg1 = (char *)lua_tostring(L, 1);
+  SWIG_check_num_args("SetParticlesFadeSpeed",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesFadeSpeed",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesFadeSpeed",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesFadeSpeed",3,"float");
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetBoneFromArmatureByName",2,SWIGTYPE_p_elf_handle);
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetParticlesFadeSpeed",1,SWIGTYPE_p_elf_handle);
   }
-  arg2 = *argp2;
+  arg1 = *argp1;
+  
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  elfSetParticlesFadeSpeed(arg1,arg2,arg3);
   
-  result = elfGetBoneFromArmatureByName((char const *)arg1,arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11939,28 +13331,30 @@ fail:
 }
 
 
-static int _wrap_elfGetBoneFromArmatureById(lua_State* L) {
+static int _wrap_elfSetParticlesPositionMin(lua_State* L) {
   int SWIG_arg = 0;
-  int arg1 ;
-  elf_handle arg2 ;
-  elf_handle *argp2 ;
-  elf_handle result;
+  elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  elf_handle *argp1 ;
   
-  SWIG_check_num_args("GetBoneFromArmatureById",2,2)
-  if(!lua_isnumber(L,1)) SWIG_fail_arg("GetBoneFromArmatureById",1,"int");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("GetBoneFromArmatureById",2,"handle");
-  arg1 = (int)lua_tonumber(L, 1);
+  SWIG_check_num_args("SetParticlesPositionMin",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesPositionMin",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesPositionMin",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesPositionMin",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesPositionMin",4,"float");
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetBoneFromArmatureById",2,SWIGTYPE_p_elf_handle);
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetParticlesPositionMin",1,SWIGTYPE_p_elf_handle);
   }
-  arg2 = *argp2;
+  arg1 = *argp1;
+  
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetParticlesPositionMin(arg1,arg2,arg3,arg4);
   
-  result = elfGetBoneFromArmatureById(arg1,arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11971,22 +13365,30 @@ fail:
 }
 
 
-static int _wrap_elfCreateParticles(lua_State* L) {
+static int _wrap_elfSetParticlesPositionMax(lua_State* L) {
   int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  int arg2 ;
-  elf_handle result;
+  elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  elf_handle *argp1 ;
   
-  SWIG_check_num_args("CreateParticles",2,2)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateParticles",1,"char const *");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("CreateParticles",2,"int");
-  arg1 = (char *)lua_tostring(L, 1);
-  arg2 = (int)lua_tonumber(L, 2);
-  result = elfCreateParticles((char const *)arg1,arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  SWIG_check_num_args("SetParticlesPositionMax",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesPositionMax",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesPositionMax",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesPositionMax",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesPositionMax",4,"float");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetParticlesPositionMax",1,SWIGTYPE_p_elf_handle);
   }
+  arg1 = *argp1;
+  
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetParticlesPositionMax(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -11997,22 +13399,30 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesName(lua_State* L) {
+static int _wrap_elfSetParticlesVelocityMin(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  char *result = 0 ;
   
-  SWIG_check_num_args("GetParticlesName",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesName",1,"handle");
+  SWIG_check_num_args("SetParticlesVelocityMin",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesVelocityMin",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesVelocityMin",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesVelocityMin",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesVelocityMin",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesVelocityMin",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetParticlesName(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetParticlesVelocityMin(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12023,22 +13433,30 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesFilePath(lua_State* L) {
+static int _wrap_elfSetParticlesVelocityMax(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  char *result = 0 ;
   
-  SWIG_check_num_args("GetParticlesFilePath",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesFilePath",1,"handle");
+  SWIG_check_num_args("SetParticlesVelocityMax",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesVelocityMax",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesVelocityMax",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesVelocityMax",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesVelocityMax",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesFilePath",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesVelocityMax",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetParticlesFilePath(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetParticlesVelocityMax(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12049,23 +13467,32 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesMaxCount(lua_State* L) {
+static int _wrap_elfSetParticlesColorMin(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetParticlesMaxCount",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesMaxCount",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesMaxCount",2,"int");
+  SWIG_check_num_args("SetParticlesColorMin",5,5)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesColorMin",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesColorMin",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesColorMin",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesColorMin",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetParticlesColorMin",5,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesMaxCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesColorMin",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  elfSetParticlesMaxCount(arg1,arg2);
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  elfSetParticlesColorMin(arg1,arg2,arg3,arg4,arg5);
   
   return SWIG_arg;
   
@@ -12077,23 +13504,32 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesDrawMode(lua_State* L) {
+static int _wrap_elfSetParticlesColorMax(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
   elf_handle *argp1 ;
   
-  SWIG_check_num_args("SetParticlesDrawMode",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesDrawMode",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesDrawMode",2,"int");
+  SWIG_check_num_args("SetParticlesColorMax",5,5)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesColorMax",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesColorMax",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesColorMax",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesColorMax",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetParticlesColorMax",5,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesDrawMode",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetParticlesColorMax",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  elfSetParticlesDrawMode(arg1,arg2);
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  elfSetParticlesColorMax(arg1,arg2,arg3,arg4,arg5);
   
   return SWIG_arg;
   
@@ -12105,30 +13541,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesTexture(lua_State* L) {
+static int _wrap_elfGetParticlesMaxCount(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  int result;
   
-  SWIG_check_num_args("SetParticlesTexture",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesTexture",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetParticlesTexture",2,"handle");
+  SWIG_check_num_args("GetParticlesMaxCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesMaxCount",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesTexture",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesMaxCount",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesTexture",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
-  
-  elfSetParticlesTexture(arg1,arg2);
-  
+  result = (int)elfGetParticlesMaxCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12139,30 +13567,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesModel(lua_State* L) {
+static int _wrap_elfGetParticlesCount(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  int result;
   
-  SWIG_check_num_args("SetParticlesModel",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesModel",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetParticlesModel",2,"handle");
+  SWIG_check_num_args("GetParticlesCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesCount",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesModel",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesCount",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesModel",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
-  
-  elfSetParticlesModel(arg1,arg2);
-  
+  result = (int)elfGetParticlesCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12173,30 +13593,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesEntity(lua_State* L) {
+static int _wrap_elfGetParticlesDrawMode(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  int result;
   
-  SWIG_check_num_args("SetParticlesEntity",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesEntity",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetParticlesEntity",2,"handle");
+  SWIG_check_num_args("GetParticlesDrawMode",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesDrawMode",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesEntity",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesDrawMode",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesEntity",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
-  
-  elfSetParticlesEntity(arg1,arg2);
-  
+  result = (int)elfGetParticlesDrawMode(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12207,30 +13619,25 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesGravity(lua_State* L) {
+static int _wrap_elfGetParticlesTexture(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetParticlesGravity",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesGravity",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesGravity",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesGravity",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesGravity",4,"float");
+  SWIG_check_num_args("GetParticlesTexture",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesTexture",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesGravity",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesTexture",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetParticlesGravity(arg1,arg2,arg3,arg4);
-  
+  result = elfGetParticlesTexture(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12241,24 +13648,25 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesSpawnDelay(lua_State* L) {
+static int _wrap_elfGetParticlesModel(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
   elf_handle *argp1 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetParticlesSpawnDelay",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesSpawnDelay",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesSpawnDelay",2,"float");
+  SWIG_check_num_args("GetParticlesModel",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesModel",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesSpawnDelay",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesModel",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  elfSetParticlesSpawnDelay(arg1,arg2);
-  
+  result = elfGetParticlesModel(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12269,24 +13677,25 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesSpawn(lua_State* L) {
+static int _wrap_elfGetParticlesEntity(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  bool arg2 ;
   elf_handle *argp1 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetParticlesSpawn",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesSpawn",1,"handle");
-  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetParticlesSpawn",2,"bool");
+  SWIG_check_num_args("GetParticlesEntity",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesEntity",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesSpawn",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesEntity",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (lua_toboolean(L, 2)!=0);
-  elfSetParticlesSpawn(arg1,arg2);
-  
+  result = elfGetParticlesEntity(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12297,27 +13706,25 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesSize(lua_State* L) {
+static int _wrap_elfGetParticlesGravity(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
   elf_handle *argp1 ;
+  elf_vec3f result;
   
-  SWIG_check_num_args("SetParticlesSize",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesSize",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesSize",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesSize",3,"float");
+  SWIG_check_num_args("GetParticlesGravity",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesGravity",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesSize",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesGravity",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  elfSetParticlesSize(arg1,arg2,arg3);
-  
+  result = elfGetParticlesGravity(arg1);
+  {
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12328,27 +13735,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesSizeGrowth(lua_State* L) {
+static int _wrap_elfGetParticlesSpawnDelay(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetParticlesSizeGrowth",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesSizeGrowth",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesSizeGrowth",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesSizeGrowth",3,"float");
+  SWIG_check_num_args("GetParticlesSpawnDelay",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesSpawnDelay",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesSizeGrowth",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesSpawnDelay",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  elfSetParticlesSizeGrowth(arg1,arg2,arg3);
-  
+  result = (float)elfGetParticlesSpawnDelay(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12359,27 +13761,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesRotation(lua_State* L) {
+static int _wrap_elfGetParticlesSpawn(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
   elf_handle *argp1 ;
+  bool result;
   
-  SWIG_check_num_args("SetParticlesRotation",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesRotation",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesRotation",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesRotation",3,"float");
+  SWIG_check_num_args("GetParticlesSpawn",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesSpawn",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesRotation",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesSpawn",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  elfSetParticlesRotation(arg1,arg2,arg3);
-  
+  result = (bool)elfGetParticlesSpawn(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12390,27 +13787,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesRotationGrowth(lua_State* L) {
+static int _wrap_elfGetParticlesSizeMin(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetParticlesRotationGrowth",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesRotationGrowth",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesRotationGrowth",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesRotationGrowth",3,"float");
+  SWIG_check_num_args("GetParticlesSizeMin",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesSizeMin",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesRotationGrowth",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesSizeMin",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  elfSetParticlesRotationGrowth(arg1,arg2,arg3);
-  
+  result = (float)elfGetParticlesSizeMin(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12421,27 +13813,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesLifeSpan(lua_State* L) {
+static int _wrap_elfGetParticlesSizeMax(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetParticlesLifeSpan",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesLifeSpan",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesLifeSpan",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesLifeSpan",3,"float");
+  SWIG_check_num_args("GetParticlesSizeMax",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesSizeMax",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesLifeSpan",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesSizeMax",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  elfSetParticlesLifeSpan(arg1,arg2,arg3);
-  
+  result = (float)elfGetParticlesSizeMax(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12452,27 +13839,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesFadeSpeed(lua_State* L) {
+static int _wrap_elfGetParticlesSizeGrowthMin(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetParticlesFadeSpeed",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesFadeSpeed",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesFadeSpeed",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesFadeSpeed",3,"float");
+  SWIG_check_num_args("GetParticlesSizeGrowthMin",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesSizeGrowthMin",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesFadeSpeed",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesSizeGrowthMin",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  elfSetParticlesFadeSpeed(arg1,arg2,arg3);
-  
+  result = (float)elfGetParticlesSizeGrowthMin(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12483,30 +13865,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesPositionMin(lua_State* L) {
+static int _wrap_elfGetParticlesSizeGrowthMax(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetParticlesPositionMin",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesPositionMin",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesPositionMin",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesPositionMin",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesPositionMin",4,"float");
+  SWIG_check_num_args("GetParticlesSizeGrowthMax",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesSizeGrowthMax",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesPositionMin",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesSizeGrowthMax",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetParticlesPositionMin(arg1,arg2,arg3,arg4);
-  
+  result = (float)elfGetParticlesSizeGrowthMax(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12517,30 +13891,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesPositionMax(lua_State* L) {
+static int _wrap_elfGetParticlesRotationMin(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetParticlesPositionMax",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesPositionMax",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesPositionMax",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesPositionMax",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesPositionMax",4,"float");
+  SWIG_check_num_args("GetParticlesRotationMin",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesRotationMin",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesPositionMax",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesRotationMin",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetParticlesPositionMax(arg1,arg2,arg3,arg4);
-  
+  result = (float)elfGetParticlesRotationMin(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12551,30 +13917,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesVelocityMin(lua_State* L) {
+static int _wrap_elfGetParticlesRotationMax(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetParticlesVelocityMin",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesVelocityMin",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesVelocityMin",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesVelocityMin",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesVelocityMin",4,"float");
+  SWIG_check_num_args("GetParticlesRotationMax",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesRotationMax",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesVelocityMin",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesRotationMax",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetParticlesVelocityMin(arg1,arg2,arg3,arg4);
-  
+  result = (float)elfGetParticlesRotationMax(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12585,30 +13943,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesVelocityMax(lua_State* L) {
+static int _wrap_elfGetParticlesRotationGrowthMin(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetParticlesVelocityMax",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesVelocityMax",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesVelocityMax",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesVelocityMax",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesVelocityMax",4,"float");
+  SWIG_check_num_args("GetParticlesRotationGrowthMin",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesRotationGrowthMin",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesVelocityMax",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesRotationGrowthMin",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetParticlesVelocityMax(arg1,arg2,arg3,arg4);
-  
+  result = (float)elfGetParticlesRotationGrowthMin(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12619,33 +13969,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesColorMin(lua_State* L) {
+static int _wrap_elfGetParticlesRotationGrowthMax(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
-  float arg5 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetParticlesColorMin",5,5)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesColorMin",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesColorMin",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesColorMin",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesColorMin",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetParticlesColorMin",5,"float");
+  SWIG_check_num_args("GetParticlesRotationGrowthMax",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesRotationGrowthMax",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesColorMin",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesRotationGrowthMax",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  elfSetParticlesColorMin(arg1,arg2,arg3,arg4,arg5);
-  
+  result = (float)elfGetParticlesRotationGrowthMax(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12656,33 +13995,22 @@ fail:
 }
 
 
-static int _wrap_elfSetParticlesColorMax(lua_State* L) {
+static int _wrap_elfGetParticlesLifeSpanMin(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
-  float arg5 ;
   elf_handle *argp1 ;
+  float result;
   
-  SWIG_check_num_args("SetParticlesColorMax",5,5)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetParticlesColorMax",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetParticlesColorMax",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetParticlesColorMax",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetParticlesColorMax",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetParticlesColorMax",5,"float");
+  SWIG_check_num_args("GetParticlesLifeSpanMin",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesLifeSpanMin",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetParticlesColorMax",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesLifeSpanMin",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  elfSetParticlesColorMax(arg1,arg2,arg3,arg4,arg5);
-  
+  result = (float)elfGetParticlesLifeSpanMin(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12693,21 +14021,21 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesMaxCount(lua_State* L) {
+static int _wrap_elfGetParticlesLifeSpanMax(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  int result;
+  float result;
   
-  SWIG_check_num_args("GetParticlesMaxCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesMaxCount",1,"handle");
+  SWIG_check_num_args("GetParticlesLifeSpanMax",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesLifeSpanMax",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesMaxCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesLifeSpanMax",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetParticlesMaxCount(arg1);
+  result = (float)elfGetParticlesLifeSpanMax(arg1);
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -12719,21 +14047,21 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesCount(lua_State* L) {
+static int _wrap_elfGetParticlesFadeSpeedMin(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  int result;
+  float result;
   
-  SWIG_check_num_args("GetParticlesCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesCount",1,"handle");
+  SWIG_check_num_args("GetParticlesFadeSpeedMin",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesFadeSpeedMin",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesFadeSpeedMin",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetParticlesCount(arg1);
+  result = (float)elfGetParticlesFadeSpeedMin(arg1);
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -12745,21 +14073,21 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesDrawMode(lua_State* L) {
+static int _wrap_elfGetParticlesFadeSpeedMax(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  int result;
+  float result;
   
-  SWIG_check_num_args("GetParticlesDrawMode",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesDrawMode",1,"handle");
+  SWIG_check_num_args("GetParticlesFadeSpeedMax",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesFadeSpeedMax",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesDrawMode",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesFadeSpeedMax",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetParticlesDrawMode(arg1);
+  result = (float)elfGetParticlesFadeSpeedMax(arg1);
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -12771,24 +14099,24 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesTexture(lua_State* L) {
+static int _wrap_elfGetParticlesPositionMin(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  elf_vec3f result;
   
-  SWIG_check_num_args("GetParticlesTexture",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesTexture",1,"handle");
+  SWIG_check_num_args("GetParticlesPositionMin",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesPositionMin",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesTexture",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesPositionMin",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetParticlesTexture(arg1);
+  result = elfGetParticlesPositionMin(arg1);
   {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
   }
   return SWIG_arg;
   
@@ -12800,24 +14128,24 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesModel(lua_State* L) {
+static int _wrap_elfGetParticlesPositionMax(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  elf_vec3f result;
   
-  SWIG_check_num_args("GetParticlesModel",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesModel",1,"handle");
+  SWIG_check_num_args("GetParticlesPositionMax",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesPositionMax",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesModel",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesPositionMax",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetParticlesModel(arg1);
+  result = elfGetParticlesPositionMax(arg1);
   {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
   }
   return SWIG_arg;
   
@@ -12829,24 +14157,24 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesEntity(lua_State* L) {
+static int _wrap_elfGetParticlesVelocityMin(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  elf_vec3f result;
   
-  SWIG_check_num_args("GetParticlesEntity",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesEntity",1,"handle");
+  SWIG_check_num_args("GetParticlesVelocityMin",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesVelocityMin",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesEntity",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesVelocityMin",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetParticlesEntity(arg1);
+  result = elfGetParticlesVelocityMin(arg1);
   {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
   }
   return SWIG_arg;
   
@@ -12858,21 +14186,21 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesGravity(lua_State* L) {
+static int _wrap_elfGetParticlesVelocityMax(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
   elf_vec3f result;
   
-  SWIG_check_num_args("GetParticlesGravity",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesGravity",1,"handle");
+  SWIG_check_num_args("GetParticlesVelocityMax",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesVelocityMax",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesGravity",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesVelocityMax",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetParticlesGravity(arg1);
+  result = elfGetParticlesVelocityMax(arg1);
   {
     elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
     SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
@@ -12887,22 +14215,25 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesSpawnDelay(lua_State* L) {
+static int _wrap_elfGetParticlesColorMin(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  float result;
+  elf_color result;
   
-  SWIG_check_num_args("GetParticlesSpawnDelay",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesSpawnDelay",1,"handle");
+  SWIG_check_num_args("GetParticlesColorMin",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesColorMin",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesSpawnDelay",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesColorMin",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetParticlesSpawnDelay(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  result = elfGetParticlesColorMin(arg1);
+  {
+    elf_color * resultptr = new elf_color((const elf_color &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12913,22 +14244,25 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesSpawn(lua_State* L) {
+static int _wrap_elfGetParticlesColorMax(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  bool result;
+  elf_color result;
   
-  SWIG_check_num_args("GetParticlesSpawn",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesSpawn",1,"handle");
+  SWIG_check_num_args("GetParticlesColorMax",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesColorMax",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesSpawn",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesColorMax",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfGetParticlesSpawn(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = elfGetParticlesColorMax(arg1);
+  {
+    elf_color * resultptr = new elf_color((const elf_color &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12939,22 +14273,19 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesSizeMin(lua_State* L) {
+static int _wrap_elfCreateSprite(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle *argp1 ;
-  float result;
-  
-  SWIG_check_num_args("GetParticlesSizeMin",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesSizeMin",1,"handle");
+  char *arg1 = (char *) 0 ;
+  elf_handle result;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesSizeMin",1,SWIGTYPE_p_elf_handle);
+  SWIG_check_num_args("CreateSprite",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateSprite",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = elfCreateSprite((char const *)arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg1 = *argp1;
-  
-  result = (float)elfGetParticlesSizeMin(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12965,22 +14296,30 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesSizeMax(lua_State* L) {
+static int _wrap_elfSetSpriteMaterial(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  float result;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("GetParticlesSizeMax",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesSizeMax",1,"handle");
+  SWIG_check_num_args("SetSpriteMaterial",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSpriteMaterial",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetSpriteMaterial",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesSizeMax",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetSpriteMaterial",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetParticlesSizeMax(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetSpriteMaterial",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfSetSpriteMaterial(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -12991,22 +14330,27 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesSizeGrowthMin(lua_State* L) {
+static int _wrap_elfSetSpriteScale(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetParticlesSizeGrowthMin",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesSizeGrowthMin",1,"handle");
+  SWIG_check_num_args("SetSpriteScale",3,3)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSpriteScale",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetSpriteScale",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetSpriteScale",3,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesSizeGrowthMin",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetSpriteScale",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetParticlesSizeGrowthMin(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  elfSetSpriteScale(arg1,arg2,arg3);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13017,22 +14361,24 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesSizeGrowthMax(lua_State* L) {
+static int _wrap_elfSetSpriteFaceCamera(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  bool arg2 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetParticlesSizeGrowthMax",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesSizeGrowthMax",1,"handle");
+  SWIG_check_num_args("SetSpriteFaceCamera",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSpriteFaceCamera",1,"handle");
+  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetSpriteFaceCamera",2,"bool");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesSizeGrowthMax",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetSpriteFaceCamera",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetParticlesSizeGrowthMax(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (lua_toboolean(L, 2)!=0);
+  elfSetSpriteFaceCamera(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13043,22 +14389,25 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesRotationMin(lua_State* L) {
+static int _wrap_elfGetSpriteMaterial(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  float result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetParticlesRotationMin",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesRotationMin",1,"handle");
+  SWIG_check_num_args("GetSpriteMaterial",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSpriteMaterial",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesRotationMin",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSpriteMaterial",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetParticlesRotationMin(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  result = elfGetSpriteMaterial(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13069,22 +14418,25 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesRotationMax(lua_State* L) {
+static int _wrap_elfGetSpriteScale(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  float result;
+  elf_vec2f result;
   
-  SWIG_check_num_args("GetParticlesRotationMax",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesRotationMax",1,"handle");
+  SWIG_check_num_args("GetSpriteScale",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSpriteScale",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesRotationMax",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSpriteScale",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetParticlesRotationMax(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  result = elfGetSpriteScale(arg1);
+  {
+    elf_vec2f * resultptr = new elf_vec2f((const elf_vec2f &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec2f,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13095,22 +14447,22 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesRotationGrowthMin(lua_State* L) {
+static int _wrap_elfGetSpriteFaceCamera(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  float result;
+  bool result;
   
-  SWIG_check_num_args("GetParticlesRotationGrowthMin",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesRotationGrowthMin",1,"handle");
+  SWIG_check_num_args("GetSpriteFaceCamera",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSpriteFaceCamera",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesRotationGrowthMin",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSpriteFaceCamera",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetParticlesRotationGrowthMin(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  result = (bool)elfGetSpriteFaceCamera(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13121,22 +14473,19 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesRotationGrowthMax(lua_State* L) {
+static int _wrap_elfCreateScene(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle *argp1 ;
-  float result;
-  
-  SWIG_check_num_args("GetParticlesRotationGrowthMax",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesRotationGrowthMax",1,"handle");
+  char *arg1 = (char *) 0 ;
+  elf_handle result;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesRotationGrowthMax",1,SWIGTYPE_p_elf_handle);
+  SWIG_check_num_args("CreateScene",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateScene",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = elfCreateScene((char const *)arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg1 = *argp1;
-  
-  result = (float)elfGetParticlesRotationGrowthMax(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13147,22 +14496,19 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesLifeSpanMin(lua_State* L) {
+static int _wrap_elfCreateSceneFromFile(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle *argp1 ;
-  float result;
-  
-  SWIG_check_num_args("GetParticlesLifeSpanMin",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesLifeSpanMin",1,"handle");
+  char *arg1 = (char *) 0 ;
+  elf_handle result;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesLifeSpanMin",1,SWIGTYPE_p_elf_handle);
+  SWIG_check_num_args("CreateSceneFromFile",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateSceneFromFile",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = elfCreateSceneFromFile((char const *)arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg1 = *argp1;
-  
-  result = (float)elfGetParticlesLifeSpanMin(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13173,22 +14519,25 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesLifeSpanMax(lua_State* L) {
+static int _wrap_elfSaveScene(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  float result;
-  
-  SWIG_check_num_args("GetParticlesLifeSpanMax",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesLifeSpanMax",1,"handle");
+  bool result;
+  
+  SWIG_check_num_args("SaveScene",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SaveScene",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("SaveScene",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesLifeSpanMax",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SaveScene",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetParticlesLifeSpanMax(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (char *)lua_tostring(L, 2);
+  result = (bool)elfSaveScene(arg1,(char const *)arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13199,22 +14548,25 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesFadeSpeedMin(lua_State* L) {
+static int _wrap_elfSaveSceneCompressed(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  float result;
+  bool result;
   
-  SWIG_check_num_args("GetParticlesFadeSpeedMin",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesFadeSpeedMin",1,"handle");
+  SWIG_check_num_args("SaveSceneCompressed",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SaveSceneCompressed",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("SaveSceneCompressed",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesFadeSpeedMin",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SaveSceneCompressed",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetParticlesFadeSpeedMin(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (char *)lua_tostring(L, 2);
+  result = (bool)elfSaveSceneCompressed(arg1,(char const *)arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13225,22 +14577,33 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesFadeSpeedMax(lua_State* L) {
+static int _wrap_elfSetSceneAmbientColor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
   elf_handle *argp1 ;
-  float result;
   
-  SWIG_check_num_args("GetParticlesFadeSpeedMax",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesFadeSpeedMax",1,"handle");
+  SWIG_check_num_args("SetSceneAmbientColor",5,5)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSceneAmbientColor",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetSceneAmbientColor",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetSceneAmbientColor",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetSceneAmbientColor",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetSceneAmbientColor",5,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesFadeSpeedMax",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetSceneAmbientColor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (float)elfGetParticlesFadeSpeedMax(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  elfSetSceneAmbientColor(arg1,arg2,arg3,arg4,arg5);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13251,24 +14614,24 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesPositionMin(lua_State* L) {
+static int _wrap_elfGetSceneAmbientColor(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
+  elf_color result;
   
-  SWIG_check_num_args("GetParticlesPositionMin",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesPositionMin",1,"handle");
+  SWIG_check_num_args("GetSceneAmbientColor",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneAmbientColor",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesPositionMin",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSceneAmbientColor",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetParticlesPositionMin(arg1);
+  result = elfGetSceneAmbientColor(arg1);
   {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+    elf_color * resultptr = new elf_color((const elf_color &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
   }
   return SWIG_arg;
   
@@ -13280,25 +14643,30 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesPositionMax(lua_State* L) {
+static int _wrap_elfSetSceneGravity(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
   
-  SWIG_check_num_args("GetParticlesPositionMax",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesPositionMax",1,"handle");
+  SWIG_check_num_args("SetSceneGravity",4,4)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSceneGravity",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetSceneGravity",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetSceneGravity",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetSceneGravity",4,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesPositionMax",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetSceneGravity",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetParticlesPositionMax(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  elfSetSceneGravity(arg1,arg2,arg3,arg4);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13309,21 +14677,21 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesVelocityMin(lua_State* L) {
+static int _wrap_elfGetSceneGravity(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
   elf_vec3f result;
   
-  SWIG_check_num_args("GetParticlesVelocityMin",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesVelocityMin",1,"handle");
+  SWIG_check_num_args("GetSceneGravity",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneGravity",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesVelocityMin",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSceneGravity",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetParticlesVelocityMin(arg1);
+  result = elfGetSceneGravity(arg1);
   {
     elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
     SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
@@ -13338,25 +14706,24 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesVelocityMax(lua_State* L) {
+static int _wrap_elfSetScenePhysics(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  bool arg2 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
   
-  SWIG_check_num_args("GetParticlesVelocityMax",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesVelocityMax",1,"handle");
+  SWIG_check_num_args("SetScenePhysics",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetScenePhysics",1,"handle");
+  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetScenePhysics",2,"bool");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesVelocityMax",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetScenePhysics",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetParticlesVelocityMax(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
-  }
+  arg2 = (lua_toboolean(L, 2)!=0);
+  elfSetScenePhysics(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13367,25 +14734,22 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesColorMin(lua_State* L) {
+static int _wrap_elfGetScenePhysics(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_color result;
+  bool result;
   
-  SWIG_check_num_args("GetParticlesColorMin",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesColorMin",1,"handle");
+  SWIG_check_num_args("GetScenePhysics",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetScenePhysics",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesColorMin",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetScenePhysics",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetParticlesColorMin(arg1);
-  {
-    elf_color * resultptr = new elf_color((const elf_color &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
-  }
+  result = (bool)elfGetScenePhysics(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13396,25 +14760,24 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesColorMax(lua_State* L) {
+static int _wrap_elfSetSceneRunScripts(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  bool arg2 ;
   elf_handle *argp1 ;
-  elf_color result;
   
-  SWIG_check_num_args("GetParticlesColorMax",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesColorMax",1,"handle");
+  SWIG_check_num_args("SetSceneRunScripts",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSceneRunScripts",1,"handle");
+  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetSceneRunScripts",2,"bool");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesColorMax",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetSceneRunScripts",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetParticlesColorMax(arg1);
-  {
-    elf_color * resultptr = new elf_color((const elf_color &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
-  }
+  arg2 = (lua_toboolean(L, 2)!=0);
+  elfSetSceneRunScripts(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13425,19 +14788,25 @@ fail:
 }
 
 
-static int _wrap_elfCreateSprite(lua_State* L) {
+static int _wrap_elfGetSceneRunScripts(lua_State* L) {
   int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  elf_handle result;
+  elf_handle arg1 ;
+  bool arg2 ;
+  elf_handle *argp1 ;
+  bool result;
   
-  SWIG_check_num_args("CreateSprite",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateSprite",1,"char const *");
-  arg1 = (char *)lua_tostring(L, 1);
-  result = elfCreateSprite((char const *)arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  SWIG_check_num_args("GetSceneRunScripts",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneRunScripts",1,"handle");
+  if(!lua_isboolean(L,2)) SWIG_fail_arg("GetSceneRunScripts",2,"bool");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetSceneRunScripts",1,SWIGTYPE_p_elf_handle);
   }
+  arg1 = *argp1;
+  
+  arg2 = (lua_toboolean(L, 2)!=0);
+  result = (bool)elfGetSceneRunScripts(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13448,30 +14817,22 @@ fail:
 }
 
 
-static int _wrap_elfSetSpriteMaterial(lua_State* L) {
+static int _wrap_elfGetSceneName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  char *result = 0 ;
   
-  SWIG_check_num_args("SetSpriteMaterial",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSpriteMaterial",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetSpriteMaterial",2,"handle");
+  SWIG_check_num_args("GetSceneName",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneName",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetSpriteMaterial",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSceneName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetSpriteMaterial",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
-  
-  elfSetSpriteMaterial(arg1,arg2);
-  
+  result = (char *)elfGetSceneName(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13482,27 +14843,22 @@ fail:
 }
 
 
-static int _wrap_elfSetSpriteScale(lua_State* L) {
+static int _wrap_elfGetSceneFilePath(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
   elf_handle *argp1 ;
+  char *result = 0 ;
   
-  SWIG_check_num_args("SetSpriteScale",3,3)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSpriteScale",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetSpriteScale",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetSpriteScale",3,"float");
+  SWIG_check_num_args("GetSceneFilePath",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneFilePath",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetSpriteScale",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSceneFilePath",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  elfSetSpriteScale(arg1,arg2,arg3);
-  
+  result = (char *)elfGetSceneFilePath(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13513,24 +14869,22 @@ fail:
 }
 
 
-static int _wrap_elfSetSpriteFaceCamera(lua_State* L) {
+static int _wrap_elfGetSceneCameraCount(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  bool arg2 ;
   elf_handle *argp1 ;
+  int result;
   
-  SWIG_check_num_args("SetSpriteFaceCamera",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSpriteFaceCamera",1,"handle");
-  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetSpriteFaceCamera",2,"bool");
+  SWIG_check_num_args("GetSceneCameraCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneCameraCount",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetSpriteFaceCamera",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSceneCameraCount",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (lua_toboolean(L, 2)!=0);
-  elfSetSpriteFaceCamera(arg1,arg2);
-  
+  result = (int)elfGetSceneCameraCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13541,25 +14895,22 @@ fail:
 }
 
 
-static int _wrap_elfGetSpriteMaterial(lua_State* L) {
+static int _wrap_elfGetSceneEntityCount(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  int result;
   
-  SWIG_check_num_args("GetSpriteMaterial",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSpriteMaterial",1,"handle");
+  SWIG_check_num_args("GetSceneEntityCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneEntityCount",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSpriteMaterial",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSceneEntityCount",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetSpriteMaterial(arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (int)elfGetSceneEntityCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13570,25 +14921,22 @@ fail:
 }
 
 
-static int _wrap_elfGetSpriteScale(lua_State* L) {
+static int _wrap_elfGetSceneLightCount(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  elf_vec2f result;
+  int result;
   
-  SWIG_check_num_args("GetSpriteScale",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSpriteScale",1,"handle");
+  SWIG_check_num_args("GetSceneLightCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneLightCount",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSpriteScale",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSceneLightCount",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetSpriteScale(arg1);
-  {
-    elf_vec2f * resultptr = new elf_vec2f((const elf_vec2f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec2f,1); SWIG_arg++;
-  }
+  result = (int)elfGetSceneLightCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13599,22 +14947,22 @@ fail:
 }
 
 
-static int _wrap_elfGetSpriteFaceCamera(lua_State* L) {
+static int _wrap_elfGetSceneArmatureCount(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  bool result;
+  int result;
   
-  SWIG_check_num_args("GetSpriteFaceCamera",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSpriteFaceCamera",1,"handle");
+  SWIG_check_num_args("GetSceneArmatureCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneArmatureCount",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSpriteFaceCamera",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSceneArmatureCount",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfGetSpriteFaceCamera(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = (int)elfGetSceneArmatureCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13625,19 +14973,22 @@ fail:
 }
 
 
-static int _wrap_elfCreateScene(lua_State* L) {
+static int _wrap_elfGetSceneParticlesCount(lua_State* L) {
   int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  elf_handle result;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  int result;
   
-  SWIG_check_num_args("CreateScene",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateScene",1,"char const *");
-  arg1 = (char *)lua_tostring(L, 1);
-  result = elfCreateScene((char const *)arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  SWIG_check_num_args("GetSceneParticlesCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneParticlesCount",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetSceneParticlesCount",1,SWIGTYPE_p_elf_handle);
   }
+  arg1 = *argp1;
+  
+  result = (int)elfGetSceneParticlesCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13648,19 +14999,22 @@ fail:
 }
 
 
-static int _wrap_elfCreateSceneFromFile(lua_State* L) {
+static int _wrap_elfGetSceneSpriteCount(lua_State* L) {
   int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  elf_handle result;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  int result;
   
-  SWIG_check_num_args("CreateSceneFromFile",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateSceneFromFile",1,"char const *");
-  arg1 = (char *)lua_tostring(L, 1);
-  result = elfCreateSceneFromFile((char const *)arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  SWIG_check_num_args("GetSceneSpriteCount",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneSpriteCount",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetSceneSpriteCount",1,SWIGTYPE_p_elf_handle);
   }
+  arg1 = *argp1;
+  
+  result = (int)elfGetSceneSpriteCount(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13671,25 +15025,30 @@ fail:
 }
 
 
-static int _wrap_elfSaveScene(lua_State* L) {
+static int _wrap_elfAddCameraToScene(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  bool result;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("SaveScene",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SaveScene",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("SaveScene",2,"char const *");
+  SWIG_check_num_args("AddCameraToScene",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddCameraToScene",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddCameraToScene",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SaveScene",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddCameraToScene",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = (bool)elfSaveScene(arg1,(char const *)arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("AddCameraToScene",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfAddCameraToScene(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13700,32 +15059,29 @@ fail:
 }
 
 
-static int _wrap_elfSetSceneAmbientColor(lua_State* L) {
+static int _wrap_elfAddEntityToScene(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
-  float arg5 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("SetSceneAmbientColor",5,5)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSceneAmbientColor",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetSceneAmbientColor",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetSceneAmbientColor",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetSceneAmbientColor",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("SetSceneAmbientColor",5,"float");
+  SWIG_check_num_args("AddEntityToScene",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddEntityToScene",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddEntityToScene",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetSceneAmbientColor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddEntityToScene",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  elfSetSceneAmbientColor(arg1,arg2,arg3,arg4,arg5);
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("AddEntityToScene",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfAddEntityToScene(arg1,arg2);
   
   return SWIG_arg;
   
@@ -13737,25 +15093,30 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneAmbientColor(lua_State* L) {
+static int _wrap_elfAddLightToScene(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_color result;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("GetSceneAmbientColor",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneAmbientColor",1,"handle");
+  SWIG_check_num_args("AddLightToScene",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddLightToScene",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddLightToScene",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneAmbientColor",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddLightToScene",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetSceneAmbientColor(arg1);
-  {
-    elf_color * resultptr = new elf_color((const elf_color &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_color,1); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("AddLightToScene",2,SWIGTYPE_p_elf_handle);
   }
+  arg2 = *argp2;
+  
+  elfAddLightToScene(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13766,29 +15127,29 @@ fail:
 }
 
 
-static int _wrap_elfSetSceneGravity(lua_State* L) {
+static int _wrap_elfAddParticlesToScene(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("SetSceneGravity",4,4)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSceneGravity",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetSceneGravity",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("SetSceneGravity",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("SetSceneGravity",4,"float");
+  SWIG_check_num_args("AddParticlesToScene",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddParticlesToScene",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddParticlesToScene",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetSceneGravity",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddParticlesToScene",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  elfSetSceneGravity(arg1,arg2,arg3,arg4);
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("AddParticlesToScene",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfAddParticlesToScene(arg1,arg2);
   
   return SWIG_arg;
   
@@ -13800,25 +15161,30 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneGravity(lua_State* L) {
+static int _wrap_elfAddSpriteToScene(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_vec3f result;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("GetSceneGravity",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneGravity",1,"handle");
+  SWIG_check_num_args("AddSpriteToScene",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddSpriteToScene",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddSpriteToScene",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneGravity",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("AddSpriteToScene",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetSceneGravity(arg1);
-  {
-    elf_vec3f * resultptr = new elf_vec3f((const elf_vec3f &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_vec3f,1); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("AddSpriteToScene",2,SWIGTYPE_p_elf_handle);
   }
+  arg2 = *argp2;
+  
+  elfAddSpriteToScene(arg1,arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13829,23 +15195,29 @@ fail:
 }
 
 
-static int _wrap_elfSetScenePhysics(lua_State* L) {
+static int _wrap_elfSetSceneActiveCamera(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  bool arg2 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
+  elf_handle *argp2 ;
   
-  SWIG_check_num_args("SetScenePhysics",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetScenePhysics",1,"handle");
-  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetScenePhysics",2,"bool");
+  SWIG_check_num_args("SetSceneActiveCamera",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSceneActiveCamera",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetSceneActiveCamera",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetScenePhysics",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetSceneActiveCamera",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (lua_toboolean(L, 2)!=0);
-  elfSetScenePhysics(arg1,arg2);
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetSceneActiveCamera",2,SWIGTYPE_p_elf_handle);
+  }
+  arg2 = *argp2;
+  
+  elfSetSceneActiveCamera(arg1,arg2);
   
   return SWIG_arg;
   
@@ -13857,22 +15229,25 @@ fail:
 }
 
 
-static int _wrap_elfGetScenePhysics(lua_State* L) {
+static int _wrap_elfGetSceneActiveCamera(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   elf_handle *argp1 ;
-  bool result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetScenePhysics",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetScenePhysics",1,"handle");
+  SWIG_check_num_args("GetSceneActiveCamera",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneActiveCamera",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetScenePhysics",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSceneActiveCamera",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (bool)elfGetScenePhysics(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = elfGetSceneActiveCamera(arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13883,24 +15258,43 @@ fail:
 }
 
 
-static int _wrap_elfSetSceneRunScripts(lua_State* L) {
+static int _wrap_elfGetSceneRayCastResult(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  bool arg2 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
+  float arg6 ;
+  float arg7 ;
   elf_handle *argp1 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetSceneRunScripts",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSceneRunScripts",1,"handle");
-  if(!lua_isboolean(L,2)) SWIG_fail_arg("SetSceneRunScripts",2,"bool");
+  SWIG_check_num_args("GetSceneRayCastResult",7,7)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneRayCastResult",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetSceneRayCastResult",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("GetSceneRayCastResult",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("GetSceneRayCastResult",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("GetSceneRayCastResult",5,"float");
+  if(!lua_isnumber(L,6)) SWIG_fail_arg("GetSceneRayCastResult",6,"float");
+  if(!lua_isnumber(L,7)) SWIG_fail_arg("GetSceneRayCastResult",7,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetSceneRunScripts",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSceneRayCastResult",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (lua_toboolean(L, 2)!=0);
-  elfSetSceneRunScripts(arg1,arg2);
-  
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  arg6 = (float)lua_tonumber(L, 6);
+  arg7 = (float)lua_tonumber(L, 7);
+  result = elfGetSceneRayCastResult(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13911,25 +15305,43 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneRunScripts(lua_State* L) {
+static int _wrap_elfGetSceneRayCastResults(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  bool arg2 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
+  float arg6 ;
+  float arg7 ;
   elf_handle *argp1 ;
-  bool result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetSceneRunScripts",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneRunScripts",1,"handle");
-  if(!lua_isboolean(L,2)) SWIG_fail_arg("GetSceneRunScripts",2,"bool");
+  SWIG_check_num_args("GetSceneRayCastResults",7,7)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneRayCastResults",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetSceneRayCastResults",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("GetSceneRayCastResults",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("GetSceneRayCastResults",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("GetSceneRayCastResults",5,"float");
+  if(!lua_isnumber(L,6)) SWIG_fail_arg("GetSceneRayCastResults",6,"float");
+  if(!lua_isnumber(L,7)) SWIG_fail_arg("GetSceneRayCastResults",7,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneRunScripts",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSceneRayCastResults",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (lua_toboolean(L, 2)!=0);
-  result = (bool)elfGetSceneRunScripts(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  arg6 = (float)lua_tonumber(L, 6);
+  arg7 = (float)lua_tonumber(L, 7);
+  result = elfGetSceneRayCastResults(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13940,22 +15352,43 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneName(lua_State* L) {
+static int _wrap_elfGetDebugSceneRayCastResult(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
+  float arg6 ;
+  float arg7 ;
   elf_handle *argp1 ;
-  char *result = 0 ;
+  elf_handle result;
   
-  SWIG_check_num_args("GetSceneName",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneName",1,"handle");
+  SWIG_check_num_args("GetDebugSceneRayCastResult",7,7)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetDebugSceneRayCastResult",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetDebugSceneRayCastResult",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("GetDebugSceneRayCastResult",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("GetDebugSceneRayCastResult",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("GetDebugSceneRayCastResult",5,"float");
+  if(!lua_isnumber(L,6)) SWIG_fail_arg("GetDebugSceneRayCastResult",6,"float");
+  if(!lua_isnumber(L,7)) SWIG_fail_arg("GetDebugSceneRayCastResult",7,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetDebugSceneRayCastResult",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetSceneName(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  arg6 = (float)lua_tonumber(L, 6);
+  arg7 = (float)lua_tonumber(L, 7);
+  result = elfGetDebugSceneRayCastResult(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13966,22 +15399,43 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneFilePath(lua_State* L) {
+static int _wrap_elfGetDebugSceneRayCastResults(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  float arg2 ;
+  float arg3 ;
+  float arg4 ;
+  float arg5 ;
+  float arg6 ;
+  float arg7 ;
   elf_handle *argp1 ;
-  char *result = 0 ;
+  elf_handle result;
   
-  SWIG_check_num_args("GetSceneFilePath",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneFilePath",1,"handle");
+  SWIG_check_num_args("GetDebugSceneRayCastResults",7,7)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetDebugSceneRayCastResults",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetDebugSceneRayCastResults",2,"float");
+  if(!lua_isnumber(L,3)) SWIG_fail_arg("GetDebugSceneRayCastResults",3,"float");
+  if(!lua_isnumber(L,4)) SWIG_fail_arg("GetDebugSceneRayCastResults",4,"float");
+  if(!lua_isnumber(L,5)) SWIG_fail_arg("GetDebugSceneRayCastResults",5,"float");
+  if(!lua_isnumber(L,6)) SWIG_fail_arg("GetDebugSceneRayCastResults",6,"float");
+  if(!lua_isnumber(L,7)) SWIG_fail_arg("GetDebugSceneRayCastResults",7,"float");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneFilePath",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetDebugSceneRayCastResults",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (char *)elfGetSceneFilePath(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  arg2 = (float)lua_tonumber(L, 2);
+  arg3 = (float)lua_tonumber(L, 3);
+  arg4 = (float)lua_tonumber(L, 4);
+  arg5 = (float)lua_tonumber(L, 5);
+  arg6 = (float)lua_tonumber(L, 6);
+  arg7 = (float)lua_tonumber(L, 7);
+  result = elfGetDebugSceneRayCastResults(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -13992,22 +15446,28 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneCameraCount(lua_State* L) {
+static int _wrap_elfGetCameraByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  int result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetSceneCameraCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneCameraCount",1,"handle");
+  SWIG_check_num_args("GetCameraByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetCameraByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneCameraCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetCameraByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetSceneCameraCount(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  result = elfGetCameraByIndex(arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14018,22 +15478,28 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneEntityCount(lua_State* L) {
+static int _wrap_elfGetEntityByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  int result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetSceneEntityCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneEntityCount",1,"handle");
+  SWIG_check_num_args("GetEntityByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetEntityByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneEntityCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetEntityByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetSceneEntityCount(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  result = elfGetEntityByIndex(arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14044,22 +15510,28 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneLightCount(lua_State* L) {
+static int _wrap_elfGetLightByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  int result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetSceneLightCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneLightCount",1,"handle");
+  SWIG_check_num_args("GetLightByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetLightByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneLightCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetLightByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetSceneLightCount(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  result = elfGetLightByIndex(arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14070,22 +15542,28 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneArmatureCount(lua_State* L) {
+static int _wrap_elfGetArmatureByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  int result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetSceneArmatureCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneArmatureCount",1,"handle");
+  SWIG_check_num_args("GetArmatureByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetArmatureByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetArmatureByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneArmatureCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetArmatureByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetSceneArmatureCount(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  result = elfGetArmatureByIndex(arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14096,22 +15574,28 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneParticlesCount(lua_State* L) {
+static int _wrap_elfGetParticlesByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  int result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetSceneParticlesCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneParticlesCount",1,"handle");
+  SWIG_check_num_args("GetParticlesByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetParticlesByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneParticlesCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetSceneParticlesCount(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  result = elfGetParticlesByIndex(arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14122,22 +15606,28 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneSpriteCount(lua_State* L) {
+static int _wrap_elfGetSpriteByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  int result;
+  elf_handle result;
   
-  SWIG_check_num_args("GetSceneSpriteCount",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneSpriteCount",1,"handle");
+  SWIG_check_num_args("GetSpriteByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSpriteByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetSpriteByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneSpriteCount",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSpriteByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = (int)elfGetSceneSpriteCount(arg1);
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  arg2 = (int)lua_tonumber(L, 2);
+  result = elfGetSpriteByIndex(arg1,arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14148,30 +15638,28 @@ fail:
 }
 
 
-static int _wrap_elfAddCameraToScene(lua_State* L) {
+static int _wrap_elfGetTextureByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  elf_handle result;
   
-  SWIG_check_num_args("AddCameraToScene",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddCameraToScene",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddCameraToScene",2,"handle");
+  SWIG_check_num_args("GetTextureByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetTextureByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddCameraToScene",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetTextureByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddCameraToScene",2,SWIGTYPE_p_elf_handle);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetTextureByName(arg1,(char const *)arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  elfAddCameraToScene(arg1,arg2);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14182,30 +15670,28 @@ fail:
 }
 
 
-static int _wrap_elfAddEntityToScene(lua_State* L) {
+static int _wrap_elfGetMaterialByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  elf_handle result;
   
-  SWIG_check_num_args("AddEntityToScene",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddEntityToScene",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddEntityToScene",2,"handle");
+  SWIG_check_num_args("GetMaterialByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetMaterialByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddEntityToScene",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetMaterialByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddEntityToScene",2,SWIGTYPE_p_elf_handle);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetMaterialByName(arg1,(char const *)arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  elfAddEntityToScene(arg1,arg2);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14216,30 +15702,28 @@ fail:
 }
 
 
-static int _wrap_elfAddLightToScene(lua_State* L) {
+static int _wrap_elfGetModelByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  elf_handle result;
   
-  SWIG_check_num_args("AddLightToScene",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddLightToScene",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddLightToScene",2,"handle");
+  SWIG_check_num_args("GetModelByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetModelByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddLightToScene",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetModelByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddLightToScene",2,SWIGTYPE_p_elf_handle);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetModelByName(arg1,(char const *)arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  elfAddLightToScene(arg1,arg2);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14250,30 +15734,28 @@ fail:
 }
 
 
-static int _wrap_elfAddParticlesToScene(lua_State* L) {
+static int _wrap_elfGetScriptByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  elf_handle result;
   
-  SWIG_check_num_args("AddParticlesToScene",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddParticlesToScene",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddParticlesToScene",2,"handle");
+  SWIG_check_num_args("GetScriptByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetScriptByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetScriptByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddParticlesToScene",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetScriptByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddParticlesToScene",2,SWIGTYPE_p_elf_handle);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetScriptByName(arg1,(char const *)arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  elfAddParticlesToScene(arg1,arg2);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14284,30 +15766,28 @@ fail:
 }
 
 
-static int _wrap_elfAddSpriteToScene(lua_State* L) {
+static int _wrap_elfGetCameraByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  elf_handle result;
   
-  SWIG_check_num_args("AddSpriteToScene",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("AddSpriteToScene",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("AddSpriteToScene",2,"handle");
+  SWIG_check_num_args("GetCameraByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetCameraByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddSpriteToScene",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetCameraByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("AddSpriteToScene",2,SWIGTYPE_p_elf_handle);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetCameraByName(arg1,(char const *)arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  elfAddSpriteToScene(arg1,arg2);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14318,30 +15798,28 @@ fail:
 }
 
 
-static int _wrap_elfSetSceneActiveCamera(lua_State* L) {
+static int _wrap_elfGetEntityByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  elf_handle arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle *argp2 ;
+  elf_handle result;
   
-  SWIG_check_num_args("SetSceneActiveCamera",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSceneActiveCamera",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("SetSceneActiveCamera",2,"handle");
+  SWIG_check_num_args("GetEntityByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetEntityByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetSceneActiveCamera",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetEntityByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetSceneActiveCamera",2,SWIGTYPE_p_elf_handle);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetEntityByName(arg1,(char const *)arg2);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg2 = *argp2;
-  
-  elfSetSceneActiveCamera(arg1,arg2);
-  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14352,21 +15830,24 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneActiveCamera(lua_State* L) {
+static int _wrap_elfGetLightByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
   elf_handle result;
   
-  SWIG_check_num_args("GetSceneActiveCamera",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneActiveCamera",1,"handle");
+  SWIG_check_num_args("GetLightByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetLightByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneActiveCamera",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetLightByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  result = elfGetSceneActiveCamera(arg1);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetLightByName(arg1,(char const *)arg2);
   {
     elf_handle * resultptr = new elf_handle((const elf_handle &) result);
     SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
@@ -14381,39 +15862,24 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneRayCastResult(lua_State* L) {
+static int _wrap_elfGetArmatureByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
-  float arg5 ;
-  float arg6 ;
-  float arg7 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
   elf_handle result;
   
-  SWIG_check_num_args("GetSceneRayCastResult",7,7)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneRayCastResult",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetSceneRayCastResult",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("GetSceneRayCastResult",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("GetSceneRayCastResult",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("GetSceneRayCastResult",5,"float");
-  if(!lua_isnumber(L,6)) SWIG_fail_arg("GetSceneRayCastResult",6,"float");
-  if(!lua_isnumber(L,7)) SWIG_fail_arg("GetSceneRayCastResult",7,"float");
+  SWIG_check_num_args("GetArmatureByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetArmatureByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetArmatureByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneRayCastResult",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetArmatureByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  arg6 = (float)lua_tonumber(L, 6);
-  arg7 = (float)lua_tonumber(L, 7);
-  result = elfGetSceneRayCastResult(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetArmatureByName(arg1,(char const *)arg2);
   {
     elf_handle * resultptr = new elf_handle((const elf_handle &) result);
     SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
@@ -14428,39 +15894,24 @@ fail:
 }
 
 
-static int _wrap_elfGetSceneRayCastResults(lua_State* L) {
+static int _wrap_elfGetParticlesByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
-  float arg5 ;
-  float arg6 ;
-  float arg7 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
   elf_handle result;
   
-  SWIG_check_num_args("GetSceneRayCastResults",7,7)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSceneRayCastResults",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetSceneRayCastResults",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("GetSceneRayCastResults",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("GetSceneRayCastResults",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("GetSceneRayCastResults",5,"float");
-  if(!lua_isnumber(L,6)) SWIG_fail_arg("GetSceneRayCastResults",6,"float");
-  if(!lua_isnumber(L,7)) SWIG_fail_arg("GetSceneRayCastResults",7,"float");
+  SWIG_check_num_args("GetParticlesByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetParticlesByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSceneRayCastResults",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetParticlesByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  arg6 = (float)lua_tonumber(L, 6);
-  arg7 = (float)lua_tonumber(L, 7);
-  result = elfGetSceneRayCastResults(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetParticlesByName(arg1,(char const *)arg2);
   {
     elf_handle * resultptr = new elf_handle((const elf_handle &) result);
     SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
@@ -14475,39 +15926,24 @@ fail:
 }
 
 
-static int _wrap_elfGetDebugSceneRayCastResult(lua_State* L) {
+static int _wrap_elfGetSpriteByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
-  float arg5 ;
-  float arg6 ;
-  float arg7 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
   elf_handle result;
   
-  SWIG_check_num_args("GetDebugSceneRayCastResult",7,7)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetDebugSceneRayCastResult",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetDebugSceneRayCastResult",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("GetDebugSceneRayCastResult",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("GetDebugSceneRayCastResult",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("GetDebugSceneRayCastResult",5,"float");
-  if(!lua_isnumber(L,6)) SWIG_fail_arg("GetDebugSceneRayCastResult",6,"float");
-  if(!lua_isnumber(L,7)) SWIG_fail_arg("GetDebugSceneRayCastResult",7,"float");
+  SWIG_check_num_args("GetSpriteByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSpriteByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetSpriteByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetDebugSceneRayCastResult",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetSpriteByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  arg6 = (float)lua_tonumber(L, 6);
-  arg7 = (float)lua_tonumber(L, 7);
-  result = elfGetDebugSceneRayCastResult(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetSpriteByName(arg1,(char const *)arg2);
   {
     elf_handle * resultptr = new elf_handle((const elf_handle &) result);
     SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
@@ -14522,39 +15958,24 @@ fail:
 }
 
 
-static int _wrap_elfGetDebugSceneRayCastResults(lua_State* L) {
+static int _wrap_elfGetActorByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  float arg2 ;
-  float arg3 ;
-  float arg4 ;
-  float arg5 ;
-  float arg6 ;
-  float arg7 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
   elf_handle result;
   
-  SWIG_check_num_args("GetDebugSceneRayCastResults",7,7)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetDebugSceneRayCastResults",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetDebugSceneRayCastResults",2,"float");
-  if(!lua_isnumber(L,3)) SWIG_fail_arg("GetDebugSceneRayCastResults",3,"float");
-  if(!lua_isnumber(L,4)) SWIG_fail_arg("GetDebugSceneRayCastResults",4,"float");
-  if(!lua_isnumber(L,5)) SWIG_fail_arg("GetDebugSceneRayCastResults",5,"float");
-  if(!lua_isnumber(L,6)) SWIG_fail_arg("GetDebugSceneRayCastResults",6,"float");
-  if(!lua_isnumber(L,7)) SWIG_fail_arg("GetDebugSceneRayCastResults",7,"float");
+  SWIG_check_num_args("GetActorByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("GetActorByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetDebugSceneRayCastResults",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetActorByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (float)lua_tonumber(L, 2);
-  arg3 = (float)lua_tonumber(L, 3);
-  arg4 = (float)lua_tonumber(L, 4);
-  arg5 = (float)lua_tonumber(L, 5);
-  arg6 = (float)lua_tonumber(L, 6);
-  arg7 = (float)lua_tonumber(L, 7);
-  result = elfGetDebugSceneRayCastResults(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  arg2 = (char *)lua_tostring(L, 2);
+  result = elfGetActorByName(arg1,(char const *)arg2);
   {
     elf_handle * resultptr = new elf_handle((const elf_handle &) result);
     SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
@@ -14569,28 +15990,25 @@ fail:
 }
 
 
-static int _wrap_elfGetCameraByIndex(lua_State* L) {
+static int _wrap_elfRemoveCameraByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("GetCameraByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetCameraByIndex",2,"int");
+  SWIG_check_num_args("RemoveCameraByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveCameraByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveCameraByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetCameraByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveCameraByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = elfGetCameraByIndex(arg1,arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (char *)lua_tostring(L, 2);
+  result = (bool)elfRemoveCameraByName(arg1,(char const *)arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14601,28 +16019,25 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityByIndex(lua_State* L) {
+static int _wrap_elfRemoveEntityByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("GetEntityByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetEntityByIndex",2,"int");
+  SWIG_check_num_args("RemoveEntityByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveEntityByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveEntityByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveEntityByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = elfGetEntityByIndex(arg1,arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (char *)lua_tostring(L, 2);
+  result = (bool)elfRemoveEntityByName(arg1,(char const *)arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14633,28 +16048,25 @@ fail:
 }
 
 
-static int _wrap_elfGetLightByIndex(lua_State* L) {
+static int _wrap_elfRemoveLightByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("GetLightByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetLightByIndex",2,"int");
+  SWIG_check_num_args("RemoveLightByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveLightByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveLightByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetLightByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveLightByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = elfGetLightByIndex(arg1,arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (char *)lua_tostring(L, 2);
+  result = (bool)elfRemoveLightByName(arg1,(char const *)arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14665,28 +16077,25 @@ fail:
 }
 
 
-static int _wrap_elfGetArmatureByIndex(lua_State* L) {
+static int _wrap_elfRemoveParticlesByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("GetArmatureByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetArmatureByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetArmatureByIndex",2,"int");
+  SWIG_check_num_args("RemoveParticlesByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveParticlesByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveParticlesByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetArmatureByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveParticlesByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = elfGetArmatureByIndex(arg1,arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (char *)lua_tostring(L, 2);
+  result = (bool)elfRemoveParticlesByName(arg1,(char const *)arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14697,28 +16106,25 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesByIndex(lua_State* L) {
+static int _wrap_elfRemoveSpriteByName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
+  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("GetParticlesByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetParticlesByIndex",2,"int");
+  SWIG_check_num_args("RemoveSpriteByName",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveSpriteByName",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveSpriteByName",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveSpriteByName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = elfGetParticlesByIndex(arg1,arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (char *)lua_tostring(L, 2);
+  result = (bool)elfRemoveSpriteByName(arg1,(char const *)arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14729,28 +16135,25 @@ fail:
 }
 
 
-static int _wrap_elfGetSpriteByIndex(lua_State* L) {
+static int _wrap_elfRemoveCameraByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   int arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("GetSpriteByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSpriteByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("GetSpriteByIndex",2,"int");
+  SWIG_check_num_args("RemoveCameraByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveCameraByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveCameraByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSpriteByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveCameraByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (int)lua_tonumber(L, 2);
-  result = elfGetSpriteByIndex(arg1,arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (bool)elfRemoveCameraByIndex(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14761,28 +16164,25 @@ fail:
 }
 
 
-static int _wrap_elfGetTextureByName(lua_State* L) {
+static int _wrap_elfRemoveEntityByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("GetTextureByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetTextureByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetTextureByName",2,"char const *");
+  SWIG_check_num_args("RemoveEntityByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveEntityByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveEntityByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetTextureByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveEntityByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetTextureByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (int)lua_tonumber(L, 2);
+  result = (bool)elfRemoveEntityByIndex(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14793,28 +16193,25 @@ fail:
 }
 
 
-static int _wrap_elfGetMaterialByName(lua_State* L) {
+static int _wrap_elfRemoveLightByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("GetMaterialByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetMaterialByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetMaterialByName",2,"char const *");
+  SWIG_check_num_args("RemoveLightByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveLightByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveLightByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetMaterialByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveLightByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetMaterialByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (int)lua_tonumber(L, 2);
+  result = (bool)elfRemoveLightByIndex(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14825,28 +16222,25 @@ fail:
 }
 
 
-static int _wrap_elfGetModelByName(lua_State* L) {
+static int _wrap_elfRemoveParticlesByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("GetModelByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetModelByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetModelByName",2,"char const *");
+  SWIG_check_num_args("RemoveParticlesByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveParticlesByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveParticlesByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetModelByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveParticlesByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetModelByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (int)lua_tonumber(L, 2);
+  result = (bool)elfRemoveParticlesByIndex(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14857,28 +16251,25 @@ fail:
 }
 
 
-static int _wrap_elfGetScriptByName(lua_State* L) {
+static int _wrap_elfRemoveSpriteByIndex(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  int arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  bool result;
   
-  SWIG_check_num_args("GetScriptByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetScriptByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetScriptByName",2,"char const *");
+  SWIG_check_num_args("RemoveSpriteByIndex",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveSpriteByIndex",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveSpriteByIndex",2,"int");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetScriptByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveSpriteByIndex",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetScriptByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  arg2 = (int)lua_tonumber(L, 2);
+  result = (bool)elfRemoveSpriteByIndex(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14889,28 +16280,31 @@ fail:
 }
 
 
-static int _wrap_elfGetCameraByName(lua_State* L) {
+static int _wrap_elfRemoveCameraByObject(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  elf_handle *argp2 ;
+  bool result;
   
-  SWIG_check_num_args("GetCameraByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetCameraByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetCameraByName",2,"char const *");
+  SWIG_check_num_args("RemoveCameraByObject",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveCameraByObject",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveCameraByObject",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetCameraByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveCameraByObject",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetCameraByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("RemoveCameraByObject",2,SWIGTYPE_p_elf_handle);
   }
+  arg2 = *argp2;
+  
+  result = (bool)elfRemoveCameraByObject(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14921,28 +16315,31 @@ fail:
 }
 
 
-static int _wrap_elfGetEntityByName(lua_State* L) {
+static int _wrap_elfRemoveEntityByObject(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  elf_handle *argp2 ;
+  bool result;
   
-  SWIG_check_num_args("GetEntityByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetEntityByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetEntityByName",2,"char const *");
+  SWIG_check_num_args("RemoveEntityByObject",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveEntityByObject",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveEntityByObject",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetEntityByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveEntityByObject",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetEntityByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("RemoveEntityByObject",2,SWIGTYPE_p_elf_handle);
   }
+  arg2 = *argp2;
+  
+  result = (bool)elfRemoveEntityByObject(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14953,28 +16350,31 @@ fail:
 }
 
 
-static int _wrap_elfGetLightByName(lua_State* L) {
+static int _wrap_elfRemoveLightByObject(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  elf_handle *argp2 ;
+  bool result;
   
-  SWIG_check_num_args("GetLightByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetLightByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetLightByName",2,"char const *");
+  SWIG_check_num_args("RemoveLightByObject",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveLightByObject",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveLightByObject",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetLightByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveLightByObject",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetLightByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("RemoveLightByObject",2,SWIGTYPE_p_elf_handle);
   }
+  arg2 = *argp2;
+  
+  result = (bool)elfRemoveLightByObject(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -14985,28 +16385,31 @@ fail:
 }
 
 
-static int _wrap_elfGetArmatureByName(lua_State* L) {
+static int _wrap_elfRemoveParticlesByObject(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  elf_handle *argp2 ;
+  bool result;
   
-  SWIG_check_num_args("GetArmatureByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetArmatureByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetArmatureByName",2,"char const *");
+  SWIG_check_num_args("RemoveParticlesByObject",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveParticlesByObject",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveParticlesByObject",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetArmatureByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveParticlesByObject",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetArmatureByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("RemoveParticlesByObject",2,SWIGTYPE_p_elf_handle);
   }
+  arg2 = *argp2;
+  
+  result = (bool)elfRemoveParticlesByObject(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15017,28 +16420,31 @@ fail:
 }
 
 
-static int _wrap_elfGetParticlesByName(lua_State* L) {
+static int _wrap_elfRemoveSpriteByObject(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  elf_handle *argp2 ;
+  bool result;
   
-  SWIG_check_num_args("GetParticlesByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetParticlesByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetParticlesByName",2,"char const *");
+  SWIG_check_num_args("RemoveSpriteByObject",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveSpriteByObject",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveSpriteByObject",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetParticlesByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveSpriteByObject",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetParticlesByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("RemoveSpriteByObject",2,SWIGTYPE_p_elf_handle);
   }
+  arg2 = *argp2;
+  
+  result = (bool)elfRemoveSpriteByObject(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15049,28 +16455,31 @@ fail:
 }
 
 
-static int _wrap_elfGetSpriteByName(lua_State* L) {
+static int _wrap_elfRemoveActorByObject(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
+  elf_handle arg2 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  elf_handle *argp2 ;
+  bool result;
   
-  SWIG_check_num_args("GetSpriteByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSpriteByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetSpriteByName",2,"char const *");
+  SWIG_check_num_args("RemoveActorByObject",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorByObject",1,"handle");
+  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveActorByObject",2,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetSpriteByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RemoveActorByObject",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetSpriteByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("RemoveActorByObject",2,SWIGTYPE_p_elf_handle);
   }
+  arg2 = *argp2;
+  
+  result = (bool)elfRemoveActorByObject(arg1,arg2);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15081,28 +16490,22 @@ fail:
 }
 
 
-static int _wrap_elfGetActorByName(lua_State* L) {
+static int _wrap_elfWarmUpSceneShaders(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  elf_handle result;
+  int result;
   
-  SWIG_check_num_args("GetActorByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetActorByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("GetActorByName",2,"char const *");
+  SWIG_check_num_args("WarmUpSceneShaders",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("WarmUpSceneShaders",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetActorByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("WarmUpSceneShaders",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = elfGetActorByName(arg1,(char const *)arg2);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  result = (int)elfWarmUpSceneShaders(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15113,25 +16516,16 @@ fail:
 }
 
 
-static int _wrap_elfRemoveCameraByName(lua_State* L) {
+static int _wrap_elfCreateScript(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
-  elf_handle *argp1 ;
-  bool result;
-  
-  SWIG_check_num_args("RemoveCameraByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveCameraByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveCameraByName",2,"char const *");
+  elf_handle result;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveCameraByName",1,SWIGTYPE_p_elf_handle);
+  SWIG_check_num_args("CreateScript",0,0)
+  result = elfCreateScript();
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg1 = *argp1;
-  
-  arg2 = (char *)lua_tostring(L, 2);
-  result = (bool)elfRemoveCameraByName(arg1,(char const *)arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15142,25 +16536,19 @@ fail:
 }
 
 
-static int _wrap_elfRemoveEntityByName(lua_State* L) {
+static int _wrap_elfCreateScriptFromFile(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
-  elf_handle *argp1 ;
-  bool result;
-  
-  SWIG_check_num_args("RemoveEntityByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveEntityByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveEntityByName",2,"char const *");
+  char *arg1 = (char *) 0 ;
+  elf_handle result;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveEntityByName",1,SWIGTYPE_p_elf_handle);
+  SWIG_check_num_args("CreateScriptFromFile",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateScriptFromFile",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = elfCreateScriptFromFile((char const *)arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
   }
-  arg1 = *argp1;
-  
-  arg2 = (char *)lua_tostring(L, 2);
-  result = (bool)elfRemoveEntityByName(arg1,(char const *)arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15171,25 +16559,22 @@ fail:
 }
 
 
-static int _wrap_elfRemoveLightByName(lua_State* L) {
+static int _wrap_elfGetScriptName(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  bool result;
+  char *result = 0 ;
   
-  SWIG_check_num_args("RemoveLightByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveLightByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveLightByName",2,"char const *");
+  SWIG_check_num_args("GetScriptName",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetScriptName",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveLightByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetScriptName",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = (bool)elfRemoveLightByName(arg1,(char const *)arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = (char *)elfGetScriptName(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15200,25 +16585,22 @@ fail:
 }
 
 
-static int _wrap_elfRemoveParticlesByName(lua_State* L) {
+static int _wrap_elfGetScriptFilePath(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  bool result;
+  char *result = 0 ;
   
-  SWIG_check_num_args("RemoveParticlesByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveParticlesByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveParticlesByName",2,"char const *");
+  SWIG_check_num_args("GetScriptFilePath",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetScriptFilePath",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveParticlesByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("GetScriptFilePath",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  result = (bool)elfRemoveParticlesByName(arg1,(char const *)arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  result = (char *)elfGetScriptFilePath(arg1);
+  lua_pushstring(L,(const char*)result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15229,25 +16611,24 @@ fail:
 }
 
 
-static int _wrap_elfRemoveSpriteByName(lua_State* L) {
+static int _wrap_elfSetScriptText(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
   char *arg2 = (char *) 0 ;
   elf_handle *argp1 ;
-  bool result;
   
-  SWIG_check_num_args("RemoveSpriteByName",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveSpriteByName",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("RemoveSpriteByName",2,"char const *");
+  SWIG_check_num_args("SetScriptText",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetScriptText",1,"handle");
+  if(!lua_isstring(L,2)) SWIG_fail_arg("SetScriptText",2,"char const *");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveSpriteByName",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("SetScriptText",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
   arg2 = (char *)lua_tostring(L, 2);
-  result = (bool)elfRemoveSpriteByName(arg1,(char const *)arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  elfSetScriptText(arg1,(char const *)arg2);
+  
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15258,24 +16639,21 @@ fail:
 }
 
 
-static int _wrap_elfRemoveCameraByIndex(lua_State* L) {
+static int _wrap_elfIsScriptError(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
   elf_handle *argp1 ;
   bool result;
   
-  SWIG_check_num_args("RemoveCameraByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveCameraByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveCameraByIndex",2,"int");
+  SWIG_check_num_args("IsScriptError",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsScriptError",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveCameraByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("IsScriptError",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = (bool)elfRemoveCameraByIndex(arg1,arg2);
+  result = (bool)elfIsScriptError(arg1);
   lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
@@ -15287,24 +16665,15 @@ fail:
 }
 
 
-static int _wrap_elfRemoveEntityByIndex(lua_State* L) {
+static int _wrap_elfRunString(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  int arg2 ;
-  elf_handle *argp1 ;
+  char *arg1 = (char *) 0 ;
   bool result;
   
-  SWIG_check_num_args("RemoveEntityByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveEntityByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveEntityByIndex",2,"int");
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveEntityByIndex",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
-  
-  arg2 = (int)lua_tonumber(L, 2);
-  result = (bool)elfRemoveEntityByIndex(arg1,arg2);
+  SWIG_check_num_args("RunString",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("RunString",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = (bool)elfRunString((char const *)arg1);
   lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
@@ -15316,24 +16685,21 @@ fail:
 }
 
 
-static int _wrap_elfRemoveLightByIndex(lua_State* L) {
+static int _wrap_elfRunScript(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
-  int arg2 ;
   elf_handle *argp1 ;
   bool result;
   
-  SWIG_check_num_args("RemoveLightByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveLightByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveLightByIndex",2,"int");
+  SWIG_check_num_args("RunScript",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RunScript",1,"handle");
   
   if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveLightByIndex",1,SWIGTYPE_p_elf_handle);
+    SWIG_fail_ptr("RunScript",1,SWIGTYPE_p_elf_handle);
   }
   arg1 = *argp1;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = (bool)elfRemoveLightByIndex(arg1,arg2);
+  result = (bool)elfRunScript(arg1);
   lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
@@ -15345,25 +16711,15 @@ fail:
 }
 
 
-static int _wrap_elfRemoveParticlesByIndex(lua_State* L) {
+static int _wrap_elfSetScriptGcMode(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  int arg2 ;
-  elf_handle *argp1 ;
-  bool result;
-  
-  SWIG_check_num_args("RemoveParticlesByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveParticlesByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveParticlesByIndex",2,"int");
+  int arg1 ;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveParticlesByIndex",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
+  SWIG_check_num_args("SetScriptGcMode",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetScriptGcMode",1,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  elfSetScriptGcMode(arg1);
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = (bool)elfRemoveParticlesByIndex(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15374,25 +16730,13 @@ fail:
 }
 
 
-static int _wrap_elfRemoveSpriteByIndex(lua_State* L) {
+static int _wrap_elfGetScriptGcMode(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  int arg2 ;
-  elf_handle *argp1 ;
-  bool result;
-  
-  SWIG_check_num_args("RemoveSpriteByIndex",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveSpriteByIndex",1,"handle");
-  if(!lua_isnumber(L,2)) SWIG_fail_arg("RemoveSpriteByIndex",2,"int");
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveSpriteByIndex",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
+  int result;
   
-  arg2 = (int)lua_tonumber(L, 2);
-  result = (bool)elfRemoveSpriteByIndex(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  SWIG_check_num_args("GetScriptGcMode",0,0)
+  result = (int)elfGetScriptGcMode();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15403,31 +16747,15 @@ fail:
 }
 
 
-static int _wrap_elfRemoveCameraByObject(lua_State* L) {
+static int _wrap_elfSetScriptGcBudget(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle arg2 ;
-  elf_handle *argp1 ;
-  elf_handle *argp2 ;
-  bool result;
-  
-  SWIG_check_num_args("RemoveCameraByObject",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveCameraByObject",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveCameraByObject",2,"handle");
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveCameraByObject",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
-  
+  float arg1 ;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveCameraByObject",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
+  SWIG_check_num_args("SetScriptGcBudget",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetScriptGcBudget",1,"float");
+  arg1 = (float)lua_tonumber(L, 1);
+  elfSetScriptGcBudget(arg1);
   
-  result = (bool)elfRemoveCameraByObject(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15438,31 +16766,13 @@ fail:
 }
 
 
-static int _wrap_elfRemoveEntityByObject(lua_State* L) {
+static int _wrap_elfGetScriptGcBudget(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle arg2 ;
-  elf_handle *argp1 ;
-  elf_handle *argp2 ;
-  bool result;
-  
-  SWIG_check_num_args("RemoveEntityByObject",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveEntityByObject",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveEntityByObject",2,"handle");
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveEntityByObject",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
-  
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveEntityByObject",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
+  float result;
   
-  result = (bool)elfRemoveEntityByObject(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  SWIG_check_num_args("GetScriptGcBudget",0,0)
+  result = (float)elfGetScriptGcBudget();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15473,31 +16783,32 @@ fail:
 }
 
 
-static int _wrap_elfRemoveLightByObject(lua_State* L) {
+static int _wrap_elfSetScriptGcStepSize(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle arg2 ;
-  elf_handle *argp1 ;
-  elf_handle *argp2 ;
-  bool result;
+  int arg1 ;
   
-  SWIG_check_num_args("RemoveLightByObject",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveLightByObject",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveLightByObject",2,"handle");
+  SWIG_check_num_args("SetScriptGcStepSize",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetScriptGcStepSize",1,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  elfSetScriptGcStepSize(arg1);
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveLightByObject",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
+  return SWIG_arg;
   
+  if(0) SWIG_fail;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveLightByObject",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetScriptGcStepSize(lua_State* L) {
+  int SWIG_arg = 0;
+  int result;
   
-  result = (bool)elfRemoveLightByObject(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  SWIG_check_num_args("GetScriptGcStepSize",0,0)
+  result = (int)elfGetScriptGcStepSize();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15508,31 +16819,30 @@ fail:
 }
 
 
-static int _wrap_elfRemoveParticlesByObject(lua_State* L) {
+static int _wrap_elfGetScriptMemory(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle arg2 ;
-  elf_handle *argp1 ;
-  elf_handle *argp2 ;
-  bool result;
-  
-  SWIG_check_num_args("RemoveParticlesByObject",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveParticlesByObject",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveParticlesByObject",2,"handle");
+  float result;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveParticlesByObject",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
+  SWIG_check_num_args("GetScriptMemory",0,0)
+  result = (float)elfGetScriptMemory();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
   
+  if(0) SWIG_fail;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveParticlesByObject",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetScriptGcTime(lua_State* L) {
+  int SWIG_arg = 0;
+  float result;
   
-  result = (bool)elfRemoveParticlesByObject(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  SWIG_check_num_args("GetScriptGcTime",0,0)
+  result = (float)elfGetScriptGcTime();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15543,31 +16853,32 @@ fail:
 }
 
 
-static int _wrap_elfRemoveSpriteByObject(lua_State* L) {
+static int _wrap_elfGetScriptGcCycles(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle arg2 ;
-  elf_handle *argp1 ;
-  elf_handle *argp2 ;
-  bool result;
+  int result;
   
-  SWIG_check_num_args("RemoveSpriteByObject",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveSpriteByObject",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveSpriteByObject",2,"handle");
+  SWIG_check_num_args("GetScriptGcCycles",0,0)
+  result = (int)elfGetScriptGcCycles();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveSpriteByObject",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
+  if(0) SWIG_fail;
   
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfSetAudioVolume(lua_State* L) {
+  int SWIG_arg = 0;
+  float arg1 ;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveSpriteByObject",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
+  SWIG_check_num_args("SetAudioVolume",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetAudioVolume",1,"float");
+  arg1 = (float)lua_tonumber(L, 1);
+  elfSetAudioVolume(arg1);
   
-  result = (bool)elfRemoveSpriteByObject(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15578,31 +16889,13 @@ fail:
 }
 
 
-static int _wrap_elfRemoveActorByObject(lua_State* L) {
+static int _wrap_elfGetAudioVolume(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle arg2 ;
-  elf_handle *argp1 ;
-  elf_handle *argp2 ;
-  bool result;
-  
-  SWIG_check_num_args("RemoveActorByObject",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RemoveActorByObject",1,"handle");
-  if(!lua_isuserdata(L,2)) SWIG_fail_arg("RemoveActorByObject",2,"handle");
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveActorByObject",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
-  
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,2,(void**)&argp2,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RemoveActorByObject",2,SWIGTYPE_p_elf_handle);
-  }
-  arg2 = *argp2;
+  float result;
   
-  result = (bool)elfRemoveActorByObject(arg1,arg2);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  SWIG_check_num_args("GetAudioVolume",0,0)
+  result = (float)elfGetAudioVolume();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15613,16 +16906,15 @@ fail:
 }
 
 
-static int _wrap_elfCreateScript(lua_State* L) {
+static int _wrap_elfSetAudioRolloff(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle result;
+  float arg1 ;
+  
+  SWIG_check_num_args("SetAudioRolloff",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetAudioRolloff",1,"float");
+  arg1 = (float)lua_tonumber(L, 1);
+  elfSetAudioRolloff(arg1);
   
-  SWIG_check_num_args("CreateScript",0,0)
-  result = elfCreateScript();
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15633,19 +16925,13 @@ fail:
 }
 
 
-static int _wrap_elfCreateScriptFromFile(lua_State* L) {
+static int _wrap_elfGetAudioRolloff(lua_State* L) {
   int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  elf_handle result;
+  float result;
   
-  SWIG_check_num_args("CreateScriptFromFile",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("CreateScriptFromFile",1,"char const *");
-  arg1 = (char *)lua_tostring(L, 1);
-  result = elfCreateScriptFromFile((char const *)arg1);
-  {
-    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
-    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
-  }
+  SWIG_check_num_args("GetAudioRolloff",0,0)
+  result = (float)elfGetAudioRolloff();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15656,22 +16942,15 @@ fail:
 }
 
 
-static int _wrap_elfGetScriptName(lua_State* L) {
+static int _wrap_elfSetAudioStreamBufferCount(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle *argp1 ;
-  char *result = 0 ;
-  
-  SWIG_check_num_args("GetScriptName",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetScriptName",1,"handle");
+  int arg1 ;
   
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetScriptName",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
+  SWIG_check_num_args("SetAudioStreamBufferCount",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetAudioStreamBufferCount",1,"int");
+  arg1 = (int)lua_tonumber(L, 1);
+  elfSetAudioStreamBufferCount(arg1);
   
-  result = (char *)elfGetScriptName(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15682,22 +16961,13 @@ fail:
 }
 
 
-static int _wrap_elfGetScriptFilePath(lua_State* L) {
+static int _wrap_elfGetAudioStreamBufferCount(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle *argp1 ;
-  char *result = 0 ;
-  
-  SWIG_check_num_args("GetScriptFilePath",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetScriptFilePath",1,"handle");
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("GetScriptFilePath",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
+  int result;
   
-  result = (char *)elfGetScriptFilePath(arg1);
-  lua_pushstring(L,(const char*)result); SWIG_arg++;
+  SWIG_check_num_args("GetAudioStreamBufferCount",0,0)
+  result = (int)elfGetAudioStreamBufferCount();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15708,23 +16978,14 @@ fail:
 }
 
 
-static int _wrap_elfSetScriptText(lua_State* L) {
+static int _wrap_elfSetAudioCullDistance(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  char *arg2 = (char *) 0 ;
-  elf_handle *argp1 ;
-  
-  SWIG_check_num_args("SetScriptText",2,2)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetScriptText",1,"handle");
-  if(!lua_isstring(L,2)) SWIG_fail_arg("SetScriptText",2,"char const *");
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("SetScriptText",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
+  float arg1 ;
   
-  arg2 = (char *)lua_tostring(L, 2);
-  elfSetScriptText(arg1,(char const *)arg2);
+  SWIG_check_num_args("SetAudioCullDistance",1,1)
+  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetAudioCullDistance",1,"float");
+  arg1 = (float)lua_tonumber(L, 1);
+  elfSetAudioCullDistance(arg1);
   
   return SWIG_arg;
   
@@ -15736,22 +16997,13 @@ fail:
 }
 
 
-static int _wrap_elfIsScriptError(lua_State* L) {
+static int _wrap_elfGetAudioCullDistance(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle *argp1 ;
-  bool result;
-  
-  SWIG_check_num_args("IsScriptError",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsScriptError",1,"handle");
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("IsScriptError",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
+  float result;
   
-  result = (bool)elfIsScriptError(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  SWIG_check_num_args("GetAudioCullDistance",0,0)
+  result = (float)elfGetAudioCullDistance();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15762,16 +17014,13 @@ fail:
 }
 
 
-static int _wrap_elfRunString(lua_State* L) {
+static int _wrap_elfGetAudioVoiceCount(lua_State* L) {
   int SWIG_arg = 0;
-  char *arg1 = (char *) 0 ;
-  bool result;
+  int result;
   
-  SWIG_check_num_args("RunString",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("RunString",1,"char const *");
-  arg1 = (char *)lua_tostring(L, 1);
-  result = (bool)elfRunString((char const *)arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  SWIG_check_num_args("GetAudioVoiceCount",0,0)
+  result = (int)elfGetAudioVoiceCount();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15782,22 +17031,13 @@ fail:
 }
 
 
-static int _wrap_elfRunScript(lua_State* L) {
+static int _wrap_elfGetAudioActiveVoiceCount(lua_State* L) {
   int SWIG_arg = 0;
-  elf_handle arg1 ;
-  elf_handle *argp1 ;
-  bool result;
-  
-  SWIG_check_num_args("RunScript",1,1)
-  if(!lua_isuserdata(L,1)) SWIG_fail_arg("RunScript",1,"handle");
-  
-  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
-    SWIG_fail_ptr("RunScript",1,SWIGTYPE_p_elf_handle);
-  }
-  arg1 = *argp1;
+  int result;
   
-  result = (bool)elfRunScript(arg1);
-  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  SWIG_check_num_args("GetAudioActiveVoiceCount",0,0)
+  result = (int)elfGetAudioActiveVoiceCount();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15808,15 +17048,13 @@ fail:
 }
 
 
-static int _wrap_elfSetAudioVolume(lua_State* L) {
+static int _wrap_elfGetAudioStolenVoiceCount(lua_State* L) {
   int SWIG_arg = 0;
-  float arg1 ;
-  
-  SWIG_check_num_args("SetAudioVolume",1,1)
-  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetAudioVolume",1,"float");
-  arg1 = (float)lua_tonumber(L, 1);
-  elfSetAudioVolume(arg1);
+  int result;
   
+  SWIG_check_num_args("GetAudioStolenVoiceCount",0,0)
+  result = (int)elfGetAudioStolenVoiceCount();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15827,12 +17065,12 @@ fail:
 }
 
 
-static int _wrap_elfGetAudioVolume(lua_State* L) {
+static int _wrap_elfGetAudioCulledSoundCount(lua_State* L) {
   int SWIG_arg = 0;
-  float result;
+  int result;
   
-  SWIG_check_num_args("GetAudioVolume",0,0)
-  result = (float)elfGetAudioVolume();
+  SWIG_check_num_args("GetAudioCulledSoundCount",0,0)
+  result = (int)elfGetAudioCulledSoundCount();
   lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
@@ -15844,15 +17082,13 @@ fail:
 }
 
 
-static int _wrap_elfSetAudioRolloff(lua_State* L) {
+static int _wrap_elfGetAudioCachedSoundCount(lua_State* L) {
   int SWIG_arg = 0;
-  float arg1 ;
-  
-  SWIG_check_num_args("SetAudioRolloff",1,1)
-  if(!lua_isnumber(L,1)) SWIG_fail_arg("SetAudioRolloff",1,"float");
-  arg1 = (float)lua_tonumber(L, 1);
-  elfSetAudioRolloff(arg1);
+  int result;
   
+  SWIG_check_num_args("GetAudioCachedSoundCount",0,0)
+  result = (int)elfGetAudioCachedSoundCount();
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15863,13 +17099,19 @@ fail:
 }
 
 
-static int _wrap_elfGetAudioRolloff(lua_State* L) {
+static int _wrap_elfLoadSound(lua_State* L) {
   int SWIG_arg = 0;
-  float result;
+  char *arg1 = (char *) 0 ;
+  elf_handle result;
   
-  SWIG_check_num_args("GetAudioRolloff",0,0)
-  result = (float)elfGetAudioRolloff();
-  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  SWIG_check_num_args("LoadSound",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("LoadSound",1,"char const *");
+  arg1 = (char *)lua_tostring(L, 1);
+  result = elfLoadSound((char const *)arg1);
+  {
+    elf_handle * resultptr = new elf_handle((const elf_handle &) result);
+    SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
+  }
   return SWIG_arg;
   
   if(0) SWIG_fail;
@@ -15880,15 +17122,15 @@ fail:
 }
 
 
-static int _wrap_elfLoadSound(lua_State* L) {
+static int _wrap_elfLoadSoundAsync(lua_State* L) {
   int SWIG_arg = 0;
   char *arg1 = (char *) 0 ;
   elf_handle result;
   
-  SWIG_check_num_args("LoadSound",1,1)
-  if(!lua_isstring(L,1)) SWIG_fail_arg("LoadSound",1,"char const *");
+  SWIG_check_num_args("LoadSoundAsync",1,1)
+  if(!lua_isstring(L,1)) SWIG_fail_arg("LoadSoundAsync",1,"char const *");
   arg1 = (char *)lua_tostring(L, 1);
-  result = elfLoadSound((char const *)arg1);
+  result = elfLoadSoundAsync((char const *)arg1);
   {
     elf_handle * resultptr = new elf_handle((const elf_handle &) result);
     SWIG_NewPointerObj(L,(void *) resultptr,SWIGTYPE_p_elf_handle,1); SWIG_arg++;
@@ -15926,6 +17168,32 @@ fail:
 }
 
 
+static int _wrap_elfIsSoundLoaded(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  bool result;
+  
+  SWIG_check_num_args("IsSoundLoaded",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("IsSoundLoaded",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("IsSoundLoaded",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = (bool)elfIsSoundLoaded(arg1);
+  lua_pushboolean(L,(int)(result!=0)); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
 static int _wrap_elfGetSoundFileType(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
@@ -15952,6 +17220,60 @@ fail:
 }
 
 
+static int _wrap_elfSetSoundPriority(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  int arg2 ;
+  elf_handle *argp1 ;
+  
+  SWIG_check_num_args("SetSoundPriority",2,2)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("SetSoundPriority",1,"handle");
+  if(!lua_isnumber(L,2)) SWIG_fail_arg("SetSoundPriority",2,"int");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("SetSoundPriority",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  arg2 = (int)lua_tonumber(L, 2);
+  elfSetSoundPriority(arg1,arg2);
+  
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
+static int _wrap_elfGetSoundPriority(lua_State* L) {
+  int SWIG_arg = 0;
+  elf_handle arg1 ;
+  elf_handle *argp1 ;
+  int result;
+  
+  SWIG_check_num_args("GetSoundPriority",1,1)
+  if(!lua_isuserdata(L,1)) SWIG_fail_arg("GetSoundPriority",1,"handle");
+  
+  if (!SWIG_IsOK(SWIG_ConvertPtr(L,1,(void**)&argp1,SWIGTYPE_p_elf_handle,0))){
+    SWIG_fail_ptr("GetSoundPriority",1,SWIGTYPE_p_elf_handle);
+  }
+  arg1 = *argp1;
+  
+  result = (int)elfGetSoundPriority(arg1);
+  lua_pushnumber(L, (lua_Number) result); SWIG_arg++;
+  return SWIG_arg;
+  
+  if(0) SWIG_fail;
+  
+fail:
+  lua_error(L);
+  return SWIG_arg;
+}
+
+
 static int _wrap_elfPlaySound(lua_State* L) {
   int SWIG_arg = 0;
   elf_handle arg1 ;
@@ -19664,6 +20986,7 @@ static const struct luaL_reg swig_commands[] = {
     { "GetObjectRefCount", _wrap_elfGetObjectRefCount},
     { "GetGlobalRefCount", _wrap_elfGetGlobalRefCount},
     { "GetGlobalObjCount", _wrap_elfGetGlobalObjCount},
+    { "GetCreatedObjCount", _wrap_elfGetCreatedObjCount},
     { "IsActor", _wrap_elfIsActor},
     { "IsGuiObject", _wrap_elfIsGuiObject},
     { "CreateList", _wrap_elfCreateList},
@@ -19682,10 +21005,13 @@ static const struct luaL_reg swig_commands[] = {
     { "GetConfigWindowWidth", _wrap_elfGetConfigWindowWidth},
     { "GetConfigWindowHeight", _wrap_elfGetConfigWindowHeight},
     { "GetConfigFullscreen", _wrap_elfGetConfigFullscreen},
+    { "GetConfigHeadless", _wrap_elfGetConfigHeadless},
     { "GetConfigTextureAnisotropy", _wrap_elfGetConfigTextureAnisotropy},
     { "GetConfigShadowMapSize", _wrap_elfGetConfigShadowMapSize},
     { "GetConfigStart", _wrap_elfGetConfigStart},
     { "GetConfigLog", _wrap_elfGetConfigLog},
+    { "SetLogLevel", _wrap_elfSetLogLevel},
+    { "GetLogLevel", _wrap_elfGetLogLevel},
     { "SetTitle", _wrap_elfSetTitle},
     { "GetWindowWidth", _wrap_elfGetWindowWidth},
     { "GetWindowHeight", _wrap_elfGetWindowHeight},
@@ -19696,6 +21022,7 @@ static const struct luaL_reg swig_commands[] = {
     { "GetMultisamples", _wrap_elfGetMultisamples},
     { "GetTime", _wrap_elfGetTime},
     { "IsWindowOpened", _wrap_elfIsWindowOpened},
+    { "IsHeadless", _wrap_elfIsHeadless},
     { "GetMousePosition", _wrap_elfGetMousePosition},
     { "GetMouseForce", _wrap_elfGetMouseForce},
     { "SetMousePosition", _wrap_elfSetMousePosition},
@@ -19710,6 +21037,7 @@ static const struct luaL_reg swig_commands[] = {
     { "GetEventCount", _wrap_elfGetEventCount},
     { "GetEvent", _wrap_elfGetEvent},
     { "Init", _wrap_elfInit},
+    { "InitHeadless", _wrap_elfInitHeadless},
     { "InitWithConfig", _wrap_elfInitWithConfig},
     { "Deinit", _wrap_elfDeinit},
     { "ResizeWindow", _wrap_elfResizeWindow},
@@ -19726,6 +21054,9 @@ static const struct luaL_reg swig_commands[] = {
     { "SetF10Exit", _wrap_elfSetF10Exit},
     { "GetF10Exit", _wrap_elfGetF10Exit},
     { "LoadScene", _wrap_elfLoadScene},
+    { "LoadSceneAsync", _wrap_elfLoadSceneAsync},
+    { "IsSceneLoading", _wrap_elfIsSceneLoading},
+    { "GetSceneLoadProgress", _wrap_elfGetSceneLoadProgress},
     { "SetScene", _wrap_elfSetScene},
     { "GetScene", _wrap_elfGetScene},
     { "SetGui", _wrap_elfSetGui},
@@ -19737,6 +21068,12 @@ static const struct luaL_reg swig_commands[] = {
     { "GetFpsLimit", _wrap_elfGetFpsLimit},
     { "SetTickRate", _wrap_elfSetTickRate},
     { "GetTickRate", _wrap_elfGetTickRate},
+    { "SetFixedTickRate", _wrap_elfSetFixedTickRate},
+    { "GetFixedTickRate", _wrap_elfGetFixedTickRate},
+    { "SetMaxTicksPerFrame", _wrap_elfSetMaxTicksPerFrame},
+    { "GetMaxTicksPerFrame", _wrap_elfGetMaxTicksPerFrame},
+    { "GetFrameTicks", _wrap_elfGetFrameTicks},
+    { "GetTickBlend", _wrap_elfGetTickBlend},
     { "SetSpeed", _wrap_elfSetSpeed},
     { "GetSpeed", _wrap_elfGetSpeed},
     { "SetTextureAnisotropy", _wrap_elfSetTextureAnisotropy},
@@ -19744,6 +21081,15 @@ static const struct luaL_reg swig_commands[] = {
     { "SetShadowMapSize", _wrap_elfSetShadowMapSize},
     { "GetShadowMapSize", _wrap_elfGetShadowMapSize},
     { "GetPolygonsRendered", _wrap_elfGetPolygonsRendered},
+    { "GetDrawCalls", _wrap_elfGetDrawCalls},
+    { "GetStateChanges", _wrap_elfGetStateChanges},
+    { "GetTextureMemory", _wrap_elfGetTextureMemory},
+    { "GetVertexBufferMemory", _wrap_elfGetVertexBufferMemory},
+    { "SetShaderCachePath", _wrap_elfSetShaderCachePath},
+    { "GetShaderCachePath", _wrap_elfGetShaderCachePath},
+    { "IsShaderBinaryCacheSupported", _wrap_elfIsShaderBinaryCacheSupported},
+    { "GetShaderCacheHits", _wrap_elfGetShaderCacheHits},
+    { "GetShaderProgramCount", _wrap_elfGetShaderProgramCount},
     { "SetBloom", _wrap_elfSetBloom},
     { "DisableBloom", _wrap_elfDisableBloom},
     { "GetBloomThreshold", _wrap_elfGetBloomThreshold},
@@ -19807,6 +21153,26 @@ static const struct luaL_reg swig_commands[] = {
     { "CreateTimer", _wrap_elfCreateTimer},
     { "StartTimer", _wrap_elfStartTimer},
     { "GetElapsedTime", _wrap_elfGetElapsedTime},
+    { "IsProfilerAvailable", _wrap_elfIsProfilerAvailable},
+    { "SetProfilerEnabled", _wrap_elfSetProfilerEnabled},
+    { "IsProfilerEnabled", _wrap_elfIsProfilerEnabled},
+    { "GetProfileFrameCount", _wrap_elfGetProfileFrameCount},
+    { "GetProfileFrameTime", _wrap_elfGetProfileFrameTime},
+    { "GetProfileSlowestFrame", _wrap_elfGetProfileSlowestFrame},
+    { "GetProfileScopeCount", _wrap_elfGetProfileScopeCount},
+    { "GetProfileScopeName", _wrap_elfGetProfileScopeName},
+    { "GetProfileScopeDepth", _wrap_elfGetProfileScopeDepth},
+    { "GetProfileScopeStart", _wrap_elfGetProfileScopeStart},
+    { "GetProfileScopeTime", _wrap_elfGetProfileScopeTime},
+    { "GetProfileTime", _wrap_elfGetProfileTime},
+    { "SaveProfileTrace", _wrap_elfSaveProfileTrace},
+    { "SetFramePacingMode", _wrap_elfSetFramePacingMode},
+    { "GetFramePacingMode", _wrap_elfGetFramePacingMode},
+    { "GetFramePacingJitter", _wrap_elfGetFramePacingJitter},
+    { "GetFramePacingMaxJitter", _wrap_elfGetFramePacingMaxJitter},
+    { "GetFrameWorkTime", _wrap_elfGetFrameWorkTime},
+    { "GetFramePacingSpinTime", _wrap_elfGetFramePacingSpinTime},
+    { "GetLateFrameCount", _wrap_elfGetLateFrameCount},
     { "CreateTextureFromFile", _wrap_elfCreateTextureFromFile},
     { "GetTextureName", _wrap_elfGetTextureName},
     { "GetTextureFilePath", _wrap_elfGetTextureFilePath},
@@ -20023,6 +21389,7 @@ static const struct luaL_reg swig_commands[] = {
     { "SetParticlesGravity", _wrap_elfSetParticlesGravity},
     { "SetParticlesSpawnDelay", _wrap_elfSetParticlesSpawnDelay},
     { "SetParticlesSpawn", _wrap_elfSetParticlesSpawn},
+    { "SetParticlesRandomSeed", _wrap_elfSetParticlesRandomSeed},
     { "SetParticlesSize", _wrap_elfSetParticlesSize},
     { "SetParticlesSizeGrowth", _wrap_elfSetParticlesSizeGrowth},
     { "SetParticlesRotation", _wrap_elfSetParticlesRotation},
@@ -20072,6 +21439,7 @@ static const struct luaL_reg swig_commands[] = {
     { "CreateScene", _wrap_elfCreateScene},
     { "CreateSceneFromFile", _wrap_elfCreateSceneFromFile},
     { "SaveScene", _wrap_elfSaveScene},
+    { "SaveSceneCompressed", _wrap_elfSaveSceneCompressed},
     { "SetSceneAmbientColor", _wrap_elfSetSceneAmbientColor},
     { "GetSceneAmbientColor", _wrap_elfGetSceneAmbientColor},
     { "SetSceneGravity", _wrap_elfSetSceneGravity},
@@ -20132,6 +21500,7 @@ static const struct luaL_reg swig_commands[] = {
     { "RemoveParticlesByObject", _wrap_elfRemoveParticlesByObject},
     { "RemoveSpriteByObject", _wrap_elfRemoveSpriteByObject},
     { "RemoveActorByObject", _wrap_elfRemoveActorByObject},
+    { "WarmUpSceneShaders", _wrap_elfWarmUpSceneShaders},
     { "CreateScript", _wrap_elfCreateScript},
     { "CreateScriptFromFile", _wrap_elfCreateScriptFromFile},
     { "GetScriptName", _wrap_elfGetScriptName},
@@ -20140,13 +21509,35 @@ static const struct luaL_reg swig_commands[] = {
     { "IsScriptError", _wrap_elfIsScriptError},
     { "RunString", _wrap_elfRunString},
     { "RunScript", _wrap_elfRunScript},
+    { "SetScriptGcMode", _wrap_elfSetScriptGcMode},
+    { "GetScriptGcMode", _wrap_elfGetScriptGcMode},
+    { "SetScriptGcBudget", _wrap_elfSetScriptGcBudget},
+    { "GetScriptGcBudget", _wrap_elfGetScriptGcBudget},
+    { "SetScriptGcStepSize", _wrap_elfSetScriptGcStepSize},
+    { "GetScriptGcStepSize", _wrap_elfGetScriptGcStepSize},
+    { "GetScriptMemory", _wrap_elfGetScriptMemory},
+    { "GetScriptGcTime", _wrap_elfGetScriptGcTime},
+    { "GetScriptGcCycles", _wrap_elfGetScriptGcCycles},
     { "SetAudioVolume", _wrap_elfSetAudioVolume},
     { "GetAudioVolume", _wrap_elfGetAudioVolume},
     { "SetAudioRolloff", _wrap_elfSetAudioRolloff},
     { "GetAudioRolloff", _wrap_elfGetAudioRolloff},
+    { "SetAudioStreamBufferCount", _wrap_elfSetAudioStreamBufferCount},
+    { "GetAudioStreamBufferCount", _wrap_elfGetAudioStreamBufferCount},
+    { "SetAudioCullDistance", _wrap_elfSetAudioCullDistance},
+    { "GetAudioCullDistance", _wrap_elfGetAudioCullDistance},
+    { "GetAudioVoiceCount", _wrap_elfGetAudioVoiceCount},
+    { "GetAudioActiveVoiceCount", _wrap_elfGetAudioActiveVoiceCount},
+    { "GetAudioStolenVoiceCount", _wrap_elfGetAudioStolenVoiceCount},
+    { "GetAudioCulledSoundCount", _wrap_elfGetAudioCulledSoundCount},
+    { "GetAudioCachedSoundCount", _wrap_elfGetAudioCachedSoundCount},
     { "LoadSound", _wrap_elfLoadSound},
+    { "LoadSoundAsync", _wrap_elfLoadSoundAsync},
     { "LoadStreamedSound", _wrap_elfLoadStreamedSound},
+    { "IsSoundLoaded", _wrap_elfIsSoundLoaded},
     { "GetSoundFileType", _wrap_elfGetSoundFileType},
+    { "SetSoundPriority", _wrap_elfSetSoundPriority},
+    { "GetSoundPriority", _wrap_elfGetSoundPriority},
     { "PlaySound", _wrap_elfPlaySound},
     { "PlayEntitySound", _wrap_elfPlayEntitySound},
     { "LoopSound", _wrap_elfLoopSound},
@@ -20440,7 +21831,8 @@ static swig_lua_const_info swig_constants[] = {
 { SWIG_LUA_INT,     (char *)"SPRITE", (long) 0x0043, 0, 0, 0},
 { SWIG_LUA_INT,     (char *)"VIDEO_MODE", (long) 0x0044, 0, 0, 0},
 { SWIG_LUA_INT,     (char *)"GENERAL", (long) 0x0045, 0, 0, 0},
-{ SWIG_LUA_INT,     (char *)"OBJECT_TYPE_COUNT", (long) 0x0046, 0, 0, 0},
+{ SWIG_LUA_INT,     (char *)"SCENE_LOADER", (long) 0x0046, 0, 0, 0},
+{ SWIG_LUA_INT,     (char *)"OBJECT_TYPE_COUNT", (long) 0x0047, 0, 0, 0},
 { SWIG_LUA_INT,     (char *)"PERSPECTIVE", (long) 0x0000, 0, 0, 0},
 { SWIG_LUA_INT,     (char *)"ORTHOGRAPHIC", (long) 0x0001, 0, 0, 0},
 { SWIG_LUA_INT,     (char *)"BOX", (long) 0x0001, 0, 0, 0},
@@ -20497,6 +21889,14 @@ static swig_lua_const_info swig_constants[] = {
 { SWIG_LUA_INT,     (char *)"CHAR_INPUT", (long) 0x0005, 0, 0, 0},
 { SWIG_LUA_INT,     (char *)"SELECTION_CHANGED", (long) 0x0006, 0, 0, 0},
 { SWIG_LUA_INT,     (char *)"STATE_CHANGED", (long) 0x0007, 0, 0, 0},
+{ SWIG_LUA_INT,     (char *)"SCRIPT_GC_FULL", (long) 0x0001, 0, 0, 0},
+{ SWIG_LUA_INT,     (char *)"SCRIPT_GC_INCREMENTAL", (long) 0x0002, 0, 0, 0},
+{ SWIG_LUA_INT,     (char *)"PACING_FIXED", (long) 0x0001, 0, 0, 0},
+{ SWIG_LUA_INT,     (char *)"PACING_ADAPTIVE", (long) 0x0002, 0, 0, 0},
+{ SWIG_LUA_INT,     (char *)"LOG_DEBUG", (long) 0x0001, 0, 0, 0},
+{ SWIG_LUA_INT,     (char *)"LOG_INFO", (long) 0x0002, 0, 0, 0},
+{ SWIG_LUA_INT,     (char *)"LOG_WARNING", (long) 0x0003, 0, 0, 0},
+{ SWIG_LUA_INT,     (char *)"LOG_ERROR", (long) 0x0004, 0, 0, 0},
 { SWIG_LUA_INT,     (char *)"JOYSTICK_BUTTON_1", (long) 0x0000, 0, 0, 0},
 { SWIG_LUA_INT,     (char *)"JOYSTICK_BUTTON_2", (long) 0x0001, 0, 0, 0},
 { SWIG_LUA_INT,     (char *)"JOYSTICK_BUTTON_3", (long) 0x0002, 0, 0, 0},
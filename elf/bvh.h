@@ -0,0 +1,505 @@
+
+// dynamic aabb tree, leaves hold entities with slightly fattened boxes so that small
+// movements don't touch the tree at all. inserts pick the sibling that grows the tree
+// the least and the tree is kept balanced with rotations, like the broadphase of box2d.
+
+elf_bvh* elf_create_bvh()
+{
+	elf_bvh *bvh;
+
+	bvh = (elf_bvh*)malloc(sizeof(elf_bvh));
+	memset(bvh, 0x0, sizeof(elf_bvh));
+
+	bvh->root = -1;
+	bvh->free_node = -1;
+
+	elf_inc_obj_count();
+
+	return bvh;
+}
+
+void elf_destroy_bvh(elf_bvh *bvh)
+{
+	if(bvh->nodes) free(bvh->nodes);
+	if(bvh->stack) free(bvh->stack);
+	if(bvh->results) free(bvh->results);
+
+	free(bvh);
+
+	elf_dec_obj_count();
+}
+
+int elf_alloc_bvh_node(elf_bvh *bvh)
+{
+	int node;
+	int i;
+
+	if(bvh->free_node < 0)
+	{
+		bvh->node_capacity = bvh->node_capacity ? bvh->node_capacity*2 : 64;
+		bvh->nodes = (elf_bvh_node*)realloc(bvh->nodes, sizeof(elf_bvh_node)*bvh->node_capacity);
+		bvh->stack = (int*)realloc(bvh->stack, sizeof(int)*bvh->node_capacity);
+		bvh->results = (elf_entity**)realloc(bvh->results, sizeof(elf_entity*)*bvh->node_capacity);
+
+		for(i = bvh->node_count; i < bvh->node_capacity; i++)
+		{
+			bvh->nodes[i].parent = i+1 < bvh->node_capacity ? i+1 : -1;
+			bvh->nodes[i].height = -1;
+		}
+		bvh->free_node = bvh->node_count;
+	}
+
+	node = bvh->free_node;
+	bvh->free_node = bvh->nodes[node].parent;
+
+	memset(&bvh->nodes[node], 0x0, sizeof(elf_bvh_node));
+	bvh->nodes[node].parent = -1;
+	bvh->nodes[node].children[0] = -1;
+	bvh->nodes[node].children[1] = -1;
+	bvh->node_count++;
+
+	return node;
+}
+
+void elf_free_bvh_node(elf_bvh *bvh, int node)
+{
+	// free nodes are chained through their parent index
+	bvh->nodes[node].parent = bvh->free_node;
+	bvh->nodes[node].height = -1;
+	bvh->nodes[node].entity = NULL;
+	bvh->free_node = node;
+	bvh->node_count--;
+}
+
+float elf_get_bvh_aabb_area(const float *min, const float *max)
+{
+	float dx, dy, dz;
+
+	dx = max[0]-min[0];
+	dy = max[1]-min[1];
+	dz = max[2]-min[2];
+
+	return 2.0*(dx*dy+dy*dz+dz*dx);
+}
+
+void elf_merge_bvh_aabbs(const float *min1, const float *max1, const float *min2, const float *max2, float *min, float *max)
+{
+	int i;
+
+	for(i = 0; i < 3; i++)
+	{
+		min[i] = min1[i] < min2[i] ? min1[i] : min2[i];
+		max[i] = max1[i] > max2[i] ? max1[i] : max2[i];
+	}
+}
+
+void elf_fit_bvh_node(elf_bvh *bvh, int node)
+{
+	elf_bvh_node *n;
+	elf_bvh_node *c1;
+	elf_bvh_node *c2;
+
+	n = &bvh->nodes[node];
+	c1 = &bvh->nodes[n->children[0]];
+	c2 = &bvh->nodes[n->children[1]];
+
+	elf_merge_bvh_aabbs(c1->min, c1->max, c2->min, c2->max, n->min, n->max);
+	n->height = 1+(c1->height > c2->height ? c1->height : c2->height);
+}
+
+int elf_balance_bvh_node(elf_bvh *bvh, int a)
+{
+	elf_bvh_node *na;
+	elf_bvh_node *nb;
+	elf_bvh_node *nc;
+	elf_bvh_node *nf;
+	elf_bvh_node *ng;
+	int b, c, f, g;
+	int balance;
+
+	na = &bvh->nodes[a];
+	if(na->height < 2) return a;
+
+	b = na->children[0];
+	c = na->children[1];
+	nb = &bvh->nodes[b];
+	nc = &bvh->nodes[c];
+
+	balance = nc->height-nb->height;
+	if(balance >= -1 && balance <= 1) return a;
+
+	// rotate the higher child up, its higher child stays below it and the other one moves under a
+	if(balance > 1)
+	{
+		f = nc->children[0];
+		g = nc->children[1];
+		nf = &bvh->nodes[f];
+		ng = &bvh->nodes[g];
+
+		nc->children[0] = a;
+		nc->parent = na->parent;
+		na->parent = c;
+
+		if(nc->parent >= 0)
+		{
+			if(bvh->nodes[nc->parent].children[0] == a) bvh->nodes[nc->parent].children[0] = c;
+			else bvh->nodes[nc->parent].children[1] = c;
+		}
+		else bvh->root = c;
+
+		if(nf->height > ng->height)
+		{
+			nc->children[1] = f;
+			na->children[1] = g;
+			ng->parent = a;
+		}
+		else
+		{
+			nc->children[1] = g;
+			na->children[1] = f;
+			nf->parent = a;
+		}
+
+		elf_fit_bvh_node(bvh, a);
+		elf_fit_bvh_node(bvh, c);
+
+		return c;
+	}
+	else
+	{
+		f = nb->children[0];
+		g = nb->children[1];
+		nf = &bvh->nodes[f];
+		ng = &bvh->nodes[g];
+
+		nb->children[0] = a;
+		nb->parent = na->parent;
+		na->parent = b;
+
+		if(nb->parent >= 0)
+		{
+			if(bvh->nodes[nb->parent].children[0] == a) bvh->nodes[nb->parent].children[0] = b;
+			else bvh->nodes[nb->parent].children[1] = b;
+		}
+		else bvh->root = b;
+
+		if(nf->height > ng->height)
+		{
+			nb->children[1] = f;
+			na->children[0] = g;
+			ng->parent = a;
+		}
+		else
+		{
+			nb->children[1] = g;
+			na->children[0] = f;
+			nf->parent = a;
+		}
+
+		elf_fit_bvh_node(bvh, a);
+		elf_fit_bvh_node(bvh, b);
+
+		return b;
+	}
+}
+
+void elf_refit_bvh_from(elf_bvh *bvh, int node)
+{
+	while(node >= 0)
+	{
+		node = elf_balance_bvh_node(bvh, node);
+		elf_fit_bvh_node(bvh, node);
+		node = bvh->nodes[node].parent;
+	}
+}
+
+float elf_get_bvh_descend_cost(elf_bvh *bvh, int child, elf_bvh_node *leaf)
+{
+	elf_bvh_node *c;
+	float min[3], max[3];
+
+	c = &bvh->nodes[child];
+	elf_merge_bvh_aabbs(c->min, c->max, leaf->min, leaf->max, min, max);
+
+	if(c->height == 0) return elf_get_bvh_aabb_area(min, max);
+	return elf_get_bvh_aabb_area(min, max)-elf_get_bvh_aabb_area(c->min, c->max);
+}
+
+void elf_insert_bvh_leaf(elf_bvh *bvh, int leaf)
+{
+	elf_bvh_node *nl;
+	elf_bvh_node *n;
+	float min[3], max[3];
+	float area, combined_area;
+	float cost, inheritance_cost;
+	float cost1, cost2;
+	int sibling;
+	int old_parent;
+	int new_parent;
+
+	if(bvh->root < 0)
+	{
+		bvh->root = leaf;
+		bvh->nodes[leaf].parent = -1;
+		return;
+	}
+
+	nl = &bvh->nodes[leaf];
+
+	// walk down to the sibling that makes the tree grow the least
+	sibling = bvh->root;
+	while(bvh->nodes[sibling].height > 0)
+	{
+		n = &bvh->nodes[sibling];
+
+		area = elf_get_bvh_aabb_area(n->min, n->max);
+		elf_merge_bvh_aabbs(n->min, n->max, nl->min, nl->max, min, max);
+		combined_area = elf_get_bvh_aabb_area(min, max);
+
+		cost = 2.0*combined_area;
+		inheritance_cost = 2.0*(combined_area-area);
+
+		cost1 = elf_get_bvh_descend_cost(bvh, n->children[0], nl)+inheritance_cost;
+		cost2 = elf_get_bvh_descend_cost(bvh, n->children[1], nl)+inheritance_cost;
+
+		if(cost < cost1 && cost < cost2) break;
+
+		sibling = cost1 < cost2 ? n->children[0] : n->children[1];
+	}
+
+	old_parent = bvh->nodes[sibling].parent;
+	new_parent = elf_alloc_bvh_node(bvh);
+
+	// the pool may have moved
+	nl = &bvh->nodes[leaf];
+	n = &bvh->nodes[new_parent];
+
+	n->parent = old_parent;
+	n->entity = NULL;
+	elf_merge_bvh_aabbs(bvh->nodes[sibling].min, bvh->nodes[sibling].max, nl->min, nl->max, n->min, n->max);
+	n->height = bvh->nodes[sibling].height+1;
+	n->children[0] = sibling;
+	n->children[1] = leaf;
+
+	if(old_parent >= 0)
+	{
+		if(bvh->nodes[old_parent].children[0] == sibling) bvh->nodes[old_parent].children[0] = new_parent;
+		else bvh->nodes[old_parent].children[1] = new_parent;
+	}
+	else bvh->root = new_parent;
+
+	bvh->nodes[sibling].parent = new_parent;
+	nl->parent = new_parent;
+
+	elf_refit_bvh_from(bvh, bvh->nodes[leaf].parent);
+}
+
+void elf_remove_bvh_leaf(elf_bvh *bvh, int leaf)
+{
+	int parent;
+	int grand_parent;
+	int sibling;
+
+	if(leaf == bvh->root)
+	{
+		bvh->root = -1;
+		return;
+	}
+
+	parent = bvh->nodes[leaf].parent;
+	grand_parent = bvh->nodes[parent].parent;
+	sibling = bvh->nodes[parent].children[0] == leaf ? bvh->nodes[parent].children[1] : bvh->nodes[parent].children[0];
+
+	if(grand_parent >= 0)
+	{
+		if(bvh->nodes[grand_parent].children[0] == parent) bvh->nodes[grand_parent].children[0] = sibling;
+		else bvh->nodes[grand_parent].children[1] = sibling;
+		bvh->nodes[sibling].parent = grand_parent;
+		elf_free_bvh_node(bvh, parent);
+
+		elf_refit_bvh_from(bvh, grand_parent);
+	}
+	else
+	{
+		bvh->root = sibling;
+		bvh->nodes[sibling].parent = -1;
+		elf_free_bvh_node(bvh, parent);
+	}
+}
+
+void elf_set_bvh_fat_aabb(elf_bvh_node *node, const float *min, const float *max)
+{
+	float margin;
+	int i;
+
+	// a tenth of the largest side, so the margin scales with the object
+	margin = 0.0;
+	for(i = 0; i < 3; i++) if(max[i]-min[i] > margin) margin = max[i]-min[i];
+	margin = margin*0.1+0.05;
+
+	for(i = 0; i < 3; i++)
+	{
+		node->min[i] = min[i]-margin;
+		node->max[i] = max[i]+margin;
+	}
+}
+
+void elf_get_bvh_entity_bounds(elf_entity *entity, float *min, float *max)
+{
+	float center[3];
+	int i;
+
+	// the culling box and the culling sphere, point lights test against the sphere
+	gfx_get_transform_position(entity->transform, center);
+	center[0] += entity->bb_offset.x;
+	center[1] += entity->bb_offset.y;
+	center[2] += entity->bb_offset.z;
+
+	for(i = 0; i < 3; i++)
+	{
+		min[i] = (&entity->cull_aabb_min.x)[i];
+		max[i] = (&entity->cull_aabb_max.x)[i];
+		if(center[i]-entity->cull_radius < min[i]) min[i] = center[i]-entity->cull_radius;
+		if(center[i]+entity->cull_radius > max[i]) max[i] = center[i]+entity->cull_radius;
+	}
+}
+
+int elf_insert_entity_to_bvh(elf_bvh *bvh, elf_entity *entity)
+{
+	float min[3], max[3];
+	int leaf;
+
+	leaf = elf_alloc_bvh_node(bvh);
+
+	elf_get_bvh_entity_bounds(entity, min, max);
+
+	bvh->nodes[leaf].entity = entity;
+	bvh->nodes[leaf].height = 0;
+	elf_set_bvh_fat_aabb(&bvh->nodes[leaf], min, max);
+
+	elf_insert_bvh_leaf(bvh, leaf);
+
+	return leaf;
+}
+
+void elf_remove_entity_from_bvh(elf_bvh *bvh, int leaf)
+{
+	if(leaf < 0 || leaf >= bvh->node_capacity || bvh->nodes[leaf].height != 0) return;
+
+	elf_remove_bvh_leaf(bvh, leaf);
+	elf_free_bvh_node(bvh, leaf);
+}
+
+void elf_move_entity_in_bvh(elf_bvh *bvh, int leaf, elf_entity *entity)
+{
+	elf_bvh_node *n;
+	float min[3], max[3];
+
+	if(leaf < 0 || leaf >= bvh->node_capacity || bvh->nodes[leaf].height != 0) return;
+
+	n = &bvh->nodes[leaf];
+	elf_get_bvh_entity_bounds(entity, min, max);
+
+	// still inside the fat box, nothing to do
+	if(min[0] >= n->min[0] && min[1] >= n->min[1] && min[2] >= n->min[2] &&
+		max[0] <= n->max[0] && max[1] <= n->max[1] && max[2] <= n->max[2]) return;
+
+	elf_remove_bvh_leaf(bvh, leaf);
+	elf_set_bvh_fat_aabb(&bvh->nodes[leaf], min, max);
+	elf_insert_bvh_leaf(bvh, leaf);
+}
+
+int elf_query_bvh_frustum(elf_bvh *bvh, elf_camera *camera)
+{
+	elf_bvh_node *n;
+	int stack_size;
+	int node;
+	int top;
+	int result;
+
+	bvh->result_count = 0;
+	if(bvh->root < 0) return 0;
+
+	stack_size = 0;
+	bvh->stack[stack_size++] = bvh->root;
+
+	while(stack_size > 0)
+	{
+		node = bvh->stack[--stack_size];
+		n = &bvh->nodes[node];
+
+		result = elf_classify_aabb_in_frustum(camera, n->min, n->max);
+		if(result == ELF_FRUSTUM_OUTSIDE) continue;
+
+		if(n->height == 0)
+		{
+			bvh->results[bvh->result_count++] = n->entity;
+		}
+		else if(result == ELF_FRUSTUM_INSIDE)
+		{
+			// the whole subtree is visible, collect its leaves without testing them
+			top = stack_size;
+			bvh->stack[stack_size++] = node;
+			while(stack_size > top)
+			{
+				n = &bvh->nodes[bvh->stack[--stack_size]];
+				if(n->height == 0) bvh->results[bvh->result_count++] = n->entity;
+				else
+				{
+					bvh->stack[stack_size++] = n->children[0];
+					bvh->stack[stack_size++] = n->children[1];
+				}
+			}
+		}
+		else
+		{
+			bvh->stack[stack_size++] = n->children[0];
+			bvh->stack[stack_size++] = n->children[1];
+		}
+	}
+
+	return bvh->result_count;
+}
+
+int elf_query_bvh_sphere(elf_bvh *bvh, const float *pos, float radius)
+{
+	elf_bvh_node *n;
+	float d, dist;
+	int stack_size;
+	int i;
+
+	bvh->result_count = 0;
+	if(bvh->root < 0) return 0;
+
+	stack_size = 0;
+	bvh->stack[stack_size++] = bvh->root;
+
+	while(stack_size > 0)
+	{
+		n = &bvh->nodes[bvh->stack[--stack_size]];
+
+		// squared distance from the sphere center to the box
+		dist = 0.0;
+		for(i = 0; i < 3; i++)
+		{
+			if(pos[i] < n->min[i]) { d = n->min[i]-pos[i]; dist += d*d; }
+			else if(pos[i] > n->max[i]) { d = pos[i]-n->max[i]; dist += d*d; }
+		}
+		if(dist > radius*radius) continue;
+
+		if(n->height == 0) bvh->results[bvh->result_count++] = n->entity;
+		else
+		{
+			bvh->stack[stack_size++] = n->children[0];
+			bvh->stack[stack_size++] = n->children[1];
+		}
+	}
+
+	return bvh->result_count;
+}
+
+elf_entity* elf_get_bvh_result(elf_bvh *bvh, int idx)
+{
+	return bvh->results[idx];
+}
+
@@ -45,6 +45,7 @@ elf_camera* elf_create_camera(const char *name)
 
 void elf_update_camera(elf_camera *camera)
 {
+	elf_sync_actor_transform((elf_actor*)camera);
 	elf_update_actor((elf_actor*)camera);
 
 	if(camera->mode == ELF_PERSPECTIVE)
@@ -250,6 +251,30 @@ unsigned char elf_aabb_inside_frustum(elf_camera *camera, float *min, float *max
 	return ELF_TRUE;
 }
 
+int elf_classify_aabb_in_frustum(elf_camera *camera, const float *min, const float *max)
+{
+	int i;
+	int result;
+	float (*plane)[4];
+
+	result = ELF_FRUSTUM_INSIDE;
+
+	// test the corner furthest along each plane normal, then the nearest one for full containment
+	for(i = 0, plane = camera->frustum; i < 6; i++, plane++)
+	{
+		if((*plane)[0]*((*plane)[0] > 0.0 ? max[0] : min[0])+
+			(*plane)[1]*((*plane)[1] > 0.0 ? max[1] : min[1])+
+			(*plane)[2]*((*plane)[2] > 0.0 ? max[2] : min[2])+(*plane)[3] <= 0.0)
+			return ELF_FRUSTUM_OUTSIDE;
+		if((*plane)[0]*((*plane)[0] > 0.0 ? min[0] : max[0])+
+			(*plane)[1]*((*plane)[1] > 0.0 ? min[1] : max[1])+
+			(*plane)[2]*((*plane)[2] > 0.0 ? min[2] : max[2])+(*plane)[3] <= 0.0)
+			result = ELF_FRUSTUM_INTERSECT;
+	}
+
+	return result;
+}
+
 unsigned char elf_sphere_inside_frustum(elf_camera *camera, float *pos, float radius)
 {
 	int i;
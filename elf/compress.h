@@ -0,0 +1,185 @@
+
+// lz4 style block compression, byte oriented so it decodes fast without any tables.
+// a block is a run of sequences: a token (4 bits literal count, 4 bits match length),
+// the literals, a 16 bit little endian match offset and the rest of the match length.
+// the last sequence only has literals. lengths of 15 and up continue in bytes of 255.
+
+int elf_get_lz_bound(int size)
+{
+	return size+size/255+16;
+}
+
+int elf_lz_compress(const unsigned char *src, int src_size, unsigned char *dst, int dst_size)
+{
+	int table[1<<ELF_LZ_HASH_BITS];
+	const unsigned char *ip;
+	const unsigned char *anchor;
+	const unsigned char *ref;
+	const unsigned char *end;
+	const unsigned char *match_limit;
+	unsigned char *op;
+	unsigned char *op_end;
+	unsigned char *token;
+	unsigned int seq;
+	unsigned int h;
+	int literals;
+	int len;
+	int step;
+
+	if(src_size < 0 || dst_size < 1) return 0;
+
+	memset(table, 0x0, sizeof(int)*(1<<ELF_LZ_HASH_BITS));
+
+	ip = src;
+	anchor = src;
+	end = src+src_size;
+	op = dst;
+	op_end = dst+dst_size;
+
+	// the last 12 bytes are never the start of a match and the last 5 are always literals
+	match_limit = src_size > 12 ? end-12 : src;
+
+	while(ip < match_limit)
+	{
+		memcpy(&seq, ip, sizeof(unsigned int));
+		h = (seq*2654435761u)>>(32-ELF_LZ_HASH_BITS);
+		ref = table[h] ? src+table[h]-1 : NULL;
+		table[h] = (int)(ip-src)+1;
+
+		if(!ref || ip-ref > 65535 || memcmp(ref, ip, 4))
+		{
+			// skip faster through data that doesn't compress
+			step = 1+((int)(ip-anchor)>>6);
+			ip += step;
+			continue;
+		}
+
+		len = 4;
+		while(ip+len < end-5 && ref[len] == ip[len]) len++;
+
+		literals = (int)(ip-anchor);
+		if(op+1+literals+literals/255+1+2+(len-4)/255+1 > op_end) return 0;
+
+		token = op++;
+		if(literals >= 15)
+		{
+			*token = 15<<4;
+			for(h = literals-15; h >= 255; h -= 255) *op++ = 255;
+			*op++ = (unsigned char)h;
+		}
+		else *token = (unsigned char)(literals<<4);
+
+		memcpy(op, anchor, literals);
+		op += literals;
+
+		*op++ = (unsigned char)((ip-ref)&0xFF);
+		*op++ = (unsigned char)((ip-ref)>>8);
+
+		if(len-4 >= 15)
+		{
+			*token |= 15;
+			for(h = len-4-15; h >= 255; h -= 255) *op++ = 255;
+			*op++ = (unsigned char)h;
+		}
+		else *token |= (unsigned char)(len-4);
+
+		ip += len;
+		anchor = ip;
+	}
+
+	literals = (int)(end-anchor);
+	if(op+1+literals+literals/255+1 > op_end) return 0;
+
+	token = op++;
+	if(literals >= 15)
+	{
+		*token = 15<<4;
+		for(h = literals-15; h >= 255; h -= 255) *op++ = 255;
+		*op++ = (unsigned char)h;
+	}
+	else *token = (unsigned char)(literals<<4);
+
+	memcpy(op, anchor, literals);
+	op += literals;
+
+	return (int)(op-dst);
+}
+
+int elf_lz_decompress(const unsigned char *src, int src_size, unsigned char *dst, int dst_size)
+{
+	const unsigned char *ip;
+	const unsigned char *ip_end;
+	const unsigned char *ref;
+	unsigned char *op;
+	unsigned char *op_end;
+	unsigned char token;
+	unsigned char b;
+	int offset;
+	int len;
+
+	if(src_size < 1 || dst_size < 0) return -1;
+
+	ip = src;
+	ip_end = src+src_size;
+	op = dst;
+	op_end = dst+dst_size;
+
+	// every length and offset is checked, corrupted data must never write outside of dst
+	while(ip < ip_end)
+	{
+		token = *ip++;
+
+		len = token>>4;
+		if(len == 15)
+		{
+			do {
+				if(ip >= ip_end) return -1;
+				b = *ip++;
+				len += b;
+				// long runs of 255 would overflow len
+				if(len > op_end-op) return -1;
+			} while(b == 255);
+		}
+
+		if(len > ip_end-ip || len > op_end-op) return -1;
+		memcpy(op, ip, len);
+		op += len;
+		ip += len;
+
+		if(ip >= ip_end) break;
+
+		if(ip_end-ip < 2) return -1;
+		offset = ip[0]|(ip[1]<<8);
+		ip += 2;
+		if(offset == 0 || offset > op-dst) return -1;
+
+		len = token&15;
+		if(len == 15)
+		{
+			do {
+				if(ip >= ip_end) return -1;
+				b = *ip++;
+				len += b;
+				if(len > op_end-op) return -1;
+			} while(b == 255);
+		}
+		len += 4;
+
+		if(len > op_end-op) return -1;
+
+		ref = op-offset;
+		if(offset >= len)
+		{
+			memcpy(op, ref, len);
+			op += len;
+		}
+		else
+		{
+			// the match overlaps what it writes, repeats a short pattern
+			while(len--) *op++ = *ref++;
+		}
+	}
+
+	return (int)(op-dst);
+}
+
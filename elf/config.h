@@ -14,6 +14,16 @@ elf_config* elf_create_config()
 	config->shadow_map_size = 1024;
 	config->start = elf_create_string("");
 	config->log = elf_create_string("elf.log");
+	config->log_level = ELF_LOG_INFO;
+	config->script_gc_mode = ELF_SCRIPT_GC_INCREMENTAL;
+	config->script_gc_budget = 0.001;
+	config->script_gc_step_size = 16;
+	config->max_ticks_per_frame = 5;
+	config->audio_stream_buffers = ELF_AUDIO_STREAM_BUFFERS;
+	config->shader_cache = elf_create_string("");
+	config->benchmark_ticks = 600;
+	config->benchmark_tick_rate = 1.0/60.0;
+	config->benchmark_report = elf_create_string("bench.json");
 
 	elf_inc_obj_count();
 
@@ -24,6 +34,8 @@ void elf_destroy_config(elf_config *config)
 {
 	if(config->start) elf_destroy_string(config->start);
 	if(config->log) elf_destroy_string(config->log);
+	if(config->shader_cache) elf_destroy_string(config->shader_cache);
+	if(config->benchmark_report) elf_destroy_string(config->benchmark_report);
 
 	free(config);
 
@@ -38,6 +50,7 @@ elf_config* elf_read_config(const char *file_path)
 	char *text;
 	int pos;
 	char *str;
+	char *mode;
 	int scope;
 
 	file = fopen(file_path, "r");
@@ -86,6 +99,10 @@ elf_config* elf_read_config(const char *file_path)
 			{
 				config->fullscreen = elf_read_sst_bool(text, &pos);
 			}
+			else if(!strcmp(str, "headless"))
+			{
+				config->headless = elf_read_sst_bool(text, &pos);
+			}
 			else if(!strcmp(str, "texture_anisotropy"))
 			{
 				config->texture_anisotropy = elf_read_sst_float(text, &pos);
@@ -104,6 +121,78 @@ elf_config* elf_read_config(const char *file_path)
 				if(config->log) elf_destroy_string(config->log);
 				config->log = elf_read_sst_string(text, &pos);
 			}
+			else if(!strcmp(str, "log_level"))
+			{
+				mode = elf_read_sst_string(text, &pos);
+				if(!strcmp(mode, "debug")) config->log_level = ELF_LOG_DEBUG;
+				else if(!strcmp(mode, "warning")) config->log_level = ELF_LOG_WARNING;
+				else if(!strcmp(mode, "error")) config->log_level = ELF_LOG_ERROR;
+				else config->log_level = ELF_LOG_INFO;
+				elf_destroy_string(mode);
+			}
+			else if(!strcmp(str, "script_gc"))
+			{
+				// "full" collects everything every frame, anything else steps incrementally
+				mode = elf_read_sst_string(text, &pos);
+				if(!strcmp(mode, "full")) config->script_gc_mode = ELF_SCRIPT_GC_FULL;
+				else config->script_gc_mode = ELF_SCRIPT_GC_INCREMENTAL;
+				elf_destroy_string(mode);
+			}
+			else if(!strcmp(str, "script_gc_budget"))
+			{
+				config->script_gc_budget = elf_read_sst_float(text, &pos);
+			}
+			else if(!strcmp(str, "script_gc_step_size"))
+			{
+				config->script_gc_step_size = elf_read_sst_int(text, &pos);
+			}
+			else if(!strcmp(str, "fixed_tick_rate"))
+			{
+				config->fixed_tick_rate = elf_read_sst_float(text, &pos);
+			}
+			else if(!strcmp(str, "max_ticks_per_frame"))
+			{
+				config->max_ticks_per_frame = elf_read_sst_int(text, &pos);
+			}
+			else if(!strcmp(str, "audio_stream_buffers"))
+			{
+				config->audio_stream_buffers = elf_read_sst_int(text, &pos);
+			}
+			else if(!strcmp(str, "shader_cache"))
+			{
+				// a directory for the compiled shader programs, empty turns the cache off
+				if(config->shader_cache) elf_destroy_string(config->shader_cache);
+				config->shader_cache = elf_read_sst_string(text, &pos);
+			}
+			else if(!strcmp(str, "pak_benchmark"))
+			{
+				config->pak_benchmark = elf_read_sst_bool(text, &pos);
+			}
+			else if(!strcmp(str, "cull_benchmark"))
+			{
+				config->cull_benchmark = elf_read_sst_bool(text, &pos);
+			}
+			else if(!strcmp(str, "skin_benchmark"))
+			{
+				config->skin_benchmark = elf_read_sst_bool(text, &pos);
+			}
+			else if(!strcmp(str, "scene_benchmark"))
+			{
+				config->scene_benchmark = elf_read_sst_bool(text, &pos);
+			}
+			else if(!strcmp(str, "benchmark_ticks"))
+			{
+				config->benchmark_ticks = elf_read_sst_int(text, &pos);
+			}
+			else if(!strcmp(str, "benchmark_tick_rate"))
+			{
+				config->benchmark_tick_rate = elf_read_sst_float(text, &pos);
+			}
+			else if(!strcmp(str, "benchmark_report"))
+			{
+				if(config->benchmark_report) elf_destroy_string(config->benchmark_report);
+				config->benchmark_report = elf_read_sst_string(text, &pos);
+			}
 			else if(!strcmp(str, "{"))
 			{
 				scope++;
@@ -146,6 +235,11 @@ unsigned char elf_get_config_fullscreen(elf_config *config)
 	return !config->fullscreen == ELF_FALSE;
 }
 
+unsigned char elf_get_config_headless(elf_config *config)
+{
+	return !config->headless == ELF_FALSE;
+}
+
 float elf_get_config_texture_anisotropy(elf_config *config)
 {
 	return config->texture_anisotropy;
@@ -173,6 +173,39 @@ unsigned char elf_init_context(int width, int height,
 
 	free(vidmodes);
 
+	elf_start_log_writer(gen->logger);
+
+	return ELF_TRUE;
+}
+
+unsigned char elf_init_context_headless(int width, int height, const char *title)
+{
+	if(ctx)
+	{
+		elf_write_to_log("warning: can not open window twice\n");
+		return ELF_FALSE;
+	}
+
+	if(width < 1 || height < 1)
+	{
+		elf_set_error(ELF_INVALID_SIZE, "error: invalid window size (%d, %d)\n", width, height);
+		return ELF_FALSE;
+	}
+
+	ctx = elf_create_context();
+	elf_inc_ref((elf_object*)ctx);
+
+	ctx->width = width;
+	ctx->height = height;
+	ctx->headless = ELF_TRUE;
+	ctx->title = elf_create_string(title);
+
+	// no window is opened and there is no input. the clock and the threads don't go through glfw,
+	// without a display glfwInit fails on x11 and headless runs anyway
+	if(!glfwInit()) elf_log(ELF_LOG_ERROR, "error: can't initialize glfw, running without it\n");
+
+	elf_start_log_writer(gen->logger);
+
 	return ELF_TRUE;
 }
 
@@ -180,6 +213,8 @@ void elf_deinit_context()
 {
 	if(!ctx) return;
 
+	elf_stop_log_writer(gen->logger);
+
 	glfwTerminate();
 
 	elf_dec_ref((elf_object*)ctx);
@@ -233,6 +268,8 @@ unsigned char elf_init_context_with_hwnd(int width, int height,
 	glfwSetKeyCallback(key_callback);
 	glfwSetCharCallback(char_callback);
 
+	elf_start_log_writer(gen->logger);
+
 	return ELF_TRUE;
 }
 
@@ -248,7 +285,7 @@ unsigned char elf_resize_context(int width, int height)
 	if(width <= 0 || height <= 0 || (width == ctx->width &&
 		height == ctx->height)) return ELF_FALSE;
 
-	glfwSetWindowSize(width, height);
+	if(!ctx->headless) glfwSetWindowSize(width, height);
 	ctx->width = width;
 	ctx->height = height;
 
@@ -263,6 +300,8 @@ void elf_set_title(const char *title)
 
 	ctx->title = elf_create_string(title);
 
+	if(ctx->headless) return;
+
 	glfwSetWindowTitle(title);
 	glfwPollEvents();
 }
@@ -316,14 +355,40 @@ int elf_get_multisamples()
 
 double elf_get_time()
 {
-	return glfwGetTime();
+	static double base = -1.0;
+	double time;
+#ifdef ELF_WINDOWS
+	LARGE_INTEGER count;
+	LARGE_INTEGER frequency;
+
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&count);
+	time = (double)count.QuadPart/(double)frequency.QuadPart;
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	time = (double)now.tv_sec+(double)now.tv_nsec/1000000000.0;
+#endif
+
+	// seconds since the first call, elf_init_general makes that the start of the program
+	if(base < 0.0) base = time;
+
+	return time-base;
 }
 
 unsigned char elf_is_window_opened()
 {
+	if(ctx->headless) return ELF_TRUE;
 	return glfwGetWindowParam(GLFW_OPENED);
 }
 
+unsigned char elf_is_headless()
+{
+	if(!ctx) return ELF_FALSE;
+	return ctx->headless;
+}
+
 void elf_swap_buffers()
 {
 	int i;
@@ -343,6 +408,8 @@ void elf_swap_buffers()
 		}
 	}
 
+	if(ctx->headless) return;
+
 	glfwSwapBuffers();
 
 	for(i = 0; i < 16; i++)
@@ -491,7 +558,7 @@ elf_vec2i elf_get_mouse_force()
 
 void elf_set_mouse_position(int x, int y)
 {
-	glfwSetMousePos(x, y);
+	if(!ctx->headless) glfwSetMousePos(x, y);
 
 	ctx->mouse_position[0] = x;
 	ctx->mouse_position[1] = y;
@@ -504,6 +571,12 @@ void elf_set_mouse_position(int x, int y)
 
 void elf_hide_mouse(unsigned char hide)
 {
+	if(ctx->headless)
+	{
+		ctx->hide_mouse = !hide ? ELF_FALSE : ELF_TRUE;
+		return;
+	}
+
 	if(hide)
 	{
 		glfwDisable(GLFW_MOUSE_CURSOR);
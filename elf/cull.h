@@ -0,0 +1,263 @@
+
+// frustum culling of many bounding volumes at once. the volumes are kept as separate arrays
+// of centers, extents and radii, so sse can test four of them against a plane together.
+// the corner of a box furthest along a plane normal is at a distance of
+// dot(n, center)+d+|n.x|*extent.x+|n.y|*extent.y+|n.z|*extent.z, spheres add their radius.
+
+elf_cull_set* elf_create_cull_set()
+{
+	elf_cull_set *set;
+
+	set = (elf_cull_set*)malloc(sizeof(elf_cull_set));
+	memset(set, 0x0, sizeof(elf_cull_set));
+
+	elf_inc_obj_count();
+
+	return set;
+}
+
+void elf_destroy_cull_set(elf_cull_set *set)
+{
+	int i;
+
+	for(i = 0; i < 3; i++)
+	{
+		if(set->center[i]) free(set->center[i]);
+		if(set->extent[i]) free(set->extent[i]);
+	}
+	if(set->radius) free(set->radius);
+	if(set->objects) free(set->objects);
+	if(set->visible) free(set->visible);
+
+	free(set);
+
+	elf_dec_obj_count();
+}
+
+void elf_clear_cull_set(elf_cull_set *set)
+{
+	set->count = 0;
+}
+
+void elf_grow_cull_set(elf_cull_set *set)
+{
+	int capacity;
+	int i;
+
+	// always a multiple of four, the sse loop reads the last group as a whole
+	capacity = set->capacity ? set->capacity*2 : 256;
+
+	for(i = 0; i < 3; i++)
+	{
+		set->center[i] = (float*)realloc(set->center[i], sizeof(float)*capacity);
+		set->extent[i] = (float*)realloc(set->extent[i], sizeof(float)*capacity);
+		memset(set->center[i]+set->capacity, 0x0, sizeof(float)*(capacity-set->capacity));
+		memset(set->extent[i]+set->capacity, 0x0, sizeof(float)*(capacity-set->capacity));
+	}
+	set->radius = (float*)realloc(set->radius, sizeof(float)*capacity);
+	memset(set->radius+set->capacity, 0x0, sizeof(float)*(capacity-set->capacity));
+	set->objects = (elf_object**)realloc(set->objects, sizeof(elf_object*)*capacity);
+	set->visible = (unsigned int*)realloc(set->visible, sizeof(unsigned int)*(capacity/32));
+
+	set->capacity = capacity;
+}
+
+void elf_add_aabb_to_cull_set(elf_cull_set *set, elf_object *obj, const float *min, const float *max)
+{
+	int i;
+
+	if(set->count >= set->capacity) elf_grow_cull_set(set);
+
+	for(i = 0; i < 3; i++)
+	{
+		set->center[i][set->count] = (min[i]+max[i])*0.5;
+		set->extent[i][set->count] = (max[i]-min[i])*0.5;
+	}
+	set->radius[set->count] = 0.0;
+	set->objects[set->count] = obj;
+
+	set->count++;
+}
+
+void elf_add_sphere_to_cull_set(elf_cull_set *set, elf_object *obj, const float *pos, float radius)
+{
+	int i;
+
+	if(set->count >= set->capacity) elf_grow_cull_set(set);
+
+	for(i = 0; i < 3; i++)
+	{
+		set->center[i][set->count] = pos[i];
+		set->extent[i][set->count] = 0.0;
+	}
+	set->radius[set->count] = radius;
+	set->objects[set->count] = obj;
+
+	set->count++;
+}
+
+void elf_cull_set_in_frustum(elf_cull_set *set, elf_camera *camera)
+{
+	float abs_plane[6][3];
+	int i, j;
+#ifdef ELF_SSE
+	__m128 planes[6][7];
+	__m128 cx, cy, cz, ex, ey, ez, r;
+	__m128 dist, out, zero;
+	unsigned int mask;
+#else
+	float dist;
+#endif
+
+	if(!set->count) return;
+
+	memset(set->visible, 0x0, sizeof(unsigned int)*((set->count+31)/32));
+
+	for(j = 0; j < 6; j++)
+	{
+		abs_plane[j][0] = fabs(camera->frustum[j][0]);
+		abs_plane[j][1] = fabs(camera->frustum[j][1]);
+		abs_plane[j][2] = fabs(camera->frustum[j][2]);
+	}
+
+#ifdef ELF_SSE
+	for(j = 0; j < 6; j++)
+	{
+		planes[j][0] = _mm_set1_ps(camera->frustum[j][0]);
+		planes[j][1] = _mm_set1_ps(camera->frustum[j][1]);
+		planes[j][2] = _mm_set1_ps(camera->frustum[j][2]);
+		planes[j][3] = _mm_set1_ps(camera->frustum[j][3]);
+		planes[j][4] = _mm_set1_ps(abs_plane[j][0]);
+		planes[j][5] = _mm_set1_ps(abs_plane[j][1]);
+		planes[j][6] = _mm_set1_ps(abs_plane[j][2]);
+	}
+
+	zero = _mm_setzero_ps();
+
+	for(i = 0; i < set->count; i += 4)
+	{
+		cx = _mm_loadu_ps(set->center[0]+i);
+		cy = _mm_loadu_ps(set->center[1]+i);
+		cz = _mm_loadu_ps(set->center[2]+i);
+		ex = _mm_loadu_ps(set->extent[0]+i);
+		ey = _mm_loadu_ps(set->extent[1]+i);
+		ez = _mm_loadu_ps(set->extent[2]+i);
+		r = _mm_loadu_ps(set->radius+i);
+
+		out = zero;
+		for(j = 0; j < 6; j++)
+		{
+			dist = _mm_add_ps(_mm_mul_ps(planes[j][0], cx), _mm_mul_ps(planes[j][1], cy));
+			dist = _mm_add_ps(dist, _mm_mul_ps(planes[j][2], cz));
+			dist = _mm_add_ps(dist, planes[j][3]);
+			dist = _mm_add_ps(dist, _mm_mul_ps(planes[j][4], ex));
+			dist = _mm_add_ps(dist, _mm_mul_ps(planes[j][5], ey));
+			dist = _mm_add_ps(dist, _mm_mul_ps(planes[j][6], ez));
+			dist = _mm_add_ps(dist, r);
+			out = _mm_or_ps(out, _mm_cmple_ps(dist, zero));
+		}
+
+		mask = (~_mm_movemask_ps(out))&0xF;
+		set->visible[i>>5] |= mask<<(i&31);
+	}
+
+	// the last group may have read past the end
+	if(set->count&31) set->visible[set->count>>5] &= (1u<<(set->count&31))-1;
+#else
+	for(i = 0; i < set->count; i++)
+	{
+		for(j = 0; j < 6; j++)
+		{
+			dist = camera->frustum[j][0]*set->center[0][i]+camera->frustum[j][1]*set->center[1][i]+
+				camera->frustum[j][2]*set->center[2][i]+camera->frustum[j][3]+
+				abs_plane[j][0]*set->extent[0][i]+abs_plane[j][1]*set->extent[1][i]+
+				abs_plane[j][2]*set->extent[2][i]+set->radius[i];
+			if(dist <= 0.0) break;
+		}
+
+		if(j == 6) set->visible[i>>5] |= 1u<<(i&31);
+	}
+#endif
+}
+
+unsigned char elf_get_cull_set_visible(elf_cull_set *set, int idx)
+{
+	return (set->visible[idx>>5]>>(idx&31))&1;
+}
+
+elf_object* elf_get_cull_set_object(elf_cull_set *set, int idx)
+{
+	return set->objects[idx];
+}
+
+void elf_benchmark_culling()
+{
+	elf_camera *camera;
+	elf_cull_set *set;
+	float *mins;
+	float *maxs;
+	float size;
+	double time;
+	int counts[3] = {10000, 50000, 100000};
+	int visible;
+	int i, j, k;
+
+	camera = elf_create_camera("CullBenchmark");
+	elf_inc_ref((elf_object*)camera);
+
+	elf_set_camera_perspective(camera, 60.0, 1.333, 1.0, 250.0);
+	elf_camera_pre_draw(camera);
+
+	set = elf_create_cull_set();
+
+	mins = (float*)malloc(sizeof(float)*3*counts[2]);
+	maxs = (float*)malloc(sizeof(float)*3*counts[2]);
+
+	// random boxes around the camera, about one in seven ends up inside the frustum
+	srand(1234);
+	for(i = 0; i < counts[2]; i++)
+	{
+		size = 0.5+(float)rand()/(float)RAND_MAX*2.0;
+		for(j = 0; j < 3; j++)
+		{
+			mins[i*3+j] = ((float)rand()/(float)RAND_MAX-0.5)*400.0;
+			maxs[i*3+j] = mins[i*3+j]+size;
+		}
+	}
+
+	for(k = 0; k < 3; k++)
+	{
+		visible = 0;
+		time = elf_get_time();
+		for(j = 0; j < 20; j++)
+		{
+			for(i = 0; i < counts[k]; i++)
+				if(elf_aabb_inside_frustum(camera, &mins[i*3], &maxs[i*3])) visible++;
+		}
+		time = elf_get_time()-time;
+
+		elf_write_to_log("cull benchmark: %d boxes, one at a time: %f ms, %d visible\n", counts[k], time/20.0*1000.0, visible/20);
+
+		visible = 0;
+		time = elf_get_time();
+		for(j = 0; j < 20; j++)
+		{
+			elf_clear_cull_set(set);
+			for(i = 0; i < counts[k]; i++)
+				elf_add_aabb_to_cull_set(set, NULL, &mins[i*3], &maxs[i*3]);
+			elf_cull_set_in_frustum(set, camera);
+			for(i = 0; i < counts[k]; i++)
+				if(elf_get_cull_set_visible(set, i)) visible++;
+		}
+		time = elf_get_time()-time;
+
+		elf_write_to_log("cull benchmark: %d boxes, batched: %f ms, %d visible\n", counts[k], time/20.0*1000.0, visible/20);
+	}
+
+	free(mins);
+	free(maxs);
+
+	elf_destroy_cull_set(set);
+	elf_dec_ref((elf_object*)camera);
+}
+
@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdarg.h>
+#include <signal.h>
 #include <math.h>
 #include <malloc.h>
 #include <sys/types.h>
@@ -20,6 +21,21 @@
 	#define _WINSOCKAPI_
 	#include <windows.h>
 	#include <strsafe.h>
+	#include <io.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <time.h>
+	#include <errno.h>
+	#include <pthread.h>
+	#include <sched.h>
+#endif
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#define ELF_SSE
+	#include <xmmintrin.h>
 #endif
 
 #include <GL/glfw.h>
@@ -50,6 +66,18 @@
 #include <assimp/aiPostProcess.h>
 #include <assimp/aiScene.h>
 
+// shared by the threads of the engine, elf_atomic_add returns the old value
+#ifdef ELF_WINDOWS
+	#define elf_atomic_add(ptr, value) InterlockedExchangeAdd((volatile LONG*)(ptr), (LONG)(value))
+	#define elf_atomic_cas(ptr, old_value, new_value) \
+		(InterlockedCompareExchange((volatile LONG*)(ptr), (LONG)(new_value), (LONG)(old_value)) == (LONG)(old_value))
+	#define elf_memory_barrier() MemoryBarrier()
+#else
+	#define elf_atomic_add(ptr, value) __sync_fetch_and_add((ptr), (value))
+	#define elf_atomic_cas(ptr, old_value, new_value) __sync_bool_compare_and_swap((ptr), (old_value), (new_value))
+	#define elf_memory_barrier() __sync_synchronize()
+#endif
+
 /* 
 	End of File 
 */
@@ -10,16 +10,15 @@ elf_engine* elf_create_engine()
 	engine->type = ELF_ENGINE;
 
 	engine->fps_timer = elf_create_timer();
-	engine->fps_limit_timer = elf_create_timer();
 	engine->time_sync_timer = elf_create_timer();
 
 	elf_inc_ref((elf_object*)engine->fps_timer);
-	elf_inc_ref((elf_object*)engine->fps_limit_timer);
 	elf_inc_ref((elf_object*)engine->time_sync_timer);
 
 	engine->free_run = ELF_TRUE;
 	engine->fps_limit = 0;
 	engine->speed = 1.0;
+	engine->max_ticks_per_frame = 5;
 	engine->f10_exit = ELF_TRUE;
 
 	engine->shadow_map_size = 1024;
@@ -35,6 +34,13 @@ elf_engine* elf_create_engine()
 	engine->sprite_vertex_array = gfx_create_vertex_array(GFX_FALSE);
 	gfx_inc_ref((gfx_object*)engine->sprite_vertex_array);
 
+	engine->workers = elf_create_workers();
+	engine->pacer = elf_create_frame_pacer();
+
+#ifdef ELF_PROFILE
+	engine->profiler = elf_create_profiler();
+#endif
+
 	vertex_data = gfx_create_vertex_data(36, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
 
 	vertex_buffer = gfx_get_vertex_data_buffer(vertex_data);
@@ -166,6 +172,8 @@ elf_engine* elf_create_engine()
 
 void elf_destroy_engine(elf_engine *engine)
 {
+	if(engine->scene_loader) elf_dec_ref((elf_object*)engine->scene_loader);
+
 	gfx_dec_ref((gfx_object*)engine->lines);
 	gfx_dec_ref((gfx_object*)engine->sprite_vertex_array);
 
@@ -177,9 +185,12 @@ void elf_destroy_engine(elf_engine *engine)
 	gfx_destroy_texture(engine->shadow_map);
 
 	elf_dec_ref((elf_object*)engine->fps_timer);
-	elf_dec_ref((elf_object*)engine->fps_limit_timer);
 	elf_dec_ref((elf_object*)engine->time_sync_timer);
 
+	elf_destroy_workers(engine->workers);
+	elf_destroy_frame_pacer(engine->pacer);
+	if(engine->profiler) elf_destroy_profiler(engine->profiler);
+
 	free(engine);
 
 	gfx_deinit();
@@ -232,6 +243,27 @@ unsigned char elf_init(int width, int height,
 	return ELF_TRUE;
 }
 
+unsigned char elf_init_headless(int width, int height, const char *log)
+{
+	elf_init_general();
+	elf_set_log_file_path(log);
+
+	elf_start_log("BlendELF 0.9 Beta\n");
+
+	if(!elf_init_context_headless(width, height, "BlendELF")) return ELF_FALSE;
+	if(!gfx_init_headless())
+	{
+		elf_deinit_context();
+		return ELF_FALSE;
+	}
+	elf_init_audio();
+	elf_init_engine();
+	elf_init_scripting();
+	elf_init_networking();
+
+	return ELF_TRUE;
+}
+
 unsigned char elf_init_with_config(const char *file_path)
 {
 	elf_config *config;
@@ -241,7 +273,8 @@ unsigned char elf_init_with_config(const char *file_path)
 	if(!(config = elf_read_config("config.txt")))
 		config = elf_create_config();
 
-	if(!elf_init(config->window_size[0], config->window_size[1], "BlendELF", !config->fullscreen == ELF_FALSE, config->log))
+	if((config->headless && !elf_init_headless(config->window_size[0], config->window_size[1], config->log)) ||
+		(!config->headless && !elf_init(config->window_size[0], config->window_size[1], "BlendELF", !config->fullscreen == ELF_FALSE, config->log)))
 	{
 		elf_set_error(ELF_CANT_INITIALIZE, "error: could not initialize engine\n");
 		elf_destroy_config(config);
@@ -250,6 +283,14 @@ unsigned char elf_init_with_config(const char *file_path)
 
 	elf_set_texture_anisotropy(config->texture_anisotropy);
 	elf_set_shadow_map_size(config->shadow_map_size);
+	elf_set_log_level(config->log_level);
+	elf_set_script_gc_mode(config->script_gc_mode);
+	elf_set_script_gc_budget(config->script_gc_budget);
+	elf_set_script_gc_step_size(config->script_gc_step_size);
+	elf_set_fixed_tick_rate(config->fixed_tick_rate);
+	elf_set_max_ticks_per_frame(config->max_ticks_per_frame);
+	elf_set_audio_stream_buffer_count(config->audio_stream_buffers);
+	elf_set_shader_cache_path(config->shader_cache);
 
 	if(strlen(config->start) > 0) elf_load_scene(config->start);
 
@@ -260,39 +301,96 @@ unsigned char elf_init_with_config(const char *file_path)
 
 void elf_limit_engine_fps()
 {
-	if(eng->fps_limit > 0)
+	elf_pace_frame(eng->pacer, eng->fps_limit);
+}
+
+void elf_run_engine_ticks(float elapsed)
+{
+	// the scene only ever advances in whole ticks of fixed_tick_rate, the rest of the time carries
+	// over to the next frame and blends the drawn transforms between the last two ticks. past
+	// max_ticks_per_frame the backlog is dropped, a slow frame would otherwise make the next slower
+	eng->tick_time += elapsed;
+	eng->sync = eng->fixed_tick_rate;
+	eng->frame_ticks = 0;
+
+	while(eng->tick_time >= eng->fixed_tick_rate && eng->frame_ticks < eng->max_ticks_per_frame)
 	{
-		if(elf_get_elapsed_time(eng->fps_limit_timer) > 0.0)
+		if(eng->scene)
 		{
-			while(elf_get_elapsed_time(eng->fps_limit_timer) < 1.0/(float)eng->fps_limit);
-			elf_start_timer(eng->fps_limit_timer);
-		}
-		else
-		{
-			elf_start_timer(eng->fps_limit_timer);
+			ELF_PROFILE_BEGIN("update scene");
+			elf_save_scene_transforms(eng->scene);
+			elf_update_scene(eng->scene, eng->fixed_tick_rate);
+			ELF_PROFILE_END();
 		}
+
+		eng->tick_time -= eng->fixed_tick_rate;
+		eng->frame_ticks++;
 	}
+
+	if(eng->tick_time >= eng->fixed_tick_rate)
+		eng->tick_time = fmod(eng->tick_time, (double)eng->fixed_tick_rate);
+
+	if(eng->scene && eng->frame_ticks > 0) elf_update_scene_transforms(eng->scene);
+
+	gfx_set_transform_blend((float)(eng->tick_time/eng->fixed_tick_rate));
+
+	// the frame scripts see the time the scene advanced this frame
+	eng->sync = eng->fixed_tick_rate*eng->frame_ticks;
 }
 
 void elf_update_engine()
 {
+	float elapsed;
+
+	if(eng->scene_loader && elf_update_scene_loader(eng->scene_loader))
+	{
+		elf_set_scene(eng->scene_loader->scene);
+		elf_warm_up_scene_shaders(eng->scene);
+		elf_dec_ref((elf_object*)eng->scene_loader);
+		eng->scene_loader = NULL;
+	}
+
+	ELF_PROFILE_BEGIN("audio");
 	elf_update_audio();
+	ELF_PROFILE_END();
 
 	if(elf_get_elapsed_time(eng->time_sync_timer) > 0.0)
 	{
-		if(elf_about_zero(eng->tick_rate))
-			eng->sync = (eng->sync*4.0+((float)elf_get_elapsed_time(eng->time_sync_timer)*eng->speed))/5.0;
-		else eng->sync = eng->tick_rate;
+		if(eng->fixed_tick_rate > 0.0)
+		{
+			elapsed = (float)elf_get_elapsed_time(eng->time_sync_timer)*eng->speed;
+			elf_start_timer(eng->time_sync_timer);
 
-		elf_start_timer(eng->time_sync_timer);
+			ELF_PROFILE_BEGIN("update gui");
+			if(eng->gui) elf_update_gui(eng->gui, elapsed);
+			ELF_PROFILE_END();
 
-		if(eng->sync > 0.0)
+			elf_run_engine_ticks(elapsed);
+		}
+		else
 		{
-			if(eng->gui) elf_update_gui(eng->gui, eng->sync);
+			if(elf_about_zero(eng->tick_rate))
+				eng->sync = (eng->sync*4.0+((float)elf_get_elapsed_time(eng->time_sync_timer)*eng->speed))/5.0;
+			else eng->sync = eng->tick_rate;
 
-			if(eng->scene)
+			elf_start_timer(eng->time_sync_timer);
+
+			eng->frame_ticks = 0;
+
+			if(eng->sync > 0.0)
 			{
-				elf_update_scene(eng->scene, eng->sync);
+				ELF_PROFILE_BEGIN("update gui");
+				if(eng->gui) elf_update_gui(eng->gui, eng->sync);
+				ELF_PROFILE_END();
+
+				if(eng->scene)
+				{
+					ELF_PROFILE_BEGIN("update scene");
+					elf_update_scene(eng->scene, eng->sync);
+					ELF_PROFILE_END();
+				}
+
+				eng->frame_ticks = 1;
 			}
 		}
 	}
@@ -301,7 +399,9 @@ void elf_update_engine()
 		elf_start_timer(eng->time_sync_timer);
 	}
 
+	ELF_PROFILE_BEGIN("scripting");
 	elf_update_scripting();
+	ELF_PROFILE_END();
 }
 
 void elf_count_engine_fps()
@@ -335,6 +435,8 @@ unsigned char elf_run()
 		return ELF_FALSE;
 	}
 
+	ELF_PROFILE_BEGIN_FRAME();
+
 	gfx_reset_vertices_drawn();
 
 	if(eng->scene && eng->post_process) elf_begin_post_process(eng->post_process, eng->scene);
@@ -342,21 +444,45 @@ unsigned char elf_run()
 
 	if(eng->scene)
 	{
+		ELF_PROFILE_BEGIN("pre draw");
 		elf_scene_pre_draw(eng->scene);
+		ELF_PROFILE_END();
+
+		ELF_PROFILE_BEGIN("draw scene");
 		elf_draw_scene(eng->scene);
+		ELF_PROFILE_END();
+
+		ELF_PROFILE_BEGIN("post draw");
 		elf_scene_post_draw(eng->scene);
+		ELF_PROFILE_END();
 	}
 
+	ELF_PROFILE_BEGIN("post process");
 	if(eng->scene && eng->post_process) elf_end_post_process(eng->post_process, eng->scene);
+	ELF_PROFILE_END();
+
 	if(eng->scene && eng->debug_draw) elf_draw_scene_debug(eng->scene);
+
+	ELF_PROFILE_BEGIN("draw gui");
 	if(eng->gui) elf_draw_gui(eng->gui);
+	ELF_PROFILE_END();
 
+	ELF_PROFILE_BEGIN("swap buffers");
 	elf_swap_buffers();
+	ELF_PROFILE_END();
 
+	ELF_PROFILE_BEGIN("limit fps");
 	elf_limit_engine_fps();
+	ELF_PROFILE_END();
+
+	ELF_PROFILE_BEGIN("update");
 	elf_update_engine();
+	ELF_PROFILE_END();
+
 	elf_count_engine_fps();
 
+	ELF_PROFILE_END_FRAME();
+
 	eng->free_run = ELF_TRUE;
 
 	return ELF_TRUE;
@@ -468,14 +594,55 @@ elf_scene* elf_load_scene(const char *file_path)
 	scene = elf_create_scene_from_file(file_path);
 	if(scene)
 	{
+		// the last requested scene wins
+		if(eng->scene_loader)
+		{
+			elf_dec_ref((elf_object*)eng->scene_loader);
+			eng->scene_loader = NULL;
+		}
+
 		if(eng->scene) elf_dec_ref((elf_object*)eng->scene);
 		eng->scene = scene;
 		elf_inc_ref((elf_object*)eng->scene);
+
+		// compile the programs now rather than on the first frames they are drawn in
+		elf_warm_up_scene_shaders(scene);
 	}
 
 	return scene;
 }
 
+unsigned char elf_load_scene_async(const char *file_path)
+{
+	elf_pak *pak;
+	char *type;
+
+	type = strrchr(file_path, '.');
+
+	// only pak files can be loaded in the background
+	if(!type || strcmp(type, ".pak")) return elf_load_scene(file_path) != NULL;
+
+	pak = elf_create_pak_from_file(file_path);
+	if(!pak) return ELF_FALSE;
+
+	if(eng->scene_loader) elf_dec_ref((elf_object*)eng->scene_loader);
+	eng->scene_loader = elf_create_scene_loader(pak);
+	elf_inc_ref((elf_object*)eng->scene_loader);
+
+	return ELF_TRUE;
+}
+
+unsigned char elf_is_scene_loading()
+{
+	return eng->scene_loader != NULL;
+}
+
+float elf_get_scene_load_progress()
+{
+	if(!eng->scene_loader) return 1.0;
+	return elf_get_scene_loader_progress(eng->scene_loader);
+}
+
 void elf_set_scene(elf_scene *scene)
 {
 	if(eng->scene) elf_dec_ref((elf_object*)eng->scene);
@@ -532,6 +699,43 @@ float elf_get_tick_rate()
 	return eng->tick_rate;
 }
 
+void elf_set_fixed_tick_rate(float tick_rate)
+{
+	eng->fixed_tick_rate = tick_rate;
+	if(eng->fixed_tick_rate < 0.0) eng->fixed_tick_rate = 0.0;
+
+	// drawn as is until the scene has ticked twice in the new mode
+	eng->tick_time = 0.0;
+	gfx_set_transform_blend(1.0);
+	if(eng->scene) elf_reset_scene_transforms(eng->scene);
+}
+
+float elf_get_fixed_tick_rate()
+{
+	return eng->fixed_tick_rate;
+}
+
+void elf_set_max_ticks_per_frame(int max_ticks)
+{
+	eng->max_ticks_per_frame = max_ticks;
+	if(eng->max_ticks_per_frame < 1) eng->max_ticks_per_frame = 1;
+}
+
+int elf_get_max_ticks_per_frame()
+{
+	return eng->max_ticks_per_frame;
+}
+
+int elf_get_frame_ticks()
+{
+	return eng->frame_ticks;
+}
+
+float elf_get_tick_blend()
+{
+	return gfx_get_transform_blend();
+}
+
 void elf_set_speed(float speed)
 {
 	eng->speed = speed;
@@ -547,6 +751,12 @@ unsigned char elf_save_screen_shot(const char *file_path)
 {
 	unsigned char *data;
 
+	if(elf_is_headless())
+	{
+		elf_set_error(ELF_MISSING_FEATURE, "error: can't save screen shot \"%s\", nothing is rendered when headless\n", file_path);
+		return ELF_FALSE;
+	}
+
 	data = (unsigned char*)malloc(sizeof(unsigned char)*elf_get_window_width()*elf_get_window_height()*4);
 
 	gfx_read_pixels(0, 0, elf_get_window_width(), elf_get_window_height(), GFX_BGRA, GFX_UBYTE, data);
@@ -596,6 +806,51 @@ int elf_get_polygons_rendered()
 	return gfx_get_vertices_drawn(GFX_TRIANGLES)/3+gfx_get_vertices_drawn(GFX_TRIANGLE_STRIP)/3;
 }
 
+int elf_get_draw_calls()
+{
+	return gfx_get_draw_calls();
+}
+
+int elf_get_state_changes()
+{
+	return gfx_get_state_changes();
+}
+
+int elf_get_texture_memory()
+{
+	return gfx_get_texture_memory();
+}
+
+int elf_get_vertex_buffer_memory()
+{
+	return gfx_get_vertex_buffer_memory();
+}
+
+void elf_set_shader_cache_path(const char *path)
+{
+	gfx_set_shader_cache_path(path);
+}
+
+const char* elf_get_shader_cache_path()
+{
+	return gfx_get_shader_cache_path();
+}
+
+unsigned char elf_is_shader_binary_cache_supported()
+{
+	return gfx_is_shader_binary_cache_supported();
+}
+
+int elf_get_shader_cache_hits()
+{
+	return gfx_get_shader_cache_hits();
+}
+
+int elf_get_shader_program_count()
+{
+	return gfx_get_shader_program_count();
+}
+
 void elf_set_bloom(float threshold)
 {
 	if(!eng->post_process) eng->post_process = elf_create_post_process();
@@ -17,6 +17,7 @@ elf_entity* elf_create_entity(const char *name)
 	elf_inc_ref((elf_object*)entity->materials);
 
 	entity->culled = ELF_TRUE;
+	entity->bvh_leaf = -1;
 
 	entity->dobject = elf_create_physics_object_box(0.2, 0.2, 0.2, 0.0, 0.0, 0.0, 0.0);
 	elf_set_physics_object_actor(entity->dobject, (elf_actor*)entity);
@@ -57,6 +58,7 @@ void elf_generate_entity_tangents(elf_entity *entity)
 
 void elf_update_entity(elf_entity *entity)
 {
+	// the transform was synced to the physics by the scene
 	elf_update_actor((elf_actor*)entity);
 	elf_update_frame_player(entity->armature_player);
 }
@@ -65,19 +67,12 @@ void elf_entity_pre_draw(elf_entity *entity)
 {
 	elf_actor_pre_draw((elf_actor*)entity);
 
-	gfx_get_transform_position(entity->transform, &entity->position.x);
-
 	if(entity->armature && fabs(elf_get_frame_player_frame(entity->armature_player)-entity->prev_armature_frame) > 0.0001 &&
 		elf_get_frame_player_frame(entity->armature_player) <= entity->armature->frame_count)
 	{
 		elf_deform_entity_with_armature(entity->armature, entity, elf_get_frame_player_frame(entity->armature_player));
 		entity->prev_armature_frame = elf_get_frame_player_frame(entity->armature_player);
 	}
-
-	if(entity->moved)
-	{
-		elf_calc_entity_aabb(entity);
-	}
 }
 
 void elf_entity_post_draw(elf_entity *entity)
@@ -103,112 +98,103 @@ void elf_destroy_entity(elf_entity *entity)
 	elf_dec_obj_count();
 }
 
-void elf_eval_entity_aabb_corner(elf_entity *entity, elf_vec4f *orient, elf_vec3f *corner, elf_vec3f *result)
+void elf_rotate_entity_aabb(float *mat, float *center, float *extent, float *min, float *max)
 {
-	corner->x -= entity->bb_offset.x;
-	corner->y -= entity->bb_offset.y;
-	corner->z -= entity->bb_offset.z;
-	gfx_mul_qua_vec(&orient->x, &corner->x, &result->x);
-
-	if(result->x < entity->cull_aabb_min.x) entity->cull_aabb_min.x = result->x;
-	if(result->y < entity->cull_aabb_min.y) entity->cull_aabb_min.y = result->y;
-	if(result->z < entity->cull_aabb_min.z) entity->cull_aabb_min.z = result->z;
-	if(result->x > entity->cull_aabb_max.x) entity->cull_aabb_max.x = result->x;
-	if(result->y > entity->cull_aabb_max.y) entity->cull_aabb_max.y = result->y;
-	if(result->z > entity->cull_aabb_max.z) entity->cull_aabb_max.z = result->z;
-}
-
-void elf_eval_entity_aabb_armature_corner(elf_entity *entity, elf_vec4f *orient, elf_vec3f *corner, elf_vec3f *result)
-{
-	gfx_mul_qua_vec(&orient->x, &corner->x, &result->x);
+	float c, e;
+	int i;
 
-	if(result->x < entity->cull_aabb_min.x) entity->cull_aabb_min.x = result->x;
-	if(result->y < entity->cull_aabb_min.y) entity->cull_aabb_min.y = result->y;
-	if(result->z < entity->cull_aabb_min.z) entity->cull_aabb_min.z = result->z;
-	if(result->x > entity->cull_aabb_max.x) entity->cull_aabb_max.x = result->x;
-	if(result->y > entity->cull_aabb_max.y) entity->cull_aabb_max.y = result->y;
-	if(result->z > entity->cull_aabb_max.z) entity->cull_aabb_max.z = result->z;
+	// rotating the center and the extents gives the same box as rotating all of the corners
+	for(i = 0; i < 3; i++)
+	{
+		c = mat[i*4]*center[0]+mat[i*4+1]*center[1]+mat[i*4+2]*center[2];
+		e = fabs(mat[i*4])*extent[0]+fabs(mat[i*4+1])*extent[1]+fabs(mat[i*4+2])*extent[2];
+		min[i] = c-e;
+		max[i] = c+e;
+	}
 }
 
-void elf_calc_entity_aabb(elf_entity *entity)
+void elf_calc_entity_state_aabb(elf_entity *entity, float *position, float *orient, float *aabb_min, float *aabb_max)
 {
-	elf_vec3f position;
-	elf_vec4f orient;
-	elf_vec3f corner;
-	elf_vec3f result;
-
-	gfx_get_transform_position(entity->transform, &position.x);
-	gfx_get_transform_orientation(entity->transform, &orient.x);
-
-	corner = entity->bb_min;
-	corner.x -= entity->bb_offset.x;
-	corner.y -= entity->bb_offset.y;
-	corner.z -= entity->bb_offset.z;
-	gfx_mul_qua_vec(&orient.x, &corner.x, &result.x);
-	
-	entity->cull_aabb_min = corner;
-	entity->cull_aabb_max = corner;
-
-	corner.x = entity->bb_min.x; corner.y = entity->bb_max.y; corner.z = entity->bb_min.z;
-	elf_eval_entity_aabb_corner(entity, &orient, &corner, &result);
-
-	corner.x = entity->bb_min.x; corner.y = entity->bb_max.y; corner.z = entity->bb_max.z;
-	elf_eval_entity_aabb_corner(entity, &orient, &corner, &result);
-
-	corner.x = entity->bb_min.x; corner.y = entity->bb_min.y; corner.z = entity->bb_max.z;
-	elf_eval_entity_aabb_corner(entity, &orient, &corner, &result);
-
-	corner.x = entity->bb_max.x; corner.y = entity->bb_min.y; corner.z = entity->bb_min.z;
-	elf_eval_entity_aabb_corner(entity, &orient, &corner, &result);
+	float mat[16];
+	float center[3];
+	float extent[3];
+	float min[3];
+	float max[3];
+	int i;
 
-	corner.x = entity->bb_max.x; corner.y = entity->bb_max.y; corner.z = entity->bb_min.z;
-	elf_eval_entity_aabb_corner(entity, &orient, &corner, &result);
+	gfx_qua_to_matrix4(orient, mat);
 
-	corner.x = entity->bb_max.x; corner.y = entity->bb_max.y; corner.z = entity->bb_max.z;
-	elf_eval_entity_aabb_corner(entity, &orient, &corner, &result);
+	center[0] = (entity->bb_min.x+entity->bb_max.x)/2.0-entity->bb_offset.x;
+	center[1] = (entity->bb_min.y+entity->bb_max.y)/2.0-entity->bb_offset.y;
+	center[2] = (entity->bb_min.z+entity->bb_max.z)/2.0-entity->bb_offset.z;
+	extent[0] = (entity->bb_max.x-entity->bb_min.x)/2.0;
+	extent[1] = (entity->bb_max.y-entity->bb_min.y)/2.0;
+	extent[2] = (entity->bb_max.z-entity->bb_min.z)/2.0;
 
-	corner.x = entity->bb_max.x; corner.y = entity->bb_min.y; corner.z = entity->bb_max.z;
-	elf_eval_entity_aabb_corner(entity, &orient, &corner, &result);
+	elf_rotate_entity_aabb(mat, center, extent, aabb_min, aabb_max);
 
 	if(entity->armature)
 	{
-		corner.x = entity->arm_bb_min.x; corner.y = entity->arm_bb_min.y; corner.z = entity->arm_bb_min.z;
-		elf_eval_entity_aabb_armature_corner(entity, &orient, &corner, &result);
+		center[0] = (entity->arm_bb_min.x+entity->arm_bb_max.x)/2.0;
+		center[1] = (entity->arm_bb_min.y+entity->arm_bb_max.y)/2.0;
+		center[2] = (entity->arm_bb_min.z+entity->arm_bb_max.z)/2.0;
+		extent[0] = (entity->arm_bb_max.x-entity->arm_bb_min.x)/2.0;
+		extent[1] = (entity->arm_bb_max.y-entity->arm_bb_min.y)/2.0;
+		extent[2] = (entity->arm_bb_max.z-entity->arm_bb_min.z)/2.0;
 
-		corner.x = entity->arm_bb_min.x; corner.y = entity->arm_bb_max.y; corner.z = entity->arm_bb_min.z;
-		elf_eval_entity_aabb_armature_corner(entity, &orient, &corner, &result);
+		elf_rotate_entity_aabb(mat, center, extent, min, max);
 
-		corner.x = entity->arm_bb_min.x; corner.y = entity->arm_bb_max.y; corner.z = entity->arm_bb_max.z;
-		elf_eval_entity_aabb_armature_corner(entity, &orient, &corner, &result);
+		for(i = 0; i < 3; i++)
+		{
+			if(min[i] < aabb_min[i]) aabb_min[i] = min[i];
+			if(max[i] > aabb_max[i]) aabb_max[i] = max[i];
+		}
+	}
 
-		corner.x = entity->arm_bb_min.x; corner.y = entity->arm_bb_min.y; corner.z = entity->arm_bb_max.z;
-		elf_eval_entity_aabb_armature_corner(entity, &orient, &corner, &result);
+	for(i = 0; i < 3; i++)
+	{
+		aabb_min[i] += position[i];
+		aabb_max[i] += position[i];
+	}
+}
 
-		corner.x = entity->arm_bb_max.x; corner.y = entity->arm_bb_min.y; corner.z = entity->arm_bb_min.z;
-		elf_eval_entity_aabb_armature_corner(entity, &orient, &corner, &result);
+void elf_calc_entity_aabb(elf_entity *entity)
+{
+	float position[3];
+	float orient[4];
+	float min[3];
+	float max[3];
+	int i;
 
-		corner.x = entity->arm_bb_max.x; corner.y = entity->arm_bb_max.y; corner.z = entity->arm_bb_min.z;
-		elf_eval_entity_aabb_armature_corner(entity, &orient, &corner, &result);
+	gfx_get_transform_position(entity->transform, position);
+	gfx_get_transform_orientation(entity->transform, orient);
 
-		corner.x = entity->arm_bb_max.x; corner.y = entity->arm_bb_max.y; corner.z = entity->arm_bb_max.z;
-		elf_eval_entity_aabb_armature_corner(entity, &orient, &corner, &result);
+	elf_calc_entity_state_aabb(entity, position, orient, &entity->cull_aabb_min.x, &entity->cull_aabb_max.x);
 
-		corner.x = entity->arm_bb_max.x; corner.y = entity->arm_bb_min.y; corner.z = entity->arm_bb_max.z;
-		elf_eval_entity_aabb_armature_corner(entity, &orient, &corner, &result);
-	}
+	// a blended entity is drawn anywhere between its last two states, the box covers both
+	if(gfx_get_transform_prev_state(entity->transform, position, orient))
+	{
+		elf_calc_entity_state_aabb(entity, position, orient, min, max);
 
-	entity->cull_aabb_min.x += position.x;
-	entity->cull_aabb_min.y += position.y;
-	entity->cull_aabb_min.z += position.z;
-	entity->cull_aabb_max.x += position.x;
-	entity->cull_aabb_max.y += position.y;
-	entity->cull_aabb_max.z += position.z;
+		for(i = 0; i < 3; i++)
+		{
+			if(min[i] < (&entity->cull_aabb_min.x)[i]) (&entity->cull_aabb_min.x)[i] = min[i];
+			if(max[i] > (&entity->cull_aabb_max.x)[i]) (&entity->cull_aabb_max.x)[i] = max[i];
+		}
+	}
 }
 
 void elf_calc_entity_bounding_volumes(elf_entity *entity, unsigned char new_model)
 {
 	float max_scale;
 	elf_vec3f tmp_vec;
+	float position[3];
+	float orient[4];
+	float min[3];
+	float max[3];
+
+	// the culling box changes, let the scene know
+	entity->moved = ELF_TRUE;
 
 	if(!entity->model)
 	{
@@ -263,9 +249,14 @@ void elf_calc_entity_bounding_volumes(elf_entity *entity, unsigned char new_mode
 
 	elf_calc_entity_aabb(entity);
 
-	tmp_vec.x = entity->cull_aabb_max.x-entity->cull_aabb_min.x;
-	tmp_vec.y = entity->cull_aabb_max.y-entity->cull_aabb_min.y;
-	tmp_vec.z = entity->cull_aabb_max.z-entity->cull_aabb_min.z;
+	// the radius is for one state, not the blend
+	gfx_get_transform_position(entity->transform, position);
+	gfx_get_transform_orientation(entity->transform, orient);
+	elf_calc_entity_state_aabb(entity, position, orient, min, max);
+
+	tmp_vec.x = max[0]-min[0];
+	tmp_vec.y = max[1]-min[1];
+	tmp_vec.z = max[2]-min[2];
 	entity->cull_radius = gfx_vec_length(&tmp_vec.x)/2;
 
 	max_scale = entity->scale.x;
@@ -729,6 +720,13 @@ unsigned char elf_cull_entity(elf_entity *entity, elf_camera *camera)
 	return !elf_aabb_inside_frustum(camera, &entity->cull_aabb_min.x, &entity->cull_aabb_max.x);
 }
 
+void elf_add_entity_to_cull_set(elf_cull_set *set, elf_entity *entity)
+{
+	if(!entity->model || !entity->visible) return;
+
+	elf_add_aabb_to_cull_set(set, (elf_object*)entity, &entity->cull_aabb_min.x, &entity->cull_aabb_max.x);
+}
+
 unsigned char elf_get_entity_changed(elf_entity *entity)
 {
 	return entity->moved;
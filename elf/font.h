@@ -1,26 +1,78 @@
 
+// every glyph of a font sits in one atlas texture. strings are decoded as utf-8 and laid out
+// into a vertex buffer owned by the font, so a whole string, or a whole list of them added
+// between elf_begin_font_text and elf_draw_font_text, is a single draw call.
+
+// pairs of first and last code, in ascending order so that the glyphs come out sorted
+static const unsigned int elf_font_glyph_ranges[] = {
+	0x0021, 0x007E,	// ascii
+	0x00A0, 0x017F,	// latin-1 supplement and latin extended-a
+	0x0370, 0x03FF,	// greek
+	0x0400, 0x04FF	// cyrillic
+};
+
 elf_font* elf_create_font()
 {
 	elf_font *font;
+	int i;
 
 	font = (elf_font*)malloc(sizeof(elf_font));
 	memset(font, 0x0, sizeof(elf_font));
 	font->type = ELF_FONT;
 
+	for(i = 0; i < 128; i++) font->ascii[i] = -1;
+
 	elf_inc_obj_count();
 
 	return font;
 }
 
+int elf_pack_font_glyphs(elf_glyph *glyphs, int count, int width, int *xs, int *ys)
+{
+	int x, y;
+	int row_height;
+	int i;
+
+	// shelves left to right, a new one when the row is full
+	x = y = row_height = 0;
+
+	for(i = 0; i < count; i++)
+	{
+		if(glyphs[i].width < 1) continue;
+
+		if(x+glyphs[i].width+ELF_FONT_GLYPH_PADDING > width)
+		{
+			x = 0;
+			y += row_height;
+			row_height = 0;
+		}
+
+		xs[i] = x;
+		ys[i] = y;
+
+		x += glyphs[i].width+ELF_FONT_GLYPH_PADDING;
+		if(glyphs[i].height+ELF_FONT_GLYPH_PADDING > row_height) row_height = glyphs[i].height+ELF_FONT_GLYPH_PADDING;
+	}
+
+	return y+row_height;
+}
+
 elf_font* elf_create_font_from_file(const char *file_path, int size)
 {
 	FT_Library library;
 	FT_Face face;
 	FT_GlyphSlot slot;
 	elf_font *font;
+	elf_glyph *glyph;
+	unsigned int code;
+	unsigned char **bitmaps;
+	unsigned char *data;
+	int *xs, *ys;
+	int atlas_width;
+	int atlas_height;
 	int width;
 	int height;
-	unsigned char *data;
+	int count;
 	int error;
 	int i, j, k;
 
@@ -68,55 +120,135 @@ elf_font* elf_create_font_from_file(const char *file_path, int size)
 
 	slot = face->glyph;
 
-	for(i = 33; i < 127; i++)
+	for(i = 0, count = 0; i < (int)(sizeof(elf_font_glyph_ranges)/sizeof(unsigned int)); i += 2)
+		count += elf_font_glyph_ranges[i+1]-elf_font_glyph_ranges[i]+1;
+
+	font->glyphs = (elf_glyph*)malloc(sizeof(elf_glyph)*count);
+	memset(font->glyphs, 0x0, sizeof(elf_glyph)*count);
+	bitmaps = (unsigned char**)malloc(sizeof(unsigned char*)*count);
+	memset(bitmaps, 0x0, sizeof(unsigned char*)*count);
+
+	for(i = 0; i < (int)(sizeof(elf_font_glyph_ranges)/sizeof(unsigned int)); i += 2)
 	{
-		error = FT_Load_Char(face, (char)i, FT_LOAD_RENDER|FT_LOAD_FORCE_AUTOHINT);
-		if(error)
+		for(code = elf_font_glyph_ranges[i]; code <= elf_font_glyph_ranges[i+1]; code++)
 		{
-			elf_write_to_log("warning: could not load character \"%c\" in font \"%s\"\n", (char)i, file_path);
-			continue;
-		}
+			// most fonts only cover a part of the extended ranges
+			if(code > 127 && !FT_Get_Char_Index(face, code)) continue;
 
-		width = slot->bitmap.width;
-		height = slot->bitmap.rows;
-		if(width < 1 || height < 1) continue;
+			error = FT_Load_Char(face, code, FT_LOAD_RENDER|FT_LOAD_FORCE_AUTOHINT);
+			if(error)
+			{
+				if(code < 128) elf_write_to_log("warning: could not load character \"%c\" in font \"%s\"\n", (char)code, file_path);
+				continue;
+			}
 
-		data = (unsigned char*)malloc(sizeof(unsigned char)*width*height*2);
-		for(j = 0; j < height; j++)
-		{
-			for(k = 0; k < width; k++)
+			width = slot->bitmap.width;
+			height = slot->bitmap.rows;
+			if((width < 1 || height < 1) && code < 128) continue;
+
+			glyph = &font->glyphs[font->glyph_count];
+			glyph->code = code;
+
+			if(width < 1 || height < 1)
 			{
-				data[j*width*2+k*2] = 255;
-				data[j*width*2+k*2+1] = slot->bitmap.buffer[((height-1)-j)*width+k];
+				// spacing characters draw nothing and take the room of a space
+				glyph->advance = size/3;
 			}
-		}
+			else
+			{
+				glyph->width = width;
+				glyph->height = height;
+				glyph->advance = width+size/7;
+				glyph->offset_y = -(height-slot->bitmap_top);
 
-		font->chars[i].code = (char)i;
-		font->chars[i].offset_x = width+size/7;
-		font->chars[i].offset_y = -(face->glyph->bitmap.rows-face->glyph->bitmap_top);
-		font->chars[i].texture = gfx_create_2d_texture(width, height, 0.0f, GFX_CLAMP, GFX_NEAREST, GFX_LUMINANCE_ALPHA, GFX_LUMINANCE_ALPHA, GFX_UBYTE, data);
+				bitmaps[font->glyph_count] = (unsigned char*)malloc(sizeof(unsigned char)*width*height);
+				for(j = 0; j < height; j++)
+					memcpy(&bitmaps[font->glyph_count][j*width], &slot->bitmap.buffer[j*slot->bitmap.pitch], sizeof(unsigned char)*width);
 
-		if(-font->chars[i].offset_y > font->offset_y) font->offset_y = -font->chars[i].offset_y;
+				if(-glyph->offset_y > font->offset_y) font->offset_y = -glyph->offset_y;
+			}
 
-		free(data);
-		data = NULL;
+			if(code < 128) font->ascii[code] = font->glyph_count;
+			font->glyph_count++;
+		}
 	}
 
 	error = FT_Done_Face(face);
 	error = FT_Done_FreeType(library);
 
+	// the narrowest power of two square or twice as tall that holds everything
+	xs = (int*)malloc(sizeof(int)*font->glyph_count);
+	ys = (int*)malloc(sizeof(int)*font->glyph_count);
+
+	atlas_width = ELF_FONT_MIN_ATLAS_SIZE;
+	atlas_height = elf_pack_font_glyphs(font->glyphs, font->glyph_count, atlas_width, xs, ys);
+	while(atlas_height > atlas_width*2 && atlas_width < ELF_FONT_MAX_ATLAS_SIZE)
+	{
+		atlas_width *= 2;
+		atlas_height = elf_pack_font_glyphs(font->glyphs, font->glyph_count, atlas_width, xs, ys);
+	}
+
+	for(i = 1; i < atlas_height; i *= 2);
+	atlas_height = i;
+
+	if(atlas_height > ELF_FONT_MAX_ATLAS_SIZE)
+	{
+		elf_write_to_log("warning: the glyphs of font \"%s\" don't fit in the atlas, some are left out\n", file_path);
+		atlas_height = ELF_FONT_MAX_ATLAS_SIZE;
+	}
+
+	data = (unsigned char*)malloc(sizeof(unsigned char)*atlas_width*atlas_height*2);
+	memset(data, 0x0, sizeof(unsigned char)*atlas_width*atlas_height*2);
+
+	for(i = 0; i < font->glyph_count; i++)
+	{
+		glyph = &font->glyphs[i];
+		if(!bitmaps[i]) continue;
+
+		if(ys[i]+glyph->height > atlas_height)
+		{
+			glyph->width = glyph->height = 0;
+			free(bitmaps[i]);
+			continue;
+		}
+
+		// flipped, the first row of the texture is the bottom of the glyph
+		for(j = 0; j < glyph->height; j++)
+		{
+			for(k = 0; k < glyph->width; k++)
+			{
+				data[((ys[i]+j)*atlas_width+xs[i]+k)*2] = 255;
+				data[((ys[i]+j)*atlas_width+xs[i]+k)*2+1] = bitmaps[i][((glyph->height-1)-j)*glyph->width+k];
+			}
+		}
+
+		glyph->tx = (float)xs[i]/(float)atlas_width;
+		glyph->ty = (float)ys[i]/(float)atlas_height;
+		glyph->twidth = (float)glyph->width/(float)atlas_width;
+		glyph->theight = (float)glyph->height/(float)atlas_height;
+
+		free(bitmaps[i]);
+	}
+
+	font->atlas = gfx_create_2d_texture(atlas_width, atlas_height, 0.0f, GFX_CLAMP, GFX_NEAREST, GFX_LUMINANCE_ALPHA, GFX_LUMINANCE_ALPHA, GFX_UBYTE, data);
+	gfx_inc_ref((gfx_object*)font->atlas);
+
+	free(data);
+	free(xs);
+	free(ys);
+	free(bitmaps);
+
 	return font;
 }
 
 void elf_destroy_font(elf_font *font)
 {
-	int i;
-
 	if(font->name) elf_destroy_string(font->name);
 	if(font->file_path) elf_destroy_string(font->file_path);
 
-	for(i = 0; i < 128; i++)
-		if(font->chars[i].texture) gfx_destroy_texture(font->chars[i].texture);
+	if(font->atlas) gfx_dec_ref((gfx_object*)font->atlas);
+	if(font->vertex_array) gfx_dec_ref((gfx_object*)font->vertex_array);
+	if(font->glyphs) free(font->glyphs);
 
 	free(font);
 
@@ -138,95 +270,214 @@ int elf_get_font_size(elf_font *font)
 	return font->size;
 }
 
-int elf_get_string_width(elf_font *font, const char *str)
+elf_glyph* elf_get_font_glyph(elf_font *font, unsigned int code)
 {
-	int x = 0;
-	int ox = 0;
-	int y = font->size;
-	elf_character *chr = 0;
-	unsigned int i;
+	int first, last, mid;
 
-	for(i = 0; i < strlen(str); i++)
+	if(code < 128) return font->ascii[code] < 0 ? NULL : &font->glyphs[font->ascii[code]];
+
+	first = 0;
+	last = font->glyph_count-1;
+
+	while(first <= last)
+	{
+		mid = (first+last)/2;
+		if(font->glyphs[mid].code == code) return &font->glyphs[mid];
+		if(font->glyphs[mid].code < code) first = mid+1;
+		else last = mid-1;
+	}
+
+	return NULL;
+}
+
+void elf_get_string_size(elf_font *font, const char *str, int *width, int *height)
+{
+	elf_glyph *glyph;
+	unsigned int code;
+	int ox;
+	int pos;
+
+	ox = 0;
+	*width = 0;
+	*height = font->size;
+
+	for(pos = 0; str[pos];)
 	{
-		if(str[i] < 0) continue;
-		chr = &font->chars[(unsigned int)str[i]];
-		if(str[i] == ' ') ox += font->size/3;
-		else if(str[i] == '\t') ox += font->size/3*5;
-		else if(str[i] == '\n')
+		code = elf_get_utf8_char(str, &pos);
+
+		if(code == ' ') ox += font->size/3;
+		else if(code == '\t') ox += font->size/3*5;
+		else if(code == '\n')
 		{
-			y += font->size+1;
+			*height += font->size+1;
 			ox = 0;
 		}
-		else
+		else if((glyph = elf_get_font_glyph(font, code)))
 		{
-			if(i != strlen(str)-1 || !chr->texture) ox += chr->offset_x;
-			else ox += gfx_get_texture_width(chr->texture);
+			// the last glyph ends at its edge rather than where the next one would start
+			if(str[pos] || glyph->width < 1) ox += glyph->advance;
+			else ox += glyph->width;
 		}
-		if(ox > x) x = ox;
+
+		if(ox > *width) *width = ox;
 	}
+}
 
-	return x;
+int elf_get_string_width(elf_font *font, const char *str)
+{
+	int width, height;
+
+	elf_get_string_size(font, str, &width, &height);
+
+	return width;
 }
 
 int elf_get_string_height(elf_font *font, const char *str)
 {
-	int ox = 0;
-	int y = font->size;
-	elf_character *chr = 0;
-	unsigned int i;
+	int width, height;
+
+	elf_get_string_size(font, str, &width, &height);
+
+	return height;
+}
+
+void elf_reserve_font_text(elf_font *font, int glyphs)
+{
+	gfx_vertex_data *vertex_data;
+	gfx_vertex_data *tex_coord_data;
+	gfx_vertex_array *vertex_array;
+	int capacity;
 
-	for(i = 0; i < strlen(str); i++)
+	if(glyphs <= font->text_capacity) return;
+
+	capacity = font->text_capacity > 0 ? font->text_capacity : ELF_FONT_MIN_TEXT_GLYPHS;
+	while(capacity < glyphs) capacity *= 2;
+
+	vertex_data = gfx_create_vertex_data(capacity*6*3, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
+	tex_coord_data = gfx_create_vertex_data(capacity*6*2, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
+	vertex_array = gfx_create_vertex_array(GFX_FALSE);
+
+	gfx_set_vertex_array_data(vertex_array, GFX_VERTEX, vertex_data);
+	gfx_set_vertex_array_data(vertex_array, GFX_TEX_COORD, tex_coord_data);
+	gfx_inc_ref((gfx_object*)vertex_array);
+
+	// keep what was laid out so far
+	if(font->vertex_array)
 	{
-		if(str[i] < 0) continue;
-		chr = &font->chars[(unsigned int)str[i]];
-		if(str[i] == ' ') ox += font->size/3;
-		else if(str[i] == '\t') ox += font->size/3*5;
-		else if(str[i] == '\n')
+		memcpy(gfx_get_vertex_data_buffer(vertex_data), gfx_get_vertex_data_buffer(font->vertex_data),
+			sizeof(float)*font->text_glyphs*6*3);
+		memcpy(gfx_get_vertex_data_buffer(tex_coord_data), gfx_get_vertex_data_buffer(font->tex_coord_data),
+			sizeof(float)*font->text_glyphs*6*2);
+		gfx_dec_ref((gfx_object*)font->vertex_array);
+	}
+
+	font->vertex_data = vertex_data;
+	font->tex_coord_data = tex_coord_data;
+	font->vertex_array = vertex_array;
+	font->text_capacity = capacity;
+}
+
+void elf_begin_font_text(elf_font *font)
+{
+	font->text_glyphs = 0;
+}
+
+elf_glyph* elf_get_next_font_glyph(elf_font *font, const char *str, int *pos, int x, int *ox, int *oy, int *gx, int *gy)
+{
+	elf_glyph *glyph;
+	unsigned int code;
+
+	// steps over the white space and the glyphs that draw nothing, the pen starts at x, *oy
+	while(str[*pos])
+	{
+		code = elf_get_utf8_char(str, pos);
+
+		if(code == ' ') *ox += font->size/3;
+		else if(code == '\t') *ox += font->size/3*5;
+		else if(code == '\n')
 		{
-			y += font->size+1;
-			ox = 0;
+			*oy -= font->size+1;
+			*ox = x;
 		}
 		else
 		{
-			if(i != strlen(str)-1 || !chr->texture) ox += chr->offset_x;
-			else ox += gfx_get_texture_width(chr->texture);
+			glyph = elf_get_font_glyph(font, code);
+			if(!glyph) continue;
+
+			*gx = *ox;
+			*gy = *oy+glyph->offset_y+font->offset_y;
+			*ox += glyph->advance;
+
+			if(glyph->width > 0) return glyph;
 		}
 	}
 
-	return y;
+	return NULL;
 }
 
-void elf_draw_string(elf_font *font, const char *str, int x, int y, gfx_shader_params *shader_params)
+void elf_add_font_text(elf_font *font, const char *str, int x, int y)
 {
-	int ox;
-	int oy;
-	elf_character *chr;
-	unsigned int i;
+	elf_glyph *glyph;
+	float *vertices;
+	float *tex_coords;
+	float gwidth, gheight;
+	int ox, oy;
+	int gx, gy;
+	int pos;
+
+	// a glyph takes at least a byte, so the length is enough room
+	elf_reserve_font_text(font, font->text_glyphs+strlen(str));
+
+	vertices = &((float*)gfx_get_vertex_data_buffer(font->vertex_data))[font->text_glyphs*6*3];
+	tex_coords = &((float*)gfx_get_vertex_data_buffer(font->tex_coord_data))[font->text_glyphs*6*2];
 
 	ox = x;
 	oy = y;
+	pos = 0;
 
-	for(i = 0; i < strlen(str); i++)
+	while((glyph = elf_get_next_font_glyph(font, str, &pos, x, &ox, &oy, &gx, &gy)))
 	{
-		if(str[i] < 0) continue;
-		chr = &font->chars[(unsigned int)str[i]];
-		if(str[i] == ' ') ox += font->size/3;
-		else if(str[i] == '\t') ox += font->size/3*5;
-		else if(str[i] == '\n')
-		{
-			oy -= font->size+1;
-			ox = x;
-		}
-		else
-		{
-			if(!chr->texture) continue;
-			shader_params->texture_params[0].texture = chr->texture;
-			shader_params->texture_params[0].type = GFX_COLOR_MAP;
-			gfx_set_shader_params(shader_params);
-			gfx_draw_textured_2d_quad((float)ox, (float)(oy+chr->offset_y+font->offset_y),
-				(float)gfx_get_texture_width(chr->texture), (float)gfx_get_texture_height(chr->texture));
-			ox += chr->offset_x;
-		}
+		gwidth = (float)glyph->width;
+		gheight = (float)glyph->height;
+
+		// two triangles, bottom left, bottom right, top right and top right, top left, bottom left
+		vertices[0] = gx; vertices[1] = gy; vertices[2] = 0.0;
+		vertices[3] = gx+gwidth; vertices[4] = gy; vertices[5] = 0.0;
+		vertices[6] = gx+gwidth; vertices[7] = gy+gheight; vertices[8] = 0.0;
+		vertices[9] = gx+gwidth; vertices[10] = gy+gheight; vertices[11] = 0.0;
+		vertices[12] = gx; vertices[13] = gy+gheight; vertices[14] = 0.0;
+		vertices[15] = gx; vertices[16] = gy; vertices[17] = 0.0;
+
+		tex_coords[0] = glyph->tx; tex_coords[1] = glyph->ty;
+		tex_coords[2] = glyph->tx+glyph->twidth; tex_coords[3] = glyph->ty;
+		tex_coords[4] = glyph->tx+glyph->twidth; tex_coords[5] = glyph->ty+glyph->theight;
+		tex_coords[6] = glyph->tx+glyph->twidth; tex_coords[7] = glyph->ty+glyph->theight;
+		tex_coords[8] = glyph->tx; tex_coords[9] = glyph->ty+glyph->theight;
+		tex_coords[10] = glyph->tx; tex_coords[11] = glyph->ty;
+
+		vertices += 6*3;
+		tex_coords += 6*2;
+		font->text_glyphs++;
 	}
 }
 
+void elf_draw_font_text(elf_font *font, gfx_shader_params *shader_params)
+{
+	if(font->text_glyphs < 1 || !font->atlas) return;
+
+	shader_params->texture_params[0].texture = font->atlas;
+	shader_params->texture_params[0].type = GFX_COLOR_MAP;
+	gfx_set_shader_params(shader_params);
+
+	gfx_draw_vertex_array(font->vertex_array, font->text_glyphs*6, GFX_TRIANGLES);
+
+	font->text_glyphs = 0;
+}
+
+void elf_draw_string(elf_font *font, const char *str, int x, int y, gfx_shader_params *shader_params)
+{
+	elf_begin_font_text(font);
+	elf_add_font_text(font, str, x, y);
+	elf_draw_font_text(font, shader_params);
+}
+
@@ -1,6 +1,8 @@
 
 void elf_init_general()
 {
+	static unsigned char log_hooks_set = ELF_FALSE;
+
 	if(gen) return;
 
 	gen = (elf_general*)malloc(sizeof(elf_general));
@@ -8,6 +10,21 @@ void elf_init_general()
 	gen->type = ELF_GENERAL;
 
 	gen->log = elf_create_string("elf.log");
+	gen->logger = elf_create_logger();
+
+	// starts the clock
+	elf_get_time();
+
+	// write out whatever is still queued when the program exits or crashes
+	if(!log_hooks_set)
+	{
+		atexit(elf_flush_log);
+		signal(SIGSEGV, elf_flush_log_on_signal);
+		signal(SIGABRT, elf_flush_log_on_signal);
+		signal(SIGFPE, elf_flush_log_on_signal);
+		signal(SIGILL, elf_flush_log_on_signal);
+		log_hooks_set = ELF_TRUE;
+	}
 }
 
 void elf_deinit_general()
@@ -37,9 +54,13 @@ void elf_deinit_general()
 		elf_write_to_log("error: possible double free in ELF, [%d] negative object count\n",
 			elf_get_global_obj_count()-1);
 
+	// the atexit flush comes after this, it must find nothing to flush
+	if(gen->logger) elf_destroy_logger(gen->logger);
+	gen->logger = NULL;
 	if(gen->log) elf_destroy_string(gen->log);
 
 	free(gen);
+	gen = NULL;
 }
 
 void elf_inc_ref(elf_object *obj)
@@ -76,6 +97,7 @@ void elf_dec_ref(elf_object *obj)
 			case ELF_SCENE: elf_destroy_scene((elf_scene*)obj); break;
 			case ELF_PAK_INDEX: elf_destroy_pak_index((elf_pak_index*)obj); break;
 			case ELF_PAK: elf_destroy_pak((elf_pak*)obj); break;
+			case ELF_SCENE_LOADER: elf_destroy_scene_loader((elf_scene_loader*)obj); break;
 			case ELF_POST_PROCESS: elf_destroy_post_process((elf_post_process*)obj); break;
 			case ELF_SCRIPT: elf_destroy_script((elf_script*)obj); break;
 			case ELF_AUDIO_DEVICE: elf_destroy_audio_device((elf_audio_device*)obj); break;
@@ -100,7 +122,6 @@ void elf_dec_ref(elf_object *obj)
 			case ELF_PHYSICS_OBJECT: elf_destroy_physics_object((elf_physics_object*)obj); break;
 			case ELF_PHYSICS_WORLD: elf_destroy_physics_world((elf_physics_world*)obj); break;
 			case ELF_JOINT: elf_destroy_joint((elf_joint*)obj); break;
-			case ELF_PARTICLE: elf_destroy_particle((elf_particle*)obj); break;
 			case ELF_PARTICLES: elf_destroy_particles((elf_particles*)obj); break;
 			case ELF_BEZIER_POINT: elf_destroy_bezier_point((elf_bezier_point*)obj); break;
 			case ELF_BEZIER_CURVE: elf_destroy_bezier_curve((elf_bezier_curve*)obj); break;
@@ -120,6 +141,7 @@ void elf_dec_ref(elf_object *obj)
 void elf_inc_obj_count()
 {
 	gen->global_obj_count++;
+	gen->created_obj_count++;
 }
 
 void elf_dec_obj_count()
@@ -161,6 +183,11 @@ int elf_get_global_obj_count()
 	return gen->global_obj_count;
 }
 
+int elf_get_created_obj_count()
+{
+	return gen->created_obj_count;
+}
+
 unsigned char elf_is_actor(elf_object *obj)
 {
 	if(obj->type == ELF_CAMERA || obj->type == ELF_ENTITY ||
@@ -193,7 +220,18 @@ void elf_set_log_file_path(const char *file_path)
 		}
 	}
 
+	fclose(file);
+
+	// the writer thread opens the log by this path, swap it while the log is locked
+	elf_lock_log(gen->logger);
+	elf_write_log_slots(gen->logger);
+	if(gen->logger->file) fclose(gen->logger->file);
+	gen->logger->file = NULL;
+	gen->logger->fd = -1;
+
 	if(gen->log) elf_destroy_string(gen->log);
 	gen->log = elf_create_string(file_path);
+
+	elf_unlock_log(gen->logger);
 }
 
@@ -52,11 +52,13 @@ void elf_set_gui_object_color(elf_gui_object *object, float r, float g, float b,
 	object->color.g = g;
 	object->color.b = b;
 	object->color.a = a;
+	elf_set_gui_object_dirty(object);
 }
 
 void elf_set_gui_object_visible(elf_gui_object *object, unsigned char visible)
 {
 	object->visible = !visible == ELF_FALSE;
+	elf_set_gui_object_dirty(object);
 }
 
 void elf_set_gui_object_script(elf_gui_object *object, elf_script *script)
@@ -66,6 +68,122 @@ void elf_set_gui_object_script(elf_gui_object *object, elf_script *script)
 	if(object->script) elf_inc_ref((elf_object*)object->script);
 }
 
+void elf_set_gui_object_dirty(elf_gui_object *object)
+{
+	if(object->root) object->root->dirty = ELF_TRUE;
+}
+
+void elf_clip_gui_area(elf_area *clip, int x, int y, int width, int height, elf_area *result)
+{
+	int x2, y2;
+
+	x2 = x+width < clip->pos.x+clip->size.x ? x+width : clip->pos.x+clip->size.x;
+	y2 = y+height < clip->pos.y+clip->size.y ? y+height : clip->pos.y+clip->size.y;
+
+	result->pos.x = x > clip->pos.x ? x : clip->pos.x;
+	result->pos.y = y > clip->pos.y ? y : clip->pos.y;
+	result->size.x = x2-result->pos.x;
+	result->size.y = y2-result->pos.y;
+}
+
+unsigned char elf_is_gui_area_overlapping(elf_area *a, elf_area *b)
+{
+	return a->pos.x < b->pos.x+b->size.x && b->pos.x < a->pos.x+a->size.x &&
+		a->pos.y < b->pos.y+b->size.y && b->pos.y < a->pos.y+a->size.y;
+}
+
+void elf_add_gui_quad(elf_gui *gui, gfx_texture *texture, elf_area *clip, float x, float y, float width, float height,
+	float tx, float ty, float twidth, float theight, elf_color *color)
+{
+	elf_gui_batch *batch;
+	elf_gui_quad *quad;
+	elf_area bounds;
+	int x2, y2;
+	int i;
+
+	elf_clip_gui_area(clip, (int)x, (int)y, (int)(x+width+0.999f)-(int)x, (int)(y+height+0.999f)-(int)y, &bounds);
+	if(bounds.size.x < 1 || bounds.size.y < 1 || color->a <= 0.0) return;
+
+	// the quad can join an earlier batch as long as nothing drawn after that batch is under it,
+	// that keeps the order the quads overlap in
+	for(i = gui->batch_count-1; i >= 0; i--)
+	{
+		batch = &gui->batches[i];
+		if(batch->texture == texture && !memcmp(&batch->clip, clip, sizeof(elf_area))) break;
+		if(elf_is_gui_area_overlapping(&batch->bounds, &bounds))
+		{
+			i = -1;
+			break;
+		}
+	}
+
+	if(i < 0)
+	{
+		if(gui->batch_count >= gui->batch_capacity)
+		{
+			gui->batch_capacity = gui->batch_capacity > 0 ? gui->batch_capacity*2 : 16;
+			gui->batches = (elf_gui_batch*)realloc(gui->batches, sizeof(elf_gui_batch)*gui->batch_capacity);
+		}
+
+		batch = &gui->batches[gui->batch_count++];
+		memset(batch, 0x0, sizeof(elf_gui_batch));
+		batch->texture = texture;
+		batch->clip = *clip;
+		batch->bounds = bounds;
+	}
+	else
+	{
+		x2 = batch->bounds.pos.x+batch->bounds.size.x;
+		y2 = batch->bounds.pos.y+batch->bounds.size.y;
+		if(bounds.pos.x+bounds.size.x > x2) x2 = bounds.pos.x+bounds.size.x;
+		if(bounds.pos.y+bounds.size.y > y2) y2 = bounds.pos.y+bounds.size.y;
+		if(bounds.pos.x < batch->bounds.pos.x) batch->bounds.pos.x = bounds.pos.x;
+		if(bounds.pos.y < batch->bounds.pos.y) batch->bounds.pos.y = bounds.pos.y;
+		batch->bounds.size.x = x2-batch->bounds.pos.x;
+		batch->bounds.size.y = y2-batch->bounds.pos.y;
+	}
+
+	if(gui->quad_count >= gui->quad_capacity)
+	{
+		gui->quad_capacity = gui->quad_capacity > 0 ? gui->quad_capacity*2 : ELF_GUI_MIN_QUADS;
+		gui->quads = (elf_gui_quad*)realloc(gui->quads, sizeof(elf_gui_quad)*gui->quad_capacity);
+	}
+
+	quad = &gui->quads[gui->quad_count++];
+	quad->batch = batch-gui->batches;
+	quad->x = x;
+	quad->y = y;
+	quad->width = width;
+	quad->height = height;
+	quad->tx = tx;
+	quad->ty = ty;
+	quad->twidth = twidth;
+	quad->theight = theight;
+	quad->color = *color;
+
+	batch->quad_count++;
+}
+
+void elf_add_gui_text(elf_gui *gui, elf_font *font, const char *str, int x, int y, elf_color *color, elf_area *clip)
+{
+	elf_glyph *glyph;
+	int ox, oy;
+	int gx, gy;
+	int pos;
+
+	if(!font->atlas) return;
+
+	ox = x;
+	oy = y;
+	pos = 0;
+
+	while((glyph = elf_get_next_font_glyph(font, str, &pos, x, &ox, &oy, &gx, &gy)))
+	{
+		elf_add_gui_quad(gui, font->atlas, clip, (float)gx, (float)gy, (float)glyph->width, (float)glyph->height,
+			glyph->tx, glyph->ty, glyph->twidth, glyph->theight, color);
+	}
+}
+
 elf_label* elf_create_label(const char *name)
 {
 	elf_label *label;
@@ -96,13 +214,11 @@ void elf_destroy_label(elf_label *label)
 	elf_dec_obj_count();
 }
 
-void elf_draw_label(elf_label *label, gfx_shader_params *shader_params)
+void elf_add_label_quads(elf_gui *gui, elf_label *label, elf_area *clip)
 {
-	if(!label->visible || !label->font || !label->text) return;
+	if(!label->font || !label->text) return;
 
-	gfx_set_color(&shader_params->material_params.color, label->color.r, label->color.g, label->color.b, label->color.a);
-	elf_draw_string(label->font, label->text, label->pos.x, label->pos.y, shader_params);
-	shader_params->texture_params[0].texture = NULL;
+	elf_add_gui_text(gui, label->font, label->text, label->pos.x, label->pos.y, &label->color, clip);
 }
 
 elf_font* elf_get_label_font(elf_label *label)
@@ -180,31 +296,19 @@ void elf_destroy_button(elf_button *button)
 	elf_dec_obj_count();
 }
 
-void elf_draw_button(elf_button *button, gfx_shader_params *shader_params)
+void elf_add_button_quads(elf_gui *gui, elf_button *button, elf_area *clip)
 {
-	if(!button->visible) return;
+	elf_texture *texture;
 
-	gfx_set_color(&shader_params->material_params.color, button->color.r, button->color.g, button->color.b, button->color.a);
+	texture = NULL;
+	if(button->state == ELF_OFF) texture = button->off;
+	else if(button->state == ELF_OVER) texture = button->over;
+	else if(button->state == ELF_ON) texture = button->on;
 
-	if(button->state == ELF_OFF)
-	{
-		if(button->off) shader_params->texture_params[0].texture = button->off->texture;
-	}
-	else if(button->state == ELF_OVER)
-	{
-		if(button->over) shader_params->texture_params[0].texture = button->over->texture;
-	}
-	else if(button->state == ELF_ON)
-	{
-		if(button->on) shader_params->texture_params[0].texture = button->on->texture;
-	}
+	if(!texture) return;
 
-	if(shader_params->texture_params[0].texture)
-	{
-		gfx_set_shader_params(shader_params);
-		gfx_draw_textured_2d_quad((float)button->pos.x, (float)button->pos.y, (float)button->width, (float)button->height);
-		shader_params->texture_params[0].texture = NULL;
-	}
+	elf_add_gui_quad(gui, texture->texture, clip, (float)button->pos.x, (float)button->pos.y,
+		(float)button->width, (float)button->height, 0.0, 0.0, 1.0, 1.0, &button->color);
 }
 
 unsigned char elf_get_button_state(elf_button *button)
@@ -212,6 +316,14 @@ unsigned char elf_get_button_state(elf_button *button)
 	return button->state;
 }
 
+void elf_change_button_state(elf_button *button, unsigned char state)
+{
+	if(button->state == state) return;
+
+	button->state = state;
+	elf_set_gui_object_dirty((elf_gui_object*)button);
+}
+
 elf_texture* elf_get_button_off_texture(elf_button *button)
 {
 	return button->off;
@@ -261,6 +373,7 @@ void elf_set_button_over_texture(elf_button *button, elf_texture *over)
 	if(button->over) elf_dec_ref((elf_object*)button->over);
 	button->over = over;
 	if(button->over) elf_inc_ref((elf_object*)button->over);
+	elf_set_gui_object_dirty((elf_gui_object*)button);
 }
 
 void elf_set_button_on_texture(elf_button *button, elf_texture *on)
@@ -268,6 +381,7 @@ void elf_set_button_on_texture(elf_button *button, elf_texture *on)
 	if(button->on) elf_dec_ref((elf_object*)button->on);
 	button->on = on;
 	if(button->on) elf_inc_ref((elf_object*)button->on);
+	elf_set_gui_object_dirty((elf_gui_object*)button);
 }
 
 elf_picture* elf_create_picture(const char *name)
@@ -300,17 +414,12 @@ void elf_destroy_picture(elf_picture *picture)
 	elf_dec_obj_count();
 }
 
-void elf_draw_picture(elf_picture *picture, gfx_shader_params *shader_params)
+void elf_add_picture_quads(elf_gui *gui, elf_picture *picture, elf_area *clip)
 {
-	if(!picture->visible || !picture->texture) return;
-
-	gfx_set_color(&shader_params->material_params.color, picture->color.r,
-		picture->color.g, picture->color.b, picture->color.a);
+	if(!picture->texture) return;
 
-	shader_params->texture_params[0].texture = picture->texture->texture;
-	gfx_set_shader_params(shader_params);
-	gfx_draw_textured_2d_quad((float)picture->pos.x, (float)picture->pos.y, (float)picture->width, (float)picture->height);
-	shader_params->texture_params[0].texture = NULL;
+	elf_add_gui_quad(gui, picture->texture->texture, clip, (float)picture->pos.x, (float)picture->pos.y,
+		(float)picture->width, (float)picture->height, 0.0, 0.0, 1.0, 1.0, &picture->color);
 }
 
 void elf_recalc_picture(elf_picture *picture)
@@ -386,74 +495,39 @@ void elf_destroy_text_field(elf_text_field *text_field)
 	elf_dec_obj_count();
 }
 
-void elf_draw_text_field(elf_text_field *text_field, elf_area *area, gfx_shader_params *shader_params)
+void elf_add_text_field_quads(elf_gui *gui, elf_text_field *text_field, elf_area *clip)
 {
+	elf_area text_clip;
+	elf_color text_color;
 	char *str;
-	int x, y, width, height;
 
-	if(!text_field->visible) return;
-
-	x = text_field->pos.x;
-	y = text_field->pos.y;
-	width = text_field->width;
-	height = text_field->height;
-	if(text_field->parent)
+	if(text_field->texture)
 	{
-		if(x < area->pos.x)
-		{
-			width -= area->pos.x-x;
-			x = area->pos.x;
-		}
-		if(y < area->pos.y)
-		{
-			height -= area->pos.y-y;
-			y = area->pos.y;
-		}
-		if(x+width > area->pos.x+area->size.x)
-			width -= (x+width)-(area->pos.x+area->size.x);
-		if(y+height > area->pos.y+area->size.y)
-			height -= (y+height)-(area->pos.y+area->size.y);
+		elf_add_gui_quad(gui, text_field->texture->texture, clip, (float)text_field->pos.x, (float)text_field->pos.y,
+			(float)text_field->width, (float)text_field->height, 0.0, 0.0, 1.0, 1.0, &text_field->color);
 	}
 
-	gfx_set_color(&shader_params->material_params.color, text_field->color.r,
-		text_field->color.g, text_field->color.b, text_field->color.a);
+	if(!text_field->font || !text_field->text) return;
 
-	if(text_field->texture) shader_params->texture_params[0].texture = text_field->texture->texture;
+	elf_clip_gui_area(clip, text_field->pos.x+text_field->offset_x, text_field->pos.y+text_field->offset_y,
+		text_field->width-text_field->offset_x*2, text_field->height-text_field->offset_y*2, &text_clip);
 
-	if(shader_params->texture_params[0].texture)
-	{
-		gfx_set_shader_params(shader_params);
-		gfx_draw_textured_2d_quad((float)text_field->pos.x, (float)text_field->pos.y, (float)text_field->width, (float)text_field->height);
-		shader_params->texture_params[0].texture = NULL;
-	}
+	text_color = text_field->text_color;
+	text_color.a *= text_field->color.a;
 
-	if(text_field->font && text_field->text && strlen(text_field->text) > 0)
+	if(text_field->draw_pos < (int)strlen(text_field->text))
 	{
-		gfx_set_viewport(x+text_field->offset_x, y+text_field->offset_y,
-			width-text_field->offset_x*2, height-text_field->offset_y*2);
-		gfx_get_orthographic_projection_matrix((float)x+text_field->offset_x, (float)x+width-text_field->offset_x,
-			(float)y+text_field->offset_y, (float)y+height-text_field->offset_y,
-			-1.0, 1.0, shader_params->projection_matrix);
-
-		gfx_set_color(&shader_params->material_params.color, text_field->text_color.r, text_field->text_color.g,
-			text_field->text_color.b, text_field->text_color.a*text_field->color.a);
-
-		str = elf_sub_string(text_field->text, text_field->draw_pos,
-			strlen(text_field->text)-text_field->draw_pos);
-		elf_draw_string(text_field->font, str, text_field->pos.x+text_field->offset_x, text_field->pos.y+text_field->offset_y, shader_params);
-		elf_destroy_string(str);
-
-		shader_params->texture_params[0].texture = NULL;
+		elf_add_gui_text(gui, text_field->font, &text_field->text[text_field->draw_pos],
+			text_field->pos.x+text_field->offset_x, text_field->pos.y+text_field->offset_y, &text_color, &text_clip);
 	}
 
-	if(text_field->text && text_field->root && text_field->root->active_text_field == text_field)
+	if(gui->active_text_field == text_field)
 	{
-		gfx_set_shader_params(shader_params);
-
 		str = elf_sub_string(text_field->text, text_field->draw_pos,
 			text_field->cursor_pos-text_field->draw_pos);
-		gfx_draw_2d_quad(text_field->pos.x+text_field->offset_x+elf_get_string_width(text_field->font, str),
-			text_field->pos.y+text_field->offset_y, 1, text_field->height-text_field->offset_y*2);
+		elf_add_gui_quad(gui, NULL, &text_clip, (float)(text_field->pos.x+text_field->offset_x+elf_get_string_width(text_field->font, str)),
+			(float)(text_field->pos.y+text_field->offset_y), 1.0, (float)(text_field->height-text_field->offset_y*2),
+			0.0, 0.0, 1.0, 1.0, &text_color);
 		elf_destroy_string(str);
 	}
 }
@@ -523,12 +597,14 @@ void elf_set_text_field_text_color(elf_text_field *text_field, float r, float g,
 	text_field->text_color.g = g;
 	text_field->text_color.b = b;
 	text_field->text_color.a = a;
+	elf_set_gui_object_dirty((elf_gui_object*)text_field);
 }
 
 void elf_set_text_field_offset(elf_text_field *text_field, int offset_x, int offset_y)
 {
 	text_field->offset_x = offset_x;
 	text_field->offset_y = offset_y;
+	elf_set_gui_object_dirty((elf_gui_object*)text_field);
 }
 
 void elf_move_text_field_cursor_left(elf_text_field *text_field)
@@ -536,6 +612,7 @@ void elf_move_text_field_cursor_left(elf_text_field *text_field)
 	if(text_field->cursor_pos == 0) return;
 
 	text_field->cursor_pos--;
+	elf_set_gui_object_dirty((elf_gui_object*)text_field);
 
 	if(text_field->cursor_pos == text_field->draw_pos &&
 		text_field->draw_pos > 0)
@@ -551,6 +628,7 @@ void elf_move_text_field_cursor_right(elf_text_field *text_field)
 	if(text_field->cursor_pos >= (int)strlen(text_field->text)) return;
 
 	text_field->cursor_pos++;
+	elf_set_gui_object_dirty((elf_gui_object*)text_field);
 
 	if(!text_field->font) return;
 
@@ -584,6 +662,7 @@ void elf_set_text_field_text(elf_text_field *text_field, const char *text)
 	text_field->text = elf_create_string(text);
 	text_field->cursor_pos = 0;
 	text_field->draw_pos = 0;
+	elf_set_gui_object_dirty((elf_gui_object*)text_field);
 
 	while(text_field->cursor_pos < strlen(text_field->text))
 		elf_move_text_field_cursor_right(text_field);
@@ -622,33 +701,26 @@ void elf_destroy_slider(elf_slider *slider)
 	elf_dec_obj_count();
 }
 
-void elf_draw_slider(elf_slider *slider, gfx_shader_params *shader_params)
+void elf_add_slider_quads(elf_gui *gui, elf_slider *slider, elf_area *clip)
 {
-	if(!slider->visible) return;
-
 	if(slider->background)
 	{
-		gfx_set_color(&shader_params->material_params.color, slider->color.r, slider->color.g, slider->color.b, slider->color.a);
-		shader_params->texture_params[0].texture = slider->background->texture;
-		gfx_set_shader_params(shader_params);
-		gfx_draw_textured_2d_quad((float)slider->pos.x, (float)slider->pos.y, (float)slider->width, (float)slider->height);
-		shader_params->texture_params[0].texture = NULL;
+		elf_add_gui_quad(gui, slider->background->texture, clip, (float)slider->pos.x, (float)slider->pos.y,
+			(float)slider->width, (float)slider->height, 0.0, 0.0, 1.0, 1.0, &slider->color);
 	}
 
 	if(slider->slider)
 	{
-		gfx_set_color(&shader_params->material_params.color, slider->color.r, slider->color.g, slider->color.b, slider->color.a);
-		shader_params->texture_params[0].texture = slider->slider->texture;
-		gfx_set_shader_params(shader_params);
 		if(slider->width > slider->height)
 		{
-			gfx_draw_textured_2d_quad_region((float)slider->pos.x, (float)slider->pos.y, (float)slider->width*slider->value, (float)slider->height, 0.0, 0.0, slider->value, 1.0);
+			elf_add_gui_quad(gui, slider->slider->texture, clip, (float)slider->pos.x, (float)slider->pos.y,
+				(float)slider->width*slider->value, (float)slider->height, 0.0, 0.0, slider->value, 1.0, &slider->color);
 		}
 		else
 		{
-			gfx_draw_textured_2d_quad_region((float)slider->pos.x, (float)slider->pos.y, (float)slider->width, (float)slider->height*slider->value, 0.0, 0.0, 1.0, slider->value);	
+			elf_add_gui_quad(gui, slider->slider->texture, clip, (float)slider->pos.x, (float)slider->pos.y,
+				(float)slider->width, (float)slider->height*slider->value, 0.0, 0.0, 1.0, slider->value, &slider->color);
 		}
-		shader_params->texture_params[0].texture = NULL;
 	}
 }
 
@@ -694,6 +766,7 @@ void elf_set_slider_slider_texture(elf_slider *slider, elf_texture *slider_textu
 	if(slider->slider) elf_dec_ref((elf_object*)slider->slider);
 	slider->slider = slider_texture;
 	if(slider->slider) elf_inc_ref((elf_object*)slider->slider);
+	elf_set_gui_object_dirty((elf_gui_object*)slider);
 }
 
 void elf_set_slider_value(elf_slider *slider, float value)
@@ -701,6 +774,7 @@ void elf_set_slider_value(elf_slider *slider, float value)
 	slider->value = value;
 	if(slider->value < 0.0) slider->value = 0.0;
 	if(slider->value > 1.0) slider->value = 1.0;
+	elf_set_gui_object_dirty((elf_gui_object*)slider);
 }
 
 elf_screen* elf_create_screen(const char *name)
@@ -741,79 +815,12 @@ void elf_destroy_screen(elf_screen *screen)
 	elf_dec_obj_count();
 }
 
-void elf_draw_screen(elf_screen *screen, elf_area *area, gfx_shader_params *shader_params)
+void elf_add_screen_quads(elf_gui *gui, elf_screen *screen, elf_area *clip)
 {
-	elf_gui_object *object;
-	int x, y, width, height;
-
-	if(!screen->visible || !screen->texture) return;
-
-	x = screen->pos.x;
-	y = screen->pos.y;
-	width = screen->width;
-	height = screen->height;
-	if(screen->parent)
-	{
-		if(x < area->pos.x)
-		{
-			width -= area->pos.x-x;
-			x = area->pos.x;
-		}
-		if(y < area->pos.y)
-		{
-			height -= area->pos.y-y;
-			y = area->pos.y;
-		}
-		if(x+width > area->pos.x+area->size.x)
-			width -= (x+width)-(area->pos.x+area->size.x);
-		if(y+height > area->pos.y+area->size.y)
-			height -= (y+height)-(area->pos.y+area->size.y);
-	}
-
-	gfx_set_color(&shader_params->material_params.color, screen->color.r, screen->color.g, screen->color.b, screen->color.a);
+	if(!screen->texture) return;
 
-	shader_params->texture_params[0].texture = screen->texture->texture;
-	gfx_set_shader_params(shader_params);
-	gfx_draw_textured_2d_quad((float)screen->pos.x, (float)screen->pos.y, (float)screen->width, (float)screen->height);
-	shader_params->texture_params[0].texture = NULL;
-
-	gfx_set_viewport(x, y, width, height);
-	gfx_get_orthographic_projection_matrix((float)x, (float)x+width, (float)y, (float)y+height,
-		-1.0, 1.0, shader_params->projection_matrix);
-
-	for(object = (elf_gui_object*)elf_begin_list(screen->children); object;
-		object = (elf_gui_object*)elf_next_in_list(screen->children))
-	{
-		if(object->type == ELF_LABEL) elf_draw_label((elf_label*)object, shader_params);
-		else if(object->type == ELF_BUTTON) elf_draw_button((elf_button*)object, shader_params);
-		else if(object->type == ELF_PICTURE) elf_draw_picture((elf_picture*)object, shader_params);
-		else if(object->type == ELF_TEXT_FIELD)
-		{
-			elf_draw_text_field((elf_text_field*)object, area, shader_params);
-			gfx_set_viewport(x, y, width, height);
-			gfx_get_orthographic_projection_matrix((float)x, (float)x+width, (float)y, (float)y+height,
-				-1.0, 1.0, shader_params->projection_matrix);
-		}
-		else if(object->type == ELF_TEXT_LIST)
-		{
-			elf_draw_text_list((elf_text_list*)object, area, shader_params);
-			gfx_set_viewport(x, y, width, height);
-			gfx_get_orthographic_projection_matrix((float)x, (float)x+width, (float)y, (float)y+height,
-				-1.0, 1.0, shader_params->projection_matrix);
-		}
-		else if(object->type == ELF_SLIDER) elf_draw_slider((elf_slider*)object, shader_params);
-		else if(object->type == ELF_CHECK_BOX) elf_draw_check_box((elf_check_box*)object, shader_params);
-	}
-
-	for(object = (elf_gui_object*)elf_begin_list(screen->screens); object;
-		object = (elf_gui_object*)elf_next_in_list(screen->screens))
-	{
-		area->pos.x = x; area->pos.y = y; area->size.x = width; area->size.y = height;
-		elf_draw_screen((elf_screen*)object, area, shader_params);
-		gfx_set_viewport(x, y, width, height);
-		gfx_get_orthographic_projection_matrix((float)x, (float)x+width, (float)y, (float)y+height,
-			-1.0, 1.0, shader_params->projection_matrix);
-	}
+	elf_add_gui_quad(gui, screen->texture->texture, clip, (float)screen->pos.x, (float)screen->pos.y,
+		(float)screen->width, (float)screen->height, 0.0, 0.0, 1.0, 1.0, &screen->color);
 }
 
 elf_texture* elf_get_screen_texture(elf_screen *screen)
@@ -851,6 +858,8 @@ void elf_set_screen_to_top(elf_screen *screen)
 	elf_remove_from_list(screen->parent->screens, (elf_object*)screen);
 	elf_append_to_list(screen->parent->screens, (elf_object*)screen);
 	elf_dec_ref((elf_object*)screen);
+
+	elf_set_gui_object_dirty((elf_gui_object*)screen);
 }
 
 void elf_force_focus_to_screen(elf_screen *screen)
@@ -862,7 +871,7 @@ void elf_force_focus_to_screen(elf_screen *screen)
 	if(screen->root->target && screen->root->target->type == ELF_BUTTON)
 	{
 		button = (elf_button*)screen->root->target;
-		button->state = ELF_OFF;
+		elf_change_button_state(button, ELF_OFF);
 	}
 
 	screen->root->trace = NULL;
@@ -918,83 +927,45 @@ void elf_destroy_text_list(elf_text_list *text_list)
 	elf_dec_obj_count();
 }
 
-void elf_draw_text_list(elf_text_list *text_list, elf_area *area, gfx_shader_params *shader_params)
+void elf_add_text_list_quads(elf_gui *gui, elf_text_list *text_list, elf_area *clip)
 {
-	int x, y, width, height;
+	elf_area list_clip;
+	elf_color *color;
+	elf_string *str_obj;
+	int row_height;
 	int offset;
 	int i;
 	unsigned char light;
-	elf_string *str_obj;
 
-	if(!text_list->visible || !text_list->font || elf_get_list_length(text_list->items) < 1) return;
+	if(!text_list->font || elf_get_list_length(text_list->items) < 1) return;
 
-	x = text_list->pos.x;
-	y = text_list->pos.y;
-	width = text_list->width;
-	height = text_list->height;
-	if(text_list->parent)
-	{
-		if(x < area->pos.x)
-		{
-			width -= area->pos.x-x;
-			x = area->pos.x;
-		}
-		if(y < area->pos.y)
-		{
-			height -= area->pos.y-y;
-			y = area->pos.y;
-		}
-		if(x+width > area->pos.x+area->size.x)
-			width -= (x+width)-(area->pos.x+area->size.x);
-		if(y+height > area->pos.y+area->size.y)
-			height -= (y+height)-(area->pos.y+area->size.y);
-	}
+	elf_clip_gui_area(clip, text_list->pos.x, text_list->pos.y, text_list->width, text_list->height, &list_clip);
 
-	gfx_set_viewport(x, y, width, height);
-	gfx_get_orthographic_projection_matrix((float)x, (float)x+width, (float)y, (float)y+height,
-		-1.0, 1.0, shader_params->projection_matrix);
-	gfx_set_color(&shader_params->material_params.color, text_list->color.r,
-		text_list->color.g, text_list->color.b, text_list->color.a);
+	row_height = text_list->font->size+text_list->font->offset_y;
 
+	// the rows don't overlap, so the backgrounds end up in one batch and the text in another
 	light = ELF_TRUE;
-	offset = text_list->font->size+text_list->font->offset_y;
+	offset = row_height;
 	for(i = 0, str_obj = (elf_string*)elf_begin_list(text_list->items); str_obj;
 		str_obj = (elf_string*)elf_next_in_list(text_list->items), i++)
 	{
 		if(i < text_list->offset) continue;
 		if(i-text_list->offset > text_list->rows-1) break;
 
-		if(i == text_list->selection)
-		{
-			shader_params->texture_params[0].texture = NULL;
-			gfx_set_color(&shader_params->material_params.color, text_list->selection_color.r,
-				text_list->selection_color.g, text_list->selection_color.b, text_list->selection_color.a);
-			gfx_set_shader_params(shader_params);	
-			gfx_draw_2d_quad((float)text_list->pos.x, (float)text_list->pos.y+text_list->height-offset,
-				(float)text_list->list_width, (float)text_list->font->size+text_list->font->offset_y);
-		}
-		else
-		{
-			shader_params->texture_params[0].texture = NULL;
-			if(light) gfx_set_color(&shader_params->material_params.color, text_list->light_color.r,
-				text_list->light_color.g, text_list->light_color.b, text_list->light_color.a);
-			else gfx_set_color(&shader_params->material_params.color, text_list->dark_color.r,
-				text_list->dark_color.g, text_list->dark_color.b, text_list->dark_color.a);
-			gfx_set_shader_params(shader_params);	
-			gfx_draw_2d_quad((float)text_list->pos.x, (float)text_list->pos.y+text_list->height-offset,
-				(float)text_list->list_width, (float)text_list->font->size+text_list->font->offset_y);
-		}
+		if(i == text_list->selection) color = &text_list->selection_color;
+		else if(light) color = &text_list->light_color;
+		else color = &text_list->dark_color;
+
+		elf_add_gui_quad(gui, NULL, &list_clip, (float)text_list->pos.x, (float)(text_list->pos.y+text_list->height-offset),
+			(float)text_list->list_width, (float)row_height, 0.0, 0.0, 1.0, 1.0, color);
 
 		light = !light;
 
-		gfx_set_color(&shader_params->material_params.color, text_list->color.r,
-			text_list->color.g, text_list->color.b, text_list->color.a);
-		elf_draw_string(text_list->font, str_obj->str, text_list->pos.x, text_list->pos.y+text_list->height-offset, shader_params);
+		elf_add_gui_text(gui, text_list->font, str_obj->str, text_list->pos.x,
+			text_list->pos.y+text_list->height-offset, &text_list->color, &list_clip);
 
-		offset += text_list->font->size+text_list->font->offset_y;
+		offset += row_height;
 	}
-
-	shader_params->texture_params[0].texture = NULL;
 }
 
 elf_font* elf_get_text_list_font(elf_text_list *text_list)
@@ -1097,6 +1068,7 @@ void elf_set_text_list_selection_color(elf_text_list *text_list, float r, float
 	text_list->selection_color.g = g;
 	text_list->selection_color.b = b;
 	text_list->selection_color.a = a;
+	elf_set_gui_object_dirty((elf_gui_object*)text_list);
 }
 
 void elf_set_text_list_light_color(elf_text_list *text_list, float r, float g, float b, float a)
@@ -1105,6 +1077,7 @@ void elf_set_text_list_light_color(elf_text_list *text_list, float r, float g, f
 	text_list->light_color.g = g;
 	text_list->light_color.b = b;
 	text_list->light_color.a = a;
+	elf_set_gui_object_dirty((elf_gui_object*)text_list);
 }
 
 void elf_set_text_list_dark_color(elf_text_list *text_list, float r, float g, float b, float a)
@@ -1113,6 +1086,7 @@ void elf_set_text_list_dark_color(elf_text_list *text_list, float r, float g, fl
 	text_list->dark_color.g = g;
 	text_list->dark_color.b = b;
 	text_list->dark_color.a = a;
+	elf_set_gui_object_dirty((elf_gui_object*)text_list);
 }
 
 void elf_set_text_list_size(elf_text_list *text_list, int rows, int width)
@@ -1134,6 +1108,7 @@ void elf_add_text_list_item(elf_text_list *text_list, const char *text)
 	str_obj->str = elf_create_string(text);
 
 	elf_append_to_list(text_list->items, (elf_object*)str_obj);
+	elf_set_gui_object_dirty((elf_gui_object*)text_list);
 }
 
 void elf_set_text_list_item(elf_text_list *text_list, int idx, const char *text)
@@ -1145,6 +1120,7 @@ void elf_set_text_list_item(elf_text_list *text_list, int idx, const char *text)
 	{
 		if(str_obj->str) elf_destroy_string(str_obj->str);
 		str_obj->str = elf_create_string(text);
+		elf_set_gui_object_dirty((elf_gui_object*)text_list);
 	}
 }
 
@@ -1162,6 +1138,7 @@ unsigned char elf_remove_text_list_item(elf_text_list *text_list, int idx)
 		{
 			if(idx == text_list->selection) text_list->selection = -1;
 			elf_remove_from_list(text_list->items, (elf_object*)str_obj);
+			elf_set_gui_object_dirty((elf_gui_object*)text_list);
 			return ELF_TRUE;
 		}
 	}
@@ -1176,12 +1153,14 @@ void elf_remove_text_list_items(elf_text_list *text_list)
 	elf_inc_ref((elf_object*)text_list->items);
 	text_list->offset = 0;
 	text_list->selection = 0;
+	elf_set_gui_object_dirty((elf_gui_object*)text_list);
 }
 
 void elf_set_text_list_offset(elf_text_list *text_list, int offset)
 {
 	text_list->offset = offset;
 	if(text_list->offset < 0) text_list->offset = 0;
+	elf_set_gui_object_dirty((elf_gui_object*)text_list);
 }
 
 void elf_set_text_list_selection(elf_text_list *text_list, int selection)
@@ -1191,6 +1170,7 @@ void elf_set_text_list_selection(elf_text_list *text_list, int selection)
 	if(text_list->selection > elf_get_list_length(text_list->items)-1)
 		text_list->selection = elf_get_list_length(text_list->items)-1;
 	if(elf_get_list_length(text_list->items) == 0) text_list->selection = -1;
+	elf_set_gui_object_dirty((elf_gui_object*)text_list);
 }
 
 elf_check_box* elf_create_check_box(const char *name)
@@ -1225,28 +1205,18 @@ void elf_destroy_check_box(elf_check_box *check_box)
 	elf_dec_obj_count();
 }
 
-void elf_draw_check_box(elf_check_box *check_box, gfx_shader_params *shader_params)
+void elf_add_check_box_quads(elf_gui *gui, elf_check_box *check_box, elf_area *clip)
 {
-	if(!check_box->visible) return;
+	elf_texture *texture;
 
-	gfx_set_color(&shader_params->material_params.color, check_box->color.r,
-		check_box->color.g, check_box->color.b, check_box->color.a);
+	texture = NULL;
+	if(check_box->state == ELF_OFF) texture = check_box->off;
+	else if(check_box->state == ELF_ON) texture = check_box->on;
 
-	if(check_box->state == ELF_OFF)
-	{
-		if(check_box->off) shader_params->texture_params[0].texture = check_box->off->texture;
-	}
-	else if(check_box->state == ELF_ON)
-	{
-		if(check_box->on) shader_params->texture_params[0].texture = check_box->on->texture;
-	}
+	if(!texture) return;
 
-	if(shader_params->texture_params[0].texture)
-	{
-		gfx_set_shader_params(shader_params);
-		gfx_draw_textured_2d_quad((float)check_box->pos.x, (float)check_box->pos.y, (float)check_box->width, (float)check_box->height);
-		shader_params->texture_params[0].texture = NULL;
-	}
+	elf_add_gui_quad(gui, texture->texture, clip, (float)check_box->pos.x, (float)check_box->pos.y,
+		(float)check_box->width, (float)check_box->height, 0.0, 0.0, 1.0, 1.0, &check_box->color);
 }
 
 unsigned char elf_get_check_box_state(elf_check_box *check_box)
@@ -1291,17 +1261,21 @@ void elf_set_check_box_on_texture(elf_check_box *check_box, elf_texture *on)
 	if(check_box->on) elf_dec_ref((elf_object*)check_box->on);
 	check_box->on = on;
 	if(check_box->on) elf_inc_ref((elf_object*)check_box->on);
+	elf_set_gui_object_dirty((elf_gui_object*)check_box);
 }
 
 void elf_set_check_box_state(elf_check_box *check_box, unsigned char state)
 {
 	check_box->state = !state == ELF_OFF;
+	elf_set_gui_object_dirty((elf_gui_object*)check_box);
 }
 
 void elf_recalc_gui_object(elf_gui_object *object)
 {
 	elf_gui_object *obj;
 
+	elf_set_gui_object_dirty(object);
+
 	if(object->type == ELF_LABEL) elf_recalc_label((elf_label*)object);
 	else if(object->type == ELF_BUTTON) elf_recalc_button((elf_button*)object);
 	else if(object->type == ELF_PICTURE) elf_recalc_picture((elf_picture*)object);
@@ -1354,6 +1328,15 @@ void elf_clear_gui_object_root(elf_gui_object *object)
 		}
 	}
 
+	if(object->screens)
+	{
+		for(cobject = (elf_gui_object*)elf_begin_list(object->screens); cobject;
+			cobject = (elf_gui_object*)elf_next_in_list(object->screens))
+		{
+			elf_clear_gui_object_root(cobject);
+		}
+	}
+
 	object->root = NULL;
 }
 
@@ -1370,6 +1353,15 @@ void elf_set_gui_object_root(elf_gui_object *object, elf_gui *root)
 		}
 	}
 
+	if(object->screens)
+	{
+		for(cobject = (elf_gui_object*)elf_begin_list(object->screens); cobject;
+			cobject = (elf_gui_object*)elf_next_in_list(object->screens))
+		{
+			elf_set_gui_object_root(cobject, root);
+		}
+	}
+
 	object->root = root;
 }
 
@@ -1396,6 +1388,8 @@ elf_gui* elf_create_gui()
 	gui->width = elf_get_window_width();
 	gui->height = elf_get_window_height();
 
+	gui->dirty = ELF_TRUE;
+
 	elf_inc_obj_count();
 
 	return gui;
@@ -1417,72 +1411,214 @@ void elf_destroy_gui(elf_gui *gui)
 	elf_dec_ref((elf_object*)gui->children);
 	elf_dec_ref((elf_object*)gui->screens);
 
+	if(gui->quads) free(gui->quads);
+	if(gui->batches) free(gui->batches);
+	if(gui->hits) free(gui->hits);
+	if(gui->vertex_array) gfx_dec_ref((gfx_object*)gui->vertex_array);
+
 	free(gui);
 
 	elf_dec_obj_count();
 }
 
-elf_gui_object* elf_trace_top_object(elf_gui_object *object, unsigned char click)
+void elf_add_gui_hit(elf_gui *gui, elf_gui_object *object, elf_area *area)
+{
+	if(gui->hit_count >= gui->hit_capacity)
+	{
+		gui->hit_capacity = gui->hit_capacity > 0 ? gui->hit_capacity*2 : 64;
+		gui->hits = (elf_gui_hit*)realloc(gui->hits, sizeof(elf_gui_hit)*gui->hit_capacity);
+	}
+
+	gui->hits[gui->hit_count].object = object;
+	gui->hits[gui->hit_count].area = *area;
+	gui->hit_count++;
+}
+
+void elf_add_gui_object_quads(elf_gui *gui, elf_gui_object *object, elf_area *clip, unsigned char draw)
 {
 	elf_gui_object *cobject;
-	elf_gui_object *result;
-	elf_vec2i mouse_pos;
+	elf_area area;
 
-	if(!object->visible) return ELF_FALSE;
+	if(!object->visible) return;
 
-	mouse_pos = elf_get_mouse_position();
-	mouse_pos.y = elf_get_window_height()-mouse_pos.y;
+	elf_clip_gui_area(clip, object->pos.x, object->pos.y, object->width, object->height, &area);
+	elf_add_gui_hit(gui, object, &area);
 
-	if(object->type == ELF_GUI && ((elf_gui*)object)->focus_screen)
+	// the contents of a screen without a texture can still be clicked but aren't drawn
+	if(object->type == ELF_SCREEN && !((elf_screen*)object)->texture) draw = ELF_FALSE;
+
+	if(draw)
 	{
-		return elf_trace_top_object((elf_gui_object*)((elf_gui*)object)->focus_screen, click);
+		if(object->type == ELF_LABEL) elf_add_label_quads(gui, (elf_label*)object, clip);
+		else if(object->type == ELF_BUTTON) elf_add_button_quads(gui, (elf_button*)object, clip);
+		else if(object->type == ELF_PICTURE) elf_add_picture_quads(gui, (elf_picture*)object, clip);
+		else if(object->type == ELF_TEXT_FIELD) elf_add_text_field_quads(gui, (elf_text_field*)object, clip);
+		else if(object->type == ELF_TEXT_LIST) elf_add_text_list_quads(gui, (elf_text_list*)object, clip);
+		else if(object->type == ELF_SLIDER) elf_add_slider_quads(gui, (elf_slider*)object, clip);
+		else if(object->type == ELF_CHECK_BOX) elf_add_check_box_quads(gui, (elf_check_box*)object, clip);
+		else if(object->type == ELF_SCREEN) elf_add_screen_quads(gui, (elf_screen*)object, clip);
+	}
+
+	if(object->children)
+	{
+		for(cobject = (elf_gui_object*)elf_begin_list(object->children); cobject;
+			cobject = (elf_gui_object*)elf_next_in_list(object->children))
+		{
+			elf_add_gui_object_quads(gui, cobject, &area, draw);
+		}
 	}
 
-	result = NULL;
 	if(object->screens)
 	{
-		for(cobject = (elf_gui_object*)elf_rbegin_list(object->screens); cobject;
-			cobject = (elf_gui_object*)elf_rnext_in_list(object->screens))
+		for(cobject = (elf_gui_object*)elf_begin_list(object->screens); cobject;
+			cobject = (elf_gui_object*)elf_next_in_list(object->screens))
 		{
-			if(mouse_pos.x >= cobject->pos.x && mouse_pos.x <= cobject->pos.x+cobject->width &&
-				mouse_pos.y >= cobject->pos.y && mouse_pos.y <= cobject->pos.y+cobject->height &&
-				cobject->visible)
-			{
-				if(click)
-				{
-					elf_inc_ref((elf_object*)cobject);
-					elf_remove_from_list(object->screens, (elf_object*)cobject);
-					elf_append_to_list(object->screens, (elf_object*)cobject);
-					elf_dec_ref((elf_object*)cobject);
-				}
-				result = elf_trace_top_object(cobject, click);
-				if(result) return result;
-				return cobject;
-			}
+			elf_add_gui_object_quads(gui, cobject, &area, draw);
 		}
 	}
+}
 
-	result = NULL;
-	if(object->children)
+void elf_reserve_gui_buffers(elf_gui *gui, int quads)
+{
+	if(quads <= gui->buffer_capacity) return;
+
+	if(gui->vertex_array) gfx_dec_ref((gfx_object*)gui->vertex_array);
+
+	if(gui->buffer_capacity < ELF_GUI_MIN_QUADS) gui->buffer_capacity = ELF_GUI_MIN_QUADS;
+	while(gui->buffer_capacity < quads) gui->buffer_capacity *= 2;
+
+	gui->vertex_data = gfx_create_vertex_data(gui->buffer_capacity*6*3, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
+	gui->tex_coord_data = gfx_create_vertex_data(gui->buffer_capacity*6*2, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
+	gui->color_data = gfx_create_vertex_data(gui->buffer_capacity*6*4, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
+
+	gui->vertex_array = gfx_create_vertex_array(GFX_TRUE);
+	gfx_set_vertex_array_data(gui->vertex_array, GFX_VERTEX, gui->vertex_data);
+	gfx_set_vertex_array_data(gui->vertex_array, GFX_TEX_COORD, gui->tex_coord_data);
+	gfx_set_vertex_array_data(gui->vertex_array, GFX_COLOR, gui->color_data);
+	gfx_inc_ref((gfx_object*)gui->vertex_array);
+}
+
+void elf_build_gui_draw_list(elf_gui *gui)
+{
+	elf_gui_quad *quad;
+	elf_gui_batch *batch;
+	elf_area clip;
+	float *vertices;
+	float *tex_coords;
+	float *colors;
+	int first;
+	int i, j, k;
+
+	gui->quad_count = 0;
+	gui->batch_count = 0;
+	gui->hit_count = 0;
+
+	clip.pos = gui->pos;
+	clip.size.x = gui->width;
+	clip.size.y = gui->height;
+
+	elf_add_gui_object_quads(gui, (elf_gui_object*)gui, &clip, ELF_TRUE);
+
+	// the batches take the buffer in order, quad_count counts back up as they are filled
+	for(i = 0, first = 0; i < gui->batch_count; i++)
 	{
-		for(cobject = (elf_gui_object*)elf_rbegin_list(object->children); cobject;
-			cobject = (elf_gui_object*)elf_rnext_in_list(object->children))
+		gui->batches[i].first = first;
+		first += gui->batches[i].quad_count;
+		gui->batches[i].quad_count = 0;
+	}
+
+	if(gui->quad_count > 0)
+	{
+		elf_reserve_gui_buffers(gui, gui->quad_count);
+
+		vertices = (float*)gfx_get_vertex_data_buffer(gui->vertex_data);
+		tex_coords = (float*)gfx_get_vertex_data_buffer(gui->tex_coord_data);
+		colors = (float*)gfx_get_vertex_data_buffer(gui->color_data);
+
+		for(i = 0; i < gui->quad_count; i++)
 		{
-			if(mouse_pos.x >= cobject->pos.x && mouse_pos.x <= cobject->pos.x+cobject->width &&
-				mouse_pos.y >= cobject->pos.y && mouse_pos.y <= cobject->pos.y+cobject->height &&
-				cobject->visible)
+			quad = &gui->quads[i];
+			batch = &gui->batches[quad->batch];
+			j = (batch->first+batch->quad_count)*6;
+			batch->quad_count++;
+
+			// two triangles, bottom left, bottom right, top right and top right, top left, bottom left
+			vertices[j*3] = quad->x; vertices[j*3+1] = quad->y; vertices[j*3+2] = 0.0;
+			vertices[j*3+3] = quad->x+quad->width; vertices[j*3+4] = quad->y; vertices[j*3+5] = 0.0;
+			vertices[j*3+6] = quad->x+quad->width; vertices[j*3+7] = quad->y+quad->height; vertices[j*3+8] = 0.0;
+			vertices[j*3+9] = quad->x+quad->width; vertices[j*3+10] = quad->y+quad->height; vertices[j*3+11] = 0.0;
+			vertices[j*3+12] = quad->x; vertices[j*3+13] = quad->y+quad->height; vertices[j*3+14] = 0.0;
+			vertices[j*3+15] = quad->x; vertices[j*3+16] = quad->y; vertices[j*3+17] = 0.0;
+
+			tex_coords[j*2] = quad->tx; tex_coords[j*2+1] = quad->ty;
+			tex_coords[j*2+2] = quad->tx+quad->twidth; tex_coords[j*2+3] = quad->ty;
+			tex_coords[j*2+4] = quad->tx+quad->twidth; tex_coords[j*2+5] = quad->ty+quad->theight;
+			tex_coords[j*2+6] = quad->tx+quad->twidth; tex_coords[j*2+7] = quad->ty+quad->theight;
+			tex_coords[j*2+8] = quad->tx; tex_coords[j*2+9] = quad->ty+quad->theight;
+			tex_coords[j*2+10] = quad->tx; tex_coords[j*2+11] = quad->ty;
+
+			for(k = 0; k < 6; k++)
 			{
-				result = elf_trace_top_object(cobject, click);
-				if(result) return result;
-				return cobject;
+				colors[(j+k)*4] = quad->color.r;
+				colors[(j+k)*4+1] = quad->color.g;
+				colors[(j+k)*4+2] = quad->color.b;
+				colors[(j+k)*4+3] = quad->color.a;
 			}
 		}
+
+		gfx_update_vertex_data_sub_data(gui->vertex_data, 0, sizeof(float)*gui->quad_count*6*3);
+		gfx_update_vertex_data_sub_data(gui->tex_coord_data, 0, sizeof(float)*gui->quad_count*6*2);
+		gfx_update_vertex_data_sub_data(gui->color_data, 0, sizeof(float)*gui->quad_count*6*4);
 	}
 
-	if(mouse_pos.x >= object->pos.x && mouse_pos.x <= object->pos.x+object->width &&
-		mouse_pos.y >= object->pos.y && mouse_pos.y <= object->pos.y+object->height)
+	gui->drawn_text_field = gui->active_text_field;
+	gui->dirty = ELF_FALSE;
+}
+
+unsigned char elf_is_gui_object_inside(elf_gui_object *object, elf_gui_object *parent)
+{
+	for(; object; object = object->parent)
+		if(object == parent) return ELF_TRUE;
+
+	return ELF_FALSE;
+}
+
+elf_gui_object* elf_trace_top_object(elf_gui *gui, unsigned char click)
+{
+	elf_gui_object *object;
+	elf_gui_hit *hit;
+	elf_vec2i mouse_pos;
+	int i;
+
+	if(!gui->visible) return NULL;
+
+	if(gui->dirty) elf_build_gui_draw_list(gui);
+
+	mouse_pos = elf_get_mouse_position();
+	mouse_pos.y = elf_get_window_height()-mouse_pos.y;
+
+	// the hits are in draw order, the last one under the mouse is on top
+	for(i = gui->hit_count-1; i >= 0; i--)
 	{
-		return object;
+		hit = &gui->hits[i];
+
+		if(mouse_pos.x < hit->area.pos.x || mouse_pos.x > hit->area.pos.x+hit->area.size.x ||
+			mouse_pos.y < hit->area.pos.y || mouse_pos.y > hit->area.pos.y+hit->area.size.y) continue;
+
+		if(gui->focus_screen && !elf_is_gui_object_inside(hit->object, (elf_gui_object*)gui->focus_screen)) continue;
+
+		// clicking raises the screens the object is on
+		if(click)
+		{
+			for(object = hit->object; object && object->parent && object != (elf_gui_object*)gui->focus_screen;
+				object = object->parent)
+			{
+				if(object->type == ELF_SCREEN && (elf_gui_object*)elf_rbegin_list(object->parent->screens) != object)
+					elf_set_screen_to_top((elf_screen*)object);
+			}
+		}
+
+		return hit->object;
 	}
 
 	return NULL;
@@ -1508,9 +1644,7 @@ void elf_send_gui_char_event(elf_gui *gui, char chr)
 			eng->actor = (elf_object*)gui->active_text_field;
 			elf_inc_ref((elf_object*)gui->active_text_field);
 
-			elf_run_string("me = elf.GetActor(); event = elf.CHAR_INPUT");
-			elf_run_script(gui->active_text_field->script);
-			elf_run_string("me = nil; event = 0");
+			elf_run_actor_script(gui->active_text_field->script, ELF_CHAR_INPUT);
 
 			elf_dec_ref((elf_object*)gui->active_text_field);
 			eng->actor = NULL;
@@ -1540,6 +1674,7 @@ void elf_send_gui_key_event(elf_gui *gui, int key)
 					gui->active_text_field->cursor_pos);
 				elf_destroy_string(gui->active_text_field->text);
 				gui->active_text_field->text = str;
+				elf_set_gui_object_dirty((elf_gui_object*)gui->active_text_field);
 			}
 		}
 		else if(key == ELF_KEY_BACKSPACE)
@@ -1562,9 +1697,7 @@ void elf_send_gui_key_event(elf_gui *gui, int key)
 				eng->actor = (elf_object*)gui->active_text_field;
 				elf_inc_ref((elf_object*)gui->active_text_field);
 
-				elf_run_string("me = elf.GetActor(); event = elf.LOSE_FOCUS");
-				elf_run_script(gui->active_text_field->script);
-				elf_run_string("me = nil; event = 0");
+				elf_run_actor_script(gui->active_text_field->script, ELF_LOSE_FOCUS);
 
 				elf_dec_ref((elf_object*)gui->active_text_field);
 				eng->actor = NULL;
@@ -1611,7 +1744,7 @@ void elf_update_gui(elf_gui *gui, float step)
 	elf_text_list *text_list;
 	int i;
 
-	if(gui->update_size)
+	if(gui->update_size && (gui->width != elf_get_window_width() || gui->height != elf_get_window_height()))
 	{
 		gui->width = elf_get_window_width();
 		gui->height = elf_get_window_height();
@@ -1627,7 +1760,7 @@ void elf_update_gui(elf_gui *gui, float step)
 	if(mouse_force.x || mouse_force.y) moved = ELF_TRUE;
 
 	prev_trace = gui->trace;
-	gui->trace = elf_trace_top_object((elf_gui_object*)gui, elf_get_mouse_button_state(ELF_BUTTON_LEFT) == ELF_PRESSED);
+	gui->trace = elf_trace_top_object(gui, elf_get_mouse_button_state(ELF_BUTTON_LEFT) == ELF_PRESSED);
 
 	if(gui->trace)
 	{
@@ -1635,11 +1768,11 @@ void elf_update_gui(elf_gui *gui, float step)
 		{
 			if(!gui->target)
 			{
-				((elf_button*)gui->trace)->state = ELF_OVER;
+				elf_change_button_state((elf_button*)gui->trace, ELF_OVER);
 			}
 			else if(gui->target == gui->trace)
 			{
-				((elf_button*)gui->trace)->state = ELF_ON;
+				elf_change_button_state((elf_button*)gui->trace, ELF_ON);
 			}
 		}
 	}
@@ -1648,7 +1781,7 @@ void elf_update_gui(elf_gui *gui, float step)
 	{
 		if(prev_trace->type == ELF_BUTTON)
 		{
-			((elf_button*)prev_trace)->state = ELF_OFF;
+			elf_change_button_state((elf_button*)prev_trace, ELF_OFF);
 		}
 	}
 
@@ -1662,9 +1795,7 @@ void elf_update_gui(elf_gui *gui, float step)
 				eng->actor = (elf_object*)gui->active_text_field;
 				elf_inc_ref((elf_object*)gui->active_text_field);
 
-				elf_run_string("me = elf.GetActor(); event = elf.LOSE_FOCUS");
-				elf_run_script(gui->active_text_field->script);
-				elf_run_string("me = nil; event = 0");
+				elf_run_actor_script(gui->active_text_field->script, ELF_LOSE_FOCUS);
 
 				elf_dec_ref((elf_object*)gui->active_text_field);
 				eng->actor = NULL;
@@ -1679,7 +1810,7 @@ void elf_update_gui(elf_gui *gui, float step)
 		{
 			if(gui->target->type == ELF_BUTTON)
 			{
-				((elf_button*)gui->target)->state = ELF_ON;
+				elf_change_button_state((elf_button*)gui->target, ELF_ON);
 			}
 			else if(gui->target->type == ELF_TEXT_FIELD)
 			{
@@ -1691,9 +1822,7 @@ void elf_update_gui(elf_gui *gui, float step)
 					eng->actor = (elf_object*)gui->active_text_field;
 					elf_inc_ref((elf_object*)gui->active_text_field);
 
-					elf_run_string("me = elf.GetActor(); event = elf.GAIN_FOCUS");
-					elf_run_script(gui->active_text_field->script);
-					elf_run_string("me = nil; event = 0");
+					elf_run_actor_script(gui->active_text_field->script, ELF_GAIN_FOCUS);
 
 					elf_dec_ref((elf_object*)gui->active_text_field);
 					eng->actor = NULL;
@@ -1714,6 +1843,7 @@ void elf_update_gui(elf_gui *gui, float step)
 					if(slider->value < 0.0) slider->value = 0.0;
 					if(slider->value > 1.0) slider->value = 1.0;
 				}
+				elf_set_gui_object_dirty((elf_gui_object*)slider);
 
 				slider->event = ELF_VALUE_CHANGED;
 				if(slider->script)
@@ -1721,9 +1851,7 @@ void elf_update_gui(elf_gui *gui, float step)
 					eng->actor = (elf_object*)gui->target;
 					elf_inc_ref((elf_object*)gui->target);
 
-					elf_run_string("me = elf.GetActor(); event = elf.VALUE_CHANGED");
-					elf_run_script(slider->script);
-					elf_run_string("me = nil; event = 0");
+					elf_run_actor_script(slider->script, ELF_VALUE_CHANGED);
 
 					elf_dec_ref((elf_object*)gui->target);
 					eng->actor = NULL;
@@ -1739,6 +1867,7 @@ void elf_update_gui(elf_gui *gui, float step)
 							(text_list->font->size+text_list->font->offset_y)
 						+text_list->offset;
 					if(text_list->selection > elf_get_list_length(text_list->items)-1) text_list->selection = -1;
+					elf_set_gui_object_dirty((elf_gui_object*)text_list);
 
 					text_list->event = ELF_SELECTION_CHANGED;
 					if(text_list->script)
@@ -1746,9 +1875,7 @@ void elf_update_gui(elf_gui *gui, float step)
 						eng->actor = (elf_object*)gui->target;
 						elf_inc_ref((elf_object*)gui->target);
 
-						elf_run_string("me = elf.GetActor(); event = elf.SELECTION_CHANGED");
-						elf_run_script(text_list->script);
-						elf_run_string("me = nil; event = 0");
+						elf_run_actor_script(text_list->script, ELF_SELECTION_CHANGED);
 
 						elf_dec_ref((elf_object*)gui->target);
 						eng->actor = NULL;
@@ -1758,6 +1885,7 @@ void elf_update_gui(elf_gui *gui, float step)
 			else if(gui->target->type == ELF_CHECK_BOX)
 			{
 				((elf_check_box*)gui->target)->state = !((elf_check_box*)gui->target)->state;
+				elf_set_gui_object_dirty(gui->target);
 
 				((elf_check_box*)gui->target)->event = ELF_STATE_CHANGED;
 				if(((elf_check_box*)gui->target)->script)
@@ -1765,9 +1893,7 @@ void elf_update_gui(elf_gui *gui, float step)
 					eng->actor = (elf_object*)gui->target;
 					elf_inc_ref((elf_object*)gui->target);
 
-					elf_run_string("me = elf.GetActor(); event = elf.STATE_CHANGED");
-					elf_run_script(((elf_check_box*)gui->target)->script);
-					elf_run_string("me = nil; event = 0");
+					elf_run_actor_script(((elf_check_box*)gui->target)->script, ELF_STATE_CHANGED);
 
 					elf_dec_ref((elf_object*)gui->target);
 					eng->actor = NULL;
@@ -1789,11 +1915,9 @@ void elf_update_gui(elf_gui *gui, float step)
 						eng->actor = (elf_object*)gui->target;
 						elf_inc_ref((elf_object*)gui->target);
 
-						((elf_button*)gui->target)->state = ELF_OFF;
+						elf_change_button_state((elf_button*)gui->target, ELF_OFF);
 
-						elf_run_string("me = elf.GetActor(); event = elf.CLICKED");
-						elf_run_script(((elf_button*)gui->target)->script);
-						elf_run_string("me = nil; event = 0");
+						elf_run_actor_script(((elf_button*)gui->target)->script, ELF_CLICKED);
 
 						elf_dec_ref((elf_object*)gui->target);
 						eng->actor = NULL;
@@ -1822,6 +1946,7 @@ void elf_update_gui(elf_gui *gui, float step)
 					if(slider->value < 0.0) slider->value = 0.0;
 					if(slider->value > 1.0) slider->value = 1.0;
 				}
+				elf_set_gui_object_dirty((elf_gui_object*)slider);
 
 				slider->event = ELF_VALUE_CHANGED;
 				if(slider->script)
@@ -1829,9 +1954,7 @@ void elf_update_gui(elf_gui *gui, float step)
 					eng->actor = (elf_object*)gui->target;
 					elf_inc_ref((elf_object*)gui->target);
 
-					elf_run_string("me = elf.GetActor(); event = elf.VALUE_CHANGED");
-					elf_run_script(slider->script);
-					elf_run_string("me = nil; event = 0");
+					elf_run_actor_script(slider->script, ELF_VALUE_CHANGED);
 
 					elf_dec_ref((elf_object*)gui->target);
 					eng->actor = NULL;
@@ -1928,58 +2051,37 @@ void elf_update_gui(elf_gui *gui, float step)
 
 void elf_draw_gui(elf_gui *gui)
 {
-	elf_gui_object *object;
-	elf_area area;
+	elf_gui_batch *batch;
+	int i;
 
 	if(!gui->visible) return;
 
-	area.pos.x = gui->pos.x;
-	area.pos.y = gui->pos.y;
-	area.size.x = gui->width;
-	area.size.y = gui->height;
+	if(gui->active_text_field != gui->drawn_text_field) gui->dirty = ELF_TRUE;
+	if(gui->dirty) elf_build_gui_draw_list(gui);
 
 	gfx_set_shader_params_default(&gui->shader_params);
 	gui->shader_params.render_params.depth_write = GFX_FALSE;
 	gui->shader_params.render_params.depth_test = GFX_FALSE;
 	gui->shader_params.render_params.blend_mode = GFX_TRANSPARENT;
-	gfx_set_viewport(gui->pos.x, gui->pos.y, gui->width, gui->height);
-	gfx_get_orthographic_projection_matrix((float)gui->pos.x, (float)gui->width, (float)gui->pos.x, (float)gui->height,
-		-1.0, 1.0, gui->shader_params.projection_matrix);
+	gui->shader_params.render_params.vertex_color = GFX_TRUE;
 
-	for(object = (elf_gui_object*)elf_begin_list(gui->children); object;
-		object = (elf_gui_object*)elf_next_in_list(gui->children))
+	// the clip area of a batch is both the viewport and the projection
+	for(i = 0; i < gui->batch_count; i++)
 	{
-		if(object->type == ELF_LABEL) elf_draw_label((elf_label*)object, &gui->shader_params);
-		else if(object->type == ELF_BUTTON) elf_draw_button((elf_button*)object, &gui->shader_params);
-		else if(object->type == ELF_PICTURE) elf_draw_picture((elf_picture*)object, &gui->shader_params);
-		else if(object->type == ELF_TEXT_FIELD)
-		{
-			elf_draw_text_field((elf_text_field*)object, &area, &gui->shader_params);
-			gfx_set_viewport(gui->pos.x, gui->pos.y, gui->width, gui->height);
-			gfx_get_orthographic_projection_matrix((float)gui->pos.x, (float)gui->pos.x+gui->width, (float)gui->pos.y, (float)gui->pos.y+gui->height,
-				-1.0, 1.0, gui->shader_params.projection_matrix);
-		}
-		else if(object->type == ELF_TEXT_LIST)
-		{
-			elf_draw_text_list((elf_text_list*)object, &area, &gui->shader_params);
-			gfx_set_viewport(gui->pos.x, gui->pos.y, gui->width, gui->height);
-			gfx_get_orthographic_projection_matrix((float)gui->pos.x, (float)gui->pos.x+gui->width, (float)gui->pos.y, (float)gui->pos.y+gui->height,
-				-1.0, 1.0, gui->shader_params.projection_matrix);
-		}
-		else if(object->type == ELF_SLIDER) elf_draw_slider((elf_slider*)object, &gui->shader_params);
-		else if(object->type == ELF_CHECK_BOX) elf_draw_check_box((elf_check_box*)object, &gui->shader_params);
-	}
+		batch = &gui->batches[i];
 
-	for(object = (elf_gui_object*)elf_begin_list(gui->screens); object;
-		object = (elf_gui_object*)elf_next_in_list(gui->screens))
-	{
-		area.pos.x = gui->pos.x; area.pos.y = gui->pos.y; area.size.x = gui->width; area.size.y = gui->height;
-		elf_draw_screen((elf_screen*)object, &area, &gui->shader_params);
-		gfx_set_viewport(gui->pos.x, gui->pos.y, gui->width, gui->height);
-		gfx_get_orthographic_projection_matrix((float)gui->pos.x, (float)gui->pos.x+gui->width, (float)gui->pos.y, (float)gui->pos.y+gui->height,
+		gfx_set_viewport(batch->clip.pos.x, batch->clip.pos.y, batch->clip.size.x, batch->clip.size.y);
+		gfx_get_orthographic_projection_matrix((float)batch->clip.pos.x, (float)batch->clip.pos.x+batch->clip.size.x,
+			(float)batch->clip.pos.y, (float)batch->clip.pos.y+batch->clip.size.y,
 			-1.0, 1.0, gui->shader_params.projection_matrix);
+
+		gui->shader_params.texture_params[0].texture = batch->texture;
+		gfx_set_shader_params(&gui->shader_params);
+		gfx_draw_vertex_array_range(gui->vertex_array, batch->first*6, batch->quad_count*6, GFX_TRIANGLES);
 	}
 
+	gfx_set_viewport(gui->pos.x, gui->pos.y, gui->width, gui->height);
+
 	// reset state just to be sure...
 	gfx_set_shader_params_default(&gui->shader_params);
 	gfx_set_shader_params(&gui->shader_params);
@@ -2072,6 +2174,7 @@ unsigned char elf_remove_gui_object_by_name(elf_gui_object *parent, const char *
 				if(object->root->active_text_field == (elf_text_field*)object)
 					object->root->active_text_field = NULL;
 			}
+			elf_set_gui_object_dirty(parent);
 			object->parent = NULL;
 			elf_clear_gui_object_root(object);
 			elf_remove_from_list(parent->children, (elf_object*)object);
@@ -2091,6 +2194,7 @@ unsigned char elf_remove_gui_object_by_name(elf_gui_object *parent, const char *
 				if(object->root->focus_screen == (elf_screen*)object)
 					object->root->focus_screen = NULL;
 			}
+			elf_set_gui_object_dirty(parent);
 			object->parent = NULL;
 			elf_clear_gui_object_root(object);
 			elf_remove_from_list(parent->children, (elf_object*)object);
@@ -2124,6 +2228,7 @@ unsigned char elf_remove_gui_object_by_index(elf_gui_object *parent, int idx)
 					if(object->root->active_text_field == (elf_text_field*)object)
 						object->root->active_text_field = NULL;
 				}
+				elf_set_gui_object_dirty(parent);
 				object->parent = NULL;
 				elf_clear_gui_object_root(object);
 				elf_remove_from_list(parent->children, (elf_object*)object);
@@ -2146,6 +2251,7 @@ unsigned char elf_remove_gui_object_by_index(elf_gui_object *parent, int idx)
 					if(object->root->focus_screen == (elf_screen*)object)
 						object->root->focus_screen = NULL;
 				}
+				elf_set_gui_object_dirty(parent);
 				object->parent = NULL;
 				elf_clear_gui_object_root(object);
 				elf_remove_from_list(parent->children, (elf_object*)object);
@@ -2170,6 +2276,7 @@ unsigned char elf_remove_gui_object_by_object(elf_gui_object *parent, elf_gui_ob
 		if(object->root->focus_screen == (elf_screen*)object)
 			object->root->focus_screen = NULL;
 	}
+	elf_set_gui_object_dirty(parent);
 	object->parent = NULL;
 	elf_clear_gui_object_root(object);
 	if(object->type != ELF_SCREEN) return elf_remove_from_list(parent->children, (elf_object*)object);
@@ -2195,5 +2302,6 @@ void elf_empty_gui(elf_gui *gui)
 	gui->screens = elf_create_list();
 	elf_inc_ref((elf_object*)gui->children);
 	elf_inc_ref((elf_object*)gui->screens);
+	gui->dirty = ELF_TRUE;
 }
 
@@ -43,6 +43,7 @@ elf_light* elf_create_light(const char *name)
 
 void elf_update_light(elf_light *light)
 {
+	elf_sync_actor_transform((elf_actor*)light);
 	elf_update_actor((elf_actor*)light);
 }
 
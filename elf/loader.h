@@ -0,0 +1,199 @@
+
+void elf_run_scene_loader_thread(void *arg)
+{
+	elf_scene_loader *loader;
+	elf_pak_index *index;
+	elf_pak_reader reader;
+	elf_decoded_texture *decoded_texture;
+	elf_decoded_model *decoded_model;
+	int job;
+
+	loader = (elf_scene_loader*)arg;
+
+	while(1)
+	{
+		elf_lock_mutex(loader->mutex);
+		if(loader->cancel || loader->next_job >= loader->job_count)
+		{
+			elf_unlock_mutex(loader->mutex);
+			return;
+		}
+		job = loader->next_job++;
+		elf_unlock_mutex(loader->mutex);
+
+		// only cpu work here, no elf or gfx objects are created outside of the main thread
+		index = loader->jobs[job];
+		decoded_texture = NULL;
+		decoded_model = NULL;
+
+		if(elf_seek_pak_index(loader->pak, index, &reader))
+		{
+			if(index->index_type == ELF_TEXTURE)
+			{
+				decoded_texture = (elf_decoded_texture*)malloc(sizeof(elf_decoded_texture));
+				elf_decode_texture_from_pak(&reader, decoded_texture);
+			}
+			else if(index->index_type == ELF_MODEL)
+			{
+				decoded_model = (elf_decoded_model*)malloc(sizeof(elf_decoded_model));
+				elf_decode_model_from_pak(&reader, decoded_model);
+			}
+			elf_close_pak_reader(&reader);
+		}
+
+		elf_lock_mutex(loader->mutex);
+		index->decoded_texture = decoded_texture;
+		index->decoded_model = decoded_model;
+		loader->jobs_done++;
+		elf_unlock_mutex(loader->mutex);
+	}
+}
+
+elf_scene_loader* elf_create_scene_loader(elf_pak *pak)
+{
+	elf_scene_loader *loader;
+	elf_pak_index *index;
+	int thread_count;
+	int i;
+
+	loader = (elf_scene_loader*)malloc(sizeof(elf_scene_loader));
+	memset(loader, 0x0, sizeof(elf_scene_loader));
+	loader->type = ELF_SCENE_LOADER;
+
+	loader->pak = pak;
+	elf_inc_ref((elf_object*)loader->pak);
+
+	loader->scene = elf_create_empty_scene_from_pak(pak);
+	elf_inc_ref((elf_object*)loader->scene);
+
+	loader->frame_budget = 0.008;
+
+	loader->index_count = elf_get_list_length(pak->indexes);
+	if(loader->index_count > 0)
+	{
+		loader->indexes = (elf_pak_index**)malloc(sizeof(elf_pak_index*)*loader->index_count);
+		loader->jobs = (elf_pak_index**)malloc(sizeof(elf_pak_index*)*loader->index_count);
+	}
+
+	for(index = (elf_pak_index*)elf_begin_list(pak->indexes), i = 0; index;
+		index = (elf_pak_index*)elf_next_in_list(pak->indexes), i++)
+	{
+		loader->indexes[i] = index;
+		if(index->index_type == ELF_TEXTURE || index->index_type == ELF_MODEL)
+			loader->jobs[loader->job_count++] = index;
+	}
+
+	loader->mutex = elf_create_mutex();
+
+	// leave one core for the main thread, it keeps running the current scene meanwhile
+	thread_count = elf_get_processor_count()-1;
+	if(thread_count < 1) thread_count = 1;
+	if(thread_count > ELF_MAX_LOADER_THREADS) thread_count = ELF_MAX_LOADER_THREADS;
+	if(thread_count > loader->job_count) thread_count = loader->job_count;
+
+	for(i = 0; i < thread_count && loader->mutex; i++)
+	{
+		loader->threads[i] = elf_create_thread(elf_run_scene_loader_thread, loader);
+		if(!loader->threads[i]) break;
+		loader->thread_count++;
+	}
+
+	// without workers the resources are decoded on demand while building the scene
+	if(!loader->thread_count)
+	{
+		loader->next_job = loader->job_count;
+		loader->jobs_done = loader->job_count;
+	}
+
+	elf_inc_obj_count();
+
+	return loader;
+}
+
+void elf_stop_scene_loader(elf_scene_loader *loader)
+{
+	int i;
+
+	if(!loader->thread_count) return;
+
+	elf_lock_mutex(loader->mutex);
+	loader->cancel = ELF_TRUE;
+	elf_unlock_mutex(loader->mutex);
+
+	for(i = 0; i < loader->thread_count; i++)
+		elf_wait_thread(loader->threads[i]);
+
+	loader->thread_count = 0;
+}
+
+void elf_destroy_scene_loader(elf_scene_loader *loader)
+{
+	elf_stop_scene_loader(loader);
+
+	if(loader->mutex) elf_destroy_mutex(loader->mutex);
+
+	if(loader->indexes) free(loader->indexes);
+	if(loader->jobs) free(loader->jobs);
+
+	elf_dec_ref((elf_object*)loader->scene);
+	elf_dec_ref((elf_object*)loader->pak);
+
+	free(loader);
+
+	elf_dec_obj_count();
+}
+
+unsigned char elf_update_scene_loader(elf_scene_loader *loader)
+{
+	double start;
+	int jobs_done;
+
+	if(loader->thread_count)
+	{
+		elf_lock_mutex(loader->mutex);
+		jobs_done = loader->jobs_done;
+		elf_unlock_mutex(loader->mutex);
+	}
+	else jobs_done = loader->jobs_done;
+
+	if(jobs_done < loader->job_count) return ELF_FALSE;
+
+	// the workers have run out of jobs, reap them
+	if(loader->thread_count) elf_stop_scene_loader(loader);
+
+	// build the actors and upload their resources, but don't stall the frame for too long
+	start = elf_get_time();
+
+	while(loader->cur_index < loader->index_count)
+	{
+		elf_load_pak_index_to_scene(loader->scene, loader->indexes[loader->cur_index], &loader->scene_read);
+		loader->cur_index++;
+
+		if(elf_get_time()-start > loader->frame_budget) break;
+	}
+
+	if(loader->cur_index < loader->index_count) return ELF_FALSE;
+
+	// resources no actor asked for
+	elf_free_pak_decoded_data(loader->pak);
+
+	return ELF_TRUE;
+}
+
+float elf_get_scene_loader_progress(elf_scene_loader *loader)
+{
+	int jobs_done;
+
+	if(loader->job_count+loader->index_count < 1) return 1.0;
+
+	if(loader->thread_count)
+	{
+		elf_lock_mutex(loader->mutex);
+		jobs_done = loader->jobs_done;
+		elf_unlock_mutex(loader->mutex);
+	}
+	else jobs_done = loader->jobs_done;
+
+	return (float)(jobs_done+loader->cur_index)/(float)(loader->job_count+loader->index_count);
+}
+
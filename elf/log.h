@@ -1,208 +1,444 @@
 
-void elf_start_log(const char *text)
+// log messages are formatted by the calling thread into a ring of fixed size slots and written
+// out in batches by a writer thread. any thread may add to the ring, a slot is claimed with a
+// compare and swap on write_pos and handed over by bumping its sequence, so producers never
+// wait on each other or on the disk. before the writer is started and after it has stopped the
+// caller writes the ring out itself.
+
+elf_logger* elf_create_logger()
 {
-	FILE *file;
+	elf_logger *logger;
+	int i;
+
+	logger = (elf_logger*)malloc(sizeof(elf_logger));
+	memset(logger, 0x0, sizeof(elf_logger));
 
-	file = fopen(gen->log, "w");
-	if(!file) return;
+	for(i = 0; i < ELF_LOG_SLOT_COUNT; i++) logger->slots[i].sequence = i;
 
-	fwrite(text, sizeof(char), strlen(text), file);
-	fclose(file);
+	logger->level = ELF_LOG_INFO;
+	logger->fd = -1;
+
+	return logger;
 }
 
-void elf_write_to_log(const char *fmt, ...)
+void elf_destroy_logger(elf_logger *logger)
 {
-	va_list list;
-	const char *p, *s;
-	int d;
-	double f;
-	FILE *file;
+	elf_stop_log_writer(logger);
 
-	va_start(list, fmt);
+	elf_lock_log(logger);
+	elf_write_log_slots(logger);
+	if(logger->file) fclose(logger->file);
+	logger->file = NULL;
+	logger->fd = -1;
+	elf_unlock_log(logger);
 
-	file = fopen(gen->log, "a");
-	if(!file) fopen(gen->log, "w");
+	free(logger);
+}
 
-	for(p = fmt; *p; ++p)
+void elf_lock_log(elf_logger *logger)
+{
+	while(!elf_atomic_cas(&logger->draining, 0, 1));
+}
+
+void elf_unlock_log(elf_logger *logger)
+{
+	elf_memory_barrier();
+	logger->draining = 0;
+}
+
+int elf_write_log_slots(elf_logger *logger)
+{
+	elf_log_slot *slot;
+	unsigned int pos;
+	unsigned int dropped;
+	int written;
+
+	// only called with the log locked, this is the single consumer of the ring
+	pos = logger->read_pos;
+	written = 0;
+
+	while(1)
 	{
-		if(*p != '%')
+		slot = &logger->slots[pos&(ELF_LOG_SLOT_COUNT-1)];
+		if(slot->sequence != pos+1) break;
+		elf_memory_barrier();
+
+		if(!logger->file && gen)
 		{
-			putc(*p, stdout);
-			if(file) putc(*p, file);
+			logger->file = fopen(gen->log, "a");
+			if(logger->file) logger->fd = fileno(logger->file);
 		}
-		else
+
+		fwrite(slot->text, sizeof(char), slot->length, stdout);
+		if(logger->file) fwrite(slot->text, sizeof(char), slot->length, logger->file);
+		written++;
+
+		elf_memory_barrier();
+		slot->sequence = pos+ELF_LOG_SLOT_COUNT;
+		pos++;
+	}
+
+	logger->read_pos = pos;
+
+	do
+	{
+		dropped = logger->dropped;
+	} while(dropped && !elf_atomic_cas(&logger->dropped, dropped, 0));
+
+	if(dropped)
+	{
+		printf("warning: %d log messages dropped\n", dropped);
+		if(logger->file) fprintf(logger->file, "warning: %d log messages dropped\n", dropped);
+	}
+
+	if(written || dropped)
+	{
+		fflush(stdout);
+		if(logger->file) fflush(logger->file);
+	}
+
+	return written;
+}
+
+unsigned char elf_push_log_slot(elf_logger *logger, const char *text, int length)
+{
+	elf_log_slot *slot;
+	unsigned int pos;
+	unsigned int dropped;
+	int diff;
+
+	pos = logger->write_pos;
+
+	while(1)
+	{
+		slot = &logger->slots[pos&(ELF_LOG_SLOT_COUNT-1)];
+		diff = (int)(slot->sequence-pos);
+
+		if(diff == 0)
 		{
-			switch(*++p)
+			if(elf_atomic_cas(&logger->write_pos, pos, pos+1)) break;
+		}
+		else if(diff < 0)
+		{
+			// the writer is behind by a whole ring, drop the message rather than wait
+			do
 			{
-				case 's':
-					s = va_arg(list, char*);
-					if(s == NULL) continue;
-					printf("%s", s);
-					if(file) fprintf(file, "%s", s);
-					continue;
-				case 'd':
-					d = va_arg(list, int);
-					printf("%d", d);
-					if(file) fprintf(file, "%d", d);
-					continue;
-				case 'f':
-					f = va_arg(list, double);
-					printf("%f", f);
-					if(file) fprintf(file, "%f", f);
-					continue;
-			}
+				dropped = logger->dropped;
+			} while(!elf_atomic_cas(&logger->dropped, dropped, dropped+1));
+			return ELF_FALSE;
 		}
+
+		pos = logger->write_pos;
 	}
 
-	if(file) fclose(file);
+	memcpy(slot->text, text, sizeof(char)*length);
+	slot->length = length;
+
+	elf_memory_barrier();
+	slot->sequence = pos+1;
+
+	return ELF_TRUE;
 }
 
-void elf_set_error(int code, const char *fmt, ...)
+void elf_push_log_text(elf_logger *logger, const char *text)
 {
-	va_list list;
-	const char *p, *s;
-	int d;
-	double f;
-	char* err_str;
-	char* tmp_str;
-	char num[32];
-	FILE *file;
+	int length;
+	int offset;
+	int size;
 
-	va_start(list, fmt);
+	length = strlen(text);
 
-	file = fopen(gen->log, "a");
-	if(!file) fopen(gen->log, "w");
+	// longer messages take several slots, they can interleave with other threads
+	for(offset = 0; offset < length; offset += size)
+	{
+		size = length-offset;
+		if(size > ELF_LOG_SLOT_SIZE) size = ELF_LOG_SLOT_SIZE;
+
+		if(!elf_push_log_slot(logger, &text[offset], size) && !logger->writer_running)
+		{
+			elf_lock_log(logger);
+			elf_write_log_slots(logger);
+			elf_unlock_log(logger);
+			elf_push_log_slot(logger, &text[offset], size);
+		}
+	}
 
-	err_str = elf_create_string("");
+	if(!logger->writer_running)
+	{
+		elf_lock_log(logger);
+		elf_write_log_slots(logger);
+		elf_unlock_log(logger);
+	}
+}
+
+char* elf_format_log_string(const char *fmt, va_list list)
+{
+	char *str;
+	char num[512];
+	const char *p, *s;
+	int length;
+	int capacity;
+	int slength;
+
+	capacity = 256;
+	length = 0;
+	str = (char*)malloc(sizeof(char)*capacity);
 
 	for(p = fmt; *p; ++p)
 	{
+		s = NULL;
+
 		if(*p != '%')
 		{
-			putc(*p, stdout);
-			if(file) putc(*p, file);
-			tmp_str = elf_append_char_to_string(err_str, *p);
-			elf_destroy_string(err_str);
-			err_str = tmp_str;
+			num[0] = *p;
+			num[1] = '\0';
+			s = num;
 		}
 		else
 		{
+			if(!*(p+1)) break;
+
 			switch(*++p)
 			{
 				case 's':
 					s = va_arg(list, char*);
-					if(s == NULL) continue;
-					printf("%s", s);
-					if(file) fprintf(file, "%s", s);
-
-					tmp_str = elf_merge_strings(err_str, s);
-					elf_destroy_string(err_str);
-					err_str = tmp_str;
-					continue;
+					break;
 				case 'd':
-					d = va_arg(list, int);
-					printf("%d", d);
-					if(file) fprintf(file, "%d", d);
-
-					memset(num, 0x0, sizeof(char)*32);
-					sprintf(num, "%d", d);
-
-					tmp_str = elf_merge_strings(err_str, num);
-					elf_destroy_string(err_str);
-					err_str = tmp_str;
-					continue;
+					sprintf(num, "%d", va_arg(list, int));
+					s = num;
+					break;
 				case 'f':
-					f = va_arg(list, double);
-					printf("%f", f);
-					if(file) fprintf(file, "%f", f);
+					sprintf(num, "%f", va_arg(list, double));
+					s = num;
+					break;
+				case '%':
+					s = "%";
+					break;
+			}
+		}
 
-					memset(num, 0x0, sizeof(char)*32);
-					sprintf(num, "%f", f);
+		if(!s) continue;
 
-					tmp_str = elf_merge_strings(err_str, num);
-					elf_destroy_string(err_str);
-					err_str = tmp_str;
-					continue;
-			}
+		slength = strlen(s);
+		if(length+slength+1 > capacity)
+		{
+			while(length+slength+1 > capacity) capacity *= 2;
+			str = (char*)realloc(str, sizeof(char)*capacity);
 		}
+
+		memcpy(&str[length], s, sizeof(char)*slength);
+		length += slength;
 	}
 
-	gen->err_code = code;
+	str[length] = '\0';
 
-	if(gen->err_str) elf_destroy_string(gen->err_str);
-	gen->err_str = elf_create_string(err_str);
-	elf_destroy_string(err_str);
+	return str;
+}
+
+void elf_run_log_writer(void *arg)
+{
+	elf_logger *logger;
+	int written;
+
+	logger = (elf_logger*)arg;
 
-	if(file) fclose(file);
+	while(!logger->quit)
+	{
+		elf_lock_log(logger);
+		written = elf_write_log_slots(logger);
+		elf_unlock_log(logger);
+
+		// keep going while there is a backlog, otherwise check again in a bit
+		if(!written) elf_sleep(0.005);
+	}
+
+	elf_lock_log(logger);
+	elf_write_log_slots(logger);
+	elf_unlock_log(logger);
 }
 
-void elf_set_error_no_save(int code, const char *fmt, ...)
+void elf_start_log_writer(elf_logger *logger)
 {
-	va_list list;
-	const char *p, *s;
-	int d;
-	double f;
-	char* err_str;
-	char* tmp_str;
-	char num[32];
+	if(logger->writer_running) return;
 
-	va_start(list, fmt);
+	logger->quit = ELF_FALSE;
+	logger->writer = elf_create_thread(elf_run_log_writer, logger);
+	if(logger->writer) logger->writer_running = ELF_TRUE;
+}
 
-	err_str = elf_create_string("");
+void elf_stop_log_writer(elf_logger *logger)
+{
+	if(!logger->writer_running) return;
 
-	for(p = fmt; *p; ++p)
+	logger->quit = ELF_TRUE;
+	elf_wait_thread(logger->writer);
+	logger->writer = NULL;
+	logger->writer_running = ELF_FALSE;
+
+	// anything added while the writer was on its way out
+	elf_lock_log(logger);
+	elf_write_log_slots(logger);
+	elf_unlock_log(logger);
+}
+
+void elf_flush_log()
+{
+	elf_logger *logger;
+	int i;
+
+	if(!gen || !gen->logger) return;
+
+	logger = gen->logger;
+
+	if(logger->writer_running)
 	{
-		if(*p != '%')
-		{
-			putc(*p, stdout);
+		// give the writer a moment to catch up, a producer could be stuck halfway
+		for(i = 0; i < 100 && logger->read_pos != logger->write_pos; i++) elf_sleep(0.001);
+	}
+	else
+	{
+		elf_lock_log(logger);
+		elf_write_log_slots(logger);
+		elf_unlock_log(logger);
+	}
+}
 
-			tmp_str = elf_append_char_to_string(err_str, *p);
-			elf_destroy_string(err_str);
-			err_str = tmp_str;
-		}
-		else
-		{
-			switch(*++p)
-			{
-				case 's':
-					s = va_arg(list, char*);
-					if(s == NULL) continue;
-					printf("%s", s);
+void elf_write_log_slots_on_signal(elf_logger *logger)
+{
+	elf_log_slot *slot;
+	unsigned int pos;
+	int out;
+	int fd;
 
-					tmp_str = elf_merge_strings(err_str, s);
-					elf_destroy_string(err_str);
-					err_str = tmp_str;
-					continue;
-				case 'd':
-					d = va_arg(list, int);
-					printf("%d", d);
+	// stdio isn't safe in a signal handler, the slots go straight to the descriptors. everything
+	// written before went through fflush already, so the order in the file stays the same
+	out = 1;
+	fd = logger->fd;
 
-					memset(num, 0x0, sizeof(char)*32);
-					sprintf(num, "%d", d);
+	for(pos = logger->read_pos; out >= 0 || fd >= 0; pos++)
+	{
+		slot = &logger->slots[pos&(ELF_LOG_SLOT_COUNT-1)];
+		if(slot->sequence != pos+1) break;
 
-					tmp_str = elf_merge_strings(err_str, num);
-					elf_destroy_string(err_str);
-					err_str = tmp_str;
-					continue;
-				case 'f':
-					f = va_arg(list, double);
-					printf("%f", f);
+		if(out >= 0 && write(out, slot->text, slot->length) < 0) out = -1;
+		if(fd >= 0 && write(fd, slot->text, slot->length) < 0) fd = -1;
+	}
+}
 
-					memset(num, 0x0, sizeof(char)*32);
-					sprintf(num, "%f", f);
+void elf_flush_log_on_signal(int sig)
+{
+	// best effort, if the writer crashed in the middle of writing the ring is left alone
+	if(gen && gen->logger && elf_atomic_cas(&gen->logger->draining, 0, 1))
+		elf_write_log_slots_on_signal(gen->logger);
 
-					tmp_str = elf_merge_strings(err_str, num);
-					elf_destroy_string(err_str);
-					err_str = tmp_str;
-					continue;
-			}
-		}
+	signal(sig, SIG_DFL);
+	raise(sig);
+}
+
+void elf_set_log_level(int level)
+{
+	if(!gen || !gen->logger) return;
+	gen->logger->level = level;
+}
+
+int elf_get_log_level()
+{
+	if(!gen || !gen->logger) return 0;
+	return gen->logger->level;
+}
+
+void elf_start_log(const char *text)
+{
+	elf_logger *logger;
+
+	logger = gen->logger;
+
+	// pending messages go to the old file, the new one stays open for the writer
+	elf_lock_log(logger);
+	elf_write_log_slots(logger);
+	if(logger->file) fclose(logger->file);
+	logger->fd = -1;
+
+	logger->file = fopen(gen->log, "w");
+	if(logger->file)
+	{
+		logger->fd = fileno(logger->file);
+		fwrite(text, sizeof(char), strlen(text), logger->file);
+		fflush(logger->file);
 	}
 
+	elf_unlock_log(logger);
+}
+
+void elf_log(int level, const char *fmt, ...)
+{
+	va_list list;
+	char *str;
+
+	// filtered messages are never formatted
+	if(!gen || !gen->logger || level < gen->logger->level) return;
+
+	va_start(list, fmt);
+	str = elf_format_log_string(fmt, list);
+	va_end(list);
+
+	elf_push_log_text(gen->logger, str);
+
+	free(str);
+}
+
+void elf_write_to_log(const char *fmt, ...)
+{
+	va_list list;
+	char *str;
+
+	if(!gen || !gen->logger || ELF_LOG_INFO < gen->logger->level) return;
+
+	va_start(list, fmt);
+	str = elf_format_log_string(fmt, list);
+	va_end(list);
+
+	elf_push_log_text(gen->logger, str);
+
+	free(str);
+}
+
+void elf_set_error(int code, const char *fmt, ...)
+{
+	va_list list;
+	char *str;
+
+	va_start(list, fmt);
+	str = elf_format_log_string(fmt, list);
+	va_end(list);
+
+	if(gen->logger && ELF_LOG_ERROR >= gen->logger->level) elf_push_log_text(gen->logger, str);
+
+	gen->err_code = code;
+
+	if(gen->err_str) elf_destroy_string(gen->err_str);
+	gen->err_str = elf_create_string(str);
+
+	free(str);
+}
+
+void elf_set_error_no_save(int code, const char *fmt, ...)
+{
+	va_list list;
+	char *str;
+
+	va_start(list, fmt);
+	str = elf_format_log_string(fmt, list);
+	va_end(list);
+
+	// only to the console, not to the log file
+	printf("%s", str);
+
 	gen->err_code = code;
 
 	if(gen->err_str) elf_destroy_string(gen->err_str);
-	gen->err_str = elf_create_string(err_str);
-	elf_destroy_string(err_str);
+	gen->err_str = elf_create_string(str);
+
+	free(str);
 }
 
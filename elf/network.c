@@ -28,7 +28,7 @@ ENetAddress clientAddress;
 ENetPeer* peer;
 ENetEvent clientEvent;
 
-GLFWthread clientThread;
+elf_thread *clientThread = NULL;
 
 /* initialises networking */
 unsigned char elf_init_networking()
@@ -43,7 +43,7 @@ unsigned char elf_init_networking()
 }
 
 /* the server thread */
-void GLFWCALL elf_run_networking(void* arg)
+void elf_run_networking(void* arg)
 {
 	// we can't run this unless the server is initialised
 	if(server == NULL)
@@ -84,7 +84,7 @@ void GLFWCALL elf_run_networking(void* arg)
 }
 
 /* the client thread */
-void GLFWCALL elf_run_client_networking(void* arg)
+void elf_run_client_networking(void* arg)
 {
 	if(client == NULL)
 		return;
@@ -152,7 +152,7 @@ unsigned char elf_create_session(const char* address, unsigned short port)
 
 	// run the server thread
 	run_server = ELF_TRUE;
-	server->thread = glfwCreateThread(elf_run_networking, server);
+	server->thread = elf_create_thread(elf_run_networking, server);
 
 	// server has successfully been initialised
 	return ELF_TRUE;
@@ -196,7 +196,7 @@ unsigned char elf_connect_session(const char* address, unsigned short port)
 
 		run_client = ELF_TRUE;
 
-		clientThread = glfwCreateThread(elf_run_client_networking, client);
+		clientThread = elf_create_thread(elf_run_client_networking, client);
 
 		return ELF_TRUE;
 	}
@@ -217,8 +217,11 @@ unsigned char elf_disconnect_session()
 
 	run_client = ELF_FALSE;
 
-	if(glfwWaitThread(clientThread, GLFW_WAIT))
+	if(clientThread)
 	{
+		elf_wait_thread(clientThread);
+		clientThread = NULL;
+
 		enet_peer_disconnect(peer, 0);
 
 		if(NULL != client)
@@ -246,8 +249,10 @@ unsigned char elf_stop_session()
 
 	run_server = ELF_FALSE;
 
-	if(glfwWaitThread(server->thread, GLFW_WAIT))
+	if(server->thread)
 	{
+		elf_wait_thread(server->thread);
+
 		enet_host_destroy(server->host);
 
 		free(server);
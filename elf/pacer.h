@@ -0,0 +1,190 @@
+
+// paces the frames to the fps limit. the frames are released on a fixed cadence, the pacer
+// sleeps until just before the release and spins only the last bit, a sleep can wake late but
+// a spin can't. the fixed mode spins ELF_PACER_SPIN_TIME, the adaptive mode learns how late the
+// sleeps wake and drops the cadence when the measured work of a frame doesn't fit the limit.
+
+elf_frame_pacer* elf_create_frame_pacer()
+{
+	elf_frame_pacer *pacer;
+
+	pacer = (elf_frame_pacer*)malloc(sizeof(elf_frame_pacer));
+	memset(pacer, 0x0, sizeof(elf_frame_pacer));
+
+	pacer->mode = ELF_PACING_FIXED;
+	pacer->spin_time = ELF_PACER_SPIN_TIME;
+
+	elf_inc_obj_count();
+
+	return pacer;
+}
+
+void elf_destroy_frame_pacer(elf_frame_pacer *pacer)
+{
+	free(pacer);
+
+	elf_dec_obj_count();
+}
+
+void elf_sleep(double time)
+{
+#if defined(ELF_WINDOWS)
+	if(time >= 0.001) Sleep((DWORD)(time*1000.0));
+#elif defined(ELF_LINUX)
+	struct timespec req;
+
+	if(time <= 0.0) return;
+
+	req.tv_sec = (time_t)time;
+	req.tv_nsec = (long)((time-(double)req.tv_sec)*1000000000.0);
+
+	// a signal cuts the sleep short, the rest is left in req
+	while(clock_nanosleep(CLOCK_MONOTONIC, 0, &req, &req) == EINTR);
+#else
+	struct timespec req;
+
+	if(time <= 0.0) return;
+
+	req.tv_sec = (time_t)time;
+	req.tv_nsec = (long)((time-(double)req.tv_sec)*1000000000.0);
+
+	while(nanosleep(&req, &req) == -1 && errno == EINTR);
+#endif
+}
+
+void elf_add_frame_pacer_sample(elf_frame_pacer *pacer, double jitter)
+{
+	pacer->samples[pacer->cur_sample] = jitter;
+	pacer->cur_sample = (pacer->cur_sample+1)%ELF_PACER_SAMPLE_COUNT;
+	if(pacer->sample_count < ELF_PACER_SAMPLE_COUNT) pacer->sample_count++;
+}
+
+void elf_pace_frame(elf_frame_pacer *pacer, int fps_limit)
+{
+	double interval;
+	double now;
+	double wake;
+	double late;
+
+	now = elf_get_time();
+
+	// the work of the frame is everything since the last release
+	if(pacer->release > 0.0)
+	{
+		if(pacer->work_time > 0.0) pacer->work_time = pacer->work_time*0.9+(now-pacer->release)*0.1;
+		else pacer->work_time = now-pacer->release;
+	}
+
+	if(fps_limit < 1)
+	{
+		pacer->deadline = 0.0;
+		pacer->release = now;
+		return;
+	}
+
+	interval = 1.0/(double)fps_limit;
+
+	if(pacer->deadline > 0.0 && now < pacer->deadline)
+	{
+		wake = pacer->deadline-pacer->spin_time;
+
+		if(wake > now)
+		{
+			elf_sleep(wake-now);
+
+			if(pacer->mode == ELF_PACING_ADAPTIVE)
+			{
+				// keep the spin a bit longer than the sleeps tend to wake late, rising faster than
+				// falling but without jumping on a single slow wake up
+				late = (elf_get_time()-wake)*1.5;
+				if(late < 0.0) late = 0.0;
+
+				if(late > pacer->spin_time) pacer->spin_time = pacer->spin_time*0.8+late*0.2;
+				else pacer->spin_time = pacer->spin_time*0.99+late*0.01;
+
+				if(pacer->spin_time < ELF_PACER_MIN_SPIN_TIME) pacer->spin_time = ELF_PACER_MIN_SPIN_TIME;
+				if(pacer->spin_time > ELF_PACER_MAX_SPIN_TIME) pacer->spin_time = ELF_PACER_MAX_SPIN_TIME;
+			}
+		}
+
+		while(elf_get_time() < pacer->deadline);
+
+		now = elf_get_time();
+	}
+	else if(pacer->deadline > 0.0)
+	{
+		pacer->late_frames++;
+	}
+
+	if(pacer->release > 0.0) elf_add_frame_pacer_sample(pacer, now-pacer->release-interval);
+
+	// stay on the cadence unless a whole frame behind, then start over instead of rushing to catch
+	// up. when the work doesn't fit the limit anymore the adaptive mode starts over every frame
+	if(pacer->deadline > 0.0 && now-pacer->deadline < interval &&
+		(pacer->mode != ELF_PACING_ADAPTIVE || pacer->work_time < interval)) pacer->deadline += interval;
+	else pacer->deadline = now+interval;
+
+	pacer->release = now;
+}
+
+void elf_set_frame_pacing_mode(int mode)
+{
+	if(!eng || !eng->pacer || (mode != ELF_PACING_FIXED && mode != ELF_PACING_ADAPTIVE)) return;
+
+	eng->pacer->mode = mode;
+	eng->pacer->spin_time = ELF_PACER_SPIN_TIME;
+}
+
+int elf_get_frame_pacing_mode()
+{
+	if(!eng || !eng->pacer) return ELF_PACING_FIXED;
+	return eng->pacer->mode;
+}
+
+float elf_get_frame_pacing_jitter()
+{
+	double jitter;
+	int i;
+
+	if(!eng || !eng->pacer || !eng->pacer->sample_count) return 0.0;
+
+	jitter = 0.0;
+	for(i = 0; i < eng->pacer->sample_count; i++) jitter += fabs(eng->pacer->samples[i]);
+
+	return (float)(jitter/eng->pacer->sample_count*1000.0);
+}
+
+float elf_get_frame_pacing_max_jitter()
+{
+	double jitter;
+	int i;
+
+	if(!eng || !eng->pacer) return 0.0;
+
+	jitter = 0.0;
+	for(i = 0; i < eng->pacer->sample_count; i++)
+	{
+		if(fabs(eng->pacer->samples[i]) > jitter) jitter = fabs(eng->pacer->samples[i]);
+	}
+
+	return (float)(jitter*1000.0);
+}
+
+float elf_get_frame_work_time()
+{
+	if(!eng || !eng->pacer) return 0.0;
+	return (float)(eng->pacer->work_time*1000.0);
+}
+
+float elf_get_frame_pacing_spin_time()
+{
+	if(!eng || !eng->pacer) return 0.0;
+	return (float)(eng->pacer->spin_time*1000.0);
+}
+
+int elf_get_late_frame_count()
+{
+	if(!eng || !eng->pacer) return 0;
+	return eng->pacer->late_frames;
+}
+
@@ -16,60 +16,252 @@ void elf_destroy_pak_index(elf_pak_index *index)
 {
 	if(index->name) elf_destroy_string(index->name);
 
+	if(index->decoded_texture)
+	{
+		elf_clear_decoded_texture(index->decoded_texture);
+		free(index->decoded_texture);
+	}
+	if(index->decoded_model)
+	{
+		elf_clear_decoded_model(index->decoded_model);
+		free(index->decoded_model);
+	}
+
 	free(index);
 
 	elf_dec_obj_count();
 }
 
+unsigned int elf_get_pak_index_hash(const char *name, unsigned char type)
+{
+	unsigned int hash;
+
+	// FNV-1a over the type and the name
+	hash = 2166136261u;
+	hash = (hash^type)*16777619u;
+
+	while(*name)
+	{
+		hash = (hash^(unsigned char)*name)*16777619u;
+		name++;
+	}
+
+	return hash;
+}
+
+unsigned char elf_map_pak_file(elf_pak *pak, const char *file_path)
+{
+#ifdef ELF_WINDOWS
+	HANDLE file;
+	HANDLE mapping;
+	DWORD size;
+
+	file = CreateFileA(file_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(file == INVALID_HANDLE_VALUE) return ELF_FALSE;
+
+	size = GetFileSize(file, NULL);
+	if(size == INVALID_FILE_SIZE || size < 1)
+	{
+		CloseHandle(file);
+		return ELF_FALSE;
+	}
+
+	mapping = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if(!mapping)
+	{
+		CloseHandle(file);
+		return ELF_FALSE;
+	}
+
+	pak->data = (unsigned char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+	// the view keeps the file mapped after the handles are closed
+	CloseHandle(mapping);
+	CloseHandle(file);
+
+	if(!pak->data) return ELF_FALSE;
+
+	pak->data_size = size;
+	pak->mapped = ELF_TRUE;
+
+	return ELF_TRUE;
+#else
+	int fd;
+	struct stat st;
+	void *data;
+
+	fd = open(file_path, O_RDONLY);
+	if(fd < 0) return ELF_FALSE;
+
+	if(fstat(fd, &st) != 0 || st.st_size < 1)
+	{
+		close(fd);
+		return ELF_FALSE;
+	}
+
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// the mapping stays valid after the descriptor is closed
+	close(fd);
+
+	if(data == MAP_FAILED) return ELF_FALSE;
+
+	pak->data = (unsigned char*)data;
+	pak->data_size = st.st_size;
+	pak->mapped = ELF_TRUE;
+
+	return ELF_TRUE;
+#endif
+}
+
+unsigned char elf_read_pak_file(elf_pak *pak, const char *file_path)
+{
+	FILE *file;
+	int size;
+
+	file = fopen(file_path, "rb");
+	if(!file) return ELF_FALSE;
+
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	if(size < 1)
+	{
+		fclose(file);
+		return ELF_FALSE;
+	}
+
+	pak->data = (unsigned char*)malloc(size);
+	pak->data_size = fread(pak->data, 1, size, file);
+	pak->mapped = ELF_FALSE;
+
+	fclose(file);
+
+	return ELF_TRUE;
+}
+
+void elf_unmap_pak_file(elf_pak *pak)
+{
+	if(!pak->data) return;
+
+	if(pak->mapped)
+	{
+#ifdef ELF_WINDOWS
+		UnmapViewOfFile(pak->data);
+#else
+		munmap(pak->data, pak->data_size);
+#endif
+	}
+	else
+	{
+		free(pak->data);
+	}
+
+	pak->data = NULL;
+	pak->data_size = 0;
+}
+
+void elf_add_pak_index_to_table(elf_pak *pak, elf_pak_index *index)
+{
+	int i;
+	elf_pak_index *cur;
+
+	i = index->hash&(pak->index_table_size-1);
+
+	while((cur = pak->index_table[i]))
+	{
+		// keep the first index with the same type and name, like the old linear search did
+		if(cur->hash == index->hash && cur->index_type == index->index_type &&
+			!strcmp(cur->name, index->name)) return;
+		i = (i+1)&(pak->index_table_size-1);
+	}
+
+	pak->index_table[i] = index;
+}
+
 elf_pak* elf_create_pak_from_file(const char *file_path)
 {
 	elf_pak *pak;
 	elf_pak_index *index;
-	FILE *file;
+	elf_pak_reader reader;
 	int magic;
 	int index_count;
+	int index_size;
 	int i;
 
 	unsigned char type;
 	char name[64];
 	int offset;
+	unsigned char compression;
+	unsigned int raw_size;
+	unsigned int stored_size;
 
-	file = fopen(file_path, "rb");
-	if(!file)
+	pak = (elf_pak*)malloc(sizeof(elf_pak));
+	memset(pak, 0x0, sizeof(elf_pak));
+	pak->type = ELF_PAK;
+
+	elf_inc_obj_count();
+
+	if(!elf_map_pak_file(pak, file_path) && !elf_read_pak_file(pak, file_path))
 	{
 		elf_set_error(ELF_CANT_OPEN_FILE, "error: can't open \"%s\"\n", file_path);
+		elf_destroy_pak(pak);
 		return NULL;
 	}
 
+	reader.data = pak->data;
+	reader.size = pak->data_size;
+	reader.pos = 0;
+	reader.buffer = NULL;
+
 	magic = 0;
-	fread((char*)&magic, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&magic, sizeof(int), 1, &reader);
 
-	if(magic != 179532100)
+	// the sections carry their own magic numbers, so all three versions are read the same way,
+	// the sections of a v3 pak may be compressed
+	if(magic == ELF_PAK_MAGIC) pak->version = 1;
+	else if(magic == ELF_PAK_MAGIC_V2) pak->version = 2;
+	else if(magic == ELF_PAK_MAGIC_V3) pak->version = 3;
+	else
 	{
 		elf_set_error(ELF_CANT_OPEN_FILE, "error: \"%s\" is not a elf pak file\n", file_path);
-		fclose(file);
+		elf_destroy_pak(pak);
 		return NULL;
 	}
 
-	pak = (elf_pak*)malloc(sizeof(elf_pak));
-	memset(pak, 0x0, sizeof(elf_pak));
-	pak->type = ELF_PAK;
-
-	elf_inc_obj_count();
-
 	pak->file_path = elf_create_string(file_path);
 
 	pak->indexes = elf_create_list();
 	elf_inc_ref((elf_object*)pak->indexes);
 
 	index_count = 0;
-	fread((char*)&index_count, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&index_count, sizeof(int), 1, &reader);
+
+	// an index takes 69 bytes, v3 adds the compression and the section sizes.
+	// don't trust a count the file can't hold
+	index_size = pak->version < 3 ? 69 : 78;
+	if(index_count < 0 || index_count > (int)((reader.size-reader.pos)/index_size))
+	{
+		elf_set_error(ELF_INVALID_FILE, "error: \"%s\" has an invalid index count\n", file_path);
+		elf_destroy_pak(pak);
+		return NULL;
+	}
+
+	pak->index_table_size = 16;
+	while(pak->index_table_size < index_count*2) pak->index_table_size *= 2;
+
+	pak->index_table = (elf_pak_index**)malloc(sizeof(elf_pak_index*)*pak->index_table_size);
+	memset(pak->index_table, 0x0, sizeof(elf_pak_index*)*pak->index_table_size);
 
 	for(i = 0; i < index_count; i++)
 	{
 		type = 0;
 		offset = 0;
-		fread((char*)&type, sizeof(unsigned char), 1, file);
+		compression = ELF_PAK_COMPRESSION_NONE;
+		raw_size = 0;
+		stored_size = 0;
+		elf_read_from_pak((char*)&type, sizeof(unsigned char), 1, &reader);
 
 		switch(type)
 		{
@@ -84,19 +276,29 @@ elf_pak* elf_create_pak_from_file(const char *file_path)
 			case ELF_SCRIPT: pak->script_count++; break;
 		}
 
-		fread(name, sizeof(char), 64, file);
-		fread((char*)&offset, sizeof(int), 1, file);
+		elf_read_from_pak(name, sizeof(char), 64, &reader);
+		name[63] = '\0';
+		elf_read_from_pak((char*)&offset, sizeof(int), 1, &reader);
+		if(pak->version > 2)
+		{
+			elf_read_from_pak((char*)&compression, sizeof(unsigned char), 1, &reader);
+			elf_read_from_pak((char*)&raw_size, sizeof(unsigned int), 1, &reader);
+			elf_read_from_pak((char*)&stored_size, sizeof(unsigned int), 1, &reader);
+		}
 
 		index = elf_create_pak_index();
 		index->index_type = type;
 		index->name = elf_create_string(name);
 		index->offset = offset;
+		index->compression = compression;
+		index->raw_size = raw_size;
+		index->stored_size = stored_size;
+		index->hash = elf_get_pak_index_hash(index->name, type);
 
 		elf_append_to_list(pak->indexes, (elf_object*)index);
+		elf_add_pak_index_to_table(pak, index);
 	}
 
-	fclose(file);
-
 	return pak;
 }
 
@@ -104,7 +306,10 @@ void elf_destroy_pak(elf_pak *pak)
 {
 	if(pak->file_path) elf_destroy_string(pak->file_path);
 
-	elf_dec_ref((elf_object*)pak->indexes);
+	if(pak->index_table) free(pak->index_table);
+	if(pak->indexes) elf_dec_ref((elf_object*)pak->indexes);
+
+	elf_unmap_pak_file(pak);
 
 	free(pak);
 
@@ -124,11 +329,18 @@ int elf_get_pak_index_count(elf_pak *pak)
 elf_pak_index* elf_get_pak_index_by_name(elf_pak *pak, const char *name, unsigned char type)
 {
 	elf_pak_index *index;
+	unsigned int hash;
+	int i;
 
-	for(index = (elf_pak_index*)elf_begin_list(pak->indexes); index;
-		index = (elf_pak_index*)elf_next_in_list(pak->indexes))
+	if(!pak->index_table) return NULL;
+
+	hash = elf_get_pak_index_hash(name, type);
+	i = hash&(pak->index_table_size-1);
+
+	while((index = pak->index_table[i]))
 	{
-		if(!strcmp(index->name, name) && index->index_type == type) return index;
+		if(index->hash == hash && index->index_type == type && !strcmp(index->name, name)) return index;
+		i = (i+1)&(pak->index_table_size-1);
 	}
 
 	return NULL;
@@ -155,277 +367,132 @@ int elf_get_pak_index_offset(elf_pak_index *index)
 	return index->offset;
 }
 
-int elf_get_actor_header_size_bytes(elf_actor *actor)
+unsigned char elf_decompress_pak_section(elf_pak *pak, elf_pak_index *index, elf_pak_reader *reader)
 {
-	int size_bytes;
-	elf_bezier_curve *curve;
-
-	size_bytes = 0;
-
-	size_bytes += sizeof(char)*64;	// name
-	size_bytes += sizeof(char)*64;	// parent
-	size_bytes += sizeof(char)*64;	// script
-	size_bytes += sizeof(float)*3;	// position
-	size_bytes += sizeof(float)*3;	// rotation
-	size_bytes += sizeof(unsigned char);	// curve count
-
-	for(curve = (elf_bezier_curve*)elf_begin_list(actor->ipo->curves); curve;
-		curve = (elf_bezier_curve*)elf_next_in_list(actor->ipo->curves))
-	{
-		size_bytes += sizeof(unsigned char);	// type
-		size_bytes += sizeof(unsigned char);	// interpolation
-		size_bytes += sizeof(int);	// point count
-		size_bytes += sizeof(float)*6*elf_get_list_length(curve->points);	// points
-	}
+	unsigned int pos;
+	unsigned int raw_size;
+	unsigned int stored_size;
+	const unsigned char *chunk;
 
-	size_bytes += sizeof(float)*3;	// bounding lengths
-	size_bytes += sizeof(float)*3;	// bounding offset
-	size_bytes += sizeof(unsigned char);	// shape
-	size_bytes += sizeof(float);	// mass
-	size_bytes += sizeof(float);	// linear damp
-	size_bytes += sizeof(float);	// angular damp
-	size_bytes += sizeof(float);	// linear sleep threshold
-	size_bytes += sizeof(float);	// angular sleep threshold
-	size_bytes += sizeof(float);	// restitution
-	size_bytes += sizeof(float)*3;	// anisotropic friction
-	size_bytes += sizeof(float)*3;	// linear factor
-	size_bytes += sizeof(float)*3;	// angular factor
+	// a chunk takes at least its 8 byte header, so a sane section can't inflate beyond that
+	if(index->compression != ELF_PAK_COMPRESSION_LZ || index->raw_size < 1 ||
+		index->stored_size > pak->data_size-index->offset ||
+		index->raw_size/ELF_PAK_CHUNK_SIZE > index->stored_size/8) goto corrupted;
 
-	return size_bytes;
-}
+	reader->buffer = (unsigned char*)malloc(index->raw_size);
+	if(!reader->buffer) goto corrupted;
 
-int elf_get_armature_size_bytes(elf_armature *armature)
-{
-	int size_bytes;
-	int i;
+	// the section is a run of independent chunks, decoded one after another straight from the mapping
+	reader->size = index->offset+index->stored_size;
 
-	size_bytes = 0;
-
-	size_bytes += sizeof(int);	// magic
-	size_bytes += sizeof(int);	// frame count
-	size_bytes += sizeof(int);	// bone count
-
-	for(i = 0; i < (int)armature->bone_count; i++)
+	for(pos = 0; pos < index->raw_size; pos += raw_size)
 	{
-		size_bytes += sizeof(char)*64;	// name
-		size_bytes += sizeof(char)*64;	// parent
-		size_bytes += sizeof(int);	// id
-		size_bytes += sizeof(float)*3;	// position
-		size_bytes += sizeof(float)*4;	// quaternion
-
-		size_bytes += sizeof(float)*3*armature->frame_count;	// positions
-		size_bytes += sizeof(float)*4*armature->frame_count;	// quaternions
+		raw_size = 0;
+		stored_size = 0;
+		elf_read_from_pak((char*)&raw_size, sizeof(unsigned int), 1, reader);
+		elf_read_from_pak((char*)&stored_size, sizeof(unsigned int), 1, reader);
+
+		if(raw_size < 1 || raw_size > ELF_PAK_CHUNK_SIZE || raw_size > index->raw_size-pos) goto corrupted;
+		if(stored_size > ELF_PAK_CHUNK_SIZE) goto corrupted;
+		if(!(chunk = (const unsigned char*)elf_map_from_pak(stored_size, reader))) goto corrupted;
+
+		// chunks that didn't get smaller are stored as they are
+		if(stored_size == raw_size) memcpy(&reader->buffer[pos], chunk, raw_size);
+		else if(elf_lz_decompress(chunk, stored_size, &reader->buffer[pos], raw_size) != (int)raw_size) goto corrupted;
 	}
 
-	return size_bytes;
-}
-
-int elf_get_camera_size_bytes(elf_camera *camera)
-{
-	int size_bytes;
+	reader->data = reader->buffer;
+	reader->size = index->raw_size;
+	reader->pos = 0;
 
-	size_bytes = 0;
-
-	size_bytes += sizeof(int);	// magic
-	size_bytes += elf_get_actor_header_size_bytes((elf_actor*)camera);	// actor header
-	size_bytes += sizeof(float);	// fov
-	size_bytes += sizeof(float);	// clip near
-	size_bytes += sizeof(float);	// clip far
+	return ELF_TRUE;
 
-	return size_bytes;
+corrupted:
+	printf("warning: compressed section \"%s\" of \"%s\" is corrupted\n", index->name, elf_get_pak_file_path(pak));
+	elf_close_pak_reader(reader);
+	return ELF_FALSE;
 }
 
-int elf_get_entity_size_bytes(elf_entity *entity)
+unsigned char elf_seek_pak_index(elf_pak *pak, elf_pak_index *index, elf_pak_reader *reader)
 {
-	int size_bytes;
-
-	size_bytes = 0;
-
-	size_bytes += sizeof(int);	// magic
-	size_bytes += elf_get_actor_header_size_bytes((elf_actor*)entity);	// actor header
-	size_bytes += sizeof(float)*3;	// scale
-	size_bytes += sizeof(char)*64;	// model
-	size_bytes += sizeof(char)*64;	// armature
-	size_bytes += sizeof(int);	// material count
-	size_bytes += sizeof(char)*64*elf_get_entity_material_count(entity);	// materials
-
-	return size_bytes;
-}
+	reader->buffer = NULL;
 
-int elf_get_light_size_bytes(elf_light *light)
-{
-	int size_bytes;
+	if(!pak->data || index->offset >= pak->data_size) return ELF_FALSE;
 
-	size_bytes = 0;
+	reader->data = pak->data;
+	reader->size = pak->data_size;
+	reader->pos = index->offset;
 
-	size_bytes += sizeof(int);	// magic
-	size_bytes += elf_get_actor_header_size_bytes((elf_actor*)light);	// actor header
-	size_bytes += sizeof(unsigned char);	// type
-	size_bytes += sizeof(float)*4;	// color
-	size_bytes += sizeof(float);	// distance
-	size_bytes += sizeof(float);	// fade speed
-	size_bytes += sizeof(float);	// inner cone
-	size_bytes += sizeof(float);	// outer cone
-	size_bytes += sizeof(unsigned int);	// junk???
-	size_bytes += sizeof(unsigned char);	// shadow caster
-	size_bytes += sizeof(unsigned char);	// shaft
-	size_bytes += sizeof(float);	// shaft size
-	size_bytes += sizeof(float);	// shaft intensity
-	size_bytes += sizeof(float);	// shaft fade off
+	if(index->compression != ELF_PAK_COMPRESSION_NONE)
+		return elf_decompress_pak_section(pak, index, reader);
 
-	return size_bytes;
+	return ELF_TRUE;
 }
 
-int elf_get_material_size_bytes(elf_material *material)
+void elf_close_pak_reader(elf_pak_reader *reader)
 {
-	int size_bytes;
-
-	size_bytes = 0;
+	if(reader->buffer) free(reader->buffer);
 
-	size_bytes += sizeof(int);	// magic
-	size_bytes += sizeof(char)*64;	// name
-	size_bytes += sizeof(float)*4;	// diffuse color
-	size_bytes += sizeof(float)*4;	// ambient color
-	size_bytes += sizeof(float)*4;	// specular color
-	size_bytes += sizeof(float);	// specular power
-	size_bytes += sizeof(char)*64*5;	// textures
-	size_bytes += sizeof(float);	// parallax scale
-	size_bytes += sizeof(unsigned char);	// alpha test
-	size_bytes += sizeof(float);	// alpha threshold
-
-	return size_bytes;
+	reader->buffer = NULL;
+	reader->data = NULL;
+	reader->size = 0;
+	reader->pos = 0;
 }
 
-int elf_get_model_size_bytes(elf_model *model)
+int elf_read_from_pak(void *ptr, int size, int count, elf_pak_reader *reader)
 {
-	int size_bytes;
-
-	size_bytes = 0;
+	unsigned int left;
+	unsigned int bytes;
 
-	size_bytes += sizeof(int);	// magic
-	size_bytes += sizeof(char)*64;	// name
-	size_bytes += sizeof(int);	// vertice count
-	size_bytes += sizeof(int);	// frame count
-	size_bytes += sizeof(int);	// indice count
-	size_bytes += sizeof(int);	// area count
-	size_bytes += sizeof(unsigned char);	// normals
-	size_bytes += sizeof(unsigned char);	// tex coords
-	size_bytes += sizeof(unsigned char);	// weights & boneids
-	size_bytes += sizeof(unsigned char);	// junk
+	if(size < 1 || count < 1) return 0;
 
-	size_bytes += sizeof(float)*3*model->vertice_count;	// vertices
+	left = reader->size-reader->pos;
+	bytes = (unsigned int)size*(unsigned int)count;
 
-	size_bytes += sizeof(unsigned int)*model->area_count;	// area indice counts
-	size_bytes += sizeof(unsigned int)*model->indice_count;	// indices
-
-	size_bytes += sizeof(float)*3*model->vertice_count;	// normals
-	if(model->tex_coords) size_bytes += sizeof(float)*2*model->vertice_count;	// texcoords
-
-	if(model->weights && model->boneids)
+	// behave like fread on a truncated file, but never leave garbage behind
+	if(bytes > left)
 	{
-		size_bytes += sizeof(float)*4*model->vertice_count;	// weights
-		size_bytes += sizeof(short int)*4*model->vertice_count;	// boneids
+		count = left/size;
+		memcpy(ptr, &reader->data[reader->pos], count*size);
+		memset((char*)ptr+count*size, 0x0, bytes-count*size);
+		reader->pos += count*size;
+		return count;
 	}
 
-	return size_bytes;
-}
-
-int elf_get_scene_size_bytes(elf_scene *scene)
-{
-	int size_bytes;
-
-	size_bytes = 0;
-
-	size_bytes += sizeof(int);	// magic
-	size_bytes += sizeof(char)*64;	// name
-	size_bytes += sizeof(float)*4;	// ambience
-
-	return size_bytes;
-}
+	memcpy(ptr, &reader->data[reader->pos], bytes);
+	reader->pos += bytes;
 
-int elf_get_particles_size_bytes(elf_particles *particles)
-{
-	int size_bytes;
-
-	size_bytes = 0;
-
-	size_bytes += sizeof(int);	// magic
-	size_bytes += elf_get_actor_header_size_bytes((elf_actor*)particles);
-	size_bytes += sizeof(char)*64;	// texture
-	size_bytes += sizeof(char)*64;	// model
-	size_bytes += sizeof(char)*64;	// entity
-	size_bytes += sizeof(int);	// max count
-	size_bytes += sizeof(unsigned char);	// draw mode
-	size_bytes += sizeof(float);	// spawn delay
-	size_bytes += sizeof(unsigned char);	// spawn
-	size_bytes += sizeof(float)*3;	// gravity
-	size_bytes += sizeof(float);	// size min
-	size_bytes += sizeof(float);	// size max
-	size_bytes += sizeof(float);	// size growth mix
-	size_bytes += sizeof(float);	// size growth max
-	size_bytes += sizeof(float);	// rotation min
-	size_bytes += sizeof(float);	// rotation max
-	size_bytes += sizeof(float);	// rotation growth min
-	size_bytes += sizeof(float);	// rotation growth max
-	size_bytes += sizeof(float);	// life span min
-	size_bytes += sizeof(float);	// life span max
-	size_bytes += sizeof(float);	// fade speed min
-	size_bytes += sizeof(float);	// fade speed max
-	size_bytes += sizeof(float)*3;	// velocity min
-	size_bytes += sizeof(float)*3;	// velocity max
-	size_bytes += sizeof(float)*3;	// position min
-	size_bytes += sizeof(float)*3;	// position max
-	size_bytes += sizeof(float)*4;	// color min
-	size_bytes += sizeof(float)*4;	// color max
-
-	return size_bytes;
+	return count;
 }
 
-int elf_get_script_size_bytes(elf_script *script)
+const void* elf_map_from_pak(int size, elf_pak_reader *reader)
 {
-	int size_bytes;
+	const void *ptr;
 
-	size_bytes = 0;
+	if(size < 0 || (unsigned int)size > reader->size-reader->pos) return NULL;
 
-	size_bytes += sizeof(int);	// magic
-	size_bytes += sizeof(char)*64;	// name
-	size_bytes += sizeof(int);	// length
-	if(script->text) size_bytes += sizeof(char)*strlen(script->text);	// text
+	ptr = &reader->data[reader->pos];
+	reader->pos += size;
 
-	return size_bytes;
+	return ptr;
 }
 
-int elf_get_sprite_size_bytes(elf_sprite *sprite)
+const void* elf_map_block_from_pak(int size, elf_pak_reader *reader)
 {
-	int size_bytes;
+	const void *ptr;
+	int padding;
 
-	size_bytes = 0;
+	// v2 data blocks are padded to 16 bytes, so they stay aligned inside the mapping
+	ptr = elf_map_from_pak(size, reader);
+	if(!ptr) return NULL;
 
-	size_bytes += sizeof(int);	// magic
-	size_bytes += elf_get_actor_header_size_bytes((elf_actor*)sprite);
-	size_bytes += sizeof(float)*2;	// scale
-	size_bytes += sizeof(char)*64;	// material
-	size_bytes += sizeof(unsigned char);	// face camera
+	padding = ((size+15)&~15)-size;
+	if(padding > 0 && !elf_map_from_pak(padding, reader)) reader->pos = reader->size;
 
-	return size_bytes;
+	return ptr;
 }
 
-int elf_get_texture_size_bytes(elf_texture *texture)
-{
-	int size_bytes;
-
-	size_bytes = 0;
-
-	size_bytes += sizeof(int);	// magic
-	size_bytes += sizeof(char)*64;	// name
-	size_bytes += sizeof(unsigned char);	// type
-	size_bytes += sizeof(int);	// data length
-	size_bytes += texture->data_size;
-
-	return size_bytes;
-}
-
-void elf_read_actor_header(elf_actor *actor, FILE *file, elf_scene *scene)
+void elf_read_actor_header(elf_actor *actor, elf_pak_reader *reader, elf_scene *scene)
 {
 	char name[64];
 	char parent_name[64];
@@ -451,15 +518,15 @@ void elf_read_actor_header(elf_actor *actor, FILE *file, elf_scene *scene)
 	float linear_factor[3];
 	float angular_factor[3];
 
-	fread(name, sizeof(char), 64, file);
-	fread(parent_name, sizeof(char), 64, file);
-	fread(script_name, sizeof(char), 64, file);
+	elf_read_from_pak(name, sizeof(char), 64, reader);
+	elf_read_from_pak(parent_name, sizeof(char), 64, reader);
+	elf_read_from_pak(script_name, sizeof(char), 64, reader);
 
 	actor->name = elf_create_string(name);
 	if(scene) actor->file_path = elf_create_string(elf_get_scene_file_path(scene));
 
-	fread((char*)position, sizeof(float), 3, file);
-	fread((char*)rotation, sizeof(float), 3, file);
+	elf_read_from_pak((char*)position, sizeof(float), 3, reader);
+	elf_read_from_pak((char*)rotation, sizeof(float), 3, reader);
 
 	elf_set_actor_position(actor, position[0], position[1], position[2]);
 	elf_set_actor_rotation(actor, rotation[0], rotation[1], rotation[2]);
@@ -473,21 +540,21 @@ void elf_read_actor_header(elf_actor *actor, FILE *file, elf_scene *scene)
 	}
 
 	curve_count = 0;
-	fread((char*)&curve_count, sizeof(unsigned char), 1, file);
+	elf_read_from_pak((char*)&curve_count, sizeof(unsigned char), 1, reader);
 	for(i = 0; i < curve_count; i++)
 	{
 		curve = elf_create_bezier_curve();
-		fread((char*)&curve->curve_type, sizeof(unsigned char), 1, file);
-		fread((char*)&curve->interpolation, sizeof(unsigned char), 1, file);
+		elf_read_from_pak((char*)&curve->curve_type, sizeof(unsigned char), 1, reader);
+		elf_read_from_pak((char*)&curve->interpolation, sizeof(unsigned char), 1, reader);
 
 		point_count = 0;
-		fread((char*)&point_count, sizeof(int), 1, file);
+		elf_read_from_pak((char*)&point_count, sizeof(int), 1, reader);
 		for(j = 0; j < point_count; j++)
 		{
 			point = elf_create_bezier_point();
-			fread((char*)&point->c1.x, sizeof(float), 2, file);
-			fread((char*)&point->p.x, sizeof(float), 2, file);
-			fread((char*)&point->c2.x, sizeof(float), 2, file);
+			elf_read_from_pak((char*)&point->c1.x, sizeof(float), 2, reader);
+			elf_read_from_pak((char*)&point->p.x, sizeof(float), 2, reader);
+			elf_read_from_pak((char*)&point->c2.x, sizeof(float), 2, reader);
 
 			elf_add_point_to_bezier_curve(curve, point);
 		}
@@ -495,22 +562,22 @@ void elf_read_actor_header(elf_actor *actor, FILE *file, elf_scene *scene)
 		elf_add_curve_to_ipo(actor->ipo, curve);
 	}
 
-	fread((char*)bounding_lengths, sizeof(float), 3, file);
-	fread((char*)bounding_offset, sizeof(float), 3, file);
+	elf_read_from_pak((char*)bounding_lengths, sizeof(float), 3, reader);
+	elf_read_from_pak((char*)bounding_offset, sizeof(float), 3, reader);
 
 	elf_set_actor_bounding_lengths(actor, bounding_lengths[0], bounding_lengths[1], bounding_lengths[2]);
 	elf_set_actor_bounding_offset(actor, bounding_offset[0], bounding_offset[1], bounding_offset[2]);
 
-	fread((char*)&shape, sizeof(unsigned char), 1, file);
-	fread((char*)&mass, sizeof(float), 1, file);
-	fread((char*)&lin_damp, sizeof(float), 1, file);
-	fread((char*)&ang_damp, sizeof(float), 1, file);
-	fread((char*)&lin_sleep, sizeof(float), 1, file);
-	fread((char*)&ang_sleep, sizeof(float), 1, file);
-	fread((char*)&restitution, sizeof(float), 1, file);
-	fread((char*)anis_fric, sizeof(float), 3, file);
-	fread((char*)linear_factor, sizeof(float), 3, file);
-	fread((char*)angular_factor, sizeof(float), 3, file);
+	elf_read_from_pak((char*)&shape, sizeof(unsigned char), 1, reader);
+	elf_read_from_pak((char*)&mass, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&lin_damp, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&ang_damp, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&lin_sleep, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&ang_sleep, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&restitution, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)anis_fric, sizeof(float), 3, reader);
+	elf_read_from_pak((char*)linear_factor, sizeof(float), 3, reader);
+	elf_read_from_pak((char*)angular_factor, sizeof(float), 3, reader);
 
 	if(shape == ELF_BOX || shape == ELF_SPHERE || shape == ELF_MESH || shape == ELF_CAPSULE)
 	{
@@ -524,7 +591,7 @@ void elf_read_actor_header(elf_actor *actor, FILE *file, elf_scene *scene)
 	}
 }
 
-elf_armature* elf_create_armature_from_pak(FILE *file, const char *name, elf_scene *scene)
+elf_armature* elf_create_armature_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene)
 {
 	elf_armature *armature;
 	char rname[64];
@@ -538,7 +605,7 @@ elf_armature* elf_create_armature_from_pak(FILE *file, const char *name, elf_sce
 	int i, j;
 	float bone_inv_qua[4];
 
-	fread((char*)&magic, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&magic, sizeof(int), 1, reader);
 
 	if(magic != ELF_ARMATURE_MAGIC)
 	{
@@ -548,9 +615,9 @@ elf_armature* elf_create_armature_from_pak(FILE *file, const char *name, elf_sce
 
 	armature = elf_create_armature(NULL);
 
-	fread(rname, sizeof(char), 64, file);
-	fread((char*)&armature->frame_count, sizeof(int), 1, file);
-	fread((char*)&armature->bone_count, sizeof(int), 1, file);
+	elf_read_from_pak(rname, sizeof(char), 64, reader);
+	elf_read_from_pak((char*)&armature->frame_count, sizeof(int), 1, reader);
+	elf_read_from_pak((char*)&armature->bone_count, sizeof(int), 1, reader);
 
 	armature->name = elf_create_string(rname);
 	armature->file_path = elf_create_string(elf_get_scene_file_path(scene));
@@ -568,11 +635,11 @@ elf_armature* elf_create_armature_from_pak(FILE *file, const char *name, elf_sce
 		{
 			bone = elf_create_bone(NULL);
 
-			fread(rname, sizeof(char), 64, file);
-			fread(parent, sizeof(char), 64, file);
-			fread((char*)&bone->id, sizeof(int), 1, file);
-			fread((char*)&bone->pos.x, sizeof(float), 3, file);
-			fread((char*)&bone->qua.x, sizeof(float), 4, file);
+			elf_read_from_pak(rname, sizeof(char), 64, reader);
+			elf_read_from_pak(parent, sizeof(char), 64, reader);
+			elf_read_from_pak((char*)&bone->id, sizeof(int), 1, reader);
+			elf_read_from_pak((char*)&bone->pos.x, sizeof(float), 3, reader);
+			elf_read_from_pak((char*)&bone->qua.x, sizeof(float), 4, reader);
 
 			gfx_qua_get_inverse(&bone->qua.x, bone_inv_qua);
 
@@ -583,8 +650,8 @@ elf_armature* elf_create_armature_from_pak(FILE *file, const char *name, elf_sce
 				bone->frames = (elf_bone_frame*)malloc(sizeof(elf_bone_frame)*armature->frame_count);
 				for(j = 0; j < armature->frame_count; j++)
 				{
-					fread((char*)&bone->frames[j].pos.x, sizeof(float), 3, file);
-					fread((char*)&bone->frames[j].qua.x, sizeof(float), 4, file);
+					elf_read_from_pak((char*)&bone->frames[j].pos.x, sizeof(float), 3, reader);
+					elf_read_from_pak((char*)&bone->frames[j].qua.x, sizeof(float), 4, reader);
 					gfx_mul_qua_qua(&bone->frames[j].qua.x, bone_inv_qua, &bone->frames[j].offset_qua.x);
 					bone->frames[j].offset_pos.x = bone->frames[j].pos.x-bone->pos.x;
 					bone->frames[j].offset_pos.y = bone->frames[j].pos.y-bone->pos.y;
@@ -635,7 +702,7 @@ elf_armature* elf_create_armature_from_pak(FILE *file, const char *name, elf_sce
 	return armature;
 }
 
-elf_camera* elf_create_camera_from_pak(FILE *file, const char *name, elf_scene *scene)
+elf_camera* elf_create_camera_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene)
 {
 	elf_camera *camera;
 	int magic;
@@ -643,7 +710,7 @@ elf_camera* elf_create_camera_from_pak(FILE *file, const char *name, elf_scene *
 	float clip_near = 0.0;
 	float clip_far = 0.0;
 
-	fread((char*)&magic, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&magic, sizeof(int), 1, reader);
 
 	if(magic != ELF_CAMERA_MAGIC)
 	{
@@ -652,18 +719,18 @@ elf_camera* elf_create_camera_from_pak(FILE *file, const char *name, elf_scene *
 	}
 
 	camera = elf_create_camera(NULL);
-	elf_read_actor_header((elf_actor*)camera, file, scene);
+	elf_read_actor_header((elf_actor*)camera, reader, scene);
 
-	fread((char*)&fov, sizeof(float), 1, file);
-	fread((char*)&clip_near, sizeof(float), 1, file);
-	fread((char*)&clip_far, sizeof(float), 1, file);
+	elf_read_from_pak((char*)&fov, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&clip_near, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&clip_far, sizeof(float), 1, reader);
 
 	elf_set_camera_perspective(camera, fov, -1.0, clip_near, clip_far);
 
 	return camera;
 }
 
-elf_entity* elf_create_entity_from_pak(FILE *file, const char *name, elf_scene *scene)
+elf_entity* elf_create_entity_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene)
 {
 	elf_entity *entity;
 	elf_model *rmodel;
@@ -679,7 +746,7 @@ elf_entity* elf_create_entity_from_pak(FILE *file, const char *name, elf_scene *
 	elf_vec3f bounding_lengths;
 	elf_vec3f bounding_offset;
 
-	fread((char*)&magic, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&magic, sizeof(int), 1, reader);
 
 	if(magic != ELF_ENTITY_MAGIC)
 	{
@@ -688,14 +755,14 @@ elf_entity* elf_create_entity_from_pak(FILE *file, const char *name, elf_scene *
 	}
 
 	entity = elf_create_entity(NULL);
-	elf_read_actor_header((elf_actor*)entity, file, scene);
+	elf_read_actor_header((elf_actor*)entity, reader, scene);
 
-	fread((char*)scale, sizeof(float), 3, file);
+	elf_read_from_pak((char*)scale, sizeof(float), 3, reader);
 
 	bounding_lengths = elf_get_actor_bounding_lengths((elf_actor*)entity);
 	bounding_offset = elf_get_actor_bounding_offset((elf_actor*)entity);
 
-	fread(model, sizeof(char), 64, file);
+	elf_read_from_pak(model, sizeof(char), 64, reader);
 	if(strlen(model))
 	{
 		rmodel = elf_get_or_load_model_by_name(scene, model);
@@ -707,7 +774,7 @@ elf_entity* elf_create_entity_from_pak(FILE *file, const char *name, elf_scene *
 	if(!elf_about_zero(bounding_offset.x) || !elf_about_zero(bounding_offset.y) || !elf_about_zero(bounding_offset.z))
 		elf_set_actor_bounding_offset((elf_actor*)entity, bounding_offset.x, bounding_offset.y, bounding_offset.y);
 
-	fread(armature, sizeof(char), 64, file);
+	elf_read_from_pak(armature, sizeof(char), 64, reader);
 	if(strlen(armature))
 	{
 		rarmature = elf_get_or_load_armature_by_name(scene, armature);
@@ -717,12 +784,12 @@ elf_entity* elf_create_entity_from_pak(FILE *file, const char *name, elf_scene *
 	// scale must be set after setting a model, setting a model resets the scale
 	elf_set_entity_scale(entity, scale[0], scale[1], scale[2]);
 
-	fread((char*)&material_count, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&material_count, sizeof(int), 1, reader);
 
 	for(i = 0, j = 0; i < (int)material_count; i++)
 	{
 		memset(material, 0x0, sizeof(char)*64);
-		fread(material, sizeof(char), 64, file);
+		elf_read_from_pak(material, sizeof(char), 64, reader);
 
 		rmaterial = NULL;
 		if(strlen(material)) rmaterial = elf_get_or_load_material_by_name(scene, material);
@@ -741,13 +808,13 @@ elf_entity* elf_create_entity_from_pak(FILE *file, const char *name, elf_scene *
 	return entity;
 }
 
-elf_light* elf_create_light_from_pak(FILE *file, const char *name, elf_scene *scene)
+elf_light* elf_create_light_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene)
 {
 	elf_light *light;
 	int magic = 0;
 	unsigned int junk;
 
-	fread((char*)&magic, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&magic, sizeof(int), 1, reader);
 
 	if(magic != ELF_LIGHT_MAGIC)
 	{
@@ -756,21 +823,21 @@ elf_light* elf_create_light_from_pak(FILE *file, const char *name, elf_scene *sc
 	}
 
 	light = elf_create_light(NULL);
-	elf_read_actor_header((elf_actor*)light, file, scene);
+	elf_read_actor_header((elf_actor*)light, reader, scene);
 
-	fread((char*)&light->light_type, sizeof(unsigned char), 1, file);
+	elf_read_from_pak((char*)&light->light_type, sizeof(unsigned char), 1, reader);
 	if(light->light_type == ELF_SPOT_LIGHT) elf_set_light_shadow_caster(light, ELF_TRUE);
-	fread((char*)&light->color.r, sizeof(float), 4, file);
-	fread((char*)&light->distance, sizeof(float), 1, file);
-	fread((char*)&light->fade_speed, sizeof(float), 1, file);
-	fread((char*)&light->inner_cone, sizeof(float), 1, file);
-	fread((char*)&light->outer_cone, sizeof(float), 1, file);
-	fread((char*)&junk, sizeof(unsigned int), 1, file);
-	fread((char*)&light->shadow_caster, sizeof(unsigned char), 1, file);
-	fread((char*)&light->shaft, sizeof(unsigned char), 1, file);
-	fread((char*)&light->shaft_size, sizeof(float), 1, file);
-	fread((char*)&light->shaft_intensity, sizeof(float), 1, file);
-	fread((char*)&light->shaft_fade_off, sizeof(float), 1, file);
+	elf_read_from_pak((char*)&light->color.r, sizeof(float), 4, reader);
+	elf_read_from_pak((char*)&light->distance, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&light->fade_speed, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&light->inner_cone, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&light->outer_cone, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&junk, sizeof(unsigned int), 1, reader);
+	elf_read_from_pak((char*)&light->shadow_caster, sizeof(unsigned char), 1, reader);
+	elf_read_from_pak((char*)&light->shaft, sizeof(unsigned char), 1, reader);
+	elf_read_from_pak((char*)&light->shaft_size, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&light->shaft_intensity, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&light->shaft_fade_off, sizeof(float), 1, reader);
 
 	elf_set_light_type(light, light->light_type);
 	elf_set_light_color(light, light->color.r, light->color.g, light->color.b, light->color.a);
@@ -783,7 +850,7 @@ elf_light* elf_create_light_from_pak(FILE *file, const char *name, elf_scene *sc
 	return light;
 }
 
-elf_material* elf_create_material_from_pak(FILE *file, const char *name, elf_scene *scene)
+elf_material* elf_create_material_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene)
 {
 	elf_material *material;
 	elf_texture *rtexture;
@@ -794,7 +861,7 @@ elf_material* elf_create_material_from_pak(FILE *file, const char *name, elf_sce
 	unsigned char alpha_test;
 	float alpha_threshold;
 
-	fread((char*)&magic, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&magic, sizeof(int), 1, reader);
 
 	if(magic != ELF_MATERIAL_MAGIC)
 	{
@@ -803,46 +870,46 @@ elf_material* elf_create_material_from_pak(FILE *file, const char *name, elf_sce
 	}
 
 	memset(rname, 0x0, sizeof(char)*64);
-	fread(rname, sizeof(char), 64, file);
+	elf_read_from_pak(rname, sizeof(char), 64, reader);
 
 	material = elf_create_material(NULL);
 
 	material->name = elf_create_string(rname);
 	material->file_path = elf_create_string(elf_get_scene_file_path(scene));
 
-	fread((char*)&material->diffuse_color.r, sizeof(float), 4, file);
-	fread((char*)&material->ambient_color.r, sizeof(float), 4, file);
-	fread((char*)&material->specular_color.r, sizeof(float), 4, file);
-	fread((char*)&material->spec_power, sizeof(float), 1, file);
+	elf_read_from_pak((char*)&material->diffuse_color.r, sizeof(float), 4, reader);
+	elf_read_from_pak((char*)&material->ambient_color.r, sizeof(float), 4, reader);
+	elf_read_from_pak((char*)&material->specular_color.r, sizeof(float), 4, reader);
+	elf_read_from_pak((char*)&material->spec_power, sizeof(float), 1, reader);
 
 	elf_set_material_diffuse_color(material, material->diffuse_color.r, material->diffuse_color.g, material->diffuse_color.b, material->diffuse_color.a);
 	elf_set_material_specular_color(material, material->specular_color.r, material->specular_color.g, material->specular_color.b, material->specular_color.a);
 	elf_set_material_ambient_color(material, material->ambient_color.r, material->ambient_color.g, material->ambient_color.b, material->ambient_color.a);
 	elf_set_material_specular_power(material, material->spec_power);
 
-	fread(texture, sizeof(char), 64, file);
+	elf_read_from_pak(texture, sizeof(char), 64, reader);
 	if(strlen(texture) > 0) rtexture = elf_get_or_load_texture_by_name(scene, texture); else rtexture = NULL;
 	if(rtexture) elf_set_material_diffuse_map(material, rtexture);
 
-	fread(texture, sizeof(char), 64, file);
+	elf_read_from_pak(texture, sizeof(char), 64, reader);
 	if(strlen(texture) > 0) rtexture = elf_get_or_load_texture_by_name(scene, texture); else rtexture = NULL;
 	if(rtexture) elf_set_material_normal_map(material, rtexture);
 
-	fread(texture, sizeof(char), 64, file);
+	elf_read_from_pak(texture, sizeof(char), 64, reader);
 	if(strlen(texture) > 0) rtexture = elf_get_or_load_texture_by_name(scene, texture); else rtexture = NULL;
 	if(rtexture) elf_set_material_height_map(material, rtexture);
 
-	fread(texture, sizeof(char), 64, file);
+	elf_read_from_pak(texture, sizeof(char), 64, reader);
 	if(strlen(texture) > 0) rtexture = elf_get_or_load_texture_by_name(scene, texture); else rtexture = NULL;
 	if(rtexture) elf_set_material_specular_map(material, rtexture);
 
-	fread(texture, sizeof(char), 64, file);
+	elf_read_from_pak(texture, sizeof(char), 64, reader);
 	if(strlen(texture) > 0) rtexture = elf_get_or_load_texture_by_name(scene, texture); else rtexture = NULL;
 	if(rtexture) elf_set_material_light_map(material, rtexture);
 
-	fread((char*)&parallax_scale, sizeof(float), 1, file);
-	fread((char*)&alpha_test, sizeof(unsigned char), 1, file);
-	fread((char*)&alpha_threshold, sizeof(float), 1, file);
+	elf_read_from_pak((char*)&parallax_scale, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&alpha_test, sizeof(unsigned char), 1, reader);
+	elf_read_from_pak((char*)&alpha_threshold, sizeof(float), 1, reader);
 
 	elf_set_material_parallax_scale(material, parallax_scale);
 	elf_set_material_alpha_test(material, alpha_test);
@@ -851,165 +918,351 @@ elf_material* elf_create_material_from_pak(FILE *file, const char *name, elf_sce
 	return material;
 }
 
-elf_model* elf_create_model_from_pak(FILE *file, const char *name, elf_scene *scene)
+void elf_decode_model_from_pak(elf_pak_reader *reader, elf_decoded_model *decoded)
 {
-	elf_model *model = NULL;
 	int magic = 0;
-	unsigned int i = 0;
-	char rname[64];
-	unsigned int indices_read = 0;
+	int i = 0;
+	int indices_read = 0;
 	unsigned char is_normals;
-	unsigned char is_tex_coords;
 	unsigned char is_weights_and_boneids;
 	unsigned char junk;
 	float weights[4];
 	float length;
 	short int boneids[4];
-	float *vertex_buffer;
+	const unsigned char *weight_data = NULL;
+	const unsigned char *boneid_data = NULL;
+
+	// runs on the loader threads too, so report errors through the decoded data instead of elf_set_error
+	memset(decoded, 0x0, sizeof(elf_decoded_model));
 
 	// read magic
-	fread((char*)&magic, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&magic, sizeof(int), 1, reader);
 
-	if(magic != ELF_MODEL_MAGIC)
+	if(magic == ELF_MODEL_MAGIC_V2)
 	{
-		elf_set_error(ELF_INVALID_FILE, "error: invalid model \"%s\", wrong magic number\n", name);
-		return NULL;
+		elf_decode_model_v2_from_pak(reader, decoded);
+		return;
 	}
 
-	model = elf_create_model(NULL);
+	if(magic != ELF_MODEL_MAGIC)
+	{
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "wrong magic number";
+		return;
+	}
 
 	// read name
-	fread(rname, sizeof(char), 64, file);
-
-	model->name = elf_create_string(rname);
-	model->file_path = elf_create_string(elf_get_scene_file_path(scene));
+	elf_read_from_pak(decoded->name, sizeof(char), 64, reader);
+	decoded->name[63] = '\0';
 
 	// read header
-	fread((char*)&model->vertice_count, sizeof(int), 1, file);
-	fread((char*)&model->frame_count, sizeof(int), 1, file);
-	fread((char*)&model->indice_count, sizeof(int), 1, file);
-	fread((char*)&model->area_count, sizeof(int), 1, file);
-	fread((char*)&is_normals, sizeof(unsigned char), 1, file);
-	fread((char*)&is_tex_coords, sizeof(unsigned char), 1, file);
-	fread((char*)&is_weights_and_boneids, sizeof(unsigned char), 1, file);
-	fread((char*)&junk, sizeof(unsigned char), 1, file);
-
-	if(model->vertice_count < 3)
-	{
-		elf_set_error(ELF_INVALID_FILE, "error: invalid model \"%s\", invalid vertex count\n", name);
-		elf_destroy_model(model);
-		return NULL;
+	elf_read_from_pak((char*)&decoded->vertice_count, sizeof(int), 1, reader);
+	elf_read_from_pak((char*)&decoded->frame_count, sizeof(int), 1, reader);
+	elf_read_from_pak((char*)&decoded->indice_count, sizeof(int), 1, reader);
+	elf_read_from_pak((char*)&decoded->area_count, sizeof(int), 1, reader);
+	elf_read_from_pak((char*)&is_normals, sizeof(unsigned char), 1, reader);
+	elf_read_from_pak((char*)&decoded->is_tex_coords, sizeof(unsigned char), 1, reader);
+	elf_read_from_pak((char*)&is_weights_and_boneids, sizeof(unsigned char), 1, reader);
+	elf_read_from_pak((char*)&junk, sizeof(unsigned char), 1, reader);
+
+	if(decoded->vertice_count < 3)
+	{
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "invalid vertex count";
+		return;
 	}
-	if(model->frame_count < 1)
+	if(decoded->frame_count < 1)
 	{
-		elf_set_error(ELF_INVALID_FILE, "error: invalid model \"%s\", invalid frame count\n", name);
-		elf_destroy_model(model);
-		return NULL;
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "invalid frame count";
+		return;
 	}
-	if(model->indice_count < 3)
+	if(decoded->indice_count < 3)
 	{
-		elf_set_error(ELF_INVALID_FILE, "error: invalid model \"%s\", invalid indice count\n", name);
-		elf_destroy_model(model);
-		return NULL;
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "invalid indice count";
+		return;
 	}
-	if(model->area_count < 1)
+	if(decoded->area_count < 1)
 	{
-		elf_set_error(ELF_INVALID_FILE, "error: invalid model \"%s\", invalid area count\n", name);
-		elf_destroy_model(model);
-		return NULL;
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "invalid area count";
+		return;
 	}
 
 	// read vertices
-	model->vertices = gfx_create_vertex_data(3*model->vertice_count, GFX_FLOAT, GFX_VERTEX_DATA_STATIC);
-	gfx_inc_ref((gfx_object*)model->vertices);
-
-	fread((char*)gfx_get_vertex_data_buffer(model->vertices), sizeof(float), 3*model->vertice_count, file);
+	decoded->vertices = (float*)malloc(sizeof(float)*3*decoded->vertice_count);
+	elf_read_from_pak((char*)decoded->vertices, sizeof(float), 3*decoded->vertice_count, reader);
 
 	// read index
-	model->index = (unsigned int*)malloc(sizeof(unsigned int)*model->indice_count);
+	decoded->index = (unsigned int*)malloc(sizeof(unsigned int)*decoded->indice_count);
+	decoded->area_indice_counts = (int*)malloc(sizeof(int)*decoded->area_count);
+	memset(decoded->area_indice_counts, 0x0, sizeof(int)*decoded->area_count);
 
-	model->areas = (elf_model_area*)malloc(sizeof(elf_model_area)*model->area_count);
-	memset(model->areas, 0x0, sizeof(elf_model_area)*model->area_count);
+	for(i = 0; i < decoded->area_count; i++)
+	{
+		elf_read_from_pak((char*)&decoded->area_indice_counts[i], sizeof(int), 1, reader);
+		if(decoded->area_indice_counts[i] < 0 || decoded->area_indice_counts[i] > decoded->indice_count-indices_read)
+		{
+			decoded->error = ELF_INVALID_FILE;
+			decoded->error_str = "invalid area indice count";
+			return;
+		}
+		if(decoded->area_indice_counts[i])
+		{
+			elf_read_from_pak((char*)&decoded->index[indices_read],
+				sizeof(unsigned int), decoded->area_indice_counts[i], reader);
+			indices_read += decoded->area_indice_counts[i];
+		}
+	}
 
-	for(i = 0; i < model->area_count; i++)
+	decoded->normals = (float*)malloc(sizeof(float)*3*decoded->vertice_count);
+	elf_read_from_pak((char*)decoded->normals, sizeof(float), 3*decoded->vertice_count, reader);
+
+	// read tex coords
+	if(decoded->is_tex_coords > 0)
 	{
-		fread((char*)&model->areas[i].indice_count, sizeof(int), 1, file);
-		if(model->areas[i].indice_count)
+		decoded->tex_coords = (float*)malloc(sizeof(float)*2*decoded->vertice_count);
+		elf_read_from_pak((char*)decoded->tex_coords, sizeof(float), 2*decoded->vertice_count, reader);
+	}
+
+	// read weights and bone ids straight from the pak data
+	if(is_weights_and_boneids > 0)
+	{
+		weight_data = (const unsigned char*)elf_map_from_pak(sizeof(float)*4*decoded->vertice_count, reader);
+		boneid_data = (const unsigned char*)elf_map_from_pak(sizeof(short int)*4*decoded->vertice_count, reader);
+	}
+
+	if(weight_data && boneid_data)
+	{
+		decoded->weights = (float*)malloc(sizeof(float)*4*decoded->vertice_count);
+		for(i = 0; i < decoded->vertice_count; i++)
 		{
-			model->areas[i].index = gfx_create_vertex_data(model->areas[i].indice_count, GFX_UINT, GFX_VERTEX_DATA_STATIC);
-			gfx_inc_ref((gfx_object*)model->areas[i].index);
+			memcpy(weights, &weight_data[i*sizeof(float)*4], sizeof(float)*4);
+			if(weights[0] > 1.0) weights[0] = 1.0;
+			if(weights[1] > 1.0) weights[1] = 1.0;
+			if(weights[2] > 1.0) weights[2] = 1.0;
+			if(weights[3] > 1.0) weights[3] = 1.0;
+			if(weights[0] < 0.0) weights[0] = 0.0;
+			if(weights[1] < 0.0) weights[1] = 0.0;
+			if(weights[2] < 0.0) weights[2] = 0.0;
+			if(weights[3] < 0.0) weights[3] = 0.0;
+			length = 1.0f/(weights[0]+weights[1]+weights[2]+weights[3]);
+			decoded->weights[i*4] = weights[0]*length;
+			decoded->weights[i*4+1] = weights[1]*length;
+			decoded->weights[i*4+2] = weights[2]*length;
+			decoded->weights[i*4+3] = weights[3]*length;
+		}
+		decoded->boneids = (int*)malloc(sizeof(int)*4*decoded->vertice_count);
+		for(i = 0; i < decoded->vertice_count; i++)
+		{
+			memcpy(boneids, &boneid_data[i*sizeof(short int)*4], sizeof(short int)*4);
+			decoded->boneids[i*4] = boneids[0];
+			decoded->boneids[i*4+1] = boneids[1];
+			decoded->boneids[i*4+2] = boneids[2];
+			decoded->boneids[i*4+3] = boneids[3];
+		}
+	}
 
-			fread((char*)gfx_get_vertex_data_buffer(model->areas[i].index),
-				sizeof(unsigned int), model->areas[i].indice_count, file);
+	// get bounding box values
+	memcpy(&decoded->bb_min.x, decoded->vertices, sizeof(float)*3);
+	memcpy(&decoded->bb_max.x, decoded->vertices, sizeof(float)*3);
 
-			memcpy(&model->index[indices_read], gfx_get_vertex_data_buffer(model->areas[i].index),
-				gfx_get_vertex_data_size_bytes(model->areas[i].index));
+	for(i = 3; i < decoded->vertice_count*3; i+=3)
+	{
+		if(decoded->vertices[i] < decoded->bb_min.x) decoded->bb_min.x = decoded->vertices[i];
+		if(decoded->vertices[i+1] < decoded->bb_min.y) decoded->bb_min.y = decoded->vertices[i+1];
+		if(decoded->vertices[i+2] < decoded->bb_min.z) decoded->bb_min.z = decoded->vertices[i+2];
 
-			indices_read += model->areas[i].indice_count;
+		if(decoded->vertices[i] > decoded->bb_max.x) decoded->bb_max.x = decoded->vertices[i];
+		if(decoded->vertices[i+1] > decoded->bb_max.y) decoded->bb_max.y = decoded->vertices[i+1];
+		if(decoded->vertices[i+2] > decoded->bb_max.z) decoded->bb_max.z = decoded->vertices[i+2];
+	}
+}
+
+void elf_decode_model_v2_from_pak(elf_pak_reader *reader, elf_decoded_model *decoded)
+{
+	int i;
+	int indices_read = 0;
+	unsigned char is_normals;
+	unsigned char is_weights_and_boneids;
+	unsigned char junk;
+	const void *block;
+
+	// read name
+	elf_read_from_pak(decoded->name, sizeof(char), 64, reader);
+	decoded->name[63] = '\0';
+
+	// read header
+	elf_read_from_pak((char*)&decoded->vertice_count, sizeof(int), 1, reader);
+	elf_read_from_pak((char*)&decoded->frame_count, sizeof(int), 1, reader);
+	elf_read_from_pak((char*)&decoded->indice_count, sizeof(int), 1, reader);
+	elf_read_from_pak((char*)&decoded->area_count, sizeof(int), 1, reader);
+	elf_read_from_pak((char*)&is_normals, sizeof(unsigned char), 1, reader);
+	elf_read_from_pak((char*)&decoded->is_tex_coords, sizeof(unsigned char), 1, reader);
+	elf_read_from_pak((char*)&is_weights_and_boneids, sizeof(unsigned char), 1, reader);
+	elf_read_from_pak((char*)&junk, sizeof(unsigned char), 1, reader);
+	elf_read_from_pak((char*)&decoded->bb_min.x, sizeof(float), 3, reader);
+	elf_read_from_pak((char*)&decoded->bb_max.x, sizeof(float), 3, reader);
+
+	// a single block can't be bigger than the pak, this also keeps the sizes below from overflowing
+	if(decoded->vertice_count < 3 || decoded->vertice_count > (int)(reader->size/(sizeof(float)*4)))
+	{
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "invalid vertex count";
+		return;
+	}
+	if(decoded->frame_count < 1)
+	{
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "invalid frame count";
+		return;
+	}
+	if(decoded->indice_count < 3 || decoded->indice_count > (int)(reader->size/sizeof(unsigned int)))
+	{
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "invalid indice count";
+		return;
+	}
+	if(decoded->area_count < 1 || decoded->area_count > (int)(reader->size/sizeof(int)))
+	{
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "invalid area count";
+		return;
+	}
+
+	// every block is stored exactly like the engine keeps it, one copy each
+	if(!(block = elf_map_block_from_pak(sizeof(int)*decoded->area_count, reader))) goto truncated;
+	decoded->area_indice_counts = (int*)malloc(sizeof(int)*decoded->area_count);
+	memcpy(decoded->area_indice_counts, block, sizeof(int)*decoded->area_count);
+
+	for(i = 0; i < decoded->area_count; i++)
+	{
+		if(decoded->area_indice_counts[i] < 0 || decoded->area_indice_counts[i] > decoded->indice_count-indices_read)
+		{
+			decoded->error = ELF_INVALID_FILE;
+			decoded->error_str = "invalid area indice count";
+			return;
 		}
+		indices_read += decoded->area_indice_counts[i];
 	}
 
-	model->normals = gfx_create_vertex_data(3*model->vertice_count, GFX_FLOAT, GFX_VERTEX_DATA_STATIC);
-	gfx_inc_ref((gfx_object*)model->normals);
+	if(!(block = elf_map_block_from_pak(sizeof(float)*3*decoded->vertice_count, reader))) goto truncated;
+	decoded->vertices = (float*)malloc(sizeof(float)*3*decoded->vertice_count);
+	memcpy(decoded->vertices, block, sizeof(float)*3*decoded->vertice_count);
 
-	fread((char*)gfx_get_vertex_data_buffer(model->normals), sizeof(float), 3*model->vertice_count, file);
+	if(!(block = elf_map_block_from_pak(sizeof(unsigned int)*decoded->indice_count, reader))) goto truncated;
+	decoded->index = (unsigned int*)malloc(sizeof(unsigned int)*decoded->indice_count);
+	memcpy(decoded->index, block, sizeof(unsigned int)*decoded->indice_count);
 
-	// read tex coords
-	if(is_tex_coords > 0)
+	if(!(block = elf_map_block_from_pak(sizeof(float)*3*decoded->vertice_count, reader))) goto truncated;
+	decoded->normals = (float*)malloc(sizeof(float)*3*decoded->vertice_count);
+	memcpy(decoded->normals, block, sizeof(float)*3*decoded->vertice_count);
+
+	if(decoded->is_tex_coords > 0)
+	{
+		if(!(block = elf_map_block_from_pak(sizeof(float)*2*decoded->vertice_count, reader))) goto truncated;
+		decoded->tex_coords = (float*)malloc(sizeof(float)*2*decoded->vertice_count);
+		memcpy(decoded->tex_coords, block, sizeof(float)*2*decoded->vertice_count);
+	}
+
+	// weights are normalized and bone ids widened by the writer already
+	if(is_weights_and_boneids > 0)
+	{
+		if(!(block = elf_map_block_from_pak(sizeof(float)*4*decoded->vertice_count, reader))) goto truncated;
+		decoded->weights = (float*)malloc(sizeof(float)*4*decoded->vertice_count);
+		memcpy(decoded->weights, block, sizeof(float)*4*decoded->vertice_count);
+
+		if(!(block = elf_map_block_from_pak(sizeof(int)*4*decoded->vertice_count, reader))) goto truncated;
+		decoded->boneids = (int*)malloc(sizeof(int)*4*decoded->vertice_count);
+		memcpy(decoded->boneids, block, sizeof(int)*4*decoded->vertice_count);
+	}
+
+	return;
+
+truncated:
+	decoded->error = ELF_INVALID_FILE;
+	decoded->error_str = "truncated data";
+}
+
+void elf_clear_decoded_model(elf_decoded_model *decoded)
+{
+	if(decoded->vertices) free(decoded->vertices);
+	if(decoded->normals) free(decoded->normals);
+	if(decoded->tex_coords) free(decoded->tex_coords);
+	if(decoded->index) free(decoded->index);
+	if(decoded->area_indice_counts) free(decoded->area_indice_counts);
+	if(decoded->weights) free(decoded->weights);
+	if(decoded->boneids) free(decoded->boneids);
+
+	memset(decoded, 0x0, sizeof(elf_decoded_model));
+}
+
+elf_model* elf_create_model_from_decoded(elf_decoded_model *decoded, const char *name, elf_scene *scene)
+{
+	elf_model *model = NULL;
+	unsigned int i = 0;
+	unsigned int indices_read = 0;
+
+	if(decoded->error)
+	{
+		elf_set_error(decoded->error, "error: invalid model \"%s\", %s\n", name, decoded->error_str);
+		return NULL;
+	}
+
+	model = elf_create_model(NULL);
+
+	model->name = elf_create_string(decoded->name);
+	model->file_path = elf_create_string(elf_get_scene_file_path(scene));
+
+	model->vertice_count = decoded->vertice_count;
+	model->frame_count = decoded->frame_count;
+	model->indice_count = decoded->indice_count;
+	model->area_count = decoded->area_count;
+
+	// the decoded buffers are handed over as they are, no copies
+	model->vertices = gfx_create_vertex_data_from_buffer(3*model->vertice_count, GFX_FLOAT, GFX_VERTEX_DATA_STATIC, decoded->vertices);
+	gfx_inc_ref((gfx_object*)model->vertices);
+	decoded->vertices = NULL;
+
+	model->normals = gfx_create_vertex_data_from_buffer(3*model->vertice_count, GFX_FLOAT, GFX_VERTEX_DATA_STATIC, decoded->normals);
+	gfx_inc_ref((gfx_object*)model->normals);
+	decoded->normals = NULL;
+
+	if(decoded->tex_coords)
 	{
-		model->tex_coords = gfx_create_vertex_data(2*model->vertice_count, GFX_FLOAT, GFX_VERTEX_DATA_STATIC);
+		model->tex_coords = gfx_create_vertex_data_from_buffer(2*model->vertice_count, GFX_FLOAT, GFX_VERTEX_DATA_STATIC, decoded->tex_coords);
 		gfx_inc_ref((gfx_object*)model->tex_coords);
-
-		fread((char*)gfx_get_vertex_data_buffer(model->tex_coords), sizeof(float), 2*model->vertice_count, file);
+		decoded->tex_coords = NULL;
 	}
 
-	// read weights and bone ids
-	if(is_weights_and_boneids > 0)
-	{
-		model->weights = (float*)malloc(sizeof(float)*4*model->vertice_count);
-		for(i = 0; i < model->vertice_count; i++)
-		{
-			fread((char*)weights, sizeof(float), 4, file);
-			if(weights[0] > 1.0) weights[0] = 1.0;
-			if(weights[1] > 1.0) weights[1] = 1.0;
-			if(weights[2] > 1.0) weights[2] = 1.0;
-			if(weights[3] > 1.0) weights[3] = 1.0;
-			if(weights[0] < 0.0) weights[0] = 0.0;
-			if(weights[1] < 0.0) weights[1] = 0.0;
-			if(weights[2] < 0.0) weights[2] = 0.0;
-			if(weights[3] < 0.0) weights[3] = 0.0;
-			length = 1.0f/(weights[0]+weights[1]+weights[2]+weights[3]);
-			model->weights[i*4] = weights[0]*length;
-			model->weights[i*4+1] = weights[1]*length;
-			model->weights[i*4+2] = weights[2]*length;
-			model->weights[i*4+3] = weights[3]*length;
-		}
-		model->boneids = (int*)malloc(sizeof(int)*4*model->vertice_count);
-		for(i = 0; i < model->vertice_count; i++)
-		{
-			fread((char*)boneids, sizeof(short int), 4, file);
-			model->boneids[i*4] = boneids[0];
-			model->boneids[i*4+1] = boneids[1];
-			model->boneids[i*4+2] = boneids[2];
-			model->boneids[i*4+3] = boneids[3];
-		}
-	}
+	model->index = decoded->index;
+	decoded->index = NULL;
 
-	vertex_buffer = gfx_get_vertex_data_buffer(model->vertices);
+	model->weights = decoded->weights;
+	model->boneids = decoded->boneids;
+	decoded->weights = NULL;
+	decoded->boneids = NULL;
 
-	// get bounding box values
-	memcpy(&model->bb_min.x, vertex_buffer, sizeof(float)*3);
-	memcpy(&model->bb_max.x, vertex_buffer, sizeof(float)*3);
+	memcpy(&model->bb_min.x, &decoded->bb_min.x, sizeof(float)*3);
+	memcpy(&model->bb_max.x, &decoded->bb_max.x, sizeof(float)*3);
 
-	for(i = 3; i < model->vertice_count*3; i+=3)
+	model->areas = (elf_model_area*)malloc(sizeof(elf_model_area)*model->area_count);
+	memset(model->areas, 0x0, sizeof(elf_model_area)*model->area_count);
+
+	for(i = 0; i < model->area_count; i++)
 	{
-		if(vertex_buffer[i] < model->bb_min.x) model->bb_min.x = vertex_buffer[i];
-		if(vertex_buffer[i+1] < model->bb_min.y) model->bb_min.y = vertex_buffer[i+1];
-		if(vertex_buffer[i+2] < model->bb_min.z) model->bb_min.z = vertex_buffer[i+2];
+		model->areas[i].indice_count = decoded->area_indice_counts[i];
+		if(model->areas[i].indice_count)
+		{
+			model->areas[i].index = gfx_create_vertex_data(model->areas[i].indice_count, GFX_UINT, GFX_VERTEX_DATA_STATIC);
+			gfx_inc_ref((gfx_object*)model->areas[i].index);
 
-		if(vertex_buffer[i] > model->bb_max.x) model->bb_max.x = vertex_buffer[i];
-		if(vertex_buffer[i+1] > model->bb_max.y) model->bb_max.y = vertex_buffer[i+1];
-		if(vertex_buffer[i+2] > model->bb_max.z) model->bb_max.z = vertex_buffer[i+2];
+			memcpy(gfx_get_vertex_data_buffer(model->areas[i].index), &model->index[indices_read],
+				gfx_get_vertex_data_size_bytes(model->areas[i].index));
+
+			indices_read += model->areas[i].indice_count;
+		}
 	}
 
 	model->vertex_array = gfx_create_vertex_array(GFX_TRUE);
@@ -1017,7 +1270,7 @@ elf_model* elf_create_model_from_pak(FILE *file, const char *name, elf_scene *sc
 
 	gfx_set_vertex_array_data(model->vertex_array, GFX_VERTEX, model->vertices);
 	gfx_set_vertex_array_data(model->vertex_array, GFX_NORMAL, model->normals);
-	if(is_tex_coords > 0) gfx_set_vertex_array_data(model->vertex_array, GFX_TEX_COORD, model->tex_coords);
+	if(model->tex_coords) gfx_set_vertex_array_data(model->vertex_array, GFX_TEX_COORD, model->tex_coords);
 
 	for(i = 0; i < model->area_count; i++)
 	{
@@ -1031,7 +1284,19 @@ elf_model* elf_create_model_from_pak(FILE *file, const char *name, elf_scene *sc
 	return model;
 }
 
-elf_particles* elf_create_particles_from_pak(FILE *file, const char *name, elf_scene *scene)
+elf_model* elf_create_model_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene)
+{
+	elf_model *model;
+	elf_decoded_model decoded;
+
+	elf_decode_model_from_pak(reader, &decoded);
+	model = elf_create_model_from_decoded(&decoded, name, scene);
+	elf_clear_decoded_model(&decoded);
+
+	return model;
+}
+
+elf_particles* elf_create_particles_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene)
 {
 	elf_particles *particles;
 	elf_texture *rtexture;
@@ -1042,7 +1307,7 @@ elf_particles* elf_create_particles_from_pak(FILE *file, const char *name, elf_s
 	char model[64];
 	char entity[64];
 
-	fread((char*)&magic, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&magic, sizeof(int), 1, reader);
 
 	if(magic != ELF_PARTICLES_MAGIC)
 	{
@@ -1051,56 +1316,56 @@ elf_particles* elf_create_particles_from_pak(FILE *file, const char *name, elf_s
 	}
 
 	particles = elf_create_particles(NULL, 10);
-	elf_read_actor_header((elf_actor*)particles, file, scene);
+	elf_read_actor_header((elf_actor*)particles, reader, scene);
 
-	fread(texture, sizeof(char), 64, file);
+	elf_read_from_pak(texture, sizeof(char), 64, reader);
 	if(strlen(texture))
 	{
 		rtexture = elf_get_or_load_texture_by_name(scene, texture);
 		elf_set_particles_texture(particles, rtexture);
 	}
 
-	fread(model, sizeof(char), 64, file);
+	elf_read_from_pak(model, sizeof(char), 64, reader);
 	if(strlen(model))
 	{
 		rmodel = elf_get_or_load_model_by_name(scene, model);
 		elf_set_particles_model(particles, rmodel);
 	}
 
-	fread(entity, sizeof(char), 64, file);
+	elf_read_from_pak(entity, sizeof(char), 64, reader);
 	if(strlen(entity))
 	{
 		rentity = elf_get_or_load_entity_by_name(scene, entity);
 		elf_set_particles_entity(particles, rentity);
 	}
 
-	fread((char*)&particles->max_count, sizeof(int), 1, file);
-	fread((char*)&particles->draw_mode, sizeof(unsigned char), 1, file);
+	elf_read_from_pak((char*)&particles->max_count, sizeof(int), 1, reader);
+	elf_read_from_pak((char*)&particles->draw_mode, sizeof(unsigned char), 1, reader);
 
 	elf_set_particles_max_count(particles, particles->max_count);
 	elf_set_particles_draw_mode(particles, particles->draw_mode);
 
-	fread((char*)&particles->spawn_delay, sizeof(float), 1, file);
-	fread((char*)&particles->spawn, sizeof(unsigned char), 1, file);
-	fread((char*)&particles->gravity.x, sizeof(float), 3, file);
-	fread((char*)&particles->size_min, sizeof(float), 1, file);
-	fread((char*)&particles->size_max, sizeof(float), 1, file);
-	fread((char*)&particles->size_growth_min, sizeof(float), 1, file);
-	fread((char*)&particles->size_growth_max, sizeof(float), 1, file);
-	fread((char*)&particles->rotation_min, sizeof(float), 1, file);
-	fread((char*)&particles->rotation_max, sizeof(float), 1, file);
-	fread((char*)&particles->rotation_growth_min, sizeof(float), 1, file);
-	fread((char*)&particles->rotation_growth_max, sizeof(float), 1, file);
-	fread((char*)&particles->life_span_min, sizeof(float), 1, file);
-	fread((char*)&particles->life_span_max, sizeof(float), 1, file);
-	fread((char*)&particles->fade_speed_min, sizeof(float), 1, file);
-	fread((char*)&particles->fade_speed_max, sizeof(float), 1, file);
-	fread((char*)&particles->velocity_min.x, sizeof(float), 3, file);
-	fread((char*)&particles->velocity_max.x, sizeof(float), 3, file);
-	fread((char*)&particles->position_min.x, sizeof(float), 3, file);
-	fread((char*)&particles->position_max.x, sizeof(float), 3, file);
-	fread((char*)&particles->color_min.r, sizeof(float), 4, file);
-	fread((char*)&particles->color_max.r, sizeof(float), 4, file);
+	elf_read_from_pak((char*)&particles->spawn_delay, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->spawn, sizeof(unsigned char), 1, reader);
+	elf_read_from_pak((char*)&particles->gravity.x, sizeof(float), 3, reader);
+	elf_read_from_pak((char*)&particles->size_min, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->size_max, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->size_growth_min, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->size_growth_max, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->rotation_min, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->rotation_max, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->rotation_growth_min, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->rotation_growth_max, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->life_span_min, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->life_span_max, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->fade_speed_min, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->fade_speed_max, sizeof(float), 1, reader);
+	elf_read_from_pak((char*)&particles->velocity_min.x, sizeof(float), 3, reader);
+	elf_read_from_pak((char*)&particles->velocity_max.x, sizeof(float), 3, reader);
+	elf_read_from_pak((char*)&particles->position_min.x, sizeof(float), 3, reader);
+	elf_read_from_pak((char*)&particles->position_max.x, sizeof(float), 3, reader);
+	elf_read_from_pak((char*)&particles->color_min.r, sizeof(float), 4, reader);
+	elf_read_from_pak((char*)&particles->color_max.r, sizeof(float), 4, reader);
 
 	elf_set_particles_spawn_delay(particles, particles->spawn_delay);
 	elf_set_particles_spawn(particles, particles->spawn);
@@ -1121,7 +1386,7 @@ elf_particles* elf_create_particles_from_pak(FILE *file, const char *name, elf_s
 	return particles;
 }
 
-elf_script* elf_create_script_from_pak(FILE *file, const char *name, elf_scene *scene)
+elf_script* elf_create_script_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene)
 {
 	elf_script *script;
 	int magic = 0;
@@ -1129,7 +1394,7 @@ elf_script* elf_create_script_from_pak(FILE *file, const char *name, elf_scene *
 	unsigned int length;
 	char *text;
 
-	fread((char*)&magic, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&magic, sizeof(int), 1, reader);
 
 	if(magic != ELF_SCRIPT_MAGIC)
 	{
@@ -1138,19 +1403,19 @@ elf_script* elf_create_script_from_pak(FILE *file, const char *name, elf_scene *
 	}
 
 	memset(rname, 0x0, sizeof(char)*64);
-	fread(rname, sizeof(char), 64, file);
+	elf_read_from_pak(rname, sizeof(char), 64, reader);
 
 	script = elf_create_script();
 
 	script->name = elf_create_string(name);
 	script->file_path = elf_create_string(elf_get_scene_file_path(scene));
 
-	fread((char*)&length, sizeof(unsigned int), 1, file);
+	elf_read_from_pak((char*)&length, sizeof(unsigned int), 1, reader);
 	if(length > 0)
 	{
 		text = (char*)malloc(sizeof(char)*length+1);
 		memset(text, 0x0, sizeof(char)*length+1);
-		fread(text, sizeof(char), length, file);
+		elf_read_from_pak(text, sizeof(char), length, reader);
 		text[length] = '\0';
 		elf_set_script_text(script, text);
 		free(text);
@@ -1159,7 +1424,7 @@ elf_script* elf_create_script_from_pak(FILE *file, const char *name, elf_scene *
 	return script;
 }
 
-elf_sprite* elf_create_sprite_from_pak(FILE *file, const char *name, elf_scene *scene)
+elf_sprite* elf_create_sprite_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene)
 {
 	elf_sprite *sprite;
 	elf_material *rmaterial;
@@ -1167,7 +1432,7 @@ elf_sprite* elf_create_sprite_from_pak(FILE *file, const char *name, elf_scene *
 	float scale[2] = {0.0, 0.0};
 	char material[64];
 
-	fread((char*)&magic, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&magic, sizeof(int), 1, reader);
 
 	if(magic != ELF_SPRITE_MAGIC)
 	{
@@ -1176,11 +1441,11 @@ elf_sprite* elf_create_sprite_from_pak(FILE *file, const char *name, elf_scene *
 	}
 
 	sprite = elf_create_sprite(NULL);
-	elf_read_actor_header((elf_actor*)sprite, file, scene);
+	elf_read_actor_header((elf_actor*)sprite, reader, scene);
 
-	fread((char*)scale, sizeof(float), 2, file);
+	elf_read_from_pak((char*)scale, sizeof(float), 2, reader);
 
-	fread(material, sizeof(char), 64, file);
+	elf_read_from_pak(material, sizeof(char), 64, reader);
 	if(strlen(material))
 	{
 		rmaterial = elf_get_or_load_material_by_name(scene, material);
@@ -1189,96 +1454,128 @@ elf_sprite* elf_create_sprite_from_pak(FILE *file, const char *name, elf_scene *
 
 	elf_set_sprite_scale(sprite, scale[0], scale[1]);
 
-	fread((char*)&sprite->face_camera, sizeof(unsigned char), 1, file);
+	elf_read_from_pak((char*)&sprite->face_camera, sizeof(unsigned char), 1, reader);
 	elf_set_sprite_face_camera(sprite, sprite->face_camera);
 
 	return sprite;
 }
 
-elf_texture *elf_create_texture_from_pak(FILE *file, const char *name, elf_scene *scene)
+void elf_decode_texture_from_pak(elf_pak_reader *reader, elf_decoded_texture *decoded)
 {
-	elf_texture *texture;
 	FIMEMORY *fi_mem;
 	FIBITMAP *fi_bitmap;
-	char *mem;
+	const char *mem;
 	FREE_IMAGE_FORMAT fi_format;
-	int magic;
-	char rname[64];
-	unsigned char type;
-	int width;
-	int height;
-	unsigned char bpp;
-	unsigned int length;
-	int format;
-	int internal_format;
-	int data_format;
-	unsigned char *data;
+	int magic = 0;
+	unsigned char type = 0;
+	unsigned int length = 0;
+
+	// runs on the loader threads too, so report errors through the decoded data instead of elf_set_error
+	memset(decoded, 0x0, sizeof(elf_decoded_texture));
 
-	fread((char*)&magic, sizeof(int), 1, file);
+	elf_read_from_pak((char*)&magic, sizeof(int), 1, reader);
 
 	if(magic != ELF_TEXTURE_MAGIC)
 	{
-		elf_set_error(ELF_INVALID_FILE, "error: invalid texture \"%s//%s\", wrong magic number\n", elf_get_scene_file_path(scene), name);
-		return NULL;
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "wrong magic number";
+		return;
 	}
 
-	fread(rname, sizeof(char), 64, file);
-	fread((char*)&type, sizeof(unsigned char), 1, file);
+	elf_read_from_pak(decoded->name, sizeof(char), 64, reader);
+	decoded->name[63] = '\0';
+	elf_read_from_pak((char*)&type, sizeof(unsigned char), 1, reader);
 
-	if(type == 1)
+	if(type != 1)
 	{
-		fread((char*)&length, sizeof(int), 1, file);
- 
-		mem = (char*)malloc(length);
-		fread(mem, sizeof(char), length, file);
+		decoded->error = ELF_UNKNOWN_FORMAT;
+		decoded->error_str = "unknown format";
+		return;
+	}
 
-		fi_mem = FreeImage_OpenMemory((BYTE*)mem, length);
-		fi_format = FreeImage_GetFileTypeFromMemory(fi_mem, 0);
-		fi_bitmap = FreeImage_LoadFromMemory(fi_format, fi_mem, 0);
+	elf_read_from_pak((char*)&length, sizeof(int), 1, reader);
 
-		width = FreeImage_GetWidth(fi_bitmap);
-		height = FreeImage_GetHeight(fi_bitmap);
-		bpp = FreeImage_GetBPP(fi_bitmap);
+	// decode the image directly from the pak data, no intermediate copy
+	mem = (const char*)elf_map_from_pak(length, reader);
+	if(!mem)
+	{
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "truncated data";
+		return;
+	}
 
-		data = (unsigned char*)malloc(sizeof(char)*width*height*(bpp/8));
-		FreeImage_ConvertToRawBits((BYTE*)data, fi_bitmap, width*(bpp/8), bpp,
-			FI_RGBA_RED_MASK, FI_RGBA_GREEN_MASK, FI_RGBA_BLUE_MASK, FALSE);
+	fi_mem = FreeImage_OpenMemory((BYTE*)mem, length);
+	fi_format = FreeImage_GetFileTypeFromMemory(fi_mem, 0);
+	fi_bitmap = FreeImage_LoadFromMemory(fi_format, fi_mem, 0);
 
-		FreeImage_Unload(fi_bitmap);
+	if(!fi_bitmap)
+	{
 		FreeImage_CloseMemory(fi_mem);
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "can't decode image data";
+		return;
+	}
+
+	decoded->width = FreeImage_GetWidth(fi_bitmap);
+	decoded->height = FreeImage_GetHeight(fi_bitmap);
+	decoded->bpp = FreeImage_GetBPP(fi_bitmap);
 
-		free(mem);
+	if(decoded->bpp != 8 && decoded->bpp != 16 && decoded->bpp != 24 && decoded->bpp != 32 && decoded->bpp != 48)
+	{
+		FreeImage_Unload(fi_bitmap);
+		FreeImage_CloseMemory(fi_mem);
+		decoded->error = ELF_INVALID_FILE;
+		decoded->error_str = "unsupported bits per pixel value";
+		return;
 	}
-	else
+
+	decoded->data = (unsigned char*)malloc(sizeof(char)*decoded->width*decoded->height*(decoded->bpp/8));
+	FreeImage_ConvertToRawBits((BYTE*)decoded->data, fi_bitmap, decoded->width*(decoded->bpp/8), decoded->bpp,
+		FI_RGBA_RED_MASK, FI_RGBA_GREEN_MASK, FI_RGBA_BLUE_MASK, FALSE);
+
+	FreeImage_Unload(fi_bitmap);
+	FreeImage_CloseMemory(fi_mem);
+}
+
+void elf_clear_decoded_texture(elf_decoded_texture *decoded)
+{
+	if(decoded->data) free(decoded->data);
+
+	memset(decoded, 0x0, sizeof(elf_decoded_texture));
+}
+
+elf_texture* elf_create_texture_from_decoded(elf_decoded_texture *decoded, const char *name, elf_scene *scene)
+{
+	elf_texture *texture;
+	int format;
+	int internal_format;
+	int data_format;
+
+	if(decoded->error)
 	{
-		elf_set_error(ELF_UNKNOWN_FORMAT, "error: can't load texture \"%s//%s\", unknown format\n", elf_get_scene_file_path(scene), rname);
+		elf_set_error(decoded->error, "error: can't load texture \"%s//%s\", %s\n", elf_get_scene_file_path(scene), name, decoded->error_str);
 		return NULL;
 	}
 
-	switch(bpp)
+	switch(decoded->bpp)
 	{
 		case 8: format = GFX_LUMINANCE; internal_format = GFX_LUMINANCE; data_format = GFX_UBYTE; break;
 		case 16: format = GFX_LUMINANCE_ALPHA; internal_format = GFX_LUMINANCE_ALPHA; data_format = GFX_UBYTE; break;
 		case 24: format = GFX_BGR; internal_format = GFX_COMPRESSED_RGB; data_format = GFX_UBYTE; break;
 		case 32: format = GFX_BGRA; internal_format = GFX_COMPRESSED_RGBA; data_format = GFX_UBYTE; break;
-		case 48: format = GFX_BGR; internal_format = GFX_COMPRESSED_RGB; data_format = GFX_USHORT; break;
-		default:
-			elf_set_error(ELF_INVALID_FILE, "error: unsupported bits per pixel value [%d] in texture \"%s//%s\"\n", (int)bpp, elf_get_scene_file_path(scene), rname);
-			free(data);
-			return NULL;
+		default: format = GFX_BGR; internal_format = GFX_COMPRESSED_RGB; data_format = GFX_USHORT; break;
 	}
 
 	texture = elf_create_texture();
 
-	texture->name = elf_create_string(rname);
+	texture->name = elf_create_string(decoded->name);
 	texture->file_path = elf_create_string(elf_get_scene_file_path(scene));
-	texture->texture = gfx_create_2d_texture(width, height, eng->texture_anisotropy, GFX_REPEAT, GFX_LINEAR, format, internal_format, data_format, data);
-
-	free(data);
+	texture->texture = gfx_create_2d_texture(decoded->width, decoded->height, eng->texture_anisotropy,
+		GFX_REPEAT, GFX_LINEAR, format, internal_format, data_format, decoded->data);
 
 	if(!texture->texture)
 	{
-		elf_set_error(ELF_CANT_CREATE, "error: can't create texture \"%s//%s\"\n", elf_get_scene_file_path(scene), rname);
+		elf_set_error(ELF_CANT_CREATE, "error: can't create texture \"%s//%s\"\n", elf_get_scene_file_path(scene), decoded->name);
 		elf_destroy_texture(texture);
 		return NULL;
 	}
@@ -1286,20 +1583,43 @@ elf_texture *elf_create_texture_from_pak(FILE *file, const char *name, elf_scene
 	return texture;
 }
 
-elf_scene* elf_create_scene_from_pak(elf_pak *pak)
+elf_texture *elf_create_texture_from_pak(elf_pak_reader *reader, const char *name, elf_scene *scene)
+{
+	elf_texture *texture;
+	elf_decoded_texture decoded;
+
+	elf_decode_texture_from_pak(reader, &decoded);
+	texture = elf_create_texture_from_decoded(&decoded, name, scene);
+	elf_clear_decoded_texture(&decoded);
+
+	return texture;
+}
+
+void elf_free_pak_decoded_data(elf_pak *pak)
 {
-	elf_scene *scene;
-	elf_camera *camera;
-	elf_entity *entity;
-	elf_light *light;
-	elf_sprite *sprite;
-	elf_particles *particles;
 	elf_pak_index *index;
-	FILE *file;
-	int magic;
-	char name[64];
-	float ambient_color[4];
-	unsigned char scene_read;
+
+	for(index = (elf_pak_index*)elf_begin_list(pak->indexes); index;
+		index = (elf_pak_index*)elf_next_in_list(pak->indexes))
+	{
+		if(index->decoded_texture)
+		{
+			elf_clear_decoded_texture(index->decoded_texture);
+			free(index->decoded_texture);
+			index->decoded_texture = NULL;
+		}
+		if(index->decoded_model)
+		{
+			elf_clear_decoded_model(index->decoded_model);
+			free(index->decoded_model);
+			index->decoded_model = NULL;
+		}
+	}
+}
+
+elf_scene* elf_create_empty_scene_from_pak(elf_pak *pak)
+{
+	elf_scene *scene;
 
 	scene = elf_create_scene(NULL);
 
@@ -1309,42 +1629,61 @@ elf_scene* elf_create_scene_from_pak(elf_pak *pak)
 	scene->pak = pak;
 	elf_inc_ref((elf_object*)pak);
 
-	scene_read = ELF_FALSE;
-	for(index = (elf_pak_index*)elf_begin_list(pak->indexes); index;
-		index = (elf_pak_index*)elf_next_in_list(pak->indexes))
+	return scene;
+}
+
+void elf_load_pak_index_to_scene(elf_scene *scene, elf_pak_index *index, unsigned char *scene_read)
+{
+	elf_pak_reader reader;
+	int magic;
+	char name[64];
+	float ambient_color[4];
+
+	if(index->index_type == ELF_CAMERA) elf_get_or_load_camera_by_name(scene, index->name);
+	else if(index->index_type == ELF_ENTITY) elf_get_or_load_entity_by_name(scene, index->name);
+	else if(index->index_type == ELF_LIGHT) elf_get_or_load_light_by_name(scene, index->name);
+	else if(index->index_type == ELF_SPRITE) elf_get_or_load_sprite_by_name(scene, index->name);
+	else if(index->index_type == ELF_PARTICLES) elf_get_or_load_particles_by_name(scene, index->name);
+	else if(index->index_type == ELF_SCENE && !*scene_read)
 	{
-		if(index->index_type == ELF_CAMERA) camera = elf_get_or_load_camera_by_name(scene, index->name);
-		else if(index->index_type == ELF_ENTITY) entity = elf_get_or_load_entity_by_name(scene, index->name);
-		else if(index->index_type == ELF_LIGHT) light = elf_get_or_load_light_by_name(scene, index->name);
-		else if(index->index_type == ELF_SPRITE) sprite = elf_get_or_load_sprite_by_name(scene, index->name);
-		else if(index->index_type == ELF_PARTICLES) particles = elf_get_or_load_particles_by_name(scene, index->name);
-		else if(index->index_type == ELF_SCENE && !scene_read)
+		if(elf_seek_pak_index(scene->pak, index, &reader))
 		{
-			file = fopen(elf_get_pak_file_path(pak), "rb");
-			if(file)
+			*scene_read = ELF_TRUE;
+
+			elf_read_from_pak((char*)&magic, sizeof(int), 1, &reader);
+			if(magic != ELF_SCENE_MAGIC)
 			{
-				scene_read = ELF_TRUE;
-				fseek(file, elf_get_pak_index_offset(index), SEEK_SET);
+				printf("warning: scene header section of \"%s\" is invalid\n", elf_get_pak_file_path(scene->pak));
+				elf_close_pak_reader(&reader);
+				return;
+			}
 
-				fread((char*)&magic, sizeof(int), 1, file);
-				if(magic != ELF_SCENE_MAGIC)
-				{
-					printf("warning: scene header section of \"%s\" is invalid\n", elf_get_pak_file_path(pak));
-					continue;
-				}
+			elf_read_from_pak(name, sizeof(char), 64, &reader);
+			name[63] = '\0';
+			if(scene->name) elf_destroy_string(scene->name);
+			scene->name = elf_create_string(name);
+
+			elf_read_from_pak((char*)ambient_color, sizeof(float), 4, &reader);
+			elf_close_pak_reader(&reader);
 
-				fread(name, sizeof(char), 64, file);
-				if(scene->name) elf_destroy_string(scene->name);
-				scene->name = elf_create_string(name);
+			elf_set_scene_ambient_color(scene, ambient_color[0], ambient_color[1], ambient_color[2], ambient_color[3]);
+		}
+	}
+}
 
-				fread((char*)ambient_color, sizeof(float), 4, file);
+elf_scene* elf_create_scene_from_pak(elf_pak *pak)
+{
+	elf_scene *scene;
+	elf_pak_index *index;
+	unsigned char scene_read;
 
-				elf_set_scene_ambient_color(scene, ambient_color[0], ambient_color[1], ambient_color[2], ambient_color[3]);
+	scene = elf_create_empty_scene_from_pak(pak);
 
-				fclose(file);
-			}
-		}
-		elf_seek_list(pak->indexes, (elf_object*)index);
+	scene_read = ELF_FALSE;
+	for(index = (elf_pak_index*)elf_begin_list(pak->indexes); index;
+		index = (elf_pak_index*)elf_next_in_list(pak->indexes))
+	{
+		elf_load_pak_index_to_scene(scene, index, &scene_read);
 	}
 
 	return scene;
@@ -1367,6 +1706,16 @@ void elf_write_name_to_file(const char *name, FILE *file)
 	fwrite(estr, sizeof(char), empty, file);
 }
 
+void elf_write_block_to_file(const void *data, int size, FILE *file)
+{
+	char padding[16];
+
+	memset(padding, 0x0, sizeof(char)*16);
+
+	fwrite(data, 1, size, file);
+	fwrite(padding, 1, ((size+15)&~15)-size, file);
+}
+
 void elf_write_actor_header(elf_actor *actor, FILE *file)
 {
 	float position[3];
@@ -1587,10 +1936,13 @@ void elf_write_model_to_file(elf_model *model, FILE *file)
 	unsigned char is_tex_coords;
 	unsigned char is_weights_and_boneids;
 	unsigned char junk;
-	int i = 0;
-	short int boneids[4];
+	unsigned int i = 0;
+	int *area_indice_counts;
+	float *weights;
+	float length;
+	int j;
 
-	magic = ELF_MODEL_MAGIC;
+	magic = ELF_MODEL_MAGIC_V2;
 	fwrite((char*)&magic, sizeof(int), 1, file);
 
 	elf_write_name_to_file(model->name, file);
@@ -1601,7 +1953,7 @@ void elf_write_model_to_file(elf_model *model, FILE *file)
 	junk = 0;
 	if(model->tex_coords) is_tex_coords = 1;
 	if(model->weights && model->boneids) is_weights_and_boneids = 1;
-	
+
 	fwrite((char*)&model->vertice_count, sizeof(int), 1, file);
 	fwrite((char*)&model->frame_count, sizeof(int), 1, file);
 	fwrite((char*)&model->indice_count, sizeof(int), 1, file);
@@ -1610,39 +1962,46 @@ void elf_write_model_to_file(elf_model *model, FILE *file)
 	fwrite((char*)&is_tex_coords, sizeof(unsigned char), 1, file);
 	fwrite((char*)&is_weights_and_boneids, sizeof(unsigned char), 1, file);
 	fwrite((char*)&junk, sizeof(unsigned char), 1, file);
+	fwrite((char*)&model->bb_min.x, sizeof(float), 3, file);
+	fwrite((char*)&model->bb_max.x, sizeof(float), 3, file);
 
-	fwrite((char*)gfx_get_vertex_data_buffer(model->vertices), sizeof(float), 3*model->vertice_count, file);
-
-	for(i = 0; i < model->area_count; i++)
-	{
-		fwrite((char*)&model->areas[i].indice_count, sizeof(int), 1, file);
-		if(model->areas[i].indice_count)
-		{
-			fwrite((char*)gfx_get_vertex_data_buffer(model->areas[i].index),
-				sizeof(unsigned int), model->areas[i].indice_count, file);
-		}
-	}
+	area_indice_counts = (int*)malloc(sizeof(int)*model->area_count);
+	for(i = 0; i < model->area_count; i++) area_indice_counts[i] = model->areas[i].indice_count;
+	elf_write_block_to_file(area_indice_counts, sizeof(int)*model->area_count, file);
+	free(area_indice_counts);
 
-	fwrite((char*)gfx_get_vertex_data_buffer(model->normals), sizeof(float), 3*model->vertice_count, file);
+	elf_write_block_to_file(gfx_get_vertex_data_buffer(model->vertices), sizeof(float)*3*model->vertice_count, file);
+	elf_write_block_to_file(model->index, sizeof(unsigned int)*model->indice_count, file);
+	elf_write_block_to_file(gfx_get_vertex_data_buffer(model->normals), sizeof(float)*3*model->vertice_count, file);
 
-	// read tex coords
 	if(is_tex_coords > 0)
-		fwrite((char*)gfx_get_vertex_data_buffer(model->tex_coords), sizeof(float), 2*model->vertice_count, file);
+		elf_write_block_to_file(gfx_get_vertex_data_buffer(model->tex_coords), sizeof(float)*2*model->vertice_count, file);
 
-	// read weights and bone ids
+	// store the weights normalized, the loader takes them as they are
 	if(is_weights_and_boneids > 0)
 	{
-		fwrite((char*)model->weights, sizeof(float), 4*model->vertice_count, file);
+		weights = (float*)malloc(sizeof(float)*4*model->vertice_count);
 
 		for(i = 0; i < model->vertice_count; i++)
 		{
-			boneids[0] = model->boneids[i*4];
-			boneids[1] = model->boneids[i*4+1];
-			boneids[2] = model->boneids[i*4+2];
-			boneids[3] = model->boneids[i*4+3];
-
-			fwrite((char*)boneids, sizeof(short int), 4, file);
+			length = 0.0;
+			for(j = 0; j < 4; j++)
+			{
+				weights[i*4+j] = model->weights[i*4+j];
+				if(weights[i*4+j] > 1.0) weights[i*4+j] = 1.0;
+				if(weights[i*4+j] < 0.0) weights[i*4+j] = 0.0;
+				length += weights[i*4+j];
+			}
+			if(length > 0.0)
+			{
+				for(j = 0; j < 4; j++) weights[i*4+j] /= length;
+			}
 		}
+
+		elf_write_block_to_file(weights, sizeof(float)*4*model->vertice_count, file);
+		elf_write_block_to_file(model->boneids, sizeof(int)*4*model->vertice_count, file);
+
+		free(weights);
 	}
 }
 
@@ -1754,7 +2113,7 @@ void elf_write_texture_to_file(elf_texture *texture, FILE *file)
 	fwrite((char*)texture->data, 1, texture->data_size, file);
 }
 
-void elf_write_resource_index_to_file(elf_resource *resource, unsigned int *offset, FILE *file)
+void elf_write_resource_index_to_file(elf_resource *resource, FILE *file)
 {
 	unsigned char ucval;
 	unsigned int ival;
@@ -1764,57 +2123,152 @@ void elf_write_resource_index_to_file(elf_resource *resource, unsigned int *offs
 
 	elf_write_name_to_file(resource->name, file);
 
-	ival = *offset;
+	// the offset, the compression and the sizes are filled in by elf_write_resources_to_file
+	ival = 0;
+	ucval = ELF_PAK_COMPRESSION_NONE;
 	fwrite((char*)&ival, sizeof(int), 1, file);
+	fwrite((char*)&ucval, sizeof(unsigned char), 1, file);
+	fwrite((char*)&ival, sizeof(unsigned int), 1, file);
+	fwrite((char*)&ival, sizeof(unsigned int), 1, file);
+}
+
+void elf_write_resource_indexes_to_file(elf_list *resources, FILE *file)
+{
+	elf_resource *res;
+
+	for(res = (elf_resource*)elf_begin_list(resources); res;
+		res = (elf_resource*)elf_next_in_list(resources))
+	{
+		elf_write_resource_index_to_file(res, file);
+	}
+}
 
+void elf_write_resource_to_file(elf_resource *resource, FILE *file)
+{
 	switch(resource->type)
 	{
-		case ELF_SCENE: *offset += elf_get_scene_size_bytes((elf_scene*)resource); break;
-		case ELF_SCRIPT: *offset += elf_get_script_size_bytes((elf_script*)resource); break;
-		case ELF_TEXTURE: *offset += elf_get_texture_size_bytes((elf_texture*)resource); break;
-		case ELF_MODEL: *offset += elf_get_model_size_bytes((elf_model*)resource); break;
-		case ELF_MATERIAL: *offset += elf_get_material_size_bytes((elf_material*)resource); break;
-		case ELF_CAMERA: *offset += elf_get_camera_size_bytes((elf_camera*)resource); break;
-		case ELF_ENTITY: *offset += elf_get_entity_size_bytes((elf_entity*)resource); break;
-		case ELF_LIGHT: *offset += elf_get_light_size_bytes((elf_light*)resource); break;
-		case ELF_PARTICLES: *offset += elf_get_particles_size_bytes((elf_particles*)resource); break;
-		case ELF_SPRITE: *offset += elf_get_sprite_size_bytes((elf_sprite*)resource); break;
-		case ELF_ARMATURE: *offset += elf_get_armature_size_bytes((elf_armature*)resource); break;
+		case ELF_SCENE: elf_write_scene_to_file((elf_scene*)resource, file); break;
+		case ELF_SCRIPT: elf_write_script_to_file((elf_script*)resource, file); break;
+		case ELF_TEXTURE: elf_write_texture_to_file((elf_texture*)resource, file); break;
+		case ELF_MODEL: elf_write_model_to_file((elf_model*)resource, file); break;
+		case ELF_MATERIAL: elf_write_material_to_file((elf_material*)resource, file); break;
+		case ELF_CAMERA: elf_write_camera_to_file((elf_camera*)resource, file); break;
+		case ELF_ENTITY: elf_write_entity_to_file((elf_entity*)resource, file); break;
+		case ELF_LIGHT: elf_write_light_to_file((elf_light*)resource, file); break;
+		case ELF_PARTICLES: elf_write_particles_to_file((elf_particles*)resource, file); break;
+		case ELF_SPRITE: elf_write_sprite_to_file((elf_sprite*)resource, file); break;
+		case ELF_ARMATURE: elf_write_armature_to_file((elf_armature*)resource, file); break;
 	}
 }
 
-void elf_write_resource_indexes_to_file(elf_list *resources, unsigned int *offset, FILE *file)
+unsigned char elf_write_compressed_resource_to_file(elf_resource *resource, unsigned int *raw_size, FILE *file)
 {
-	elf_resource *res;
+	FILE *tmp;
+	unsigned char *raw;
+	unsigned char *out;
+	unsigned int out_size;
+	unsigned int pos;
+	unsigned int chunk_raw_size;
+	int chunk_stored_size;
+
+	// the section is written out first, the writers only know how to write to a file
+	tmp = tmpfile();
+	if(!tmp)
+	{
+		*raw_size = ftell(file);
+		elf_write_resource_to_file(resource, file);
+		*raw_size = ftell(file)-*raw_size;
+		return ELF_PAK_COMPRESSION_NONE;
+	}
 
-	for(res = (elf_resource*)elf_begin_list(resources); res;
-		res = (elf_resource*)elf_next_in_list(resources))
+	elf_write_resource_to_file(resource, tmp);
+
+	*raw_size = ftell(tmp);
+	raw = (unsigned char*)malloc(*raw_size+1);
+	fseek(tmp, 0, SEEK_SET);
+	*raw_size = fread(raw, 1, *raw_size, tmp);
+	fclose(tmp);
+
+	// chunks are compressed on their own, so the reader never needs more than one chunk of context
+	out = (unsigned char*)malloc((*raw_size/ELF_PAK_CHUNK_SIZE+1)*(sizeof(unsigned int)*2+elf_get_lz_bound(ELF_PAK_CHUNK_SIZE)));
+	out_size = 0;
+
+	for(pos = 0; pos < *raw_size; pos += chunk_raw_size)
+	{
+		chunk_raw_size = *raw_size-pos;
+		if(chunk_raw_size > ELF_PAK_CHUNK_SIZE) chunk_raw_size = ELF_PAK_CHUNK_SIZE;
+
+		chunk_stored_size = elf_lz_compress(&raw[pos], chunk_raw_size,
+			&out[out_size+sizeof(unsigned int)*2], elf_get_lz_bound(chunk_raw_size));
+		if(chunk_stored_size < 1 || chunk_stored_size >= (int)chunk_raw_size)
+		{
+			memcpy(&out[out_size+sizeof(unsigned int)*2], &raw[pos], chunk_raw_size);
+			chunk_stored_size = chunk_raw_size;
+		}
+
+		memcpy(&out[out_size], &chunk_raw_size, sizeof(unsigned int));
+		memcpy(&out[out_size+sizeof(unsigned int)], &chunk_stored_size, sizeof(unsigned int));
+		out_size += sizeof(unsigned int)*2+chunk_stored_size;
+	}
+
+	// a section that doesn't get any smaller is stored as it is
+	if(out_size < *raw_size)
 	{
-		elf_write_resource_index_to_file(res, offset, file);
+		fwrite(out, 1, out_size, file);
+		free(out);
+		free(raw);
+		return ELF_PAK_COMPRESSION_LZ;
 	}
+
+	fwrite(raw, 1, *raw_size, file);
+	free(out);
+	free(raw);
+	return ELF_PAK_COMPRESSION_NONE;
 }
 
-void elf_write_resources_to_file(elf_list *resources, FILE *file)
+void elf_write_resources_to_file(elf_list *resources, unsigned char compress, unsigned int *index_pos, FILE *file)
 {
 	elf_resource *res;
+	char padding[16];
+	unsigned int offset;
+	unsigned int raw_size;
+	unsigned int stored_size;
+	unsigned char compression;
+	long int end;
+
+	memset(padding, 0x0, sizeof(char)*16);
 
 	for(res = (elf_resource*)elf_begin_list(resources); res;
 		res = (elf_resource*)elf_next_in_list(resources))
 	{
-		switch(res->type)
+		// models start at 16 byte boundaries, their blocks are mapped straight from the file
+		if(res->type == ELF_MODEL) fwrite(padding, 1, (16-ftell(file)%16)%16, file);
+
+		offset = ftell(file);
+
+		if(compress)
 		{
-			case ELF_SCENE: elf_write_scene_to_file((elf_scene*)res, file); break;
-			case ELF_SCRIPT: elf_write_script_to_file((elf_script*)res, file); break;
-			case ELF_TEXTURE: elf_write_texture_to_file((elf_texture*)res, file); break;
-			case ELF_MODEL: elf_write_model_to_file((elf_model*)res, file); break;
-			case ELF_MATERIAL: elf_write_material_to_file((elf_material*)res, file); break;
-			case ELF_CAMERA: elf_write_camera_to_file((elf_camera*)res, file); break;
-			case ELF_ENTITY: elf_write_entity_to_file((elf_entity*)res, file); break;
-			case ELF_LIGHT: elf_write_light_to_file((elf_light*)res, file); break;
-			case ELF_PARTICLES: elf_write_particles_to_file((elf_particles*)res, file); break;
-			case ELF_SPRITE: elf_write_sprite_to_file((elf_sprite*)res, file); break;
-			case ELF_ARMATURE: elf_write_armature_to_file((elf_armature*)res, file); break;
+			compression = elf_write_compressed_resource_to_file(res, &raw_size, file);
+			stored_size = ftell(file)-offset;
 		}
+		else
+		{
+			compression = ELF_PAK_COMPRESSION_NONE;
+			elf_write_resource_to_file(res, file);
+			stored_size = ftell(file)-offset;
+			raw_size = stored_size;
+		}
+
+		// now that the section is written, fill in its index entry
+		end = ftell(file);
+		fseek(file, *index_pos+sizeof(unsigned char)+sizeof(char)*64, SEEK_SET);
+		fwrite((char*)&offset, sizeof(unsigned int), 1, file);
+		fwrite((char*)&compression, sizeof(unsigned char), 1, file);
+		fwrite((char*)&raw_size, sizeof(unsigned int), 1, file);
+		fwrite((char*)&stored_size, sizeof(unsigned int), 1, file);
+		fseek(file, end, SEEK_SET);
+
+		*index_pos += sizeof(unsigned char)+sizeof(char)*64+sizeof(unsigned int)*3+sizeof(unsigned char);
 	}
 }
 
@@ -1834,10 +2288,11 @@ void elf_add_texture_for_saving(elf_list *textures, elf_texture *texture)
 	}
 }
 
-unsigned char elf_save_scene_to_pak(elf_scene *scene, const char *file_path)
+unsigned char elf_save_scene_to_pak(elf_scene *scene, const char *file_path, unsigned char compress)
 {
-	unsigned int offset;
+	unsigned int index_pos;
 	int ival;
+	int i;
 	
 	FILE *file;
 
@@ -1899,9 +2354,9 @@ unsigned char elf_save_scene_to_pak(elf_scene *scene, const char *file_path)
 		elf_append_to_list(cameras, (elf_object*)cam);
 	}
 
-	for(ent = (elf_entity*)elf_begin_list(scene->entities); ent;
-		ent = (elf_entity*)elf_next_in_list(scene->entities))
+	for(i = 0; i < elf_get_array_length(scene->entities); i++)
 	{
+		ent = (elf_entity*)elf_get_item_from_array(scene->entities, i);
 		if(ent->script && !elf_get_resource_by_id(scripts, ent->script->id))
 		{
 			elf_set_unique_name_for_resource(scripts, (elf_resource*)ent->script);
@@ -2034,26 +2489,7 @@ unsigned char elf_save_scene_to_pak(elf_scene *scene, const char *file_path)
 		return ELF_FALSE;
 	}
 
-	offset = 0;
-	offset += sizeof(unsigned char);	// index type
-	offset += sizeof(char)*64;	// index name
-	offset += sizeof(int);	// index offset
-	offset *= elf_get_list_length(scenes) +
-		elf_get_list_length(scripts) +
-		elf_get_list_length(textures) +
-		elf_get_list_length(materials) +
-		elf_get_list_length(models) +
-		elf_get_list_length(cameras) +
-		elf_get_list_length(entities) +
-		elf_get_list_length(lights) +
-		elf_get_list_length(armatures) +
-		elf_get_list_length(particles) +
-		elf_get_list_length(sprites);
-
-	offset += sizeof(int);	// magic
-	offset += sizeof(int);	// number of indexes
-
-	ival = 179532100;
+	ival = ELF_PAK_MAGIC_V3;
 
 	fwrite((char*)&ival, sizeof(int), 1, file);	// magic
 
@@ -2071,29 +2507,32 @@ unsigned char elf_save_scene_to_pak(elf_scene *scene, const char *file_path)
 
 	fwrite((char*)&ival, sizeof(int), 1, file);	// index count
 
-	elf_write_resource_indexes_to_file(scenes, &offset, file);
-	elf_write_resource_indexes_to_file(scripts, &offset, file);
-	elf_write_resource_indexes_to_file(textures, &offset, file);
-	elf_write_resource_indexes_to_file(materials, &offset, file);
-	elf_write_resource_indexes_to_file(models, &offset, file);
-	elf_write_resource_indexes_to_file(cameras, &offset, file);
-	elf_write_resource_indexes_to_file(entities, &offset, file);
-	elf_write_resource_indexes_to_file(lights, &offset, file);
-	elf_write_resource_indexes_to_file(armatures, &offset, file);
-	elf_write_resource_indexes_to_file(particles, &offset, file);
-	elf_write_resource_indexes_to_file(sprites, &offset, file);
-
-	elf_write_resources_to_file(scenes, file);
-	elf_write_resources_to_file(scripts, file);
-	elf_write_resources_to_file(textures, file);
-	elf_write_resources_to_file(materials, file);
-	elf_write_resources_to_file(models, file);
-	elf_write_resources_to_file(cameras, file);
-	elf_write_resources_to_file(entities, file);
-	elf_write_resources_to_file(lights, file);
-	elf_write_resources_to_file(armatures, file);
-	elf_write_resources_to_file(particles, file);
-	elf_write_resources_to_file(sprites, file);
+	index_pos = ftell(file);
+
+	elf_write_resource_indexes_to_file(scenes, file);
+	elf_write_resource_indexes_to_file(scripts, file);
+	elf_write_resource_indexes_to_file(textures, file);
+	elf_write_resource_indexes_to_file(materials, file);
+	elf_write_resource_indexes_to_file(models, file);
+	elf_write_resource_indexes_to_file(cameras, file);
+	elf_write_resource_indexes_to_file(entities, file);
+	elf_write_resource_indexes_to_file(lights, file);
+	elf_write_resource_indexes_to_file(armatures, file);
+	elf_write_resource_indexes_to_file(particles, file);
+	elf_write_resource_indexes_to_file(sprites, file);
+
+	// the resources are written in the same order as the indexes
+	elf_write_resources_to_file(scenes, compress, &index_pos, file);
+	elf_write_resources_to_file(scripts, compress, &index_pos, file);
+	elf_write_resources_to_file(textures, compress, &index_pos, file);
+	elf_write_resources_to_file(materials, compress, &index_pos, file);
+	elf_write_resources_to_file(models, compress, &index_pos, file);
+	elf_write_resources_to_file(cameras, compress, &index_pos, file);
+	elf_write_resources_to_file(entities, compress, &index_pos, file);
+	elf_write_resources_to_file(lights, compress, &index_pos, file);
+	elf_write_resources_to_file(armatures, compress, &index_pos, file);
+	elf_write_resources_to_file(particles, compress, &index_pos, file);
+	elf_write_resources_to_file(sprites, compress, &index_pos, file);
 
 	fclose(file);
 
@@ -2112,3 +2551,86 @@ unsigned char elf_save_scene_to_pak(elf_scene *scene, const char *file_path)
 	return ELF_TRUE;
 }
 
+double elf_time_pak_load(const char *file_path, int *file_size, int *raw_size)
+{
+	elf_pak *pak;
+	elf_pak_index *index;
+	elf_pak_reader reader;
+	elf_decoded_texture decoded_texture;
+	elf_decoded_model decoded_model;
+	double start;
+
+	start = elf_get_time();
+
+	pak = elf_create_pak_from_file(file_path);
+	if(!pak) return 0.0;
+
+	*file_size = pak->data_size;
+	*raw_size = 0;
+
+	// the same work the scene loader threads do, without the uploads
+	for(index = (elf_pak_index*)elf_begin_list(pak->indexes); index;
+		index = (elf_pak_index*)elf_next_in_list(pak->indexes))
+	{
+		if(!elf_seek_pak_index(pak, index, &reader)) continue;
+
+		*raw_size += index->compression != ELF_PAK_COMPRESSION_NONE ? index->raw_size : index->stored_size;
+
+		if(index->index_type == ELF_TEXTURE)
+		{
+			elf_decode_texture_from_pak(&reader, &decoded_texture);
+			elf_clear_decoded_texture(&decoded_texture);
+		}
+		else if(index->index_type == ELF_MODEL)
+		{
+			elf_decode_model_from_pak(&reader, &decoded_model);
+			elf_clear_decoded_model(&decoded_model);
+		}
+
+		elf_close_pak_reader(&reader);
+	}
+
+	elf_destroy_pak(pak);
+
+	return elf_get_time()-start;
+}
+
+void elf_benchmark_pak(const char *file_path)
+{
+	elf_scene *scene;
+	char *paths[2];
+	int file_size;
+	int raw_size;
+	double time;
+	int i, j;
+
+	scene = elf_create_scene_from_file(file_path);
+	if(!scene) return;
+
+	elf_inc_ref((elf_object*)scene);
+
+	paths[0] = elf_merge_strings(file_path, ".raw.tmp");
+	paths[1] = elf_merge_strings(file_path, ".lz.tmp");
+
+	elf_save_scene_to_pak(scene, paths[0], ELF_FALSE);
+	elf_save_scene_to_pak(scene, paths[1], ELF_TRUE);
+
+	elf_dec_ref((elf_object*)scene);
+
+	// the files were just written, so this measures decompression and decoding out of the page cache
+	for(i = 0; i < 2; i++)
+	{
+		time = 0.0;
+		file_size = 0;
+		raw_size = 0;
+
+		for(j = 0; j < 5; j++) time += elf_time_pak_load(paths[i], &file_size, &raw_size);
+
+		elf_write_to_log("pak benchmark: %s, %d bytes on disk, %d bytes of sections, %f ms per load\n",
+			i == 0 ? "uncompressed" : "compressed", file_size, raw_size, time/5.0*1000.0);
+
+		remove(paths[i]);
+		elf_destroy_string(paths[i]);
+	}
+}
+
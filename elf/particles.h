@@ -1,22 +1,38 @@
 
-elf_particle* elf_create_particle()
+void elf_alloc_particle_pool(elf_particles *particles)
 {
-	elf_particle *particle;
+	float **streams[16];
+	int stride;
+	int i;
 
-	particle = (elf_particle*)malloc(sizeof(elf_particle));
-	memset(particle, 0x0, sizeof(elf_particle));
-	particle->type = ELF_PARTICLE;
+	if(particles->particle_data) free(particles->particle_data);
 
-	elf_inc_obj_count();
+	streams[0] = &particles->position[0];
+	streams[1] = &particles->position[1];
+	streams[2] = &particles->position[2];
+	streams[3] = &particles->velocity[0];
+	streams[4] = &particles->velocity[1];
+	streams[5] = &particles->velocity[2];
+	streams[6] = &particles->color[0];
+	streams[7] = &particles->color[1];
+	streams[8] = &particles->color[2];
+	streams[9] = &particles->color[3];
+	streams[10] = &particles->size;
+	streams[11] = &particles->size_growth;
+	streams[12] = &particles->rotation;
+	streams[13] = &particles->rotation_growth;
+	streams[14] = &particles->life_span;
+	streams[15] = &particles->fade_speed;
 
-	return particle;
-}
+	// every attribute array is padded to a multiple of four so the sse loops can run over the end
+	stride = (particles->max_count+3)&~3;
 
-void elf_destroy_particle(elf_particle *particle)
-{
-	free(particle);
+	particles->particle_data = (float*)malloc(sizeof(float)*stride*16);
+	memset(particles->particle_data, 0x0, sizeof(float)*stride*16);
 
-	elf_dec_obj_count();
+	for(i = 0; i < 16; i++) *streams[i] = particles->particle_data+stride*i;
+
+	particles->particle_count = 0;
 }
 
 elf_particles* elf_create_particles(const char *name, int max_count)
@@ -35,8 +51,8 @@ elf_particles* elf_create_particles(const char *name, int max_count)
 	elf_init_actor((elf_actor*)particles, ELF_FALSE);
 
 	particles->max_count = max_count;
-	particles->particles = elf_create_list();
-	elf_inc_ref((elf_object*)particles->particles);
+	elf_alloc_particle_pool(particles);
+	elf_set_particles_random_seed(particles, elf_random_int());
 
 	particles->draw_mode = ELF_ADD;
 	particles->spawn_delay = 0.02;
@@ -61,7 +77,7 @@ elf_particles* elf_create_particles(const char *name, int max_count)
 	particles->vertices = gfx_create_vertex_data(3*6*max_count, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
 	particles->tex_coords = gfx_create_vertex_data(2*6*max_count, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
 	particles->colors = gfx_create_vertex_data(4*6*max_count,  GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
-	particles->vertex_array = gfx_create_vertex_array(GFX_FALSE);
+	particles->vertex_array = gfx_create_vertex_array(GFX_TRUE);
 	gfx_set_vertex_array_data(particles->vertex_array, GFX_VERTEX, particles->vertices);
 	gfx_set_vertex_array_data(particles->vertex_array, GFX_TEX_COORD, particles->tex_coords);
 	gfx_set_vertex_array_data(particles->vertex_array, GFX_COLOR, particles->colors);
@@ -119,6 +135,10 @@ elf_particles* elf_create_particles(const char *name, int max_count)
 		color_buffer[k+23] = 1.0;
 	}
 
+	// the vertex data lives on the gpu now, send the filled buffers over
+	gfx_update_vertex_data(particles->tex_coords);
+	gfx_update_vertex_data(particles->colors);
+
 	if(name) particles->name = elf_create_string(name);
 
 	particles->id = ++gen->particles_id_counter;
@@ -128,58 +148,156 @@ elf_particles* elf_create_particles(const char *name, int max_count)
 	return particles;
 }
 
-void elf_init_new_particle(elf_particles *particles, elf_particle *particle)
+float elf_get_particles_random(elf_particles *particles, float min, float max)
+{
+	unsigned int x;
+
+	// xorshift with a state per emitter, so the emitters can be stepped on any thread and
+	// still spawn the same particles for the same seed
+	x = particles->random_state;
+	x ^= x<<13;
+	x ^= x>>17;
+	x ^= x<<5;
+	particles->random_state = x;
+
+	return min+(max-min)*((float)(x>>8)/16777216.0);
+}
+
+int elf_get_particles_random_index(elf_particles *particles, int count)
+{
+	int idx;
+
+	idx = (int)elf_get_particles_random(particles, 0.0, (float)count);
+	if(idx > count-1) idx = count-1;
+
+	return idx;
+}
+
+void elf_init_new_particle(elf_particles *particles, int idx)
 {
-	static int num;
-	static float *vertices;
-	static elf_vec4f orient;
-	static elf_vec3f local_pos;
-	static elf_vec3f result;
+	int num;
+	float *vertices;
+	elf_vec4f orient;
+	elf_vec3f local_pos;
+	elf_vec3f result;
+	elf_vec3f position;
 
-	particle->life_span = elf_random_float_range(particles->life_span_min, particles->life_span_max);
-	particle->fade_speed = elf_random_float_range(particles->fade_speed_min, particles->fade_speed_max);
-	particle->size = elf_random_float_range(particles->size_min, particles->size_max);
-	particle->size_growth = elf_random_float_range(particles->size_growth_min, particles->size_growth_max);
-	particle->rotation = elf_random_float_range(particles->rotation_min, particles->rotation_max);
-	particle->rotation_growth = elf_random_float_range(particles->rotation_growth_min, particles->rotation_growth_max);
+	particles->life_span[idx] = elf_get_particles_random(particles, particles->life_span_min, particles->life_span_max);
+	particles->fade_speed[idx] = elf_get_particles_random(particles, particles->fade_speed_min, particles->fade_speed_max);
+	particles->size[idx] = elf_get_particles_random(particles, particles->size_min, particles->size_max);
+	particles->size_growth[idx] = elf_get_particles_random(particles, particles->size_growth_min, particles->size_growth_max);
+	particles->rotation[idx] = elf_get_particles_random(particles, particles->rotation_min, particles->rotation_max);
+	particles->rotation_growth[idx] = elf_get_particles_random(particles, particles->rotation_growth_min, particles->rotation_growth_max);
 	if(particles->model && elf_get_model_vertice_count(particles->model) > 0)
 	{
-		elf_get_actor_position_((elf_actor*)particles, &particle->position.x);
-		num = elf_random_int_range(0, elf_get_model_vertice_count(particles->model));
+		elf_get_actor_position_((elf_actor*)particles, &position.x);
+		num = elf_get_particles_random_index(particles, elf_get_model_vertice_count(particles->model));
 		vertices = elf_get_model_vertices(particles->model);
-		particle->position.x += vertices[3*num];
-		particle->position.y += vertices[3*num+1];
-		particle->position.z += vertices[3*num+2];
+		position.x += vertices[3*num];
+		position.y += vertices[3*num+1];
+		position.z += vertices[3*num+2];
 	}
 	else if(particles->entity && particles->entity->model && particles->entity->vertices &&
 		elf_get_model_vertice_count(particles->entity->model) > 0)
 	{
-		elf_get_actor_position_((elf_actor*)particles->entity, &particle->position.x);
-		num = elf_random_int_range(0, elf_get_model_vertice_count(particles->entity->model));
+		elf_get_actor_position_((elf_actor*)particles->entity, &position.x);
+		num = elf_get_particles_random_index(particles, elf_get_model_vertice_count(particles->entity->model));
 		vertices = gfx_get_vertex_data_buffer(particles->entity->vertices);
 		local_pos.x = vertices[3*num];
 		local_pos.y = vertices[3*num+1];
 		local_pos.z = vertices[3*num+2];
 		elf_get_actor_orientation_((elf_actor*)particles->entity, &orient.x);
 		gfx_mul_qua_vec(&orient.x, &local_pos.x, &result.x);
-		particle->position.x += result.x;
-		particle->position.y += result.y;
-		particle->position.z += result.z;
+		position.x += result.x;
+		position.y += result.y;
+		position.z += result.z;
 	}
 	else
 	{
-		elf_get_actor_position_((elf_actor*)particles, &particle->position.x);
-		particle->position.x += elf_random_float_range(particles->position_min.x, particles->position_max.x);
-		particle->position.y += elf_random_float_range(particles->position_min.y, particles->position_max.y);
-		particle->position.z += elf_random_float_range(particles->position_min.z, particles->position_max.z);
+		elf_get_actor_position_((elf_actor*)particles, &position.x);
+		position.x += elf_get_particles_random(particles, particles->position_min.x, particles->position_max.x);
+		position.y += elf_get_particles_random(particles, particles->position_min.y, particles->position_max.y);
+		position.z += elf_get_particles_random(particles, particles->position_min.z, particles->position_max.z);
+	}
+	particles->position[0][idx] = position.x;
+	particles->position[1][idx] = position.y;
+	particles->position[2][idx] = position.z;
+	particles->velocity[0][idx] = elf_get_particles_random(particles, particles->velocity_min.x, particles->velocity_max.x);
+	particles->velocity[1][idx] = elf_get_particles_random(particles, particles->velocity_min.y, particles->velocity_max.y);
+	particles->velocity[2][idx] = elf_get_particles_random(particles, particles->velocity_min.z, particles->velocity_max.z);
+	particles->color[0][idx] = elf_get_particles_random(particles, particles->color_min.r, particles->color_max.r);
+	particles->color[1][idx] = elf_get_particles_random(particles, particles->color_min.g, particles->color_max.g);
+	particles->color[2][idx] = elf_get_particles_random(particles, particles->color_min.b, particles->color_max.b);
+	particles->color[3][idx] = elf_get_particles_random(particles, particles->color_min.a, particles->color_max.a);
+}
+
+void elf_swap_remove_particle(elf_particles *particles, int idx)
+{
+	int last;
+	int i;
+
+	last = --particles->particle_count;
+	if(idx == last) return;
+
+	for(i = 0; i < 3; i++)
+	{
+		particles->position[i][idx] = particles->position[i][last];
+		particles->velocity[i][idx] = particles->velocity[i][last];
+	}
+	for(i = 0; i < 4; i++) particles->color[i][idx] = particles->color[i][last];
+	particles->size[idx] = particles->size[last];
+	particles->size_growth[idx] = particles->size_growth[last];
+	particles->rotation[idx] = particles->rotation[last];
+	particles->rotation_growth[idx] = particles->rotation_growth[last];
+	particles->life_span[idx] = particles->life_span[last];
+	particles->fade_speed[idx] = particles->fade_speed[last];
+}
+
+void elf_integrate_particles(elf_particles *particles, float sync)
+{
+	int i;
+#ifdef ELF_SSE
+	__m128 dt, vx, vy, vz;
+
+	dt = _mm_set1_ps(sync);
+
+	// the pool is padded, the last group may step a few dead particles too
+	for(i = 0; i < particles->particle_count; i += 4)
+	{
+		_mm_storeu_ps(particles->size+i, _mm_add_ps(_mm_loadu_ps(particles->size+i),
+			_mm_mul_ps(_mm_loadu_ps(particles->size_growth+i), dt)));
+		_mm_storeu_ps(particles->rotation+i, _mm_add_ps(_mm_loadu_ps(particles->rotation+i),
+			_mm_mul_ps(_mm_loadu_ps(particles->rotation_growth+i), dt)));
+
+		vx = _mm_loadu_ps(particles->velocity[0]+i);
+		vy = _mm_loadu_ps(particles->velocity[1]+i);
+		vz = _mm_loadu_ps(particles->velocity[2]+i);
+		_mm_storeu_ps(particles->position[0]+i, _mm_add_ps(_mm_loadu_ps(particles->position[0]+i), _mm_mul_ps(vx, dt)));
+		_mm_storeu_ps(particles->position[1]+i, _mm_add_ps(_mm_loadu_ps(particles->position[1]+i), _mm_mul_ps(vy, dt)));
+		_mm_storeu_ps(particles->position[2]+i, _mm_add_ps(_mm_loadu_ps(particles->position[2]+i), _mm_mul_ps(vz, dt)));
+		_mm_storeu_ps(particles->velocity[0]+i, _mm_add_ps(vx, _mm_set1_ps(particles->gravity.x*sync)));
+		_mm_storeu_ps(particles->velocity[1]+i, _mm_add_ps(vy, _mm_set1_ps(particles->gravity.y*sync)));
+		_mm_storeu_ps(particles->velocity[2]+i, _mm_add_ps(vz, _mm_set1_ps(particles->gravity.z*sync)));
+
+		_mm_storeu_ps(particles->life_span+i, _mm_sub_ps(_mm_loadu_ps(particles->life_span+i), dt));
+		_mm_storeu_ps(particles->color[3]+i, _mm_sub_ps(_mm_loadu_ps(particles->color[3]+i),
+			_mm_mul_ps(_mm_loadu_ps(particles->fade_speed+i), dt)));
+	}
+#else
+	for(i = 0; i < particles->particle_count; i++)
+	{
+		particles->size[i] += particles->size_growth[i]*sync;
+		particles->rotation[i] += particles->rotation_growth[i]*sync;
+		particles->position[0][i] += particles->velocity[0][i]*sync;
+		particles->position[1][i] += particles->velocity[1][i]*sync;
+		particles->position[2][i] += particles->velocity[2][i]*sync;
+		particles->velocity[0][i] += particles->gravity.x*sync;
+		particles->velocity[1][i] += particles->gravity.y*sync;
+		particles->velocity[2][i] += particles->gravity.z*sync;
+		particles->life_span[i] -= sync;
+		particles->color[3][i] -= particles->fade_speed[i]*sync;
 	}
-	particle->velocity.x = elf_random_float_range(particles->velocity_min.x, particles->velocity_max.x);
-	particle->velocity.y = elf_random_float_range(particles->velocity_min.y, particles->velocity_max.y);
-	particle->velocity.z = elf_random_float_range(particles->velocity_min.z, particles->velocity_max.z);
-	particle->color.r = elf_random_float_range(particles->color_min.r, particles->color_max.r);
-	particle->color.g = elf_random_float_range(particles->color_min.g, particles->color_max.g);
-	particle->color.b = elf_random_float_range(particles->color_min.b, particles->color_max.b);
-	particle->color.a = elf_random_float_range(particles->color_min.a, particles->color_max.a);
+#endif
 }
 
 void elf_calc_particles_aabb(elf_particles *particles)
@@ -217,73 +335,58 @@ void elf_particles_post_draw(elf_particles *particles)
 	elf_actor_post_draw((elf_actor*)particles);
 }
 
-void elf_update_particles(elf_particles *particles, float sync)
+void elf_update_particles(elf_particles *particles)
+{
+	elf_sync_actor_transform((elf_actor*)particles);
+	elf_update_actor((elf_actor*)particles);
+}
+
+void elf_simulate_particles(elf_particles *particles, float sync)
 {
-	elf_particle *particle;
 	int spawn_count;
 	int i;
 
-	elf_update_actor((elf_actor*)particles);
-
 	// update, remove and spawn particles
 	particles->cur_time += sync;
 	spawn_count = (int)(particles->cur_time/particles->spawn_delay);
-	if(elf_get_list_length(particles->particles)+spawn_count > particles->max_count)
-		spawn_count -= (elf_get_list_length(particles->particles)+spawn_count)-particles->max_count;
+	if(particles->particle_count+spawn_count > particles->max_count)
+		spawn_count -= (particles->particle_count+spawn_count)-particles->max_count;
 	if(spawn_count > 0) particles->cur_time -= particles->spawn_delay*spawn_count;
 
-	for(particle = (elf_particle*)elf_begin_list(particles->particles); particle;
-		particle = (elf_particle*)elf_next_in_list(particles->particles))
+	elf_integrate_particles(particles, sync);
+
+	// dead particles are respawned in place while there is something to spawn, the rest
+	// are replaced by the last particle of the pool
+	for(i = 0; i < particles->particle_count; i++)
 	{
-		if(particle->life_span < 0.0 || particle->color.a < 0.0)
+		if(particles->life_span[i] >= 0.0 && particles->color[3][i] >= 0.0) continue;
+
+		if(spawn_count > 0 && particles->spawn)
 		{
-			if(spawn_count > 0 && particles->spawn)
-			{
-				elf_init_new_particle(particles, particle);
-				spawn_count--;
-			}
-			else
-			{
-				elf_remove_from_list(particles->particles, (elf_object*)particle);
-			}
-			continue;
+			elf_init_new_particle(particles, i);
+			spawn_count--;
+		}
+		else
+		{
+			elf_swap_remove_particle(particles, i);
+			i--;
 		}
-		particle->size += particle->size_growth*sync;
-		particle->rotation += particle->rotation_growth*sync;
-		particle->position.x += particle->velocity.x*sync;
-		particle->position.y += particle->velocity.y*sync;
-		particle->position.z += particle->velocity.z*sync;
-		particle->life_span -= sync;
-		particle->velocity.x += particles->gravity.x*sync;
-		particle->velocity.y += particles->gravity.y*sync;
-		particle->velocity.z += particles->gravity.z*sync;
-		particle->color.a -= particle->fade_speed*sync;
 	}
 
 	// spawn particles
 	if(particles->spawn)
 	{
-		for(i = 0; i < spawn_count; i++)
-		{
-			particle = elf_create_particle();
-
-			elf_init_new_particle(particles, particle);
-
-			elf_append_to_list(particles->particles, (elf_object*)particle);
-		}
+		for(i = 0; i < spawn_count && particles->particle_count < particles->max_count; i++)
+			elf_init_new_particle(particles, particles->particle_count++);
 	}
 }
 
-void elf_draw_particles(elf_particles *particles, elf_camera *camera, gfx_shader_params *shader_params)
+void elf_write_particles_vertices(elf_particles *particles, int first, int last,
+	float *inv_camera_pos, float *inv_camera_orient)
 {
-	elf_particle *particle;
 	int i, j;
 	float offset;
 	float pos[3];
-	float camera_pos[3];
-	float camera_orient[4];
-	float inv_camera_pos[3];
-	float inv_camera_orient[4];
 	float particle_offset[3];
 	elf_color real_color;
 	float sin_x1;
@@ -301,28 +404,21 @@ void elf_draw_particles(elf_particles *particles, elf_camera *camera, gfx_shader
 	vertex_buffer = gfx_get_vertex_data_buffer(particles->vertices);
 	color_buffer = gfx_get_vertex_data_buffer(particles->colors);
 
-	elf_get_actor_position_((elf_actor*)camera, camera_pos);
-	elf_get_actor_orientation_((elf_actor*)camera, camera_orient);
-
-	inv_camera_pos[0] = -camera_pos[0]; inv_camera_pos[1] = -camera_pos[1]; inv_camera_pos[2] = -camera_pos[2];
-	gfx_qua_get_inverse(camera_orient, inv_camera_orient);
-
 	// rotating the particles takes up a lot of processing power, so see if it is really
 	// necessary before going ahead and doing it
 	if(elf_about_zero(particles->rotation_min) && elf_about_zero(particles->rotation_max) &&
 		elf_about_zero(particles->rotation_growth_min) && elf_about_zero(particles->rotation_growth_max))
 	{
-		for(i = 0, j = 0, particle = (elf_particle*)elf_begin_list(particles->particles); particle;
-			particle = (elf_particle*)elf_next_in_list(particles->particles), i++)
+		for(i = first; i < last; i++)
 		{
-			particle_offset[0] = inv_camera_pos[0]+particle->position.x;
-			particle_offset[1] = inv_camera_pos[1]+particle->position.y;
-			particle_offset[2] = inv_camera_pos[2]+particle->position.z;
+			particle_offset[0] = inv_camera_pos[0]+particles->position[0][i];
+			particle_offset[1] = inv_camera_pos[1]+particles->position[1][i];
+			particle_offset[2] = inv_camera_pos[2]+particles->position[2][i];
 
 			gfx_mul_qua_vec(inv_camera_orient, particle_offset, pos);
 
 			j = i*18;
-			offset = particle->size*0.5;
+			offset = particles->size[i]*0.5;
 
 			vertex_buffer[j] = pos[0]-offset;
 			vertex_buffer[j+1] = pos[1]+offset;
@@ -345,7 +441,10 @@ void elf_draw_particles(elf_particles *particles, elf_camera *camera, gfx_shader
 			vertex_buffer[j+17] = pos[2];
 
 			j = i*24;
-			real_color = particle->color;
+			real_color.r = particles->color[0][i];
+			real_color.g = particles->color[1][i];
+			real_color.b = particles->color[2][i];
+			real_color.a = particles->color[3][i];
 			if(particles->draw_mode == ELF_ADD)
 			{
 				real_color.r *= real_color.a;
@@ -373,36 +472,35 @@ void elf_draw_particles(elf_particles *particles, elf_camera *camera, gfx_shader
 			color_buffer[j+16] = real_color.r;
 			color_buffer[j+17] = real_color.g;
 			color_buffer[j+18] = real_color.b;
-			color_buffer[j+19] = particle->color.a;
+			color_buffer[j+19] = particles->color[3][i];
 			color_buffer[j+20] = real_color.r;
 			color_buffer[j+21] = real_color.g;
 			color_buffer[j+22] = real_color.b;
-			color_buffer[j+23] = particle->color.a;
+			color_buffer[j+23] = particles->color[3][i];
 		}
 	}
 	else
 	{
-		for(i = 0, j = 0, particle = (elf_particle*)elf_begin_list(particles->particles); particle;
-			particle = (elf_particle*)elf_next_in_list(particles->particles), i++)
+		for(i = first; i < last; i++)
 		{
-
-			particle_offset[0] = inv_camera_pos[0]+particle->position.x;
-			particle_offset[1] = inv_camera_pos[1]+particle->position.y;
-			particle_offset[2] = inv_camera_pos[2]+particle->position.z;
+			particle_offset[0] = inv_camera_pos[0]+particles->position[0][i];
+			particle_offset[1] = inv_camera_pos[1]+particles->position[1][i];
+			particle_offset[2] = inv_camera_pos[2]+particles->position[2][i];
 
 			gfx_mul_qua_vec(inv_camera_orient, particle_offset, pos);
 
 			j = i*18;
-			offset = particle->size*0.5;
+			offset = particles->size[i]*0.5;
 			radius = offset/0.707107;
-			sin_x1 = sin(GFX_PI_DIV_180*(45.0+particle->rotation));
-			cos_y1 = cos(GFX_PI_DIV_180*(45.0+particle->rotation));
-			sin_x2 = sin(GFX_PI_DIV_180*(135.0+particle->rotation));
-			cos_y2 = cos(GFX_PI_DIV_180*(135.0+particle->rotation));
-			sin_x3 = sin(GFX_PI_DIV_180*(225.0+particle->rotation));
-			cos_y3 = cos(GFX_PI_DIV_180*(225.0+particle->rotation));
-			sin_x4 = sin(GFX_PI_DIV_180*(315.0+particle->rotation));
-			cos_y4 = cos(GFX_PI_DIV_180*(315.0+particle->rotation));
+			// the other corners are 90 degrees apart, so one sin and cos is enough
+			sin_x1 = sin(GFX_PI_DIV_180*(45.0+particles->rotation[i]));
+			cos_y1 = cos(GFX_PI_DIV_180*(45.0+particles->rotation[i]));
+			sin_x2 = cos_y1;
+			cos_y2 = -sin_x1;
+			sin_x3 = -sin_x1;
+			cos_y3 = -cos_y1;
+			sin_x4 = -cos_y1;
+			cos_y4 = sin_x1;
 
 			vertex_buffer[j] = pos[0]+radius*sin_x4;
 			vertex_buffer[j+1] = pos[1]+radius*cos_y4;
@@ -425,7 +523,10 @@ void elf_draw_particles(elf_particles *particles, elf_camera *camera, gfx_shader
 			vertex_buffer[j+17] = pos[2];
 
 			j = i*24;
-			real_color = particle->color;
+			real_color.r = particles->color[0][i];
+			real_color.g = particles->color[1][i];
+			real_color.b = particles->color[2][i];
+			real_color.a = particles->color[3][i];
 			if(particles->draw_mode == ELF_ADD)
 			{
 				real_color.r *= real_color.a;
@@ -453,16 +554,23 @@ void elf_draw_particles(elf_particles *particles, elf_camera *camera, gfx_shader
 			color_buffer[j+16] = real_color.r;
 			color_buffer[j+17] = real_color.g;
 			color_buffer[j+18] = real_color.b;
-			color_buffer[j+19] = particle->color.a;
+			color_buffer[j+19] = particles->color[3][i];
 			color_buffer[j+20] = real_color.r;
 			color_buffer[j+21] = real_color.g;
 			color_buffer[j+22] = real_color.b;
-			color_buffer[j+23] = particle->color.a;
+			color_buffer[j+23] = particles->color[3][i];
 		}
 	}
+}
 
-	if(elf_get_list_length(particles->particles) > 0)
+void elf_draw_particles(elf_particles *particles, gfx_shader_params *shader_params)
+{
+	if(particles->particle_count > 0)
 	{
+		// the quads were written by elf_write_particles_vertices, only the live ones are sent
+		gfx_update_vertex_data_sub_data(particles->vertices, 0, sizeof(float)*18*particles->particle_count);
+		gfx_update_vertex_data_sub_data(particles->colors, 0, sizeof(float)*24*particles->particle_count);
+
 		shader_params->render_params.blend_mode = particles->draw_mode;
 		shader_params->render_params.vertex_color = GFX_TRUE;
 		gfx_matrix4_set_identity(shader_params->modelview_matrix);
@@ -471,7 +579,7 @@ void elf_draw_particles(elf_particles *particles, elf_camera *camera, gfx_shader
 		shader_params->texture_params->type = GFX_COLOR_MAP;
 		gfx_set_shader_params(shader_params);
 
-		gfx_draw_vertex_array(particles->vertex_array, 6*elf_get_list_length(particles->particles), GFX_TRIANGLES);
+		gfx_draw_vertex_array(particles->vertex_array, 6*particles->particle_count, GFX_TRIANGLES);
 	}
 }
 
@@ -479,7 +587,7 @@ void elf_destroy_particles(elf_particles *particles)
 {
 	elf_clean_actor((elf_actor*)particles);
 
-	elf_dec_ref((elf_object*)particles->particles);
+	free(particles->particle_data);
 	if(particles->texture) elf_dec_ref((elf_object*)particles->texture);
 	if(particles->model) elf_dec_ref((elf_object*)particles->model);
 	if(particles->entity) elf_dec_ref((elf_object*)particles->entity);
@@ -514,9 +622,7 @@ void elf_set_particles_max_count(elf_particles *particles, int max_count)
 
 	particles->max_count = max_count;
 
-	elf_dec_ref((elf_object*)particles->particles);
-	particles->particles = elf_create_list();
-	elf_inc_ref((elf_object*)particles->particles);
+	elf_alloc_particle_pool(particles);
 
 	gfx_dec_ref((gfx_object*)particles->vertices);
 	gfx_dec_ref((gfx_object*)particles->tex_coords);
@@ -526,7 +632,7 @@ void elf_set_particles_max_count(elf_particles *particles, int max_count)
 	particles->vertices = gfx_create_vertex_data(3*6*max_count, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
 	particles->tex_coords = gfx_create_vertex_data(2*6*max_count, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
 	particles->colors = gfx_create_vertex_data(4*6*max_count,  GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
-	particles->vertex_array = gfx_create_vertex_array(GFX_FALSE);
+	particles->vertex_array = gfx_create_vertex_array(GFX_TRUE);
 	gfx_set_vertex_array_data(particles->vertex_array, GFX_VERTEX, particles->vertices);
 	gfx_set_vertex_array_data(particles->vertex_array, GFX_TEX_COORD, particles->tex_coords);
 	gfx_set_vertex_array_data(particles->vertex_array, GFX_COLOR, particles->colors);
@@ -583,6 +689,10 @@ void elf_set_particles_max_count(elf_particles *particles, int max_count)
 		color_buffer[k+22] = 1.0;
 		color_buffer[k+23] = 1.0;
 	}
+
+	// the vertex data lives on the gpu now, send the filled buffers over
+	gfx_update_vertex_data(particles->tex_coords);
+	gfx_update_vertex_data(particles->colors);
 }
 
 void elf_set_particles_draw_mode(elf_particles *particles, int mode)
@@ -635,6 +745,12 @@ void elf_set_particles_spawn(elf_particles *particles, unsigned char spawn)
 	particles->spawn = !spawn == ELF_FALSE;
 }
 
+void elf_set_particles_random_seed(elf_particles *particles, int seed)
+{
+	// a zero state would stay zero forever
+	particles->random_state = seed ? (unsigned int)seed : 0x9E3779B9;
+}
+
 void elf_set_particles_size(elf_particles *particles, float min, float max)
 {
 	particles->size_min = min;
@@ -722,7 +838,7 @@ int elf_get_particles_max_count(elf_particles *particles)
 
 int elf_get_particles_count(elf_particles *particles)
 {
-	return elf_get_list_length(particles->particles);
+	return particles->particle_count;
 }
 
 int elf_get_particles_draw_mode(elf_particles *particles)
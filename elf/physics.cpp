@@ -46,7 +46,7 @@ struct elf_physics_object {
 	btDefaultMotionState *motionState;
 	elf_physics_tri_mesh *tri_mesh;
 	elf_physics_world *world;
-	elf_list *collisions;
+	elf_array *collisions;
 	int collision_count;
 	elf_actor *actor;
 };
@@ -136,7 +136,7 @@ void elf_destroy_physics_world(elf_physics_world *world)
 	free(world);
 }
 
-void elf_update_physics_world(elf_physics_world *world, float time)
+void elf_update_physics_world(elf_physics_world *world, float time, unsigned char fixed)
 {
 	int manifold_count;
 	int contact_count;
@@ -148,7 +148,9 @@ void elf_update_physics_world(elf_physics_world *world, float time)
 	elf_collision *col1;
 	int i, j;
 
-	world->world->stepSimulation(time, 4);
+	// a fixed tick is stepped exactly once instead of being split into internal substeps
+	if(fixed) world->world->stepSimulation(time, 1, time);
+	else world->world->stepSimulation(time, 4);
 
 	manifold_count = world->dispatcher->getNumManifolds();
 	contact_count = 0;
@@ -165,25 +167,24 @@ void elf_update_physics_world(elf_physics_world *world, float time)
 
 		// add elf_clear_physic_object_collisions somewhere...
 
-		while(elf_get_list_length(obj0->collisions) < obj0->collision_count+contact_count)
+		while(elf_get_array_length(obj0->collisions) < obj0->collision_count+contact_count)
 		{
 			col0 = elf_create_collision();
-			elf_append_to_list(obj0->collisions, (elf_object*)col0);
+			elf_append_to_array(obj0->collisions, (elf_object*)col0);
 		}
-		while(elf_get_list_length(obj1->collisions) < obj1->collision_count+contact_count)
+		while(elf_get_array_length(obj1->collisions) < obj1->collision_count+contact_count)
 		{
 			col1 = elf_create_collision();
-			elf_append_to_list(obj1->collisions, (elf_object*)col1);
+			elf_append_to_array(obj1->collisions, (elf_object*)col1);
 		}
 
 		obj0->collision_count += contact_count;
 		obj1->collision_count += contact_count;
 
-		for(j = 0, col0 = (elf_collision*)elf_begin_list(obj0->collisions),
-			col1 = (elf_collision*)elf_begin_list(obj1->collisions); j < contact_count;
-			col0 = (elf_collision*)elf_next_in_list(obj0->collisions),
-			col1 = (elf_collision*)elf_next_in_list(obj1->collisions), j++)
+		for(j = 0; j < contact_count; j++)
 		{
+			col0 = (elf_collision*)elf_get_item_from_array(obj0->collisions, j);
+			col1 = (elf_collision*)elf_get_item_from_array(obj1->collisions, j);
 			point = &manifold->getContactPoint(j);
 
 			if(col0->actor) elf_dec_ref((elf_object*)col0->actor);
@@ -589,8 +590,7 @@ elf_physics_object* elf_create_physics_object()
 	memset(object, 0x0, sizeof(elf_physics_object));
 	object->type = ELF_PHYSICS_OBJECT;
 
-	object->collisions = elf_create_list();
-	elf_inc_ref((elf_object*)object->collisions);
+	object->collisions = elf_create_array();
 
 	return object;
 }
@@ -758,7 +758,7 @@ void elf_destroy_physics_object(elf_physics_object *object)
 	if(object->shape) delete object->shape;
 	if(object->motionState) delete object->motionState;
 	if(object->tri_mesh) elf_dec_ref((elf_object*)object->tri_mesh);
-	elf_dec_ref((elf_object*)object->collisions);
+	elf_destroy_array(object->collisions);
 
 	free(object);
 }
@@ -770,31 +770,26 @@ void elf_set_physics_object_actor(elf_physics_object *object, elf_actor *actor)
 
 void elf_remove_physics_object_collisions(elf_physics_object *object)
 {
-	if(elf_get_list_length(object->collisions) > 0)
-	{
-		elf_dec_ref((elf_object*)object->collisions);
-		object->collisions = elf_create_list();
-		elf_inc_ref((elf_object*)object->collisions);
-	}
+	elf_truncate_array(object->collisions, 0);
 	object->collision_count = 0;
 }
 
 void elf_clear_physics_object_collisions(elf_physics_object *object)
 {
-	if(elf_get_list_length(object->collisions) > 0) elf_remove_from_list(object->collisions, elf_begin_list(object->collisions));
+	if(elf_get_array_length(object->collisions) > 0) elf_remove_array_item(object->collisions, 0);
 	object->collision_count = 0;
 }
 
 int elf_get_physics_object_collision_count(elf_physics_object *object)
 {
-	return elf_get_list_length(object->collisions);
+	return elf_get_array_length(object->collisions);
 }
 
 elf_collision* elf_get_physics_object_collision(elf_physics_object *object, int idx)
 {
-	if(idx < 0 || idx > elf_get_list_length(object->collisions)-1) return NULL;
+	if(idx < 0 || idx > elf_get_array_length(object->collisions)-1) return NULL;
 
-	return (elf_collision*)elf_get_item_from_list(object->collisions, idx);
+	return (elf_collision*)elf_get_item_from_array(object->collisions, idx);
 }
 
 void elf_set_physics_object_position(elf_physics_object *object, float x, float y, float z)
@@ -352,6 +352,8 @@ void elf_end_post_process(elf_post_process *post_process, elf_scene *scene)
 	// SSAO
 	if(post_process->ssao && scene->cur_camera)
 	{
+		ELF_PROFILE_BEGIN("ssao");
+
 		if(post_process->dof || post_process->bloom)
 		{
 			gfx_set_render_target(post_process->main_rt);
@@ -388,11 +390,15 @@ void elf_end_post_process(elf_post_process *post_process, elf_scene *scene)
 		
 		post_process->shader_params.texture_params[0].texture = NULL;
 		post_process->shader_params.texture_params[1].texture = NULL;
+
+		ELF_PROFILE_END();
 	}
 
 	// DOF
 	if(post_process->dof)
 	{
+		ELF_PROFILE_BEGIN("dof");
+
 		gfx_set_viewport(0, 0, post_process->buffer_width*2, post_process->buffer_height*2);
 		gfx_get_orthographic_projection_matrix(0, post_process->buffer_width*2, 0, post_process->buffer_height*2, -1.0, 1.0,
 			post_process->shader_params.projection_matrix);
@@ -444,11 +450,15 @@ void elf_end_post_process(elf_post_process *post_process, elf_scene *scene)
 		source_rt = !source_rt;
 		
 		post_process->shader_params.texture_params[0].texture = NULL;
+
+		ELF_PROFILE_END();
 	}
 
 	// BLOOM
 	if(post_process->bloom)
 	{
+		ELF_PROFILE_BEGIN("bloom");
+
 		gfx_set_viewport(0, 0, post_process->buffer_width, post_process->buffer_height);
 		gfx_get_orthographic_projection_matrix(0, post_process->buffer_width, 0, post_process->buffer_height, -1.0, 1.0,
 			post_process->shader_params.projection_matrix);
@@ -537,6 +547,8 @@ void elf_end_post_process(elf_post_process *post_process, elf_scene *scene)
 		post_process->shader_params.texture_params[1].texture = NULL;
 		post_process->shader_params.texture_params[2].texture = NULL;
 		post_process->shader_params.texture_params[3].texture = NULL;
+
+		ELF_PROFILE_END();
 	}
 
 	if(!post_process->bloom && !post_process->dof && !post_process->ssao)
@@ -559,6 +571,8 @@ void elf_end_post_process(elf_post_process *post_process, elf_scene *scene)
 
 	if(post_process->light_shafts && scene->cur_camera)
 	{
+		ELF_PROFILE_BEGIN("light shafts");
+
 		for(light = (elf_light*)elf_begin_list(scene->lights); light;
 			light = (elf_light*)elf_next_in_list(scene->lights))
 		{
@@ -579,10 +593,9 @@ void elf_end_post_process(elf_post_process *post_process, elf_scene *scene)
 					scene->shader_params.render_params.color_write = ELF_FALSE;
 					scene->shader_params.render_params.alpha_write = ELF_FALSE;
 
-					for(i = 0, ent = (elf_entity*)elf_begin_list(scene->entity_queue);
-						i < scene->entity_queue_count && ent != NULL;
-						i++, ent = (elf_entity*)elf_next_in_list(scene->entity_queue))
+					for(i = 0; i < scene->entity_queue_count; i++)
 					{
+						ent = (elf_entity*)elf_get_item_from_array(scene->entity_queue, i);
 						elf_draw_entity_without_materials(ent, &scene->shader_params);
 					}
 
@@ -666,6 +679,8 @@ void elf_end_post_process(elf_post_process *post_process, elf_scene *scene)
 				scene->shader_params.texture_params[0].texture = NULL;
 			}
 		}
+
+		ELF_PROFILE_END();
 	}
 
 	// reset state just to be sure...
@@ -0,0 +1,344 @@
+
+// a scope profiler for the main thread. ELF_PROFILE_BEGIN and ELF_PROFILE_END mark the stages
+// of a frame, the scopes of the last ELF_PROFILE_FRAME_COUNT frames are kept for the query
+// functions and for saving as a chrome trace (chrome://tracing). without ELF_PROFILE the
+// macros are empty and no profiler is created, the query functions then return nothing.
+
+elf_profiler* elf_create_profiler()
+{
+	elf_profiler *profiler;
+
+	profiler = (elf_profiler*)malloc(sizeof(elf_profiler));
+	memset(profiler, 0x0, sizeof(elf_profiler));
+
+	profiler->frames = (elf_profile_frame*)malloc(sizeof(elf_profile_frame)*ELF_PROFILE_FRAME_COUNT);
+	memset(profiler->frames, 0x0, sizeof(elf_profile_frame)*ELF_PROFILE_FRAME_COUNT);
+
+	profiler->enabled = ELF_TRUE;
+
+	elf_inc_obj_count();
+
+	return profiler;
+}
+
+void elf_destroy_profiler(elf_profiler *profiler)
+{
+	free(profiler->frames);
+	free(profiler);
+
+	elf_dec_obj_count();
+}
+
+void elf_begin_profile_frame()
+{
+	elf_profiler *profiler;
+	elf_profile_frame *frame;
+
+	if(!eng || !eng->profiler || !eng->profiler->enabled) return;
+
+	profiler = eng->profiler;
+	frame = &profiler->frames[profiler->cur_frame];
+
+	frame->start = elf_get_time();
+	frame->end = frame->start;
+	frame->scope_count = 0;
+
+	profiler->depth = 0;
+	profiler->in_frame = ELF_TRUE;
+}
+
+void elf_end_profile_frame()
+{
+	elf_profiler *profiler;
+	elf_profile_frame *frame;
+	double time;
+
+	if(!eng || !eng->profiler || !eng->profiler->in_frame) return;
+
+	profiler = eng->profiler;
+	frame = &profiler->frames[profiler->cur_frame];
+
+	time = elf_get_time();
+
+	// scopes left open by an early return end with the frame
+	while(profiler->depth > 0)
+	{
+		profiler->depth--;
+		if(profiler->depth < ELF_PROFILE_MAX_DEPTH && profiler->stack[profiler->depth] >= 0)
+			frame->scopes[profiler->stack[profiler->depth]].end = time;
+	}
+
+	frame->end = time;
+
+	profiler->cur_frame = (profiler->cur_frame+1)%ELF_PROFILE_FRAME_COUNT;
+	if(profiler->frame_count < ELF_PROFILE_FRAME_COUNT) profiler->frame_count++;
+	profiler->in_frame = ELF_FALSE;
+}
+
+void elf_begin_profile_scope(const char *name)
+{
+	elf_profiler *profiler;
+	elf_profile_frame *frame;
+	elf_profile_scope *scope;
+	int idx;
+
+	if(!eng || !eng->profiler || !eng->profiler->in_frame) return;
+
+	profiler = eng->profiler;
+	frame = &profiler->frames[profiler->cur_frame];
+
+	// past the limits the scope is only counted so that its end still matches
+	idx = -1;
+	if(frame->scope_count < ELF_PROFILE_MAX_SCOPES && profiler->depth < ELF_PROFILE_MAX_DEPTH)
+	{
+		idx = frame->scope_count++;
+		scope = &frame->scopes[idx];
+
+		strncpy(scope->name, name ? name : "", ELF_PROFILE_NAME_LENGTH-1);
+		scope->name[ELF_PROFILE_NAME_LENGTH-1] = '\0';
+		scope->depth = profiler->depth;
+		scope->start = elf_get_time();
+		scope->end = scope->start;
+	}
+
+	if(profiler->depth < ELF_PROFILE_MAX_DEPTH) profiler->stack[profiler->depth] = idx;
+	profiler->depth++;
+}
+
+void elf_end_profile_scope()
+{
+	elf_profiler *profiler;
+
+	if(!eng || !eng->profiler || !eng->profiler->in_frame || eng->profiler->depth < 1) return;
+
+	profiler = eng->profiler;
+
+	profiler->depth--;
+	if(profiler->depth < ELF_PROFILE_MAX_DEPTH && profiler->stack[profiler->depth] >= 0)
+		profiler->frames[profiler->cur_frame].scopes[profiler->stack[profiler->depth]].end = elf_get_time();
+}
+
+elf_profile_frame* elf_get_profile_frame(int frame)
+{
+	elf_profiler *profiler;
+
+	if(!eng || !eng->profiler) return NULL;
+
+	profiler = eng->profiler;
+
+	// counted back from the last finished frame
+	if(frame < 0 || frame >= profiler->frame_count) return NULL;
+
+	return &profiler->frames[(profiler->cur_frame-1-frame+ELF_PROFILE_FRAME_COUNT*2)%ELF_PROFILE_FRAME_COUNT];
+}
+
+elf_profile_scope* elf_get_profile_frame_scope(int frame, int idx)
+{
+	elf_profile_frame *pframe;
+
+	pframe = elf_get_profile_frame(frame);
+	if(!pframe || idx < 0 || idx >= pframe->scope_count) return NULL;
+
+	return &pframe->scopes[idx];
+}
+
+unsigned char elf_is_profiler_available()
+{
+#ifdef ELF_PROFILE
+	return ELF_TRUE;
+#else
+	return ELF_FALSE;
+#endif
+}
+
+void elf_set_profiler_enabled(unsigned char enabled)
+{
+	if(!eng || !eng->profiler) return;
+
+	eng->profiler->enabled = !enabled ? ELF_FALSE : ELF_TRUE;
+
+	// a frame that was being recorded is dropped
+	if(!eng->profiler->enabled) eng->profiler->in_frame = ELF_FALSE;
+}
+
+unsigned char elf_is_profiler_enabled()
+{
+	if(!eng || !eng->profiler) return ELF_FALSE;
+	return eng->profiler->enabled;
+}
+
+int elf_get_profile_frame_count()
+{
+	if(!eng || !eng->profiler) return 0;
+	return eng->profiler->frame_count;
+}
+
+float elf_get_profile_frame_time(int frame)
+{
+	elf_profile_frame *pframe;
+
+	pframe = elf_get_profile_frame(frame);
+	if(!pframe) return 0.0;
+
+	return (float)((pframe->end-pframe->start)*1000.0);
+}
+
+int elf_get_profile_slowest_frame()
+{
+	float time;
+	float max_time;
+	int slowest;
+	int i;
+
+	slowest = -1;
+	max_time = 0.0;
+
+	for(i = 0; i < elf_get_profile_frame_count(); i++)
+	{
+		time = elf_get_profile_frame_time(i);
+		if(slowest < 0 || time > max_time)
+		{
+			slowest = i;
+			max_time = time;
+		}
+	}
+
+	return slowest;
+}
+
+int elf_get_profile_scope_count(int frame)
+{
+	elf_profile_frame *pframe;
+
+	pframe = elf_get_profile_frame(frame);
+	if(!pframe) return 0;
+
+	return pframe->scope_count;
+}
+
+const char* elf_get_profile_scope_name(int frame, int idx)
+{
+	elf_profile_scope *scope;
+
+	scope = elf_get_profile_frame_scope(frame, idx);
+	if(!scope) return "";
+
+	return scope->name;
+}
+
+int elf_get_profile_scope_depth(int frame, int idx)
+{
+	elf_profile_scope *scope;
+
+	scope = elf_get_profile_frame_scope(frame, idx);
+	if(!scope) return 0;
+
+	return scope->depth;
+}
+
+float elf_get_profile_scope_start(int frame, int idx)
+{
+	elf_profile_scope *scope;
+
+	scope = elf_get_profile_frame_scope(frame, idx);
+	if(!scope) return 0.0;
+
+	return (float)((scope->start-elf_get_profile_frame(frame)->start)*1000.0);
+}
+
+float elf_get_profile_scope_time(int frame, int idx)
+{
+	elf_profile_scope *scope;
+
+	scope = elf_get_profile_frame_scope(frame, idx);
+	if(!scope) return 0.0;
+
+	return (float)((scope->end-scope->start)*1000.0);
+}
+
+float elf_get_profile_time(int frame, const char *name)
+{
+	elf_profile_frame *pframe;
+	double time;
+	int i;
+
+	pframe = elf_get_profile_frame(frame);
+	if(!pframe || !name) return 0.0;
+
+	time = 0.0;
+	for(i = 0; i < pframe->scope_count; i++)
+	{
+		if(!strcmp(pframe->scopes[i].name, name))
+			time += pframe->scopes[i].end-pframe->scopes[i].start;
+	}
+
+	return (float)(time*1000.0);
+}
+
+void elf_write_profile_trace_name(FILE *file, const char *name)
+{
+	const char *c;
+
+	for(c = name; *c; c++)
+	{
+		if(*c == '"' || *c == '\\') fputc('\\', file);
+		if((unsigned char)*c < 0x20) fputc(' ', file);
+		else fputc(*c, file);
+	}
+}
+
+unsigned char elf_save_profile_trace(const char *file_path)
+{
+	elf_profile_frame *pframe;
+	elf_profile_scope *scope;
+	FILE *file;
+	double base;
+	int i, j;
+	unsigned char first;
+
+	if(!eng || !eng->profiler)
+	{
+		elf_set_error(ELF_MISSING_FEATURE, "error: can't save profile trace \"%s\", the profiler is not enabled in this build\n", file_path);
+		return ELF_FALSE;
+	}
+
+	file = fopen(file_path, "w");
+	if(!file)
+	{
+		elf_set_error(ELF_CANT_OPEN_FILE, "error: can't open file \"%s\" for writing\n", file_path);
+		return ELF_FALSE;
+	}
+
+	pframe = elf_get_profile_frame(elf_get_profile_frame_count()-1);
+	base = pframe ? pframe->start : 0.0;
+
+	fprintf(file, "{\"traceEvents\":[\n");
+
+	// oldest frame first, every frame and scope as a complete event in microseconds
+	first = ELF_TRUE;
+	for(i = elf_get_profile_frame_count()-1; i >= 0; i--)
+	{
+		pframe = elf_get_profile_frame(i);
+
+		fprintf(file, "%s{\"name\":\"frame\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+			first ? "" : ",\n", (pframe->start-base)*1000000.0, (pframe->end-pframe->start)*1000000.0);
+		first = ELF_FALSE;
+
+		for(j = 0; j < pframe->scope_count; j++)
+		{
+			scope = &pframe->scopes[j];
+
+			fprintf(file, ",\n{\"name\":\"");
+			elf_write_profile_trace_name(file, scope->name);
+			fprintf(file, "\",\"cat\":\"elf\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+				(scope->start-base)*1000000.0, (scope->end-scope->start)*1000000.0);
+		}
+	}
+
+	fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+	fclose(file);
+
+	return ELF_TRUE;
+}
+
@@ -66,25 +66,27 @@ elf_scene* elf_create_scene(const char *name)
 	scene->textures = elf_create_list();
 	scene->materials = elf_create_list();
 	scene->cameras = elf_create_list();
-	scene->entities = elf_create_list();
+	scene->entities = elf_create_array();
 	scene->lights = elf_create_list();
 	scene->armatures = elf_create_list();
 	scene->particles = elf_create_list();
 	scene->sprites = elf_create_list();
-	scene->entity_queue = elf_create_list();
+	scene->entity_queue = elf_create_array();
+	scene->entity_updates = elf_create_array();
 	scene->sprite_queue = elf_create_list();
 
+	scene->entity_bvh = elf_create_bvh();
+	scene->cull_set = elf_create_cull_set();
+
 	elf_inc_ref((elf_object*)scene->models);
 	elf_inc_ref((elf_object*)scene->scripts);
 	elf_inc_ref((elf_object*)scene->materials);
 	elf_inc_ref((elf_object*)scene->textures);
 	elf_inc_ref((elf_object*)scene->cameras);
-	elf_inc_ref((elf_object*)scene->entities);
 	elf_inc_ref((elf_object*)scene->lights);
 	elf_inc_ref((elf_object*)scene->armatures);
 	elf_inc_ref((elf_object*)scene->particles);
 	elf_inc_ref((elf_object*)scene->sprites);
-	elf_inc_ref((elf_object*)scene->entity_queue);
 	elf_inc_ref((elf_object*)scene->sprite_queue);
 
 	gfx_set_shader_params_default(&scene->shader_params);
@@ -350,7 +352,85 @@ elf_scene* elf_create_scene_from_file(const char *file_path)
 
 unsigned char elf_save_scene(elf_scene *scene, const char *file_path)
 {
-	return elf_save_scene_to_pak(scene, file_path);
+	return elf_save_scene_to_pak(scene, file_path, ELF_FALSE);
+}
+
+unsigned char elf_save_scene_compressed(elf_scene *scene, const char *file_path)
+{
+	return elf_save_scene_to_pak(scene, file_path, ELF_TRUE);
+}
+
+void elf_add_scene_particle_job(elf_scene *scene, elf_particles *particles, int first, int last)
+{
+	if(scene->particle_job_count >= scene->particle_job_capacity)
+	{
+		scene->particle_job_capacity = scene->particle_job_capacity ? scene->particle_job_capacity*2 : 64;
+		scene->particle_jobs = (elf_particle_job*)realloc(scene->particle_jobs,
+			sizeof(elf_particle_job)*scene->particle_job_capacity);
+	}
+
+	scene->particle_jobs[scene->particle_job_count].particles = particles;
+	scene->particle_jobs[scene->particle_job_count].first = first;
+	scene->particle_jobs[scene->particle_job_count].last = last;
+	scene->particle_job_count++;
+}
+
+void elf_run_scene_particle_simulation(void *data, int first, int last)
+{
+	elf_scene *scene;
+	int i;
+
+	scene = (elf_scene*)data;
+
+	for(i = first; i < last; i++)
+		elf_simulate_particles(scene->particle_jobs[i].particles, scene->particle_sync);
+}
+
+void elf_run_scene_particle_vertices(void *data, int first, int last)
+{
+	elf_scene *scene;
+	elf_particle_job *job;
+	int i;
+
+	scene = (elf_scene*)data;
+
+	for(i = first; i < last; i++)
+	{
+		job = &scene->particle_jobs[i];
+		elf_write_particles_vertices(job->particles, job->first, job->last,
+			scene->particle_camera_pos, scene->particle_camera_orient);
+	}
+}
+
+void elf_run_scene_entity_syncs(void *data, int first, int last)
+{
+	elf_scene *scene;
+	int i;
+
+	scene = (elf_scene*)data;
+
+	for(i = first; i < last; i++)
+		elf_sync_actor_transform((elf_actor*)elf_get_item_from_array(scene->entities, i));
+}
+
+void elf_run_scene_entity_pre_draws(void *data, int first, int last)
+{
+	elf_scene *scene;
+	elf_entity *ent;
+	int i;
+
+	scene = (elf_scene*)data;
+
+	gfx_update_transform_matrices(&scene->pre_draw_transforms[first], last-first);
+
+	for(i = first; i < last; i++)
+	{
+		ent = scene->pre_draw_entities[i];
+		if(!ent->moved) continue;
+
+		gfx_get_transform_position(ent->transform, &ent->position.x);
+		elf_calc_entity_aabb(ent);
+	}
 }
 
 void elf_update_scene(elf_scene *scene, float sync)
@@ -360,17 +440,24 @@ void elf_update_scene(elf_scene *scene, float sync)
 	elf_light *light;
 	elf_particles *par;
 	elf_sprite *spr;
+	int i;
 	float position[3];
 	float orient[4];
 	float vec_z[3] = {0.0, 0.0, -1.0};
 	float vec_y[3] = {0.0, 1.0, -1.0};
 	float front_up_vec[6];
 
+	ELF_PROFILE_BEGIN("physics");
 	if(sync > 0.0)
 	{
-		if(scene->physics) elf_update_physics_world(scene->world, sync);
-		elf_update_physics_world(scene->dworld, sync);
+		if(scene->physics) elf_update_physics_world(scene->world, sync, eng->fixed_tick_rate > 0.0);
+		elf_update_physics_world(scene->dworld, sync, eng->fixed_tick_rate > 0.0);
 	}
+	ELF_PROFILE_END();
+
+	ELF_PROFILE_BEGIN("sync entities");
+	elf_run_workers(eng->workers, elf_run_scene_entity_syncs, scene, elf_get_array_length(scene->entities), ELF_ENTITY_JOB_SIZE);
+	ELF_PROFILE_END();
 
 	if(scene->cur_camera)
 	{
@@ -389,24 +476,43 @@ void elf_update_scene(elf_scene *scene, float sync)
 		elf_update_camera(cam);
 	}
 
-	for(ent = (elf_entity*)elf_begin_list(scene->entities); ent != NULL;
-		ent = (elf_entity*)elf_next_in_list(scene->entities))
+	// the actor scripts run from here
+	ELF_PROFILE_BEGIN("update entities");
+	// a script may add or remove any entity, so they are walked from a copy and the ones
+	// removed before their turn are left out
+	for(i = 0; i < elf_get_array_length(scene->entities); i++)
+		elf_append_to_array(scene->entity_updates, elf_get_item_from_array(scene->entities, i));
+
+	for(i = 0; i < elf_get_array_length(scene->entity_updates); i++)
 	{
-		elf_update_entity(ent);
+		ent = (elf_entity*)elf_get_item_from_array(scene->entity_updates, i);
+		if(ent->scene == scene) elf_update_entity(ent);
 	}
 
+	elf_truncate_array(scene->entity_updates, 0);
+	ELF_PROFILE_END();
+
 	for(light = (elf_light*)elf_begin_list(scene->lights); light != NULL;
 		light = (elf_light*)elf_next_in_list(scene->lights))
 	{
 		elf_update_light(light);
 	}
 
+	// the scripts run here, the emitters are stepped after on the worker threads, one emitter
+	// per job so every emitter always spawns from the same random sequence
+	ELF_PROFILE_BEGIN("update particles");
+	scene->particle_job_count = 0;
 	for(par = (elf_particles*)elf_begin_list(scene->particles); par != NULL;
 		par = (elf_particles*)elf_next_in_list(scene->particles))
 	{
-		elf_update_particles(par, sync);
+		elf_update_particles(par);
+		elf_add_scene_particle_job(scene, par, 0, 0);
 	}
 
+	scene->particle_sync = sync;
+	elf_run_workers(eng->workers, elf_run_scene_particle_simulation, scene, scene->particle_job_count, 1);
+	ELF_PROFILE_END();
+
 	for(spr = (elf_sprite*)elf_begin_list(scene->sprites); spr != NULL;
 		spr = (elf_sprite*)elf_next_in_list(scene->sprites))
 	{
@@ -414,6 +520,76 @@ void elf_update_scene(elf_scene *scene, float sync)
 	}
 }
 
+void elf_set_actor_transform_state(elf_actor *actor, int state)
+{
+	unsigned char changed;
+
+	if(state == ELF_TRANSFORM_SAVE)
+	{
+		gfx_save_transform_state(actor->transform);
+		return;
+	}
+
+	if(state == ELF_TRANSFORM_UPDATE) changed = gfx_update_transform_state(actor->transform);
+	else changed = gfx_reset_transform_state(actor->transform);
+
+	// the culling box follows whether the drawn transform is blended
+	if(changed) actor->moved = ELF_TRUE;
+}
+
+void elf_set_scene_transform_states(elf_scene *scene, int state)
+{
+	elf_actor *actor;
+	int i;
+
+	for(actor = (elf_actor*)elf_begin_list(scene->cameras); actor != NULL;
+		actor = (elf_actor*)elf_next_in_list(scene->cameras))
+	{
+		elf_set_actor_transform_state(actor, state);
+	}
+
+	for(i = 0; i < elf_get_array_length(scene->entities); i++)
+	{
+		actor = (elf_actor*)elf_get_item_from_array(scene->entities, i);
+		elf_set_actor_transform_state(actor, state);
+	}
+
+	for(actor = (elf_actor*)elf_begin_list(scene->lights); actor != NULL;
+		actor = (elf_actor*)elf_next_in_list(scene->lights))
+	{
+		elf_set_actor_transform_state(actor, state);
+	}
+
+	for(actor = (elf_actor*)elf_begin_list(scene->particles); actor != NULL;
+		actor = (elf_actor*)elf_next_in_list(scene->particles))
+	{
+		elf_set_actor_transform_state(actor, state);
+	}
+
+	for(actor = (elf_actor*)elf_begin_list(scene->sprites); actor != NULL;
+		actor = (elf_actor*)elf_next_in_list(scene->sprites))
+	{
+		elf_set_actor_transform_state(actor, state);
+	}
+}
+
+void elf_save_scene_transforms(elf_scene *scene)
+{
+	// the state before a tick, the drawn transforms are blended from here to the state after it
+	elf_set_scene_transform_states(scene, ELF_TRANSFORM_SAVE);
+}
+
+void elf_update_scene_transforms(elf_scene *scene)
+{
+	// after the ticks of a frame, only what the last tick changed is blended
+	elf_set_scene_transform_states(scene, ELF_TRANSFORM_UPDATE);
+}
+
+void elf_reset_scene_transforms(elf_scene *scene)
+{
+	elf_set_scene_transform_states(scene, ELF_TRANSFORM_RESET);
+}
+
 void elf_scene_pre_draw(elf_scene *scene)
 {
 	elf_camera *cam;
@@ -421,6 +597,8 @@ void elf_scene_pre_draw(elf_scene *scene)
 	elf_light *light;
 	elf_sprite *spr;
 	elf_particles *par;
+	elf_worker_fence fence;
+	int i;
 
 	for(cam = (elf_camera*)elf_begin_list(scene->cameras); cam != NULL;
 		cam = (elf_camera*)elf_next_in_list(scene->cameras))
@@ -428,12 +606,36 @@ void elf_scene_pre_draw(elf_scene *scene)
 		elf_camera_pre_draw(cam);
 	}
 
-	for(ent = (elf_entity*)elf_begin_list(scene->entities); ent != NULL;
-		ent = (elf_entity*)elf_next_in_list(scene->entities))
+	// the moved entities are collected here and their matrices, culling boxes and positions are
+	// worked out in batches on the worker threads while the lights, sprites and particles get
+	// ready. the drawing then only reads them, the bvh is updated once they are all in
+	scene->pre_draw_count = 0;
+	for(i = 0; i < elf_get_array_length(scene->entities); i++)
 	{
+		ent = (elf_entity*)elf_get_item_from_array(scene->entities, i);
 		elf_entity_pre_draw(ent);
+
+		if(ent->moved || gfx_is_transform_matrix_outdated(ent->transform))
+		{
+			if(scene->pre_draw_count >= scene->pre_draw_capacity)
+			{
+				scene->pre_draw_capacity = scene->pre_draw_capacity ? scene->pre_draw_capacity*2 : 256;
+				scene->pre_draw_entities = (elf_entity**)realloc(scene->pre_draw_entities,
+					sizeof(elf_entity*)*scene->pre_draw_capacity);
+				scene->pre_draw_transforms = (gfx_transform**)realloc(scene->pre_draw_transforms,
+					sizeof(gfx_transform*)*scene->pre_draw_capacity);
+			}
+
+			scene->pre_draw_entities[scene->pre_draw_count] = ent;
+			scene->pre_draw_transforms[scene->pre_draw_count] = ent->transform;
+			scene->pre_draw_count++;
+		}
 	}
 
+	elf_init_worker_fence(&fence);
+	elf_run_workers_async(eng->workers, elf_run_scene_entity_pre_draws, scene, scene->pre_draw_count,
+		ELF_ENTITY_JOB_SIZE, NULL, &fence);
+
 	for(light = (elf_light*)elf_begin_list(scene->lights); light != NULL;
 		light = (elf_light*)elf_next_in_list(scene->lights))
 	{
@@ -451,6 +653,14 @@ void elf_scene_pre_draw(elf_scene *scene)
 	{
 		elf_particles_pre_draw(par);
 	}
+
+	elf_wait_workers(eng->workers, &fence);
+
+	for(i = 0; i < scene->pre_draw_count; i++)
+	{
+		ent = scene->pre_draw_entities[i];
+		if(ent->moved && ent->bvh_leaf >= 0) elf_move_entity_in_bvh(scene->entity_bvh, ent->bvh_leaf, ent);
+	}
 }
 
 void elf_scene_post_draw(elf_scene *scene)
@@ -460,6 +670,7 @@ void elf_scene_post_draw(elf_scene *scene)
 	elf_light *light;
 	elf_sprite *spr;
 	elf_particles *par;
+	int i;
 
 	for(cam = (elf_camera*)elf_begin_list(scene->cameras); cam != NULL;
 		cam = (elf_camera*)elf_next_in_list(scene->cameras))
@@ -467,9 +678,9 @@ void elf_scene_post_draw(elf_scene *scene)
 		elf_camera_post_draw(cam);
 	}
 
-	for(ent = (elf_entity*)elf_begin_list(scene->entities); ent != NULL;
-		ent = (elf_entity*)elf_next_in_list(scene->entities))
+	for(i = 0; i < elf_get_array_length(scene->entities); i++)
 	{
+		ent = (elf_entity*)elf_get_item_from_array(scene->entities, i);
 		elf_entity_post_draw(ent);
 	}
 
@@ -495,17 +706,19 @@ void elf_scene_post_draw(elf_scene *scene)
 void elf_destroy_scene(elf_scene *scene)
 {
 	elf_actor *actor;
+	int i;
 
 	if(scene->name) elf_destroy_string(scene->name);
 	if(scene->file_path) elf_destroy_string(scene->file_path);
 
-	if(scene->entity_queue) elf_dec_ref((elf_object*)scene->entity_queue);
+	if(scene->entity_queue) elf_destroy_array(scene->entity_queue);
+	if(scene->entity_updates) elf_destroy_array(scene->entity_updates);
 	if(scene->sprite_queue) elf_dec_ref((elf_object*)scene->sprite_queue);
 
 	for(actor = (elf_actor*)elf_begin_list(scene->cameras); actor;
 		actor = (elf_actor*)elf_next_in_list(scene->cameras)) elf_remove_actor(actor);
-	for(actor = (elf_actor*)elf_begin_list(scene->entities); actor;
-		actor = (elf_actor*)elf_next_in_list(scene->entities)) elf_remove_actor(actor);
+	for(i = 0; i < elf_get_array_length(scene->entities); i++)
+		elf_remove_actor((elf_actor*)elf_get_item_from_array(scene->entities, i));
 	for(actor = (elf_actor*)elf_begin_list(scene->lights); actor;
 		actor = (elf_actor*)elf_next_in_list(scene->lights)) elf_remove_actor(actor);
 	for(actor = (elf_actor*)elf_begin_list(scene->particles); actor;
@@ -513,12 +726,18 @@ void elf_destroy_scene(elf_scene *scene)
 	for(actor = (elf_actor*)elf_begin_list(scene->sprites); actor;
 		actor = (elf_actor*)elf_next_in_list(scene->sprites)) elf_remove_actor(actor);
 
+	elf_destroy_bvh(scene->entity_bvh);
+	elf_destroy_cull_set(scene->cull_set);
+	if(scene->pre_draw_entities) free(scene->pre_draw_entities);
+	if(scene->pre_draw_transforms) free(scene->pre_draw_transforms);
+	if(scene->particle_jobs) free(scene->particle_jobs);
+
 	if(scene->models) elf_dec_ref((elf_object*)scene->models);
 	if(scene->scripts) elf_dec_ref((elf_object*)scene->scripts);
 	if(scene->materials) elf_dec_ref((elf_object*)scene->materials);
 	if(scene->textures) elf_dec_ref((elf_object*)scene->textures);
 	if(scene->cameras) elf_dec_ref((elf_object*)scene->cameras);
-	if(scene->entities) elf_dec_ref((elf_object*)scene->entities);
+	if(scene->entities) elf_destroy_array(scene->entities);
 	if(scene->lights) elf_dec_ref((elf_object*)scene->lights);
 	if(scene->armatures) elf_dec_ref((elf_object*)scene->armatures);
 	if(scene->particles) elf_dec_ref((elf_object*)scene->particles);
@@ -597,7 +816,7 @@ int elf_get_scene_camera_count(elf_scene *scene)
 
 int elf_get_scene_entity_count(elf_scene *scene)
 {
-	return elf_get_list_length(scene->entities);
+	return elf_get_array_length(scene->entities);
 }
 
 int elf_get_scene_light_count(elf_scene *scene)
@@ -650,7 +869,9 @@ void elf_add_entity_to_scene(elf_scene *scene, elf_entity *entity)
 {
 	if(!entity) return;
 	elf_set_actor_scene(scene, (elf_actor*)entity);
-	elf_append_to_list(scene->entities, (elf_object*)entity);
+	elf_append_to_array(scene->entities, (elf_object*)entity);
+	entity->queue_frame = 0;
+	entity->bvh_leaf = elf_insert_entity_to_bvh(scene->entity_bvh, entity);
 }
 
 void elf_add_light_to_scene(elf_scene *scene, elf_light *light)
@@ -711,7 +932,7 @@ elf_camera* elf_get_camera_by_index(elf_scene *scene, int idx)
 
 elf_entity* elf_get_entity_by_index(elf_scene *scene, int idx)
 {
-	return (elf_entity*)elf_get_item_from_list(scene->entities, idx);
+	return (elf_entity*)elf_get_item_from_array(scene->entities, idx);
 }
 
 elf_light* elf_get_light_by_index(elf_scene *scene, int idx)
@@ -820,10 +1041,11 @@ elf_camera *elf_get_camera_by_name(elf_scene *scene, const char *name)
 elf_entity *elf_get_entity_by_name(elf_scene *scene, const char *name)
 {
 	elf_entity *entity;
+	int i;
 
-	for(entity = (elf_entity*)elf_begin_list(scene->entities); entity;
-		entity = (elf_entity*)elf_next_in_list(scene->entities))
+	for(i = 0; i < elf_get_array_length(scene->entities); i++)
 	{
+		entity = (elf_entity*)elf_get_item_from_array(scene->entities, i);
 		if(!strcmp(entity->name, name)) return entity;
 	}
 
@@ -886,7 +1108,7 @@ elf_texture* elf_get_or_load_texture_by_name(elf_scene *scene, const char *name)
 {
 	elf_texture *texture;
 	elf_pak_index *index;
-	FILE *file;
+	elf_pak_reader reader;
 
 	for(texture = (elf_texture*)elf_begin_list(scene->textures); texture;
 		texture = (elf_texture*)elf_next_in_list(scene->textures))
@@ -897,15 +1119,21 @@ elf_texture* elf_get_or_load_texture_by_name(elf_scene *scene, const char *name)
 	if(scene->pak)
 	{
 		index = elf_get_pak_index_by_name(scene->pak, name, ELF_TEXTURE);
-		if(index)
+		if(index && index->decoded_texture)
 		{
-			file = fopen(scene->pak->file_path, "rb");
-			fseek(file, elf_get_pak_index_offset(index), SEEK_SET);
-			if(feof(file)) return NULL;
-
-			texture = elf_create_texture_from_pak(file, name, scene);
+			// already decoded by the scene loader threads, only the upload is left
+			texture = elf_create_texture_from_decoded(index->decoded_texture, name, scene);
+			elf_clear_decoded_texture(index->decoded_texture);
+			free(index->decoded_texture);
+			index->decoded_texture = NULL;
+			if(texture) elf_append_to_list(scene->textures, (elf_object*)texture);
+			return texture;
+		}
+		if(index && elf_seek_pak_index(scene->pak, index, &reader))
+		{
+			texture = elf_create_texture_from_pak(&reader, name, scene);
+			elf_close_pak_reader(&reader);
 			if(texture) elf_append_to_list(scene->textures, (elf_object*)texture);
-			fclose(file);
 			return texture;
 		}
 	}
@@ -917,7 +1145,7 @@ elf_model* elf_get_or_load_model_by_name(elf_scene *scene, const char *name)
 {
 	elf_model *model;
 	elf_pak_index *index;
-	FILE *file;
+	elf_pak_reader reader;
 
 	for(model = (elf_model*)elf_begin_list(scene->models); model;
 		model = (elf_model*)elf_next_in_list(scene->models))
@@ -928,15 +1156,21 @@ elf_model* elf_get_or_load_model_by_name(elf_scene *scene, const char *name)
 	if(scene->pak)
 	{
 		index = elf_get_pak_index_by_name(scene->pak, name, ELF_MODEL);
-		if(index)
+		if(index && index->decoded_model)
 		{
-			file = fopen(scene->pak->file_path, "rb");
-			fseek(file, elf_get_pak_index_offset(index), SEEK_SET);
-			if(feof(file)) return NULL;
-
-			model = elf_create_model_from_pak(file, name, scene);
+			// already decoded by the scene loader threads, only the upload is left
+			model = elf_create_model_from_decoded(index->decoded_model, name, scene);
+			elf_clear_decoded_model(index->decoded_model);
+			free(index->decoded_model);
+			index->decoded_model = NULL;
+			if(model) elf_append_to_list(scene->models, (elf_object*)model);
+			return model;
+		}
+		if(index && elf_seek_pak_index(scene->pak, index, &reader))
+		{
+			model = elf_create_model_from_pak(&reader, name, scene);
+			elf_close_pak_reader(&reader);
 			if(model) elf_append_to_list(scene->models, (elf_object*)model);
-			fclose(file);
 			return model;
 		}
 	}
@@ -948,7 +1182,7 @@ elf_script* elf_get_or_load_script_by_name(elf_scene *scene, const char *name)
 {
 	elf_script *script;
 	elf_pak_index *index;
-	FILE *file;
+	elf_pak_reader reader;
 
 	for(script = (elf_script*)elf_begin_list(scene->scripts); script;
 		script = (elf_script*)elf_next_in_list(scene->scripts))
@@ -959,15 +1193,11 @@ elf_script* elf_get_or_load_script_by_name(elf_scene *scene, const char *name)
 	if(scene->pak)
 	{
 		index = elf_get_pak_index_by_name(scene->pak, name, ELF_SCRIPT);
-		if(index)
+		if(index && elf_seek_pak_index(scene->pak, index, &reader))
 		{
-			file = fopen(scene->pak->file_path, "rb");
-			fseek(file, elf_get_pak_index_offset(index), SEEK_SET);
-			if(feof(file)) return NULL;
-
-			script = elf_create_script_from_pak(file, name, scene);
+			script = elf_create_script_from_pak(&reader, name, scene);
+			elf_close_pak_reader(&reader);
 			if(script) elf_append_to_list(scene->scripts, (elf_object*)script);
-			fclose(file);
 			return script;
 		}
 	}
@@ -979,7 +1209,7 @@ elf_material *elf_get_or_load_material_by_name(elf_scene *scene, const char *nam
 {
 	elf_material *material;
 	elf_pak_index *index;
-	FILE *file;
+	elf_pak_reader reader;
 
 	for(material = (elf_material*)elf_begin_list(scene->materials); material;
 		material = (elf_material*)elf_next_in_list(scene->materials))
@@ -990,15 +1220,11 @@ elf_material *elf_get_or_load_material_by_name(elf_scene *scene, const char *nam
 	if(scene->pak)
 	{
 		index = elf_get_pak_index_by_name(scene->pak, name, ELF_MATERIAL);
-		if(index)
+		if(index && elf_seek_pak_index(scene->pak, index, &reader))
 		{
-			file = fopen(scene->pak->file_path, "rb");
-			fseek(file, elf_get_pak_index_offset(index), SEEK_SET);
-			if(feof(file)) return NULL;
-
-			material = elf_create_material_from_pak(file, name, scene);
+			material = elf_create_material_from_pak(&reader, name, scene);
+			elf_close_pak_reader(&reader);
 			if(material) elf_append_to_list(scene->materials, (elf_object*)material);
-			fclose(file);
 			return material;
 		}
 	}
@@ -1010,7 +1236,7 @@ elf_camera *elf_get_or_load_camera_by_name(elf_scene *scene, const char *name)
 {
 	elf_camera *camera;
 	elf_pak_index *index;
-	FILE *file;
+	elf_pak_reader reader;
 
 	for(camera = (elf_camera*)elf_begin_list(scene->cameras); camera;
 		camera = (elf_camera*)elf_next_in_list(scene->cameras))
@@ -1021,15 +1247,11 @@ elf_camera *elf_get_or_load_camera_by_name(elf_scene *scene, const char *name)
 	if(scene->pak)
 	{
 		index = elf_get_pak_index_by_name(scene->pak, name, ELF_CAMERA);
-		if(index)
+		if(index && elf_seek_pak_index(scene->pak, index, &reader))
 		{
-			file = fopen(scene->pak->file_path, "rb");
-			fseek(file, elf_get_pak_index_offset(index), SEEK_SET);
-			if(feof(file)) return NULL;
-
-			camera = elf_create_camera_from_pak(file, name, scene);
+			camera = elf_create_camera_from_pak(&reader, name, scene);
+			elf_close_pak_reader(&reader);
 			if(camera) elf_add_camera_to_scene(scene, camera);
-			fclose(file);
 			return camera;
 		}
 	}
@@ -1041,26 +1263,23 @@ elf_entity *elf_get_or_load_entity_by_name(elf_scene *scene, const char *name)
 {
 	elf_entity *entity;
 	elf_pak_index *index;
-	FILE *file;
+	elf_pak_reader reader;
+	int i;
 
-	for(entity = (elf_entity*)elf_begin_list(scene->entities); entity;
-		entity = (elf_entity*)elf_next_in_list(scene->entities))
+	for(i = 0; i < elf_get_array_length(scene->entities); i++)
 	{
+		entity = (elf_entity*)elf_get_item_from_array(scene->entities, i);
 		if(!strcmp(entity->name, name)) return entity;
 	}
 
 	if(scene->pak)
 	{
 		index = elf_get_pak_index_by_name(scene->pak, name, ELF_ENTITY);
-		if(index)
+		if(index && elf_seek_pak_index(scene->pak, index, &reader))
 		{
-			file = fopen(scene->pak->file_path, "rb");
-			fseek(file, elf_get_pak_index_offset(index), SEEK_SET);
-			if(feof(file)) return NULL;
-
-			entity = elf_create_entity_from_pak(file, name, scene);
+			entity = elf_create_entity_from_pak(&reader, name, scene);
+			elf_close_pak_reader(&reader);
 			if(entity) elf_add_entity_to_scene(scene, entity);
-			fclose(file);
 			return entity;
 		}
 	}
@@ -1072,7 +1291,7 @@ elf_light *elf_get_or_load_light_by_name(elf_scene *scene, const char *name)
 {
 	elf_light *light;
 	elf_pak_index *index;
-	FILE *file;
+	elf_pak_reader reader;
 
 	for(light = (elf_light*)elf_begin_list(scene->lights); light;
 		light = (elf_light*)elf_next_in_list(scene->lights))
@@ -1083,15 +1302,11 @@ elf_light *elf_get_or_load_light_by_name(elf_scene *scene, const char *name)
 	if(scene->pak)
 	{
 		index = elf_get_pak_index_by_name(scene->pak, name, ELF_LIGHT);
-		if(index)
+		if(index && elf_seek_pak_index(scene->pak, index, &reader))
 		{
-			file = fopen(scene->pak->file_path, "rb");
-			fseek(file, elf_get_pak_index_offset(index), SEEK_SET);
-			if(feof(file)) return NULL;
-
-			light = elf_create_light_from_pak(file, name, scene);
+			light = elf_create_light_from_pak(&reader, name, scene);
+			elf_close_pak_reader(&reader);
 			if(light) elf_add_light_to_scene(scene, light);
-			fclose(file);
 			return light;
 		}
 	}
@@ -1103,7 +1318,7 @@ elf_armature *elf_get_or_load_armature_by_name(elf_scene *scene, const char *nam
 {
 	elf_armature *armature;
 	elf_pak_index *index;
-	FILE *file;
+	elf_pak_reader reader;
 
 	for(armature = (elf_armature*)elf_begin_list(scene->armatures); armature;
 		armature = (elf_armature*)elf_next_in_list(scene->armatures))
@@ -1114,15 +1329,11 @@ elf_armature *elf_get_or_load_armature_by_name(elf_scene *scene, const char *nam
 	if(scene->pak)
 	{
 		index = elf_get_pak_index_by_name(scene->pak, name, ELF_ARMATURE);
-		if(index)
+		if(index && elf_seek_pak_index(scene->pak, index, &reader))
 		{
-			file = fopen(scene->pak->file_path, "rb");
-			fseek(file, elf_get_pak_index_offset(index), SEEK_SET);
-			if(feof(file)) return NULL;
-
-			armature = elf_create_armature_from_pak(file, name, scene);
+			armature = elf_create_armature_from_pak(&reader, name, scene);
+			elf_close_pak_reader(&reader);
 			elf_append_to_list(scene->armatures, (elf_object*)armature);
-			fclose(file);
 			return armature;
 		}
 	}
@@ -1134,7 +1345,7 @@ elf_particles *elf_get_or_load_particles_by_name(elf_scene *scene, const char *n
 {
 	elf_particles *particles;
 	elf_pak_index *index;
-	FILE *file;
+	elf_pak_reader reader;
 
 	for(particles = (elf_particles*)elf_begin_list(scene->particles); particles;
 		particles = (elf_particles*)elf_next_in_list(scene->particles))
@@ -1145,15 +1356,11 @@ elf_particles *elf_get_or_load_particles_by_name(elf_scene *scene, const char *n
 	if(scene->pak)
 	{
 		index = elf_get_pak_index_by_name(scene->pak, name, ELF_PARTICLES);
-		if(index)
+		if(index && elf_seek_pak_index(scene->pak, index, &reader))
 		{
-			file = fopen(scene->pak->file_path, "rb");
-			fseek(file, elf_get_pak_index_offset(index), SEEK_SET);
-			if(feof(file)) return NULL;
-
-			particles = elf_create_particles_from_pak(file, name, scene);
+			particles = elf_create_particles_from_pak(&reader, name, scene);
+			elf_close_pak_reader(&reader);
 			if(particles) elf_add_particles_to_scene(scene, particles);
-			fclose(file);
 			return particles;
 		}
 	}
@@ -1165,7 +1372,7 @@ elf_sprite *elf_get_or_load_sprite_by_name(elf_scene *scene, const char *name)
 {
 	elf_sprite *sprite;
 	elf_pak_index *index;
-	FILE *file;
+	elf_pak_reader reader;
 
 	for(sprite = (elf_sprite*)elf_begin_list(scene->sprites); sprite;
 		sprite = (elf_sprite*)elf_next_in_list(scene->sprites))
@@ -1176,15 +1383,11 @@ elf_sprite *elf_get_or_load_sprite_by_name(elf_scene *scene, const char *name)
 	if(scene->pak)
 	{
 		index = elf_get_pak_index_by_name(scene->pak, name, ELF_SPRITE);
-		if(index)
+		if(index && elf_seek_pak_index(scene->pak, index, &reader))
 		{
-			file = fopen(scene->pak->file_path, "rb");
-			fseek(file, elf_get_pak_index_offset(index), SEEK_SET);
-			if(feof(file)) return NULL;
-
-			sprite = elf_create_sprite_from_pak(file, name, scene);
+			sprite = elf_create_sprite_from_pak(&reader, name, scene);
+			elf_close_pak_reader(&reader);
 			if(sprite) elf_add_sprite_to_scene(scene, sprite);
-			fclose(file);
 			return sprite;
 		}
 	}
@@ -1212,6 +1415,12 @@ void elf_remove_actor(elf_actor *actor)
 {
 	elf_joint *joint;
 
+	if(actor->type == ELF_ENTITY && actor->scene && ((elf_entity*)actor)->bvh_leaf >= 0)
+	{
+		elf_remove_entity_from_bvh(actor->scene->entity_bvh, ((elf_entity*)actor)->bvh_leaf);
+		((elf_entity*)actor)->bvh_leaf = -1;
+	}
+
 	actor->scene = NULL;
 
 	if(actor->object)
@@ -1258,14 +1467,15 @@ unsigned char elf_remove_camera_by_name(elf_scene *scene, const char *name)
 unsigned char elf_remove_entity_by_name(elf_scene *scene, const char *name)
 {
 	elf_entity *ent;
+	int i;
 
-	for(ent = (elf_entity*)elf_begin_list(scene->entities); ent != NULL;
-		ent = (elf_entity*)elf_next_in_list(scene->entities))
+	for(i = 0; i < elf_get_array_length(scene->entities); i++)
 	{
+		ent = (elf_entity*)elf_get_item_from_array(scene->entities, i);
 		if(!strcmp(ent->name, name))
 		{
 			elf_remove_actor((elf_actor*)ent);
-			elf_remove_from_list(scene->entities, (elf_object*)ent);
+			elf_remove_array_item(scene->entities, i);
 			return ELF_TRUE;
 		}
 	}
@@ -1355,22 +1565,14 @@ unsigned char elf_remove_camera_by_index(elf_scene *scene, int idx)
 unsigned char elf_remove_entity_by_index(elf_scene *scene, int idx)
 {
 	elf_entity *ent;
-	int i;
 
-	if(idx < 0 || idx > elf_get_list_length(scene->entities)-1) return ELF_FALSE;
+	if(idx < 0 || idx > elf_get_array_length(scene->entities)-1) return ELF_FALSE;
 
-	for(i = 0, ent = (elf_entity*)elf_begin_list(scene->entities); ent != NULL;
-		ent = (elf_entity*)elf_next_in_list(scene->entities), i++)
-	{
-		if(i == idx)
-		{
-			elf_remove_actor((elf_actor*)ent);
-			elf_remove_from_list(scene->entities, (elf_object*)ent);
-			return ELF_TRUE;
-		}
-	}
+	ent = (elf_entity*)elf_get_item_from_array(scene->entities, idx);
+	elf_remove_actor((elf_actor*)ent);
+	elf_remove_array_item(scene->entities, idx);
 
-	return ELF_FALSE;
+	return ELF_TRUE;
 }
 
 unsigned char elf_remove_light_by_index(elf_scene *scene, int idx)
@@ -1446,7 +1648,7 @@ unsigned char elf_remove_camera_by_object(elf_scene *scene, elf_camera *camera)
 unsigned char elf_remove_entity_by_object(elf_scene *scene, elf_entity *entity)
 {
 	elf_remove_actor((elf_actor*)entity);
-	return elf_remove_from_list(scene->entities, (elf_object*)entity);
+	return elf_remove_from_array(scene->entities, (elf_object*)entity);
 }
 
 unsigned char elf_remove_light_by_object(elf_scene *scene, elf_light *light)
@@ -1485,6 +1687,149 @@ unsigned char elf_remove_actor_by_object(elf_scene *scene, elf_actor *actor)
 	return ELF_FALSE;
 }
 
+void elf_warm_up_material_shaders(elf_material *material, unsigned char *light_passes, unsigned char sprite)
+{
+	static const int light_types[4] = {GFX_POINT_LIGHT, GFX_SUN_LIGHT, GFX_SPOT_LIGHT, GFX_SPOT_LIGHT};
+	gfx_shader_params shader_params;
+	int i;
+
+	// the same params the passes of elf_draw_scene end up with, only what goes into the config
+	if(material->lighting)
+	{
+		gfx_set_shader_params_default(&shader_params);
+		if(sprite) elf_set_material(material, &shader_params);
+		else elf_set_material_ambient(material, &shader_params);
+		gfx_precompile_shader_program(&shader_params);
+	}
+
+	gfx_set_shader_params_default(&shader_params);
+	elf_set_material_alpha_texture(material, &shader_params);
+	gfx_precompile_shader_program(&shader_params);
+
+	for(i = 0; i < 4; i++)
+	{
+		if(!light_passes[i]) continue;
+
+		gfx_set_shader_params_default(&shader_params);
+		if(i == 3)
+		{
+			shader_params.texture_params[GFX_MAX_TEXTURES-1].type = GFX_SHADOW_MAP;
+			shader_params.texture_params[GFX_MAX_TEXTURES-1].texture = eng->shadow_map;
+		}
+		shader_params.light_params.type = light_types[i];
+
+		elf_set_material(material, &shader_params);
+
+		// the non lit ones look the same under every light
+		if(!material->lighting) shader_params.light_params.type = GFX_NONE;
+		gfx_precompile_shader_program(&shader_params);
+		if(!material->lighting) break;
+	}
+}
+
+int elf_warm_up_scene_shaders(elf_scene *scene)
+{
+	gfx_shader_params shader_params;
+	elf_entity *ent;
+	elf_sprite *spr;
+	elf_light *lig;
+	elf_particles *par;
+	elf_material *mat;
+	unsigned char light_passes[4];
+	int count;
+	int i;
+
+	if(!scene) return 0;
+
+	count = gfx_get_shader_program_count();
+
+	// point, sun, spot and shadow casting spot lights each have their own programs
+	memset(light_passes, 0x0, sizeof(unsigned char)*4);
+	for(lig = (elf_light*)elf_begin_list(scene->lights); lig;
+		lig = (elf_light*)elf_next_in_list(scene->lights))
+	{
+		if(lig->light_type == ELF_POINT_LIGHT) light_passes[0] = ELF_TRUE;
+		else if(lig->light_type == ELF_SUN_LIGHT) light_passes[1] = ELF_TRUE;
+		else if(lig->light_type == ELF_SPOT_LIGHT && elf_get_light_shadow_caster(lig)) light_passes[3] = ELF_TRUE;
+		else if(lig->light_type == ELF_SPOT_LIGHT) light_passes[2] = ELF_TRUE;
+	}
+
+	for(i = 0; i < elf_get_array_length(scene->entities); i++)
+	{
+		ent = (elf_entity*)elf_get_item_from_array(scene->entities, i);
+		if(!ent->model) continue;
+
+		for(mat = (elf_material*)elf_begin_list(ent->materials); mat;
+			mat = (elf_material*)elf_next_in_list(ent->materials))
+		{
+			elf_warm_up_material_shaders(mat, light_passes, ELF_FALSE);
+		}
+	}
+
+	for(spr = (elf_sprite*)elf_begin_list(scene->sprites); spr;
+		spr = (elf_sprite*)elf_next_in_list(scene->sprites))
+	{
+		if(spr->material) elf_warm_up_material_shaders(spr->material, light_passes, ELF_TRUE);
+	}
+
+	for(par = (elf_particles*)elf_begin_list(scene->particles); par;
+		par = (elf_particles*)elf_next_in_list(scene->particles))
+	{
+		gfx_set_shader_params_default(&shader_params);
+		shader_params.render_params.vertex_color = GFX_TRUE;
+		shader_params.texture_params[0].type = GFX_COLOR_MAP;
+		if(par->texture) shader_params.texture_params[0].texture = par->texture->texture;
+		gfx_precompile_shader_program(&shader_params);
+	}
+
+	count = gfx_get_shader_program_count()-count;
+
+	elf_log(ELF_LOG_DEBUG, "warmed up %d shader programs\n", count);
+
+	return count;
+}
+
+void elf_draw_scene_entity_lit(elf_scene *scene, elf_light *light, elf_entity *ent, elf_vec3f lpos)
+{
+	elf_vec3f epos;
+	elf_vec3f dvec;
+	float dist, att;
+
+	// get the entity position for culling point light entities and testing against bounding sphere
+	epos = elf_get_actor_position((elf_actor*)ent);
+	epos = elf_add_vec3f_vec3f(epos, ent->bb_offset);
+	if((eng->occlusion_culling && gfx_get_query_result(ent->query) > 0) || !eng->occlusion_culling ||
+		elf_camera_inside_sphere(scene->cur_camera, &epos.x, ent->cull_radius))
+	{
+		if(light->light_type == ELF_SPOT_LIGHT)
+		{
+			if(!elf_cull_entity(ent, light->shadow_camera))
+			{
+				elf_draw_entity(ent, &scene->shader_params);
+			}
+		}
+		else if(light->light_type == ELF_POINT_LIGHT)
+		{
+			dvec = elf_sub_vec3f_vec3f(epos, lpos);
+			dist = elf_get_vec3f_length(dvec);
+			dist -= ent->cull_radius;
+			att = 1.0-elf_float_max(dist-light->distance, 0.0)*light->fade_speed;
+			if(att > 0.0)
+			{
+				elf_draw_entity(ent, &scene->shader_params);
+			}
+		}
+		else
+		{
+			elf_draw_entity(ent, &scene->shader_params);
+		}
+	}
+	else
+	{
+		ent->culled = ELF_TRUE;
+	}
+}
+
 void elf_draw_scene(elf_scene *scene)
 {
 	elf_light *light;
@@ -1498,11 +1843,13 @@ void elf_draw_scene(elf_scene *scene)
 	float temp_mat1[16];
 	float temp_mat2[16];
 	gfx_render_target *render_target;
-	int i, j;
+	int i, j, k;
+	int count;
 	elf_vec3f lpos;
-	elf_vec3f epos;
 	elf_vec3f spos;
 	elf_vec3f dvec;
+	float cam_pos[3];
+	float cam_orient[4];
 	float dist, att;
 	unsigned char found;
 
@@ -1511,46 +1858,63 @@ void elf_draw_scene(elf_scene *scene)
 	render_target = gfx_get_cur_render_target();
 
 	// draw depth buffer
+	ELF_PROFILE_BEGIN("depth pass");
 	gfx_set_shader_params_default(&scene->shader_params);
 	elf_set_camera(scene->cur_camera, &scene->shader_params);
 	scene->shader_params.render_params.color_write = ELF_FALSE;
 	scene->shader_params.render_params.alpha_write = ELF_FALSE;
 
+	// entities queued on this frame are marked with the frame number, the light passes filter with it
+	scene->draw_frame++;
+
+	// only the entities of the last queue can still be marked as visible, the rest never left the tree
+	for(i = 0; i < scene->entity_queue_count; i++)
+	{
+		ent = (elf_entity*)elf_get_item_from_array(scene->entity_queue, i);
+		ent->culled = ELF_TRUE;
+	}
+
 	scene->entity_queue_count = 0;
-	elf_begin_list(scene->entity_queue);
 
-	for(ent = (elf_entity*)elf_begin_list(scene->entities); ent != NULL;
-		ent = (elf_entity*)elf_next_in_list(scene->entities))
+	// test the boxes the tree gives in one batch and queue the ones left visible
+	count = elf_query_bvh_frustum(scene->entity_bvh, scene->cur_camera);
+	elf_clear_cull_set(scene->cull_set);
+	for(k = 0; k < count; k++)
+		elf_add_entity_to_cull_set(scene->cull_set, elf_get_bvh_result(scene->entity_bvh, k));
+	elf_cull_set_in_frustum(scene->cull_set, scene->cur_camera);
+
+	for(k = 0; k < scene->cull_set->count; k++)
 	{
-		if(!elf_cull_entity(ent, scene->cur_camera))
+		if(elf_get_cull_set_visible(scene->cull_set, k))
 		{
-			if(scene->entity_queue_count < elf_get_list_length(scene->entity_queue))
-			{
-				elf_set_list_cur_ptr(scene->entity_queue, (elf_object*)ent);
-				elf_next_in_list(scene->entity_queue);
-			}
-			else
-			{
-				elf_append_to_list(scene->entity_queue, (elf_object*)ent);
-			}
+			ent = (elf_entity*)elf_get_cull_set_object(scene->cull_set, k);
+			if(scene->entity_queue_count < elf_get_array_length(scene->entity_queue))
+				elf_set_array_item(scene->entity_queue, scene->entity_queue_count, (elf_object*)ent);
+			else elf_append_to_array(scene->entity_queue, (elf_object*)ent);
 			scene->entity_queue_count++;
 			elf_draw_entity_without_materials(ent, &scene->shader_params);
 			ent->culled = ELF_FALSE;
-		}
-		else
-		{
-			ent->culled = ELF_TRUE;
+			ent->queue_frame = scene->draw_frame;
 		}
 	}
 
 	scene->sprite_queue_count = 0;
 	elf_begin_list(scene->sprite_queue);
 
+	elf_clear_cull_set(scene->cull_set);
 	for(spr = (elf_sprite*)elf_begin_list(scene->sprites); spr != NULL;
 		spr = (elf_sprite*)elf_next_in_list(scene->sprites))
 	{
-		if(!elf_cull_sprite(spr, scene->cur_camera))
+		spr->culled = ELF_TRUE;
+		elf_add_sprite_to_cull_set(scene->cull_set, spr);
+	}
+	elf_cull_set_in_frustum(scene->cull_set, scene->cur_camera);
+
+	for(k = 0; k < scene->cull_set->count; k++)
+	{
+		if(elf_get_cull_set_visible(scene->cull_set, k))
 		{
+			spr = (elf_sprite*)elf_get_cull_set_object(scene->cull_set, k);
 			if(scene->sprite_queue_count < elf_get_list_length(scene->sprite_queue))
 			{
 				elf_set_list_cur_ptr(scene->sprite_queue, (elf_object*)spr);
@@ -1564,15 +1928,15 @@ void elf_draw_scene(elf_scene *scene)
 			elf_draw_sprite_without_materials(spr, &scene->shader_params);
 			spr->culled = ELF_FALSE;
 		}
-		else
-		{
-			spr->culled = ELF_TRUE;
-		}
 	}
 
+	ELF_PROFILE_END();
+
 	// initiate occlusion queries
 	if(eng->occlusion_culling)
 	{
+		ELF_PROFILE_BEGIN("occlusion queries");
+
 		gfx_set_shader_params_default(&scene->shader_params);
 		elf_set_camera(scene->cur_camera, &scene->shader_params);
 		scene->shader_params.render_params.depth_write = GFX_FALSE;
@@ -1583,10 +1947,9 @@ void elf_draw_scene(elf_scene *scene)
 		scene->shader_params.render_params.offset_bias = -1.0;
 		scene->shader_params.render_params.offset_scale = -1.0;
 
-		for(i = 0, ent = (elf_entity*)elf_begin_list(scene->entity_queue);
-			i < scene->entity_queue_count && ent != NULL;
-			i++, ent = (elf_entity*)elf_next_in_list(scene->entity_queue))
+		for(i = 0; i < scene->entity_queue_count; i++)
 		{
+			ent = (elf_entity*)elf_get_item_from_array(scene->entity_queue, i);
 			gfx_begin_query(ent->query);
 			elf_draw_entity_bounding_box(ent, &scene->shader_params);
 			gfx_end_query(ent->query);
@@ -1594,6 +1957,8 @@ void elf_draw_scene(elf_scene *scene)
 
 		scene->shader_params.render_params.offset_bias = 0.0;
 		scene->shader_params.render_params.offset_scale = 0.0;
+
+		ELF_PROFILE_END();
 	}
 
 	eng->ambient_color = scene->ambient_color;
@@ -1603,6 +1968,8 @@ void elf_draw_scene(elf_scene *scene)
 		!elf_about_zero(eng->ambient_color.g) ||
 		!elf_about_zero(eng->ambient_color.b) )
 	{
+		ELF_PROFILE_BEGIN("ambient pass");
+
 		gfx_set_shader_params_default(&scene->shader_params);
 		elf_set_camera(scene->cur_camera, &scene->shader_params);
 
@@ -1610,10 +1977,9 @@ void elf_draw_scene(elf_scene *scene)
 		scene->shader_params.render_params.depth_func = GFX_EQUAL;
 		scene->shader_params.render_params.blend_mode = GFX_ADD;
 
-		for(i = 0, ent = (elf_entity*)elf_begin_list(scene->entity_queue);
-			i < scene->entity_queue_count && ent != NULL;
-			i++, ent = (elf_entity*)elf_next_in_list(scene->entity_queue))
+		for(i = 0; i < scene->entity_queue_count; i++)
 		{
+			ent = (elf_entity*)elf_get_item_from_array(scene->entity_queue, i);
 			elf_draw_entity_ambient(ent, &scene->shader_params);
 		}
 
@@ -1623,6 +1989,8 @@ void elf_draw_scene(elf_scene *scene)
 		{
 			elf_draw_sprite_ambient(spr, &scene->shader_params);
 		}
+
+		ELF_PROFILE_END();
 	}
 
 	// used for detecting if some non lit geometry has been rendered already
@@ -1641,12 +2009,13 @@ void elf_draw_scene(elf_scene *scene)
 			elf_set_camera(light->shadow_camera, &scene->shader_params);
 
 			// check are there any entities visible for the spot, if there aren't don't bother continuing, just skip to the next light
+			// the results are kept for the shadow map and the lighting pass of this light
 			found = ELF_FALSE;
-			for(i = 0, ent = (elf_entity*)elf_begin_list(scene->entity_queue);
-				i < scene->entity_queue_count && ent != NULL;
-				i++, ent = (elf_entity*)elf_next_in_list(scene->entity_queue))
+			count = elf_query_bvh_frustum(scene->entity_bvh, light->shadow_camera);
+			for(k = 0; k < count; k++)
 			{
-				if(!elf_cull_entity(ent, light->shadow_camera))
+				ent = elf_get_bvh_result(scene->entity_bvh, k);
+				if(ent->queue_frame == scene->draw_frame && !elf_cull_entity(ent, light->shadow_camera))
 				{
 					found = ELF_TRUE;
 					break;
@@ -1667,9 +2036,14 @@ void elf_draw_scene(elf_scene *scene)
 			if(!found) continue;
 		}
 
+		// one scope for each light that is drawn, named after the light
+		ELF_PROFILE_BEGIN(light->name);
+
 		// render shadow map if needed
 		if(light->light_type == ELF_SPOT_LIGHT && elf_get_light_shadow_caster(light))
 		{
+			ELF_PROFILE_BEGIN("shadow map");
+
 			gfx_set_shader_params_default(&scene->shader_params);
 			scene->shader_params.render_params.color_write = GFX_FALSE;
 			scene->shader_params.render_params.alpha_write = GFX_FALSE;
@@ -1681,22 +2055,23 @@ void elf_draw_scene(elf_scene *scene)
 			gfx_set_render_target(eng->shadow_target);
 			gfx_clear_depth_buffer(1.0);
 
-			for(ent = (elf_entity*)elf_begin_list(scene->entities); ent != NULL;
-				ent = (elf_entity*)elf_next_in_list(scene->entities))
+			elf_clear_cull_set(scene->cull_set);
+			for(k = 0; k < count; k++)
+				elf_add_entity_to_cull_set(scene->cull_set, elf_get_bvh_result(scene->entity_bvh, k));
+			for(spr = (elf_sprite*)elf_begin_list(scene->sprites); spr != NULL;
+				spr = (elf_sprite*)elf_next_in_list(scene->sprites))
 			{
-				if(!elf_cull_entity(ent, light->shadow_camera))
-				{
-					elf_draw_entity_without_materials(ent, &scene->shader_params);
-				}
+				elf_add_sprite_to_cull_set(scene->cull_set, spr);
 			}
+			elf_cull_set_in_frustum(scene->cull_set, light->shadow_camera);
 
-			for(spr = (elf_sprite*)elf_begin_list(scene->sprites); spr != NULL;
-				spr = (elf_sprite*)elf_next_in_list(scene->sprites))
+			for(k = 0; k < scene->cull_set->count; k++)
 			{
-				if(!elf_cull_sprite(spr, light->shadow_camera))
-				{
-					elf_draw_sprite_without_materials(spr, &scene->shader_params);
-				}
+				if(!elf_get_cull_set_visible(scene->cull_set, k)) continue;
+
+				if(elf_get_cull_set_object(scene->cull_set, k)->type == ELF_ENTITY)
+					elf_draw_entity_without_materials((elf_entity*)elf_get_cull_set_object(scene->cull_set, k), &scene->shader_params);
+				else elf_draw_sprite_without_materials((elf_sprite*)elf_get_cull_set_object(scene->cull_set, k), &scene->shader_params);
 			}
 
 			gfx_mul_matrix4_matrix4(elf_get_camera_projection_matrix(light->shadow_camera), bias, temp_mat1);
@@ -1706,6 +2081,8 @@ void elf_draw_scene(elf_scene *scene)
 
 			if(render_target) gfx_set_render_target(render_target);
 			else gfx_disable_render_target();
+
+			ELF_PROFILE_END();
 		}
 
 		// render lighting
@@ -1737,42 +2114,26 @@ void elf_draw_scene(elf_scene *scene)
 
 		// get the light position for culling point light entities
 		lpos = elf_get_actor_position((elf_actor*)light);
-		for(i = 0, ent = (elf_entity*)elf_begin_list(scene->entity_queue);
-			i < scene->entity_queue_count && ent != NULL;
-			i++, ent = (elf_entity*)elf_next_in_list(scene->entity_queue))
+
+		// spot and fading point lights only look at the entities the tree gives for their volume
+		if(light->light_type == ELF_POINT_LIGHT && light->fade_speed > 0.0)
+			count = elf_query_bvh_sphere(scene->entity_bvh, &lpos.x, light->distance+1.0/light->fade_speed);
+
+		if(light->light_type == ELF_SPOT_LIGHT || (light->light_type == ELF_POINT_LIGHT && light->fade_speed > 0.0))
 		{
-			// get the entity position for culling point light entities and testing against bounding sphere
-			epos = elf_get_actor_position((elf_actor*)ent);
-			epos = elf_add_vec3f_vec3f(epos, ent->bb_offset);
-			if((eng->occlusion_culling && gfx_get_query_result(ent->query) > 0) || !eng->occlusion_culling ||
-				elf_camera_inside_sphere(scene->cur_camera, &epos.x, ent->cull_radius))
+			for(k = 0; k < count; k++)
 			{
-				if(light->light_type == ELF_SPOT_LIGHT)
-				{
-					if(!elf_cull_entity(ent, light->shadow_camera))
-					{
-						elf_draw_entity(ent, &scene->shader_params);
-					}
-				}
-				else if(light->light_type == ELF_POINT_LIGHT)
-				{
-					dvec = elf_sub_vec3f_vec3f(epos, lpos);
-					dist = elf_get_vec3f_length(dvec);
-					dist -= ent->cull_radius;
-					att = 1.0-elf_float_max(dist-light->distance, 0.0)*light->fade_speed;
-					if(att > 0.0)
-					{
-						elf_draw_entity(ent, &scene->shader_params);
-					}
-				}
-				else
-				{
-					elf_draw_entity(ent, &scene->shader_params);
-				}
+				ent = elf_get_bvh_result(scene->entity_bvh, k);
+				if(ent->queue_frame == scene->draw_frame)
+					elf_draw_scene_entity_lit(scene, light, ent, lpos);
 			}
-			else
+		}
+		else
+		{
+			for(i = 0; i < scene->entity_queue_count; i++)
 			{
-				ent->culled = ELF_TRUE;
+				ent = (elf_entity*)elf_get_item_from_array(scene->entity_queue, i);
+				elf_draw_scene_entity_lit(scene, light, ent, lpos);
 			}
 		}
 
@@ -1804,9 +2165,12 @@ void elf_draw_scene(elf_scene *scene)
 				elf_draw_sprite(spr, &scene->shader_params);
 			}
 		}
+
+		ELF_PROFILE_END();
 	}
 
 	// render particles
+	ELF_PROFILE_BEGIN("draw particles");
 	gfx_set_shader_params_default(&scene->shader_params);
 	scene->shader_params.render_params.depth_write = GFX_FALSE;
 	scene->shader_params.render_params.depth_func = GFX_LEQUAL;
@@ -1814,18 +2178,44 @@ void elf_draw_scene(elf_scene *scene)
 	scene->shader_params.render_params.alpha_write = GFX_TRUE;
 	elf_set_camera(scene->cur_camera, &scene->shader_params);
 	
+	// the quads of the visible emitters are written on the worker threads in ranges of
+	// ELF_PARTICLE_JOB_SIZE particles, then sent to the gpu and drawn from here
+	elf_get_actor_position_((elf_actor*)scene->cur_camera, cam_pos);
+	elf_get_actor_orientation_((elf_actor*)scene->cur_camera, cam_orient);
+	scene->particle_camera_pos[0] = -cam_pos[0];
+	scene->particle_camera_pos[1] = -cam_pos[1];
+	scene->particle_camera_pos[2] = -cam_pos[2];
+	gfx_qua_get_inverse(cam_orient, scene->particle_camera_orient);
+
+	scene->particle_job_count = 0;
 	for(par = (elf_particles*)elf_begin_list(scene->particles); par;
 		par = (elf_particles*)elf_next_in_list(scene->particles))
 	{
-		if(!elf_cull_particles(par, scene->cur_camera))
+		if(elf_cull_particles(par, scene->cur_camera)) continue;
+
+		for(i = 0; i < par->particle_count; i += ELF_PARTICLE_JOB_SIZE)
 		{
-			elf_draw_particles(par, scene->cur_camera, &scene->shader_params);
+			count = i+ELF_PARTICLE_JOB_SIZE;
+			if(count > par->particle_count) count = par->particle_count;
+			elf_add_scene_particle_job(scene, par, i, count);
 		}
 	}
 
+	elf_run_workers(eng->workers, elf_run_scene_particle_vertices, scene, scene->particle_job_count, 1);
+
+	for(i = 0; i < scene->particle_job_count; i++)
+	{
+		if(scene->particle_jobs[i].first == 0)
+			elf_draw_particles(scene->particle_jobs[i].particles, &scene->shader_params);
+	}
+
+	ELF_PROFILE_END();
+
 	// render stuff for dof...
 	if(elf_is_dof())
 	{
+		ELF_PROFILE_BEGIN("dof depth");
+
 		gfx_set_shader_params_default(&scene->shader_params);
 		scene->shader_params.render_params.depth_write = GFX_FALSE;
 		scene->shader_params.render_params.depth_func = GFX_EQUAL;
@@ -1837,10 +2227,9 @@ void elf_draw_scene(elf_scene *scene)
 		gfx_set_shader_program_uniform_1f("elf_FocalRange", elf_get_dof_focal_range());
 		gfx_set_shader_program_uniform_1f("elf_FocalDistance", elf_get_dof_focal_distance());
 
-		for(i = 0, ent = (elf_entity*)elf_begin_list(scene->entity_queue);
-			i < scene->entity_queue_count && ent != NULL;
-			i++, ent = (elf_entity*)elf_next_in_list(scene->entity_queue))
+		for(i = 0; i < scene->entity_queue_count; i++)
 		{
+			ent = (elf_entity*)elf_get_item_from_array(scene->entity_queue, i);
 			if((!ent->culled || !eng->occlusion_culling) && ent->model && ent->model->vertex_array && ent->visible)
 			{
 				elf_pre_draw_entity(ent);
@@ -1874,6 +2263,8 @@ void elf_draw_scene(elf_scene *scene)
 				gfx_draw_vertex_array(eng->sprite_vertex_array, 12, GFX_TRIANGLES);
 			}
 		}
+
+		ELF_PROFILE_END();
 	}
 
 	// reset state just to be sure...
@@ -1882,11 +2273,8 @@ void elf_draw_scene(elf_scene *scene)
 
 	// keep the query lists compact
 
-	if(elf_get_list_length(scene->entity_queue) > scene->entity_queue_count)
-	{
-		ent = (elf_entity*)elf_rbegin_list(scene->entity_queue);
-		if(ent) elf_remove_from_list(scene->entity_queue, (elf_object*)ent);
-	}
+	if(elf_get_array_length(scene->entity_queue) > scene->entity_queue_count)
+		elf_truncate_array(scene->entity_queue, elf_get_array_length(scene->entity_queue)-1);
 
 	if(elf_get_list_length(scene->sprite_queue) > scene->sprite_queue_count)
 	{
@@ -1901,6 +2289,7 @@ void elf_draw_scene_debug(elf_scene *scene)
 	elf_light *lig;
 	elf_camera *cam;
 	elf_sprite *spr;
+	int i;
 
 	if(!scene->cur_camera) return;
 
@@ -1910,9 +2299,9 @@ void elf_draw_scene_debug(elf_scene *scene)
 	scene->shader_params.render_params.blend_mode = GFX_ADD;
 	elf_set_camera(scene->cur_camera, &scene->shader_params);
 
-	for(ent = (elf_entity*)elf_begin_list(scene->entities); ent != NULL;
-		ent = (elf_entity*)elf_next_in_list(scene->entities))
+	for(i = 0; i < elf_get_array_length(scene->entities); i++)
 	{
+		ent = (elf_entity*)elf_get_item_from_array(scene->entities, i);
 		elf_draw_entity_debug(ent, &scene->shader_params);
 	}
 
@@ -51,6 +51,8 @@ elf_script* elf_create_script_from_file(const char *file_path)
 
 void elf_destroy_script(elf_script *script)
 {
+	elf_release_script_function(script);
+
 	if(script->name) elf_destroy_string(script->name);
 	if(script->file_path) elf_destroy_string(script->file_path);
 	if(script->text) elf_destroy_string(script->text);
@@ -72,6 +74,8 @@ const char* elf_get_script_file_path(elf_script *script)
 
 void elf_set_script_text(elf_script *script, const char *text)
 {
+	elf_release_script_function(script);
+
 	if(script->text) elf_destroy_string(script->text);
 	script->text = NULL;
 	if(text) script->text = elf_create_string(text);
@@ -15,6 +15,13 @@ struct elf_scripting {
 	ELF_OBJECT_HEADER;
 	struct lua_State *L;
 	elf_list *cur_scripts;
+	int get_actor_ref;
+
+	int gc_mode;
+	float gc_budget;
+	int gc_step_size;
+	float gc_time;
+	int gc_cycles;
 };
 
 elf_scripting *scr = NULL;
@@ -37,9 +44,19 @@ elf_scripting* elf_create_scripting()
 	luaL_openlibs(scripting->L);
 	luaopen_elf(scripting->L);
 
+	// keep elf.GetActor at hand, it gives the actor scripts the same object as calling it from lua
+	lua_getglobal(scripting->L, "elf");
+	lua_getfield(scripting->L, -1, "GetActor");
+	scripting->get_actor_ref = luaL_ref(scripting->L, LUA_REGISTRYINDEX);
+	lua_pop(scripting->L, 1);
+
 	scripting->cur_scripts = elf_create_list();
 	elf_inc_ref((elf_object*)scripting->cur_scripts);
 
+	scripting->gc_mode = ELF_SCRIPT_GC_INCREMENTAL;
+	scripting->gc_budget = 0.001;
+	scripting->gc_step_size = 16;
+
 	return scripting;
 }
 
@@ -70,7 +87,32 @@ unsigned char elf_init_scripting()
 
 void elf_update_scripting()
 {
-	if(scr) lua_gc(scr->L, LUA_GCCOLLECT, 0);
+	double start;
+
+	if(!scr) return;
+
+	start = elf_get_time();
+
+	if(scr->gc_mode == ELF_SCRIPT_GC_FULL)
+	{
+		lua_gc(scr->L, LUA_GCCOLLECT, 0);
+		scr->gc_cycles++;
+	}
+	else
+	{
+		// step the incremental collector until the frame budget is used up or a cycle ends,
+		// lua keeps stepping on its own as memory is allocated in between
+		do
+		{
+			if(lua_gc(scr->L, LUA_GCSTEP, scr->gc_step_size))
+			{
+				scr->gc_cycles++;
+				break;
+			}
+		} while(elf_get_time()-start < scr->gc_budget);
+	}
+
+	scr->gc_time = elf_get_time()-start;
 }
 
 void elf_deinit_scripting()
@@ -117,19 +159,55 @@ unsigned char elf_run_string(const char *str)
 	return ELF_TRUE;
 }
 
-unsigned char elf_run_script(elf_script *script)
+unsigned char elf_compile_script(elf_script *script)
 {
 	int err;
-	
+
 	if(!scr || !script->text || script->error) return ELF_FALSE;
+	if(script->function_ref) return ELF_TRUE;
+
+	err = luaL_loadbuffer(scr->L, script->text, strlen(script->text), script->name ? script->name : script->text);
+	if(err)
+	{
+		elf_set_error(ELF_CANT_RUN_SCRIPT, "error: can't compile script \"%s\"\n%s\n", script->name, lua_tostring(scr->L, -1));
+		lua_pop(scr->L, 1);
+
+		script->error = ELF_TRUE;
+		return ELF_FALSE;
+	}
+
+	// the compiled chunk stays in the registry until the text changes
+	script->function_ref = luaL_ref(scr->L, LUA_REGISTRYINDEX);
+
+	return ELF_TRUE;
+}
+
+void elf_release_script_function(elf_script *script)
+{
+	if(scr && script->function_ref) luaL_unref(scr->L, LUA_REGISTRYINDEX, script->function_ref);
+	script->function_ref = 0;
+}
+
+unsigned char elf_call_script(elf_script *script, int arg_count)
+{
+	int err;
+
+	if(!elf_compile_script(script))
+	{
+		lua_pop(scr->L, arg_count);
+		return ELF_FALSE;
+	}
+
+	lua_rawgeti(scr->L, LUA_REGISTRYINDEX, script->function_ref);
+	lua_insert(scr->L, -(arg_count+1));
 
 	elf_append_to_list(scr->cur_scripts, (elf_object*)script);
 
-	err = 0;
-	err = luaL_dostring(scr->L, script->text);
+	err = lua_pcall(scr->L, arg_count, 0, 0);
 	if(err)
 	{
 		elf_set_error(ELF_CANT_RUN_SCRIPT, "error: can't run script \"%s\"\n%s\n", script->name, lua_tostring(scr->L, -1));
+		lua_pop(scr->L, 1);
 
 		script->error = ELF_TRUE;
 		elf_rbegin_list(scr->cur_scripts);
@@ -142,3 +220,104 @@ unsigned char elf_run_script(elf_script *script)
 	return ELF_TRUE;
 }
 
+unsigned char elf_run_script(elf_script *script)
+{
+	if(!scr || !script->text || script->error) return ELF_FALSE;
+
+	return elf_call_script(script, 0);
+}
+
+unsigned char elf_run_actor_script(elf_script *script, int event)
+{
+	unsigned char result;
+
+	if(!scr || !script->text || script->error) return ELF_FALSE;
+
+	// the actor set to eng->actor is passed as the first argument and, like before, as the
+	// global "me". gui events also go to the global "event" and the second argument
+	lua_rawgeti(scr->L, LUA_REGISTRYINDEX, scr->get_actor_ref);
+	if(lua_pcall(scr->L, 0, 1, 0))
+	{
+		lua_pop(scr->L, 1);
+		lua_pushnil(scr->L);
+	}
+	lua_pushvalue(scr->L, -1);
+	lua_setglobal(scr->L, "me");
+
+	if(event)
+	{
+		lua_pushinteger(scr->L, event);
+		lua_pushvalue(scr->L, -1);
+		lua_setglobal(scr->L, "event");
+	}
+
+	result = elf_call_script(script, event ? 2 : 1);
+
+	lua_pushnil(scr->L);
+	lua_setglobal(scr->L, "me");
+
+	if(event)
+	{
+		lua_pushinteger(scr->L, 0);
+		lua_setglobal(scr->L, "event");
+	}
+
+	return result;
+}
+
+void elf_set_script_gc_mode(int mode)
+{
+	if(!scr || (mode != ELF_SCRIPT_GC_FULL && mode != ELF_SCRIPT_GC_INCREMENTAL)) return;
+	scr->gc_mode = mode;
+}
+
+int elf_get_script_gc_mode()
+{
+	if(!scr) return 0;
+	return scr->gc_mode;
+}
+
+void elf_set_script_gc_budget(float budget)
+{
+	if(!scr) return;
+	scr->gc_budget = budget;
+	if(scr->gc_budget < 0.0) scr->gc_budget = 0.0;
+}
+
+float elf_get_script_gc_budget()
+{
+	if(!scr) return 0.0;
+	return scr->gc_budget;
+}
+
+void elf_set_script_gc_step_size(int size)
+{
+	if(!scr) return;
+	scr->gc_step_size = size;
+	if(scr->gc_step_size < 1) scr->gc_step_size = 1;
+}
+
+int elf_get_script_gc_step_size()
+{
+	if(!scr) return 0;
+	return scr->gc_step_size;
+}
+
+float elf_get_script_memory()
+{
+	if(!scr) return 0.0;
+	return (float)lua_gc(scr->L, LUA_GCCOUNT, 0)+(float)lua_gc(scr->L, LUA_GCCOUNTB, 0)/1024.0;
+}
+
+float elf_get_script_gc_time()
+{
+	if(!scr) return 0.0;
+	return scr->gc_time;
+}
+
+int elf_get_script_gc_cycles()
+{
+	if(!scr) return 0;
+	return scr->gc_cycles;
+}
+
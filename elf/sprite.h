@@ -36,6 +36,7 @@ elf_sprite* elf_create_sprite(const char *name)
 
 void elf_update_sprite(elf_sprite *sprite)
 {
+	elf_sync_actor_transform((elf_actor*)sprite);
 	elf_update_actor((elf_actor*)sprite);
 }
 
@@ -191,6 +192,13 @@ unsigned char elf_cull_sprite(elf_sprite *sprite, elf_camera *camera)
 	return !elf_sphere_inside_frustum(camera, &sprite->position.x, sprite->cull_radius);
 }
 
+void elf_add_sprite_to_cull_set(elf_cull_set *set, elf_sprite *sprite)
+{
+	if(!sprite->material || !sprite->visible) return;
+
+	elf_add_sphere_to_cull_set(set, (elf_object*)sprite, &sprite->position.x, sprite->cull_radius);
+}
+
 void elf_draw_sprite(elf_sprite *sprite, gfx_shader_params *shader_params)
 {
 	unsigned char light_type;
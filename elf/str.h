@@ -244,6 +244,43 @@ int elf_rfind_chars_from_string(const char *str, char *chrs)
 	return result;
 }
 
+unsigned int elf_get_utf8_char(const char *str, int *pos)
+{
+	const unsigned char *c;
+	unsigned int code;
+	int length;
+	int i;
+
+	c = (const unsigned char*)&str[*pos];
+
+	if(c[0] < 0x80) length = 1;
+	else if((c[0]&0xE0) == 0xC0) length = 2;
+	else if((c[0]&0xF0) == 0xE0) length = 3;
+	else if((c[0]&0xF8) == 0xF0) length = 4;
+	else
+	{
+		// a stray continuation byte or garbage, skip the byte
+		(*pos)++;
+		return 0xFFFD;
+	}
+
+	code = length == 1 ? c[0] : c[0]&(0xFF>>(length+1));
+	for(i = 1; i < length; i++)
+	{
+		// cut short, the terminator is never stepped over
+		if((c[i]&0xC0) != 0x80)
+		{
+			*pos += i;
+			return 0xFFFD;
+		}
+		code = (code<<6)|(c[i]&0x3F);
+	}
+
+	*pos += length;
+
+	return code;
+}
+
 char* elf_get_file_folder(const char *file_path)
 {
 	char *str;
@@ -128,6 +128,7 @@ unsigned char elf_load_texture_data(elf_texture *texture)
 	FILE *file;
 	elf_pak *pak;
 	elf_pak_index *index;
+	elf_pak_reader reader;
 	int magic;
 	char name[64];
 	unsigned char type;
@@ -142,47 +143,43 @@ unsigned char elf_load_texture_data(elf_texture *texture)
 		if(!pak) return ELF_FALSE;
 
 		index = elf_get_pak_index_by_name(pak, texture->name, ELF_TEXTURE);
-		if(!index)
+		if(!index || !elf_seek_pak_index(pak, index, &reader))
 		{
 			elf_set_error(ELF_INVALID_FILE, "error: couldn't fine index for \"%s//%s\"\n", texture->file_path, texture->name);
 			elf_destroy_pak(pak);
 			return ELF_FALSE;
 		}
 
-		file = fopen(pak->file_path, "rb");
-		fseek(file, elf_get_pak_index_offset(index), SEEK_SET);
-		if(feof(file)) return ELF_FALSE;
-
-		fread((char*)&magic, sizeof(int), 1, file);
+		elf_read_from_pak((char*)&magic, sizeof(int), 1, &reader);
 
 		if(magic != 179532108)
 		{
 			elf_set_error(ELF_INVALID_FILE, "error: invalid texture \"%s//%s\", wrong magic number\n", texture->file_path, texture->name);
+			elf_close_pak_reader(&reader);
 			elf_destroy_pak(pak);
-			fclose(file);
 			return ELF_FALSE;
 		}
 
-		fread(name, sizeof(char), 64, file);
-		fread((char*)&type, sizeof(unsigned char), 1, file);
+		elf_read_from_pak(name, sizeof(char), 64, &reader);
+		elf_read_from_pak((char*)&type, sizeof(unsigned char), 1, &reader);
 
 		if(type == 1)
 		{
-			fread((char*)&texture->data_size, sizeof(int), 1, file);
+			elf_read_from_pak((char*)&texture->data_size, sizeof(int), 1, &reader);
 	 
 			texture->data = (char*)malloc(texture->data_size);
-			fread((char*)texture->data, 1, texture->data_size, file);
+			elf_read_from_pak((char*)texture->data, 1, texture->data_size, &reader);
 		}
 		else
 		{
 			elf_set_error(ELF_UNKNOWN_FORMAT, "error: can't load texture \"%s//%s\", unknown format\n", texture->file_path, texture->name);
+			elf_close_pak_reader(&reader);
 			elf_destroy_pak(pak);
-			fclose(file);
 			return ELF_FALSE;
 		}
 
+		elf_close_pak_reader(&reader);
 		elf_destroy_pak(pak);
-		fclose(file);
 	}
 	else
 	{
@@ -0,0 +1,175 @@
+
+// threads, mutexes and conditions on top of the system apis. they used to come from glfw, but
+// glfw 2 refuses everything before glfwInit and that needs a display on x11, which a headless
+// machine doesn't have.
+
+#ifdef ELF_WINDOWS
+DWORD WINAPI elf_run_thread(LPVOID arg)
+#else
+void* elf_run_thread(void *arg)
+#endif
+{
+	elf_thread *thread;
+
+	thread = (elf_thread*)arg;
+	thread->func(thread->arg);
+
+	return 0;
+}
+
+elf_thread* elf_create_thread(void (*func)(void *arg), void *arg)
+{
+	elf_thread *thread;
+
+	thread = (elf_thread*)malloc(sizeof(elf_thread));
+	memset(thread, 0x0, sizeof(elf_thread));
+
+	thread->func = func;
+	thread->arg = arg;
+
+#ifdef ELF_WINDOWS
+	thread->handle = CreateThread(NULL, 0, elf_run_thread, thread, 0, NULL);
+	if(!thread->handle)
+#else
+	if(pthread_create(&thread->handle, NULL, elf_run_thread, thread))
+#endif
+	{
+		free(thread);
+		return NULL;
+	}
+
+	return thread;
+}
+
+void elf_wait_thread(elf_thread *thread)
+{
+#ifdef ELF_WINDOWS
+	WaitForSingleObject(thread->handle, INFINITE);
+	CloseHandle(thread->handle);
+#else
+	pthread_join(thread->handle, NULL);
+#endif
+
+	free(thread);
+}
+
+void elf_yield_thread()
+{
+#ifdef ELF_WINDOWS
+	SwitchToThread();
+#else
+	sched_yield();
+#endif
+}
+
+int elf_get_processor_count()
+{
+#ifdef ELF_WINDOWS
+	SYSTEM_INFO info;
+
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
+#else
+	long count;
+
+	count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? (int)count : 1;
+#endif
+}
+
+elf_mutex* elf_create_mutex()
+{
+	elf_mutex *mutex;
+
+	mutex = (elf_mutex*)malloc(sizeof(elf_mutex));
+	memset(mutex, 0x0, sizeof(elf_mutex));
+
+#ifdef ELF_WINDOWS
+	InitializeCriticalSection(&mutex->handle);
+#else
+	if(pthread_mutex_init(&mutex->handle, NULL))
+	{
+		free(mutex);
+		return NULL;
+	}
+#endif
+
+	return mutex;
+}
+
+void elf_destroy_mutex(elf_mutex *mutex)
+{
+#ifdef ELF_WINDOWS
+	DeleteCriticalSection(&mutex->handle);
+#else
+	pthread_mutex_destroy(&mutex->handle);
+#endif
+
+	free(mutex);
+}
+
+void elf_lock_mutex(elf_mutex *mutex)
+{
+#ifdef ELF_WINDOWS
+	EnterCriticalSection(&mutex->handle);
+#else
+	pthread_mutex_lock(&mutex->handle);
+#endif
+}
+
+void elf_unlock_mutex(elf_mutex *mutex)
+{
+#ifdef ELF_WINDOWS
+	LeaveCriticalSection(&mutex->handle);
+#else
+	pthread_mutex_unlock(&mutex->handle);
+#endif
+}
+
+elf_cond* elf_create_cond()
+{
+	elf_cond *cond;
+
+	cond = (elf_cond*)malloc(sizeof(elf_cond));
+	memset(cond, 0x0, sizeof(elf_cond));
+
+#ifdef ELF_WINDOWS
+	InitializeConditionVariable(&cond->handle);
+#else
+	if(pthread_cond_init(&cond->handle, NULL))
+	{
+		free(cond);
+		return NULL;
+	}
+#endif
+
+	return cond;
+}
+
+void elf_destroy_cond(elf_cond *cond)
+{
+#ifndef ELF_WINDOWS
+	pthread_cond_destroy(&cond->handle);
+#endif
+
+	free(cond);
+}
+
+void elf_wait_cond(elf_cond *cond, elf_mutex *mutex)
+{
+#ifdef ELF_WINDOWS
+	SleepConditionVariableCS(&cond->handle, &mutex->handle, INFINITE);
+#else
+	pthread_cond_wait(&cond->handle, &mutex->handle);
+#endif
+}
+
+void elf_broadcast_cond(elf_cond *cond)
+{
+#ifdef ELF_WINDOWS
+	WakeAllConditionVariable(&cond->handle);
+#else
+	pthread_cond_broadcast(&cond->handle);
+#endif
+}
+
@@ -80,9 +80,65 @@ struct elf_list {
 	int length;
 };
 
+struct elf_array {
+	elf_object **items;
+	int length;
+	int capacity;
+};
+
+#define ELF_LOG_SLOT_COUNT	1024
+#define ELF_LOG_SLOT_SIZE	248
+
+struct elf_log_slot {
+	volatile unsigned int sequence;
+	int length;
+	char text[ELF_LOG_SLOT_SIZE];
+};
+
+struct elf_thread {
+#ifdef ELF_WINDOWS
+	HANDLE handle;
+#else
+	pthread_t handle;
+#endif
+	void (*func)(void *arg);
+	void *arg;
+};
+
+struct elf_mutex {
+#ifdef ELF_WINDOWS
+	CRITICAL_SECTION handle;
+#else
+	pthread_mutex_t handle;
+#endif
+};
+
+struct elf_cond {
+#ifdef ELF_WINDOWS
+	CONDITION_VARIABLE handle;
+#else
+	pthread_cond_t handle;
+#endif
+};
+
+struct elf_logger {
+	elf_log_slot slots[ELF_LOG_SLOT_COUNT];
+	volatile unsigned int write_pos;
+	volatile unsigned int read_pos;
+	volatile unsigned int dropped;
+	volatile unsigned int draining;
+	int level;
+	FILE *file;
+	int fd;
+	elf_thread *writer;
+	volatile unsigned char writer_running;
+	volatile unsigned char quit;
+};
+
 struct elf_general {
 	ELF_OBJECT_HEADER;
 	char *log;
+	elf_logger *logger;
 
 	char* err_str;
 	int err_code;
@@ -101,18 +157,38 @@ struct elf_general {
 
 	int global_ref_count;
 	int global_obj_count;
+	int created_obj_count;
 
 	int global_ref_count_table[ELF_OBJECT_TYPE_COUNT];
 };
 
+#define ELF_AUDIO_STREAM_BUFFERS	8
+#define ELF_AUDIO_MAX_STREAM_BUFFERS	16
+
 struct elf_config {
 	ELF_OBJECT_HEADER;
 	int window_size[2];
 	unsigned char fullscreen;
+	unsigned char headless;
 	float texture_anisotropy;
 	int shadow_map_size;
 	char *start;
 	char *log;
+	int log_level;
+	int script_gc_mode;
+	float script_gc_budget;
+	int script_gc_step_size;
+	float fixed_tick_rate;
+	int max_ticks_per_frame;
+	int audio_stream_buffers;
+	char *shader_cache;
+	unsigned char pak_benchmark;
+	unsigned char cull_benchmark;
+	unsigned char skin_benchmark;
+	unsigned char scene_benchmark;
+	int benchmark_ticks;
+	float benchmark_tick_rate;
+	char *benchmark_report;
 };
 
 struct elf_key_event {
@@ -144,6 +220,7 @@ struct elf_context {
 	int width;
 	int height;
 	unsigned char fullscreen;
+	unsigned char headless;
 	char *title;
 	int multisamples;
 	elf_list *video_modes;
@@ -168,11 +245,14 @@ struct elf_engine {
 
 	int fps;
 	elf_timer *fps_timer;
-	elf_timer *fps_limit_timer;
 	elf_timer *time_sync_timer;
 	unsigned int frames;
 	int fps_limit;
 	float tick_rate;
+	float fixed_tick_rate;
+	int max_ticks_per_frame;
+	int frame_ticks;
+	double tick_time;
 	float speed;
 	float sync;
 	unsigned char f10_exit;
@@ -194,6 +274,10 @@ struct elf_engine {
 
 	elf_scene *scene;
 	elf_gui *gui;
+	elf_scene_loader *scene_loader;
+	elf_workers *workers;
+	elf_profiler *profiler;
+	elf_frame_pacer *pacer;
 
 	elf_object *actor;
 };
@@ -377,6 +461,9 @@ struct elf_entity {
 	unsigned char visible;
 	unsigned char culled;
 	unsigned char non_lit_flag;
+
+	int bvh_leaf;
+	unsigned int queue_frame;
 };
 
 struct elf_light {
@@ -428,21 +515,25 @@ struct elf_armature {
 	elf_list *root_bones;
 	elf_bone **bones;
 	float cur_frame;
+	// bone poses for pose_frame as padded 3x4 matrices, 16 floats per bone
+	float *matrices;
+	float pose_frame;
+	unsigned char pose_valid;
 	elf_vec3f bb_min;
 	elf_vec3f bb_max;
 };
 
-struct elf_particle {
-	ELF_OBJECT_HEADER;
-	float size;
-	float size_growth;
-	float rotation;
-	float rotation_growth;
-	elf_color color;
-	float life_span;
-	float fade_speed;
-	elf_vec3f position;
-	elf_vec3f velocity;
+#define ELF_SKIN_JOB_SIZE	1024
+
+// the buffers of one entity being skinned, its vertices are split over the worker threads
+struct elf_skin_job {
+	elf_armature *armature;
+	float *weights;
+	int *boneids;
+	float *orig_vertices;
+	float *orig_normals;
+	float *vertices;
+	float *normals;
 };
 
 struct elf_particles {
@@ -450,7 +541,20 @@ struct elf_particles {
 
 	int max_count;
 	unsigned char draw_mode;
-	elf_list *particles;
+
+	// a pool of max_count particles, one array per attribute, the first particle_count are alive
+	int particle_count;
+	float *particle_data;
+	float *position[3];
+	float *velocity[3];
+	float *color[4];
+	float *size;
+	float *size_growth;
+	float *rotation;
+	float *rotation_growth;
+	float *life_span;
+	float *fade_speed;
+
 	elf_texture *texture;
 	elf_model *model;
 	elf_entity *entity;
@@ -461,6 +565,7 @@ struct elf_particles {
 
 	float spawn_delay;
 	unsigned char spawn;
+	unsigned int random_state;
 	float cur_time;
 	elf_vec3f gravity;
 	float size_min;
@@ -486,6 +591,15 @@ struct elf_particles {
 	elf_vec3f cull_aabb_max;
 };
 
+#define ELF_PARTICLE_JOB_SIZE	1024
+
+// a range of the particles of one emitter, handed to the worker threads
+struct elf_particle_job {
+	elf_particles *particles;
+	int first;
+	int last;
+};
+
 struct elf_sprite {
 	ELF_ACTOR_HEADER;
 
@@ -506,6 +620,41 @@ struct elf_sprite {
 	unsigned char non_lit_flag;
 };
 
+typedef struct elf_bvh_node {
+	float min[3];
+	float max[3];
+	int parent;
+	int children[2];
+	int height;
+	elf_entity *entity;
+} elf_bvh_node;
+
+struct elf_bvh {
+	elf_bvh_node *nodes;
+	int node_capacity;
+	int node_count;
+	int free_node;
+	int root;
+	int *stack;
+	elf_entity **results;
+	int result_count;
+};
+
+struct elf_cull_set {
+	float *center[3];
+	float *extent[3];
+	float *radius;
+	elf_object **objects;
+	unsigned int *visible;
+	int count;
+	int capacity;
+};
+
+// what elf_set_scene_transform_states does with the transforms of the actors
+#define ELF_TRANSFORM_SAVE	0
+#define ELF_TRANSFORM_UPDATE	1
+#define ELF_TRANSFORM_RESET	2
+
 struct elf_scene {
 	ELF_RESOURCE_HEADER;
 	char *file_path;
@@ -518,18 +667,39 @@ struct elf_scene {
 	elf_list *materials;
 	elf_list *models;
 	elf_list *cameras;
-	elf_list *entities;
+	elf_array *entities;
 	elf_list *lights;
 	elf_list *armatures;
 	elf_list *particles;
 	elf_list *sprites;
 
-	elf_list *entity_queue;
+	elf_bvh *entity_bvh;
+	unsigned int draw_frame;
+	elf_cull_set *cull_set;
+
+	elf_array *entity_queue;
 	int entity_queue_count;
 
+	// the entities as they were when the scripts started, kept alive until they have all run
+	elf_array *entity_updates;
+
 	elf_list *sprite_queue;
 	int sprite_queue_count;
 
+	// the entities that moved since the last frame, readied on the worker threads
+	elf_entity **pre_draw_entities;
+	gfx_transform **pre_draw_transforms;
+	int pre_draw_count;
+	int pre_draw_capacity;
+
+	// emitters are stepped and their quads written on the worker threads
+	elf_particle_job *particle_jobs;
+	int particle_job_count;
+	int particle_job_capacity;
+	float particle_sync;
+	float particle_camera_pos[3];
+	float particle_camera_orient[4];
+
 	elf_physics_world *world;
 	elf_physics_world *dworld;
 
@@ -548,6 +718,49 @@ struct elf_pak_index {
 	unsigned char index_type;
 	char *name;
 	unsigned int offset;
+	unsigned char compression;
+	unsigned int raw_size;
+	unsigned int stored_size;
+	unsigned int hash;
+	elf_decoded_texture *decoded_texture;
+	elf_decoded_model *decoded_model;
+};
+
+struct elf_pak_reader {
+	const unsigned char *data;
+	unsigned int size;
+	unsigned int pos;
+	unsigned char *buffer;
+};
+
+struct elf_decoded_texture {
+	int error;
+	const char *error_str;
+	char name[64];
+	int width;
+	int height;
+	int bpp;
+	unsigned char *data;
+};
+
+struct elf_decoded_model {
+	int error;
+	const char *error_str;
+	char name[64];
+	int vertice_count;
+	int frame_count;
+	int indice_count;
+	int area_count;
+	unsigned char is_tex_coords;
+	float *vertices;
+	float *normals;
+	float *tex_coords;
+	unsigned int *index;
+	int *area_indice_counts;
+	float *weights;
+	int *boneids;
+	elf_vec3f bb_min;
+	elf_vec3f bb_max;
 };
 
 struct elf_pak {
@@ -555,6 +768,15 @@ struct elf_pak {
 	char *file_path;
 	elf_list *indexes;
 
+	int version;
+
+	unsigned char *data;
+	unsigned int data_size;
+	unsigned char mapped;
+
+	elf_pak_index **index_table;
+	int index_table_size;
+
 	int texture_count;
 	int material_count;
 	int model_count;
@@ -566,6 +788,118 @@ struct elf_pak {
 	int script_count;
 };
 
+#define ELF_MAX_LOADER_THREADS	8
+
+struct elf_scene_loader {
+	ELF_OBJECT_HEADER;
+	elf_pak *pak;
+	elf_scene *scene;
+
+	// textures and models are decoded by the worker threads
+	elf_pak_index **jobs;
+	int job_count;
+	int next_job;
+	int jobs_done;
+	unsigned char cancel;
+	elf_mutex *mutex;
+	elf_thread *threads[ELF_MAX_LOADER_THREADS];
+	int thread_count;
+
+	// everything else is built on the main thread, a bit every frame
+	elf_pak_index **indexes;
+	int index_count;
+	int cur_index;
+	unsigned char scene_read;
+	float frame_budget;
+};
+
+#define ELF_MAX_WORKER_THREADS	32
+#define ELF_ENTITY_JOB_SIZE	64
+#define ELF_MAX_WORKER_TASKS	16
+
+// counts the tasks queued against it that haven't finished yet
+struct elf_worker_fence {
+	volatile int pending;
+};
+
+struct elf_worker_task {
+	void (*func)(void *data, int first, int last);
+	void *data;
+	int batch;
+
+	// slice i is [next[i], end[i]), one per thread and the last one for the main thread
+	int slice_count;
+	volatile int next[ELF_MAX_WORKER_THREADS+1];
+	int end[ELF_MAX_WORKER_THREADS+1];
+	volatile int remaining;
+	volatile int users;
+	volatile int active;
+
+	elf_worker_fence *after;
+	elf_worker_fence *fence;
+};
+
+struct elf_workers {
+	elf_mutex *mutex;
+	elf_cond *start_cond;
+	elf_thread *threads[ELF_MAX_WORKER_THREADS];
+	int thread_count;
+	volatile int started;
+	volatile int quit;
+
+	elf_worker_task tasks[ELF_MAX_WORKER_TASKS];
+};
+
+#define ELF_PROFILE_FRAME_COUNT	120
+#define ELF_PROFILE_MAX_SCOPES	256
+#define ELF_PROFILE_MAX_DEPTH	32
+#define ELF_PROFILE_NAME_LENGTH	32
+
+struct elf_profile_scope {
+	char name[ELF_PROFILE_NAME_LENGTH];
+	double start;
+	double end;
+	int depth;
+};
+
+struct elf_profile_frame {
+	double start;
+	double end;
+	int scope_count;
+	elf_profile_scope scopes[ELF_PROFILE_MAX_SCOPES];
+};
+
+struct elf_profiler {
+	elf_profile_frame *frames;
+	int cur_frame;
+	int frame_count;
+	int stack[ELF_PROFILE_MAX_DEPTH];
+	int depth;
+	unsigned char enabled;
+	unsigned char in_frame;
+};
+
+#define ELF_PACER_SAMPLE_COUNT	120
+#define ELF_PACER_SPIN_TIME	0.0005
+#define ELF_PACER_MIN_SPIN_TIME	0.0002
+#define ELF_PACER_MAX_SPIN_TIME	0.004
+
+struct elf_frame_pacer {
+	int mode;
+	double deadline;
+	double release;
+	double work_time;
+	double spin_time;
+	double samples[ELF_PACER_SAMPLE_COUNT];
+	int cur_sample;
+	int sample_count;
+	int late_frames;
+};
+
+#define ELF_BENCH_SEED	1234
+#define ELF_BENCH_BONE_COUNT	8
+#define ELF_BENCH_MAX_TIMINGS	64
+
 struct elf_post_process {
 	ELF_OBJECT_HEADER;
 
@@ -624,21 +958,41 @@ struct elf_script {
 	char *file_path;
 	char *text;
 	unsigned char error;
+	// registry reference of the compiled text, 0 until the script is first run
+	int function_ref;
 };
 
-typedef struct elf_character {
-	char code;
-	gfx_texture *texture;
-	int offset_x, offset_y;
-} elf_character;
+#define ELF_FONT_MIN_ATLAS_SIZE		256
+#define ELF_FONT_MAX_ATLAS_SIZE		4096
+#define ELF_FONT_GLYPH_PADDING		1
+#define ELF_FONT_MIN_TEXT_GLYPHS	256
+
+struct elf_glyph {
+	unsigned int code;
+	int width, height;
+	int advance;
+	int offset_y;
+	// region of the glyph in the atlas
+	float tx, ty, twidth, theight;
+};
 
 struct elf_font {
 	ELF_OBJECT_HEADER;
 	char *name;
 	char *file_path;
 	int size;
-	elf_character chars[128];
+	gfx_texture *atlas;
+	// sorted by code, ascii points straight to the glyph or is -1
+	elf_glyph *glyphs;
+	int glyph_count;
+	int ascii[128];
 	int offset_y;
+	// the text laid out since elf_begin_font_text, six vertices a glyph
+	gfx_vertex_data *vertex_data;
+	gfx_vertex_data *tex_coord_data;
+	gfx_vertex_array *vertex_array;
+	int text_capacity;
+	int text_glyphs;
 };
 
 struct elf_area {
@@ -714,6 +1068,30 @@ struct elf_check_box {
 	elf_texture *on;
 };
 
+#define ELF_GUI_MIN_QUADS		256
+
+typedef struct elf_gui_quad {
+	int batch;
+	float x, y, width, height;
+	float tx, ty, twidth, theight;
+	elf_color color;
+} elf_gui_quad;
+
+// quads with the same texture and clip area, drawn with one call
+typedef struct elf_gui_batch {
+	gfx_texture *texture;
+	elf_area clip;
+	elf_area bounds;
+	int quad_count;
+	int first;
+} elf_gui_batch;
+
+// the visible part of an object, in draw order
+typedef struct elf_gui_hit {
+	elf_gui_object *object;
+	elf_area area;
+} elf_gui_hit;
+
 struct elf_gui {
 	ELF_GUI_OBJECT_HEADER;
 	elf_font *def_font;
@@ -725,6 +1103,24 @@ struct elf_gui {
 
 	unsigned char update_size;
 
+	// the draw list, rebuilt only when an object changed
+	unsigned char dirty;
+	elf_text_field *drawn_text_field;
+	elf_gui_quad *quads;
+	int quad_count;
+	int quad_capacity;
+	elf_gui_batch *batches;
+	int batch_count;
+	int batch_capacity;
+	elf_gui_hit *hits;
+	int hit_count;
+	int hit_capacity;
+	gfx_vertex_data *vertex_data;
+	gfx_vertex_data *tex_coord_data;
+	gfx_vertex_data *color_data;
+	gfx_vertex_array *vertex_array;
+	int buffer_capacity;
+
 	int cur_key;
 	float key_step;
 	unsigned char key_repeat;
@@ -738,7 +1134,7 @@ struct elf_server {
 	ENetHost* host;
 	ENetAddress address;
 	ENetEvent event;
-	GLFWthread thread;
+	elf_thread *thread;
 };
 
 struct elf_client {
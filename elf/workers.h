@@ -0,0 +1,269 @@
+
+// a pool of threads for splitting cpu work of the main thread over the other cores. a loop is
+// handed out as a task, its range is cut into one contiguous slice per thread and every thread
+// takes batches off the front of its own slice, then steals batches from the other slices once
+// its own runs dry. tasks are only queued from the main thread. elf_run_workers runs a loop and
+// returns when it is done, elf_run_workers_async returns right away and counts the task in a
+// fence, a task can also wait for the tasks of another fence to finish before it starts. the
+// main thread works on the tasks while it waits. the loop bodies must not touch gfx or create
+// elf objects.
+
+unsigned char elf_run_worker_task_batch(elf_workers *workers, elf_worker_task *task, int slice)
+{
+	elf_worker_fence *fence;
+	int first;
+	int last;
+
+	// a plain look first, the threads that are out of work would otherwise keep bumping next
+	if(task->next[slice] >= task->end[slice]) return ELF_FALSE;
+
+	first = elf_atomic_add(&task->next[slice], task->batch);
+	if(first >= task->end[slice]) return ELF_FALSE;
+
+	last = first+task->batch;
+	if(last > task->end[slice]) last = task->end[slice];
+
+	task->func(task->data, first, last);
+
+	// whoever does the last items retires the task
+	if(elf_atomic_add(&task->remaining, -(last-first)) == last-first)
+	{
+		fence = task->fence;
+		task->active = ELF_FALSE;
+		if(fence) elf_atomic_add(&fence->pending, -1);
+
+		// the tasks after this fence may be ready now
+		elf_lock_mutex(workers->mutex);
+		elf_broadcast_cond(workers->start_cond);
+		elf_unlock_mutex(workers->mutex);
+	}
+
+	return ELF_TRUE;
+}
+
+unsigned char elf_run_worker_jobs(elf_workers *workers, int idx)
+{
+	elf_worker_task *task;
+	unsigned char ran;
+	int i, j;
+
+	ran = ELF_FALSE;
+
+	for(i = 0; i < ELF_MAX_WORKER_TASKS && !ran; i++)
+	{
+		task = &workers->tasks[i];
+
+		// a task isn't recycled while anyone is looking at it
+		elf_atomic_add(&task->users, 1);
+
+		if(task->active && (!task->after || task->after->pending < 1))
+		{
+			for(j = 0; j < task->slice_count && !ran; j++)
+				ran = elf_run_worker_task_batch(workers, task, (idx+j)%task->slice_count);
+		}
+
+		elf_atomic_add(&task->users, -1);
+	}
+
+	return ran;
+}
+
+unsigned char elf_has_worker_batches(elf_workers *workers)
+{
+	elf_worker_task *task;
+	int i, j;
+
+	for(i = 0; i < ELF_MAX_WORKER_TASKS; i++)
+	{
+		task = &workers->tasks[i];
+
+		if(!task->active || (task->after && task->after->pending > 0)) continue;
+
+		for(j = 0; j < task->slice_count; j++)
+		{
+			if(task->next[j] < task->end[j]) return ELF_TRUE;
+		}
+	}
+
+	return ELF_FALSE;
+}
+
+void elf_run_worker_thread(void *arg)
+{
+	elf_workers *workers;
+	int idx;
+
+	workers = (elf_workers*)arg;
+	idx = elf_atomic_add(&workers->started, 1);
+
+	while(!workers->quit)
+	{
+		if(elf_run_worker_jobs(workers, idx)) continue;
+
+		// sleep while the batches left are taken or wait on a fence, queuing or retiring a task wakes
+		// everyone up. both happen under the mutex, so the look here can't miss one
+		elf_lock_mutex(workers->mutex);
+		if(!workers->quit && !elf_has_worker_batches(workers))
+			elf_wait_cond(workers->start_cond, workers->mutex);
+		elf_unlock_mutex(workers->mutex);
+	}
+}
+
+elf_workers* elf_create_workers()
+{
+	elf_workers *workers;
+	int thread_count;
+	int i;
+
+	workers = (elf_workers*)malloc(sizeof(elf_workers));
+	memset(workers, 0x0, sizeof(elf_workers));
+
+	workers->mutex = elf_create_mutex();
+	workers->start_cond = elf_create_cond();
+
+	// the main thread works too, so one thread less than there are cores
+	thread_count = elf_get_processor_count()-1;
+	if(thread_count > ELF_MAX_WORKER_THREADS) thread_count = ELF_MAX_WORKER_THREADS;
+
+	if(workers->mutex && workers->start_cond)
+	{
+		for(i = 0; i < thread_count; i++)
+		{
+			workers->threads[i] = elf_create_thread(elf_run_worker_thread, workers);
+			if(!workers->threads[i]) break;
+			workers->thread_count++;
+		}
+	}
+
+	elf_inc_obj_count();
+
+	return workers;
+}
+
+void elf_destroy_workers(elf_workers *workers)
+{
+	int i;
+
+	if(workers->thread_count)
+	{
+		elf_lock_mutex(workers->mutex);
+		workers->quit = ELF_TRUE;
+		elf_broadcast_cond(workers->start_cond);
+		elf_unlock_mutex(workers->mutex);
+
+		for(i = 0; i < workers->thread_count; i++)
+			elf_wait_thread(workers->threads[i]);
+	}
+
+	if(workers->start_cond) elf_destroy_cond(workers->start_cond);
+	if(workers->mutex) elf_destroy_mutex(workers->mutex);
+
+	free(workers);
+
+	elf_dec_obj_count();
+}
+
+int elf_get_worker_thread_count(elf_workers *workers)
+{
+	return workers->thread_count;
+}
+
+void elf_init_worker_fence(elf_worker_fence *fence)
+{
+	fence->pending = 0;
+}
+
+unsigned char elf_is_worker_fence_done(elf_worker_fence *fence)
+{
+	return fence->pending < 1;
+}
+
+void elf_run_workers_async(elf_workers *workers, void (*func)(void *data, int first, int last), void *data, int count, int batch,
+	elf_worker_fence *after, elf_worker_fence *fence)
+{
+	elf_worker_task *task;
+	int slice_size;
+	int i;
+
+	if(count < 1) return;
+	if(batch < 1) batch = 1;
+
+	// without threads everything runs in place and in order, so whatever this depends on is done
+	if(!workers || !workers->thread_count)
+	{
+		func(data, 0, count);
+		return;
+	}
+
+	if(fence) elf_atomic_add(&fence->pending, 1);
+
+	// find a free slot, help with the queued tasks while there is none
+	task = NULL;
+	while(!task)
+	{
+		for(i = 0; i < ELF_MAX_WORKER_TASKS; i++)
+		{
+			if(!workers->tasks[i].active && workers->tasks[i].users < 1)
+			{
+				task = &workers->tasks[i];
+				break;
+			}
+		}
+
+		if(!task && !elf_run_worker_jobs(workers, workers->thread_count)) elf_yield_thread();
+	}
+
+	task->func = func;
+	task->data = data;
+	task->batch = batch;
+	task->remaining = count;
+	task->after = after;
+	task->fence = fence;
+
+	// whole batches per slice, the last slices may come out short or empty
+	task->slice_count = workers->thread_count+1;
+	slice_size = (count+task->slice_count-1)/task->slice_count;
+	slice_size = (slice_size+batch-1)/batch*batch;
+
+	for(i = 0; i < task->slice_count; i++)
+	{
+		task->next[i] = i*slice_size < count ? i*slice_size : count;
+		task->end[i] = (i+1)*slice_size < count ? (i+1)*slice_size : count;
+	}
+
+	elf_memory_barrier();
+	task->active = ELF_TRUE;
+
+	elf_lock_mutex(workers->mutex);
+	elf_broadcast_cond(workers->start_cond);
+	elf_unlock_mutex(workers->mutex);
+}
+
+void elf_wait_workers(elf_workers *workers, elf_worker_fence *fence)
+{
+	while(fence->pending > 0)
+	{
+		// the batches left are running on the other threads
+		if(!workers || !elf_run_worker_jobs(workers, workers->thread_count)) elf_yield_thread();
+	}
+}
+
+void elf_run_workers(elf_workers *workers, void (*func)(void *data, int first, int last), void *data, int count, int batch)
+{
+	elf_worker_fence fence;
+
+	if(count < 1) return;
+	if(batch < 1) batch = 1;
+
+	// not worth waking anyone up
+	if(!workers || !workers->thread_count || count <= batch)
+	{
+		func(data, 0, count);
+		return;
+	}
+
+	elf_init_worker_fence(&fence);
+	elf_run_workers_async(workers, func, data, count, batch, NULL, &fence);
+	elf_wait_workers(workers, &fence);
+}
+
@@ -31,12 +31,78 @@ void elf_write_to_log(const char *fmt, ...);
 #include "gfxtexture.h"
 #include "gfxshaderprogram.h"
 #include "gfxshadergen.h"
+#include "gfxshadercache.h"
 #include "gfxrendertarget.h"
 #include "gfxshaderparams.h"
 #include "gfxquery.h"
 #include "gfxdraw.h"
 
-unsigned char gfx_init()
+unsigned char gfx_init_gl()
+{
+	int formats;
+
+	glewInit();
+
+	if(glewIsSupported("GL_VERSION_2_0")) driver->version = 200;
+	if(glewIsSupported("GL_VERSION_2_1")) driver->version = 210;
+	if(glewIsSupported("GL_VERSION_3_0")) driver->version = 300;
+	if(glewIsSupported("GL_VERSION_3_1")) driver->version = 310;
+	if(glewIsSupported("GL_VERSION_3_2")) driver->version = 320;
+	if(glewIsSupported("GL_VERSION_3_3")) driver->version = 330;
+	if(glewIsSupported("GL_VERSION_4_0")) driver->version = 400;
+
+	if(driver->version < 200)
+	{
+		elf_write_to_log("OpenGL version 2.0 not supported!\n");
+		return GFX_FALSE;
+	}
+
+	if(!glewIsSupported("GL_EXT_framebuffer_object"))
+	{
+		elf_write_to_log("GL_EXT_framebuffer_object not supported!\n");
+		return GFX_FALSE;
+	}
+
+	if(!glewIsSupported("GL_ARB_texture_float"))
+	{
+		elf_write_to_log("GL_ARB_texture_float not supported!\n");
+		return GFX_FALSE;
+	}
+
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &driver->max_texture_size);
+	glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &driver->max_texture_image_units);
+	glGetIntegerv(GL_MAX_DRAW_BUFFERS, &driver->max_draw_buffers);
+	glGetIntegerv(GL_MAX_COLOR_ATTACHMENTS_EXT, &driver->max_color_attachments);
+	glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &driver->max_anisotropy);
+
+	elf_write_to_log("OpenGL %s; %s; %s\n", glGetString(GL_VERSION), glGetString(GL_VENDOR), glGetString(GL_RENDERER));
+
+	// cached shaders are only good for the driver that made them
+	driver->driver_hash = gfx_get_data_hash(glGetString(GL_VERSION), strlen((const char*)glGetString(GL_VERSION)), 2166136261u);
+	driver->driver_hash = gfx_get_data_hash(glGetString(GL_VENDOR), strlen((const char*)glGetString(GL_VENDOR)), driver->driver_hash);
+	driver->driver_hash = gfx_get_data_hash(glGetString(GL_RENDERER), strlen((const char*)glGetString(GL_RENDERER)), driver->driver_hash);
+
+	if(glewIsSupported("GL_ARB_get_program_binary"))
+	{
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+		if(formats > 0) driver->program_binaries = GFX_TRUE;
+	}
+
+	glClearColor(0.0, 0.0, 0.0, 1.0);
+	glClearDepth(1.0);
+
+	glShadeModel(GL_SMOOTH);
+	glFrontFace(GL_CCW);
+
+	glEnable(GL_DEPTH_TEST);
+	glEnable(GL_CULL_FACE);
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	return GFX_TRUE;
+}
+
+unsigned char gfx_init_driver(unsigned char headless)
 {
 	unsigned int *index_buffer;
 
@@ -104,57 +170,48 @@ unsigned char gfx_init()
 	driver->vertex_data_draw_modes[GFX_VERTEX_DATA_STATIC] = GL_STATIC_DRAW;
 	driver->vertex_data_draw_modes[GFX_VERTEX_DATA_DYNAMIC] = GL_DYNAMIC_DRAW;
 
+	// bytes per pixel for the memory counts, compressed formats are counted as uncompressed
+	driver->texture_pixel_sizes[GFX_LUMINANCE] = 1;
+	driver->texture_pixel_sizes[GFX_LUMINANCE_ALPHA] = 2;
+	driver->texture_pixel_sizes[GFX_RGB] = 3;
+	driver->texture_pixel_sizes[GFX_RGBA] = 4;
+	driver->texture_pixel_sizes[GFX_BGR] = 3;
+	driver->texture_pixel_sizes[GFX_BGRA] = 4;
+	driver->texture_pixel_sizes[GFX_RGB16F] = 6;
+	driver->texture_pixel_sizes[GFX_RGB32F] = 12;
+	driver->texture_pixel_sizes[GFX_RGBA16F] = 8;
+	driver->texture_pixel_sizes[GFX_RGBA32F] = 16;
+	driver->texture_pixel_sizes[GFX_ALPHA32F] = 4;
+	driver->texture_pixel_sizes[GFX_DEPTH_COMPONENT] = 4;
+	driver->texture_pixel_sizes[GFX_COMPRESSED_RGB] = 3;
+	driver->texture_pixel_sizes[GFX_COMPRESSED_RGBA] = 4;
+
 	// just inputting with values that do not make sense
 	driver->shader_config.textures = 255;
 	driver->shader_config.light = 255;
 
-	glewInit();
-
-	if(glewIsSupported("GL_VERSION_2_0")) driver->version = 200;
-	if(glewIsSupported("GL_VERSION_2_1")) driver->version = 210;
-	if(glewIsSupported("GL_VERSION_3_0")) driver->version = 300;
-	if(glewIsSupported("GL_VERSION_3_1")) driver->version = 310;
-	if(glewIsSupported("GL_VERSION_3_2")) driver->version = 320;
-	if(glewIsSupported("GL_VERSION_3_3")) driver->version = 330;
-	if(glewIsSupported("GL_VERSION_4_0")) driver->version = 400;
-
-	if(driver->version < 200)
-	{
-		elf_write_to_log("OpenGL version 2.0 not supported!\n");
-		return GFX_FALSE;
-	}
+	driver->headless = headless;
+	driver->transform_blend = 1.0;
 
-	if(!glewIsSupported("GL_EXT_framebuffer_object"))
+	if(headless)
 	{
-		elf_write_to_log("GL_EXT_framebuffer_object not supported!\n");
-		return GFX_FALSE;
+		// no context to ask, the limits of a common gl 2.1 card
+		driver->version = 210;
+		driver->max_texture_size = 8192;
+		driver->max_texture_image_units = 16;
+		driver->max_draw_buffers = 8;
+		driver->max_color_attachments = 8;
+		driver->max_anisotropy = 16.0;
+
+		elf_write_to_log("gfx: headless, nothing is rendered\n");
 	}
-
-	if(!glewIsSupported("GL_ARB_texture_float"))
+	else if(!gfx_init_gl())
 	{
-		elf_write_to_log("GL_ARB_texture_float not supported!\n");
+		free(driver);
+		driver = NULL;
 		return GFX_FALSE;
 	}
 
-	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &driver->max_texture_size);
-	glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &driver->max_texture_image_units);
-	glGetIntegerv(GL_MAX_DRAW_BUFFERS, &driver->max_draw_buffers);
-	glGetIntegerv(GL_MAX_COLOR_ATTACHMENTS_EXT, &driver->max_color_attachments);
-	glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &driver->max_anisotropy);
-
-	elf_write_to_log("OpenGL %s; %s; %s\n", glGetString(GL_VERSION), glGetString(GL_VENDOR), glGetString(GL_RENDERER));
-
-	glClearColor(0.0, 0.0, 0.0, 1.0);
-	glClearDepth(1.0);
-
-	glShadeModel(GL_SMOOTH);
-	glFrontFace(GL_CCW);
-
-	glEnable(GL_DEPTH_TEST);
-	glEnable(GL_CULL_FACE);
-
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-
 	driver->quad_vertex_data = gfx_create_vertex_data(12, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
 	driver->quad_tex_coord_data = gfx_create_vertex_data(12, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
 	driver->quad_normal_data = gfx_create_vertex_data(12, GFX_FLOAT, GFX_VERTEX_DATA_DYNAMIC);
@@ -236,11 +293,22 @@ unsigned char gfx_init()
 	return GFX_TRUE;
 }
 
+unsigned char gfx_init()
+{
+	return gfx_init_driver(GFX_FALSE);
+}
+
+unsigned char gfx_init_headless()
+{
+	return gfx_init_driver(GFX_TRUE);
+}
+
 void gfx_deinit()
 {
 	if(!driver) return;
 
 	if(driver->shader_programs) gfx_destroy_shader_programs(driver->shader_programs);
+	if(driver->shader_cache_path) free(driver->shader_cache_path);
 
 	gfx_dec_ref((gfx_object*)driver->quad_vertex_array);
 	gfx_dec_ref((gfx_object*)driver->quad_vertex_data);
@@ -263,8 +331,15 @@ void gfx_deinit()
 	gfx_deinit_objects();
 }
 
+unsigned char gfx_is_headless()
+{
+	return driver->headless;
+}
+
 void gfx_clear_buffers(float r, float g, float b, float a, float d)
 {
+	if(driver->headless) return;
+
 	glClearColor(r, g, b, a);
 	glClearDepth(d);
 	glClear(GL_COLOR_BUFFER_BIT|GL_DEPTH_BUFFER_BIT);
@@ -272,18 +347,24 @@ void gfx_clear_buffers(float r, float g, float b, float a, float d)
 
 void gfx_clear_color_buffer(float r, float g, float b, float a)
 {
+	if(driver->headless) return;
+
 	glClearColor(r, g, b, a);
 	glClear(GL_COLOR_BUFFER_BIT);
 }
 
 void gfx_clear_depth_buffer(float d)
 {
+	if(driver->headless) return;
+
 	glClearDepth(d);
 	glClear(GL_DEPTH_BUFFER_BIT);
 }
 
 void gfx_read_pixels(int x, int y, unsigned int width, unsigned int height, unsigned int format, unsigned int data_format, void *data)
 {
+	if(driver->headless) return;
+
 	glReadPixels(x, y, width, height, driver->texture_data_formats[format], driver->formats[data_format], data);
 }
 
@@ -292,9 +373,31 @@ void gfx_reset_vertices_drawn()
 	memset(driver->vertices_drawn, 0x0, sizeof(unsigned int)*GFX_MAX_DRAW_MODES);
 	driver->vertices_drawn[GFX_TRIANGLES] = 0;
 	driver->vertices_drawn[GFX_TRIANGLE_STRIP] = 0;
+	driver->draw_calls = 0;
+	driver->state_changes = 0;
 }
 
 int gfx_get_vertices_drawn(unsigned int draw_mode)
 {
 	return driver->vertices_drawn[draw_mode];
 }
+
+int gfx_get_draw_calls()
+{
+	return driver->draw_calls;
+}
+
+int gfx_get_state_changes()
+{
+	return driver->state_changes;
+}
+
+int gfx_get_texture_memory()
+{
+	return driver->texture_memory;
+}
+
+int gfx_get_vertex_buffer_memory()
+{
+	return driver->vertex_buffer_memory;
+}
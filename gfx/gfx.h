@@ -109,6 +109,11 @@ extern "C" {
 
 #define GFX_MAX_CIRCLE_VERTICES				255
 
+#define GFX_TRANSFORM_BATCH_SIZE			64
+
+#define GFX_SHADER_PROGRAM_TABLE_SIZE			256
+#define GFX_SHADER_CACHE_VERSION			1
+
 #define GFX_PI 3.14159265
 #define GFX_PI_DIV_180					GFX_PI/180.0
 #define GFX_180_DIV_PI					180.0/GFX_PI
@@ -257,8 +262,13 @@ void gfx_set_orthographic(float left, float right, float bottom, float top, floa
 void gfx_project(float x, float y, float z, float modl[16], float proj[16], int viewport[4], float win_coord[3]);
 void gfx_un_project(float x, float y, float z, float modl[16], float proj[16], int viewport[4], float obj_coord[3]);
 
+void gfx_calc_transform_matrix(float *position, float *orient, float *scale, unsigned char camera_mode, float *matrix);
 void gfx_recalc_transform_matrix(gfx_transform *transform);
+void gfx_recalc_transform_blend_matrix(gfx_transform *transform);
 float* gfx_get_transform_matrix(gfx_transform *transform);
+void gfx_calc_transform_matrix_batch(int count, float *position[3], float *orient[4], float *scale[3], float *matrix[16]);
+void gfx_store_transform_batch_matrix(float *matrix[16], int idx, float *result);
+void gfx_update_transform_matrices(gfx_transform **transforms, int count);
 gfx_transform* gfx_create_camera_transform();
 gfx_transform* gfx_create_object_transform();
 void gfx_destroy_transform(gfx_transform *transform);
@@ -276,11 +286,20 @@ void gfx_get_transform_position(gfx_transform *transform, float *params);
 void gfx_get_transform_rotation(gfx_transform *transform, float *params);
 void gfx_get_transform_scale(gfx_transform *transofrm, float *paramt);
 void gfx_get_transform_orientation(gfx_transform *transform, float *params);
+unsigned char gfx_is_transform_matrix_outdated(gfx_transform *transform);
+void gfx_save_transform_state(gfx_transform *transform);
+unsigned char gfx_update_transform_state(gfx_transform *transform);
+unsigned char gfx_reset_transform_state(gfx_transform *transform);
+unsigned char gfx_get_transform_prev_state(gfx_transform *transform, float *position, float *orient);
+void gfx_set_transform_blend(float blend);
+float gfx_get_transform_blend();
 
 //////////////////////////////// DRIVER ////////////////////////////////
 
 unsigned char gfx_init();
+unsigned char gfx_init_headless();
 void gfx_deinit();
+unsigned char gfx_is_headless();
 
 void gfx_clear_buffers(float r, float g, float b, float a, float d);
 void gfx_clear_color_buffer(float r, float g, float b, float a);
@@ -290,10 +309,15 @@ void gfx_read_pixels(int x, int y, unsigned int width, unsigned int height, unsi
 
 void gfx_reset_vertices_drawn();
 int gfx_get_vertices_drawn(unsigned int draw_mode);
+int gfx_get_draw_calls();
+int gfx_get_state_changes();
+int gfx_get_texture_memory();
+int gfx_get_vertex_buffer_memory();
 
 //////////////////////////////// VERTEX ARRAY/INDEX ////////////////////////////////
 
 gfx_vertex_data* gfx_create_vertex_data(int count, int format, int data_type);
+gfx_vertex_data* gfx_create_vertex_data_from_buffer(int count, int format, int data_type, void *buffer);
 void gfx_destroy_vertex_data(gfx_vertex_data *data);
 int gfx_get_vertex_data_count(gfx_vertex_data *data);
 int gfx_get_vertex_data_format(gfx_vertex_data *data);
@@ -311,6 +335,7 @@ void gfx_set_vertex_array_data(gfx_vertex_array *vertex_array, unsigned int targ
 void gfx_reset_vertex_array(gfx_vertex_array *vertex_array);
 void gfx_set_vertex_array(gfx_vertex_array *vertex_array);
 void gfx_draw_vertex_array(gfx_vertex_array *vertex_array, unsigned int count, unsigned int draw_mode);
+void gfx_draw_vertex_array_range(gfx_vertex_array *vertex_array, unsigned int first, unsigned int count, unsigned int draw_mode);
 
 gfx_vertex_index* gfx_create_vertex_index(unsigned char gpu_data, gfx_vertex_data *data);
 void gfx_destroy_vertex_index(gfx_vertex_index *vertex_index);
@@ -333,7 +358,10 @@ void gfx_copy_framebuffer_to_texture(gfx_texture *texture);
 
 //////////////////////////////// SHADER PROGRAM ////////////////////////////////
 
+int gfx_get_shader_program_uniform_location(gfx_shader_program *shader_program, const char *name);
+void gfx_init_shader_program_uniform_locations(gfx_shader_program *shader_program);
 gfx_shader_program* gfx_create_shader_program(const char* vertex, const char* fragment);
+gfx_shader_program* gfx_create_shader_program_from_binary(int format, const void *binary, int length);
 void gfx_destroy_shader_program(gfx_shader_program *shader_program);
 void gfx_destroy_shader_programs(gfx_shader_program *shader_program);
 
@@ -361,6 +389,8 @@ void gfx_set_color(gfx_color *color, float r, float g, float b, float a);
 void gfx_set_shader_params_default(gfx_shader_params *shader_params);
 void gfx_set_material_params_default(gfx_shader_params *shader_params);
 void gfx_set_texture_params_default(gfx_shader_params *shader_params);
+void gfx_apply_render_params(gfx_render_params *render_params);
+void gfx_apply_texture_params(gfx_texture_params *texture_params);
 void gfx_set_shader_params(gfx_shader_params *shader_params);
 
 //////////////////////////////// DRAW ////////////////////////////////
@@ -376,7 +406,20 @@ void gfx_draw_circle(int vertices, float size);
 //////////////////////////////// SHADER GEN ////////////////////////////////
 
 void gfx_get_shader_program_config(gfx_shader_params *shader_params, gfx_shader_config *shader_config);
+unsigned int gfx_get_data_hash(const void *data, int length, unsigned int hash);
+unsigned int gfx_get_shader_config_hash(gfx_shader_config *config);
 gfx_shader_program* gfx_get_shader_program(gfx_shader_config *config);
+unsigned char gfx_precompile_shader_program(gfx_shader_params *shader_params);
+int gfx_get_shader_program_count();
+
+//////////////////////////////// SHADER CACHE ////////////////////////////////
+
+void gfx_set_shader_cache_path(const char *path);
+const char* gfx_get_shader_cache_path();
+unsigned char gfx_is_shader_binary_cache_supported();
+int gfx_get_shader_cache_hits();
+gfx_shader_program* gfx_load_cached_shader_program(gfx_shader_config *config, unsigned int hash);
+void gfx_save_cached_shader_program(gfx_shader_program *shader_program, const char *vertex, const char *fragment);
 
 //////////////////////////////// QUERY ////////////////////////////////
 
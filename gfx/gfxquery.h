@@ -6,24 +6,26 @@ gfx_query *gfx_create_query()
 	query = (gfx_query*)malloc(sizeof(gfx_query));
 	memset(query, 0x0, sizeof(gfx_query));
 
-	glGenQueries(1, &query->id);
+	if(!driver->headless) glGenQueries(1, &query->id);
 
 	return query;
 }
 
 void gfx_destroy_query(gfx_query *query)
 {
-	glDeleteQueries(1, &query->id);
+	if(query->id) glDeleteQueries(1, &query->id);
 	free(query);
 }
 
 void gfx_begin_query(gfx_query *query)
 {
+	if(driver->headless) return;
 	glBeginQuery(GL_SAMPLES_PASSED, query->id);
 }
 
 void gfx_end_query(gfx_query *query)
 {
+	if(driver->headless) return;
 	glEndQuery(GL_SAMPLES_PASSED);
 }
 
@@ -31,6 +33,8 @@ unsigned char gfx_is_query_result(gfx_query *query)
 {
 	int result;
 
+	if(driver->headless) return GFX_TRUE;
+
 	result = 0;
 	glGetQueryObjectiv(query->id, GL_QUERY_RESULT_AVAILABLE, &result);
 
@@ -41,6 +45,9 @@ int gfx_get_query_result(gfx_query *query)
 {
 	int result;
 
+	// nothing is rasterized, so nothing is ever occluded
+	if(driver->headless) return 1;
+
 	result = 0;
 	glGetQueryObjectiv(query->id, GL_QUERY_RESULT, &result);
 
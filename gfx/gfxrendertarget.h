@@ -3,6 +3,8 @@ unsigned char gfx_check_render_target()
 {
 	GLenum status;
 
+	if(driver->headless) return GFX_TRUE;
+
 	status = glCheckFramebufferStatusEXT(GL_FRAMEBUFFER_EXT);
 
 	switch(status) {
@@ -42,7 +44,7 @@ gfx_render_target* gfx_create_render_target(unsigned int width, unsigned int hei
 	render_target = (gfx_render_target*)malloc(sizeof(gfx_render_target));
 	memset(render_target, 0x0, sizeof(gfx_render_target));
 
-	glGenFramebuffersEXT(1, &render_target->fb);
+	if(!driver->headless) glGenFramebuffersEXT(1, &render_target->fb);
 
 	return render_target;
 }
@@ -66,6 +68,12 @@ unsigned char gfx_set_render_target_color_texture(gfx_render_target *render_targ
 
 	if((int)n > driver->max_draw_buffers-1) return GFX_FALSE;
 
+	if(driver->headless)
+	{
+		render_target->targets[n] = GFX_TRUE;
+		return GFX_TRUE;
+	}
+
 	if(driver->render_target != render_target)
 		glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, render_target->fb);
 
@@ -95,6 +103,8 @@ unsigned char gfx_set_render_target_depth_texture(gfx_render_target *render_targ
 	unsigned char status;
 	gfx_render_target *rt;
 
+	if(driver->headless) return GFX_TRUE;
+
 	if(driver->render_target != render_target)
 		glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, render_target->fb);
 
@@ -136,6 +146,14 @@ unsigned char gfx_set_render_target(gfx_render_target *render_target)
 
 	if(driver->render_target == render_target) return GFX_TRUE;
 
+	driver->state_changes++;
+
+	if(driver->headless)
+	{
+		driver->render_target = render_target;
+		return GFX_TRUE;
+	}
+
 	for(i = 0, j = 0; i < driver->max_draw_buffers; i++)
 	{
 		if(render_target->targets[i])
@@ -171,6 +189,14 @@ void gfx_disable_render_target()
 
 	if(!driver->render_target) return;
 
+	driver->state_changes++;
+
+	if(driver->headless)
+	{
+		driver->render_target = NULL;
+		return;
+	}
+
 	for(i = 0, j = 0; i < driver->max_draw_buffers; i++)
 	{
 		if(driver->render_target->targets[i])
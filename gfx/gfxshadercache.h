@@ -0,0 +1,182 @@
+
+// an optional disk cache for the generated shader programs. a program is saved to a file named
+// after the driver and the hash of its config, with the generated source and the program binary
+// when the driver hands one out. a binary is loaded as is, when the driver turns it down the
+// cached source is compiled and the file is saved again. without a path nothing is touched, the
+// directory has to exist.
+
+typedef struct gfx_shader_cache_header {
+	char magic[4];
+	int version;
+	unsigned int driver_hash;
+	gfx_shader_config config;
+	int vertex_length;
+	int fragment_length;
+	int binary_format;
+	int binary_length;
+} gfx_shader_cache_header;
+
+void gfx_set_shader_cache_path(const char *path)
+{
+	if(driver->shader_cache_path) free(driver->shader_cache_path);
+	driver->shader_cache_path = NULL;
+
+	if(!path || !strlen(path)) return;
+
+	driver->shader_cache_path = (char*)malloc(sizeof(char)*(strlen(path)+1));
+	memcpy(driver->shader_cache_path, path, sizeof(char)*(strlen(path)+1));
+}
+
+const char* gfx_get_shader_cache_path()
+{
+	return driver->shader_cache_path ? driver->shader_cache_path : "";
+}
+
+unsigned char gfx_is_shader_binary_cache_supported()
+{
+	return driver->program_binaries;
+}
+
+int gfx_get_shader_cache_hits()
+{
+	return driver->shader_cache_hits;
+}
+
+char* gfx_get_shader_cache_file_path(unsigned int hash)
+{
+	char *file_path;
+
+	file_path = (char*)malloc(sizeof(char)*(strlen(driver->shader_cache_path)+32));
+	sprintf(file_path, "%s/%08x_%08x.shc", driver->shader_cache_path, driver->driver_hash, hash);
+
+	return file_path;
+}
+
+gfx_shader_program* gfx_load_cached_shader_program(gfx_shader_config *config, unsigned int hash)
+{
+	gfx_shader_cache_header header;
+	gfx_shader_program *shader_program;
+	char *file_path;
+	char *vertex;
+	char *fragment;
+	void *binary;
+	FILE *file;
+	unsigned char success;
+
+	if(!driver->shader_cache_path || driver->headless) return NULL;
+
+	file_path = gfx_get_shader_cache_file_path(hash);
+	file = fopen(file_path, "rb");
+	free(file_path);
+
+	if(!file) return NULL;
+
+	// a file that doesn't match is overwritten when the program is saved again
+	if(fread(&header, sizeof(gfx_shader_cache_header), 1, file) != 1 || memcmp(header.magic, "ESHC", 4) ||
+		header.version != GFX_SHADER_CACHE_VERSION || header.driver_hash != driver->driver_hash ||
+		memcmp(&header.config, config, sizeof(gfx_shader_config)) ||
+		header.vertex_length < 1 || header.fragment_length < 1 || header.binary_length < 0)
+	{
+		fclose(file);
+		return NULL;
+	}
+
+	vertex = (char*)malloc(sizeof(char)*(header.vertex_length+1));
+	fragment = (char*)malloc(sizeof(char)*(header.fragment_length+1));
+	binary = header.binary_length > 0 ? malloc(header.binary_length) : NULL;
+
+	success = fread(vertex, sizeof(char), header.vertex_length, file) == (size_t)header.vertex_length &&
+		fread(fragment, sizeof(char), header.fragment_length, file) == (size_t)header.fragment_length &&
+		(!binary || fread(binary, 1, header.binary_length, file) == (size_t)header.binary_length);
+
+	fclose(file);
+
+	shader_program = NULL;
+
+	if(success)
+	{
+		vertex[header.vertex_length] = '\0';
+		fragment[header.fragment_length] = '\0';
+
+		if(binary) shader_program = gfx_create_shader_program_from_binary(header.binary_format, binary, header.binary_length);
+
+		if(!shader_program)
+		{
+			shader_program = gfx_create_shader_program(vertex, fragment);
+
+			// a fresh binary for next time
+			if(shader_program && driver->program_binaries)
+			{
+				memcpy(&shader_program->config, config, sizeof(gfx_shader_config));
+				shader_program->hash = hash;
+				gfx_save_cached_shader_program(shader_program, vertex, fragment);
+			}
+		}
+
+		if(shader_program) driver->shader_cache_hits++;
+	}
+
+	free(vertex);
+	free(fragment);
+	if(binary) free(binary);
+
+	return shader_program;
+}
+
+void gfx_save_cached_shader_program(gfx_shader_program *shader_program, const char *vertex, const char *fragment)
+{
+	gfx_shader_cache_header header;
+	char *file_path;
+	void *binary;
+	GLenum format;
+	int length;
+	FILE *file;
+
+	if(!driver->shader_cache_path || driver->headless) return;
+
+	memset(&header, 0x0, sizeof(gfx_shader_cache_header));
+	memcpy(header.magic, "ESHC", 4);
+	header.version = GFX_SHADER_CACHE_VERSION;
+	header.driver_hash = driver->driver_hash;
+	memcpy(&header.config, &shader_program->config, sizeof(gfx_shader_config));
+	header.vertex_length = strlen(vertex);
+	header.fragment_length = strlen(fragment);
+
+	binary = NULL;
+
+	if(driver->program_binaries)
+	{
+		length = 0;
+		glGetProgramiv(shader_program->id, GL_PROGRAM_BINARY_LENGTH, &length);
+
+		if(length > 0)
+		{
+			binary = malloc(length);
+			format = 0;
+			glGetProgramBinary(shader_program->id, length, &length, &format, binary);
+
+			header.binary_format = (int)format;
+			header.binary_length = length;
+		}
+	}
+
+	file_path = gfx_get_shader_cache_file_path(shader_program->hash);
+	file = fopen(file_path, "wb");
+
+	if(!file)
+	{
+		elf_write_to_log("warning: can't write shader cache file \"%s\"\n", file_path);
+	}
+	else
+	{
+		fwrite(&header, sizeof(gfx_shader_cache_header), 1, file);
+		fwrite(vertex, sizeof(char), header.vertex_length, file);
+		fwrite(fragment, sizeof(char), header.fragment_length, file);
+		if(binary) fwrite(binary, 1, header.binary_length, file);
+		fclose(file);
+	}
+
+	free(file_path);
+	if(binary) free(binary);
+}
+
@@ -1,58 +1,13 @@
 
-typedef struct gfx_line {
-	struct gfx_line *next;
-	char *text;
-} gfx_line;
+// the generated source goes into one growing buffer, every line is appended with its newline
 
 typedef struct gfx_document {
 	unsigned int num_lines;
 	unsigned int num_chars;
-	gfx_line *lines;
+	unsigned int capacity;
+	char *text;
 } gfx_document;
 
-char* gfx_create_string(const char *str)
-{
-	char *nstr;
-
-	if(!str || !strlen(str)) return NULL;
-
-	nstr = (char*)malloc(strlen(str)+1);
-	memset(nstr, 0x0, sizeof(char)*(strlen(str)+1));
-
-	memcpy(nstr, str, sizeof(char)*strlen(str));
-
-	return nstr;
-}
-
-void gfx_destroy_string(char *str)
-{
-	free(str);
-}
-
-gfx_line *gfx_create_line()
-{
-	gfx_line *line;
-
-	line = (gfx_line*)malloc(sizeof(gfx_line));
-	memset(line, 0x0, sizeof(gfx_line));
-
-	return line;
-}
-
-void gfx_destroy_line(gfx_line *line)
-{
-	if(line->text) gfx_destroy_string(line->text);
-
-	free(line);
-}
-
-void gfx_destroy_lines(gfx_line *line)
-{
-	if(line->next) gfx_destroy_lines(line->next);
-
-	gfx_destroy_line(line);
-}
-
 gfx_document* gfx_create_document()
 {
 	gfx_document *document;
@@ -65,39 +20,38 @@ gfx_document* gfx_create_document()
 
 void gfx_destroy_document(gfx_document *document)
 {
-	if(document->lines) gfx_destroy_lines(document->lines);
+	if(document->text) free(document->text);
 
 	free(document);
 }
 
 void gfx_clear_document(gfx_document *document)
 {
-	if(document->lines) gfx_destroy_lines(document->lines);
-
-	memset(document, 0x0, sizeof(gfx_document));
+	// the buffer is kept for the next shader
+	document->num_lines = 0;
+	document->num_chars = 0;
 }
 
 void gfx_add_line_to_document(gfx_document *document, const char *str)
 {
-	gfx_line *line;
-	gfx_line *lline;
+	unsigned int length;
 
 	if(!str || !strlen(str)) return;
 
-	line = gfx_create_line();
-
-	line->text = gfx_create_string(str);
+	length = strlen(str);
 
-	if(!document->lines) document->lines = line;
-	else
+	if(document->num_chars+length+1 > document->capacity)
 	{
-		lline = document->lines;
-		while(lline->next) lline = lline->next;
-		lline->next = line;
+		if(!document->capacity) document->capacity = 4096;
+		while(document->num_chars+length+1 > document->capacity) document->capacity *= 2;
+		document->text = (char*)realloc(document->text, sizeof(char)*document->capacity);
 	}
 
+	memcpy(&document->text[document->num_chars], str, sizeof(char)*length);
+	document->text[document->num_chars+length] = '\n';
+
 	document->num_lines++;
-	document->num_chars += strlen(str)+1;
+	document->num_chars += length+1;
 }
 
 unsigned int gfx_get_document_lines(gfx_document *document)
@@ -112,20 +66,28 @@ unsigned int gfx_get_document_chars(gfx_document *document)
 
 void gfx_document_to_buffer(gfx_document *document, char *buf)
 {
-	int offset;
-	gfx_line *line;
+	if(document->num_chars) memcpy(buf, document->text, sizeof(char)*document->num_chars);
+}
 
-	offset = 0;
-	line = document->lines;
+unsigned int gfx_get_data_hash(const void *data, int length, unsigned int hash)
+{
+	const unsigned char *bytes;
+	int i;
 
-	while(line)
+	// fnv-1a, chained by passing the previous hash, start with 2166136261
+	bytes = (const unsigned char*)data;
+	for(i = 0; i < length; i++)
 	{
-		memcpy(&buf[offset], line->text, strlen(line->text));
-		offset += strlen(line->text);
-		buf[offset] = '\n';
-		offset++;
-		line = line->next;
+		hash ^= bytes[i];
+		hash *= 16777619u;
 	}
+
+	return hash;
+}
+
+unsigned int gfx_get_shader_config_hash(gfx_shader_config *config)
+{
+	return gfx_get_data_hash(config, sizeof(gfx_shader_config), 2166136261u);
 }
 
 void gfx_get_shader_program_config(gfx_shader_params *shader_params, gfx_shader_config *shader_config)
@@ -402,21 +364,9 @@ void gfx_add_fragment_post_lighting_calcs(gfx_document *document, gfx_shader_con
 	if(config->light == GFX_SPOT_LIGHT) gfx_add_line_to_document(document, "\tfinal_color.rgb *= spot;");
 }
 
-gfx_shader_program* gfx_get_shader_program(gfx_shader_config *config)
+void gfx_generate_shader_program_source(gfx_shader_config *config, char **vert_shdr, char **frag_shdr)
 {
 	gfx_document *document;
-	gfx_shader_program *shader_program;
-	gfx_shader_program *lshpr;
-	char *vert_shdr;
-	char *frag_shdr;
-
-	shader_program = driver->shader_programs;
-	while(shader_program)
-	{
-		if(!memcmp(&shader_program->config, config, sizeof(gfx_shader_config)))
-			return shader_program;
-		shader_program = shader_program->next;
-	}
 
 	document = gfx_create_document();
 
@@ -430,10 +380,10 @@ gfx_shader_program* gfx_get_shader_program(gfx_shader_config *config)
 	gfx_add_vertex_lighting_calcs(document, config);
 	gfx_add_vertex_end(document, config);
 
-	vert_shdr = (char*)malloc(sizeof(char)*gfx_get_document_chars(document)+1);
-	gfx_document_to_buffer(document, vert_shdr);
-	vert_shdr[gfx_get_document_chars(document)] = '\0';
-	//gfx_write_to_log(vert_shdr);
+	*vert_shdr = (char*)malloc(sizeof(char)*(gfx_get_document_chars(document)+1));
+	gfx_document_to_buffer(document, *vert_shdr);
+	(*vert_shdr)[gfx_get_document_chars(document)] = '\0';
+	//gfx_write_to_log(*vert_shdr);
 
 	gfx_clear_document(document);
 
@@ -453,35 +403,96 @@ gfx_shader_program* gfx_get_shader_program(gfx_shader_config *config)
 	gfx_add_fragment_post_lighting_calcs(document, config);
 	gfx_add_fragment_end(document, config);
 
-	frag_shdr = (char*)malloc(sizeof(char)*(gfx_get_document_chars(document)+1));
-	gfx_document_to_buffer(document, frag_shdr);
-	frag_shdr[gfx_get_document_chars(document)] = '\0';
-	//gfx_write_to_log(frag_shdr);
+	*frag_shdr = (char*)malloc(sizeof(char)*(gfx_get_document_chars(document)+1));
+	gfx_document_to_buffer(document, *frag_shdr);
+	(*frag_shdr)[gfx_get_document_chars(document)] = '\0';
+	//gfx_write_to_log(*frag_shdr);
 
 	// ----------------------------------------------------------- //
 
 	gfx_destroy_document(document);
+}
 
-	shader_program = gfx_create_shader_program(vert_shdr, frag_shdr);
+void gfx_add_shader_program(gfx_shader_program *shader_program, gfx_shader_config *config, unsigned int hash)
+{
+	int idx;
 
-	free(vert_shdr);
-	free(frag_shdr);
+	memcpy(&shader_program->config, config, sizeof(gfx_shader_config));
+	shader_program->hash = hash;
 
+	// the list is only walked on deinit, the table is what gets searched
+	shader_program->next = driver->shader_programs;
+	driver->shader_programs = shader_program;
+
+	idx = hash&(GFX_SHADER_PROGRAM_TABLE_SIZE-1);
+	shader_program->hash_next = driver->shader_program_table[idx];
+	driver->shader_program_table[idx] = shader_program;
+
+	driver->shader_program_count++;
+}
+
+gfx_shader_program* gfx_get_shader_program(gfx_shader_config *config)
+{
+	gfx_shader_program *shader_program;
+	unsigned int hash;
+	char *vert_shdr;
+	char *frag_shdr;
+
+	hash = gfx_get_shader_config_hash(config);
+
+	shader_program = driver->shader_program_table[hash&(GFX_SHADER_PROGRAM_TABLE_SIZE-1)];
+	while(shader_program)
+	{
+		if(shader_program->hash == hash && !memcmp(&shader_program->config, config, sizeof(gfx_shader_config)))
+			return shader_program;
+		shader_program = shader_program->hash_next;
+	}
+
+	shader_program = gfx_load_cached_shader_program(config, hash);
 	if(shader_program)
 	{
-		memcpy(&shader_program->config, config, sizeof(gfx_shader_config));
+		gfx_add_shader_program(shader_program, config, hash);
+		return shader_program;
+	}
 
-		if(!driver->shader_programs) driver->shader_programs = shader_program;
-		else
-		{
-			lshpr = driver->shader_programs;
-			while(lshpr->next) lshpr = lshpr->next;
-			lshpr->next = shader_program;
-		}
+	gfx_generate_shader_program_source(config, &vert_shdr, &frag_shdr);
+
+	shader_program = gfx_create_shader_program(vert_shdr, frag_shdr);
+
+	if(shader_program)
+	{
+		gfx_add_shader_program(shader_program, config, hash);
+		gfx_save_cached_shader_program(shader_program, vert_shdr, frag_shdr);
 	}
 
+	free(vert_shdr);
+	free(frag_shdr);
+
 	//gfx_write_to_log("---------------------------------------\n");
 
 	return shader_program;
 }
 
+unsigned char gfx_precompile_shader_program(gfx_shader_params *shader_params)
+{
+	gfx_shader_config config;
+	gfx_shader_program *shader_program;
+
+	gfx_get_shader_program_config(shader_params, &config);
+	shader_program = gfx_get_shader_program(&config);
+
+	// creating a program binds it, put back what the state cache thinks is bound
+	if(!driver->headless)
+	{
+		if(driver->shader_params.shader_program) glUseProgram(driver->shader_params.shader_program->id);
+		else glUseProgram(0);
+	}
+
+	return shader_program != NULL;
+}
+
+int gfx_get_shader_program_count()
+{
+	return driver->shader_program_count;
+}
+
@@ -71,142 +71,160 @@ void gfx_set_texture_params_default(gfx_shader_params *shader_params)
 	}
 }
 
-void gfx_set_shader_params(gfx_shader_params *shader_params)
+void gfx_apply_render_params(gfx_render_params *render_params)
 {
-	int i;
-	gfx_shader_config shader_config;
-	gfx_shader_program *shader_program;
+	if(render_params->depth_test) glEnable(GL_DEPTH_TEST);
+	else glDisable(GL_DEPTH_TEST);
 
-	if(memcmp(&driver->shader_params.render_params, &shader_params->render_params, sizeof(gfx_render_params)))
+	if(render_params->depth_write) glDepthMask(1);
+	else glDepthMask(0);
+
+	switch(render_params->depth_func)
 	{
-		if(shader_params->render_params.depth_test) glEnable(GL_DEPTH_TEST);
-		else glDisable(GL_DEPTH_TEST);
+		case GFX_NEVER: glDepthFunc(GL_NEVER); break;
+		case GFX_LESS: glDepthFunc(GL_LESS); break;
+		case GFX_EQUAL: glDepthFunc(GL_EQUAL); break;
+		case GFX_LEQUAL: glDepthFunc(GL_LEQUAL); break;
+		case GFX_GREATER: glDepthFunc(GL_GREATER); break;
+		case GFX_NOTEQUAL: glDepthFunc(GL_NOTEQUAL); break;
+		case GFX_GEQUAL: glDepthFunc(GL_GEQUAL); break;
+		case GFX_ALWAYS: glDepthFunc(GL_ALWAYS); break;
+	}
 
-		if(shader_params->render_params.depth_write) glDepthMask(1);
-		else glDepthMask(0);
+	glColorMask(render_params->color_write,
+		render_params->color_write,
+		render_params->color_write,
+		render_params->alpha_write);
 
-		switch(shader_params->render_params.depth_func)
-		{
-			case GFX_NEVER: glDepthFunc(GL_NEVER); break;
-			case GFX_LESS: glDepthFunc(GL_LESS); break;
-			case GFX_EQUAL: glDepthFunc(GL_EQUAL); break;
-			case GFX_LEQUAL: glDepthFunc(GL_LEQUAL); break;
-			case GFX_GREATER: glDepthFunc(GL_GREATER); break;
-			case GFX_NOTEQUAL: glDepthFunc(GL_NOTEQUAL); break;
-			case GFX_GEQUAL: glDepthFunc(GL_GEQUAL); break;
-			case GFX_ALWAYS: glDepthFunc(GL_ALWAYS); break;
-		}
-
-		glColorMask(shader_params->render_params.color_write,
-			shader_params->render_params.color_write,
-			shader_params->render_params.color_write,
-			shader_params->render_params.alpha_write);
+	if(render_params->cull_face) glEnable(GL_CULL_FACE);
+	else glDisable(GL_CULL_FACE);
 
-		if(shader_params->render_params.cull_face) glEnable(GL_CULL_FACE);
-		else glDisable(GL_CULL_FACE);
+	if(render_params->alpha_test && !render_params->alpha_test_in_shader)
+	{
+		glEnable(GL_ALPHA_TEST);
+		glAlphaFunc(GL_GREATER, render_params->alpha_threshold);
+	}
+	else glDisable(GL_ALPHA_TEST);
 
-		if(shader_params->render_params.alpha_test && !shader_params->render_params.alpha_test_in_shader)
-		{
-			glEnable(GL_ALPHA_TEST);
-			glAlphaFunc(GL_GREATER, shader_params->render_params.alpha_threshold);
-		}
-		else glDisable(GL_ALPHA_TEST);
+	switch(render_params->blend_mode)
+	{
+		case GFX_NONE:
+			glDisable(GL_BLEND);
+			break;
+		case GFX_TRANSPARENT:
+			glEnable(GL_BLEND);
+			glBlendEquation(GL_FUNC_ADD);
+			glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			break;
+		case GFX_ADD:
+			glEnable(GL_BLEND);
+			glBlendEquation(GL_FUNC_ADD);
+			glBlendFunc(GL_ONE, GL_ONE);
+			break;
+		case GFX_MULTIPLY:
+			glEnable(GL_BLEND);
+			glBlendEquation(GL_FUNC_ADD);
+			glBlendFunc(GL_DST_COLOR, GL_ZERO);
+			break;
+		case GFX_SUBTRACT:
+			glEnable(GL_BLEND);
+			glBlendEquation(GL_FUNC_SUBTRACT);
+			glBlendFunc(GL_ONE, GL_ONE);
+			break;
+	}
 
-		switch(shader_params->render_params.blend_mode)
-		{
-			case GFX_NONE:
-				glDisable(GL_BLEND);
-				break;
-			case GFX_TRANSPARENT:
-				glEnable(GL_BLEND);
-				glBlendEquation(GL_FUNC_ADD);
-				glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-				break;
-			case GFX_ADD:
-				glEnable(GL_BLEND);
-				glBlendEquation(GL_FUNC_ADD);
-				glBlendFunc(GL_ONE, GL_ONE);
-				break;
-			case GFX_MULTIPLY:
-				glEnable(GL_BLEND);
-				glBlendEquation(GL_FUNC_ADD);
-				glBlendFunc(GL_DST_COLOR, GL_ZERO);
-				break;
-			case GFX_SUBTRACT:
-				glEnable(GL_BLEND);
-				glBlendEquation(GL_FUNC_SUBTRACT);
-				glBlendFunc(GL_ONE, GL_ONE);
-				break;
-		}
+	if(!render_params->offset_scale ||
+		!render_params->offset_bias)
+		glDisable(GL_POLYGON_OFFSET_FILL);
+	else
+	{
+		glEnable(GL_POLYGON_OFFSET_FILL);
+		glPolygonOffset(render_params->offset_scale,
+			render_params->offset_bias);
+	}
 
-		if(!shader_params->render_params.offset_scale ||
-			!shader_params->render_params.offset_bias)
-			glDisable(GL_POLYGON_OFFSET_FILL);
-		else
-		{
-			glEnable(GL_POLYGON_OFFSET_FILL);
-			glPolygonOffset(shader_params->render_params.offset_scale,
-				shader_params->render_params.offset_bias);
-		}
+	glLineWidth(render_params->line_width);
+	if(render_params->line_smooth)
+		glEnable(GL_LINE_SMOOTH);
+	else glDisable(GL_LINE_SMOOTH);
 
-		glLineWidth(shader_params->render_params.line_width);
-		if(shader_params->render_params.line_smooth)
-			glEnable(GL_LINE_SMOOTH);
-		else glDisable(GL_LINE_SMOOTH);
+	if(render_params->cull_face_mode == GFX_BACK)
+		glCullFace(GL_BACK);
+	else glCullFace(GL_FRONT);
 
-		if(shader_params->render_params.cull_face_mode == GFX_BACK)
-			glCullFace(GL_BACK);
-		else glCullFace(GL_FRONT);
+	if(render_params->front_face == GFX_COUNTER_CLOCK_WISE)
+		glFrontFace(GL_CCW);
+	else glFrontFace(GL_CW);
 
-		if(shader_params->render_params.front_face == GFX_COUNTER_CLOCK_WISE)
-			glFrontFace(GL_CCW);
-		else glFrontFace(GL_CW);
+	if(render_params->wireframe)
+		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+	else glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+}
 
-		if(shader_params->render_params.wireframe)
-			glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-		else glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-	}
+void gfx_apply_texture_params(gfx_texture_params *texture_params)
+{
+	int i;
 
-	if(memcmp(&driver->shader_params.texture_params, &shader_params->texture_params, sizeof(gfx_texture_params)*GFX_MAX_TEXTURES))
+	for(i = 0; i < GFX_MAX_TEXTURES; i++)
 	{
-		for(i = 0; i < GFX_MAX_TEXTURES; i++)
+		glActiveTexture(GL_TEXTURE0+i);
+		glClientActiveTexture(GL_TEXTURE0+i);
+
+		if(texture_params[i].texture)
 		{
-			glActiveTexture(GL_TEXTURE0+i);
-			glClientActiveTexture(GL_TEXTURE0+i);
+			glMatrixMode(GL_TEXTURE);
+			glLoadMatrixf(texture_params[i].matrix);
 
-			if(shader_params->texture_params[i].texture)
+			glBindTexture(GL_TEXTURE_2D, texture_params[i].texture->id);
+
+			switch(texture_params[i].projection_mode)
 			{
-				glMatrixMode(GL_TEXTURE);
-				glLoadMatrixf(shader_params->texture_params[i].matrix);
-
-				glBindTexture(GL_TEXTURE_2D, shader_params->texture_params[i].texture->id);
-
-				switch(shader_params->texture_params[i].projection_mode)
-				{
-					case GFX_NONE:
-						glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE_ARB, GL_NONE);
-						break;
-					case GFX_SHADOW_PROJECTION:
-						glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_R_TO_TEXTURE);
-						break;
-				}
+				case GFX_NONE:
+					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE_ARB, GL_NONE);
+					break;
+				case GFX_SHADOW_PROJECTION:
+					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_R_TO_TEXTURE);
+					break;
 			}
-			else
-			{
-				glMatrixMode(GL_TEXTURE);
-				glLoadIdentity();
+		}
+		else
+		{
+			glMatrixMode(GL_TEXTURE);
+			glLoadIdentity();
 
-				glBindTexture(GL_TEXTURE_2D, 0);
-			}
+			glBindTexture(GL_TEXTURE_2D, 0);
 		}
 	}
+}
+
+void gfx_set_shader_params(gfx_shader_params *shader_params)
+{
+	int i;
+	gfx_shader_config shader_config;
+	gfx_shader_program *shader_program;
+
+	// the null driver only counts what would have been sent to gl
+	if(memcmp(&driver->shader_params.render_params, &shader_params->render_params, sizeof(gfx_render_params)))
+	{
+		driver->state_changes++;
+		if(!driver->headless) gfx_apply_render_params(&shader_params->render_params);
+	}
+
+	if(memcmp(&driver->shader_params.texture_params, &shader_params->texture_params, sizeof(gfx_texture_params)*GFX_MAX_TEXTURES))
+	{
+		driver->state_changes++;
+		if(!driver->headless) gfx_apply_texture_params(shader_params->texture_params);
+	}
 
 	shader_program = shader_params->shader_program;
 
 	if(shader_program)
 	{
 		if(shader_program != driver->shader_params.shader_program)
-			glUseProgram(shader_program->id);
+		{
+			driver->state_changes++;
+			if(!driver->headless) glUseProgram(shader_program->id);
+		}
 
 		// just inputting with values that do not make sense
 		driver->shader_config.textures = 255;
@@ -219,8 +237,10 @@ void gfx_set_shader_params(gfx_shader_params *shader_params)
 		{
 			memcpy(&driver->shader_config, &shader_config, sizeof(gfx_shader_config));
 			shader_program = gfx_get_shader_program(&shader_config);
-			if(shader_program) glUseProgram(shader_program->id);
-			else return;
+			if(!shader_program) return;
+
+			driver->state_changes++;
+			if(!driver->headless) glUseProgram(shader_program->id);
 		}
 		else
 		{
@@ -1,4 +1,44 @@
 
+int gfx_get_shader_program_uniform_location(gfx_shader_program *shader_program, const char *name)
+{
+	if(driver->headless) return -1;
+	return glGetUniformLocation(shader_program->id, name);
+}
+
+void gfx_init_shader_program_uniform_locations(gfx_shader_program *shader_program)
+{
+	shader_program->projection_matrix_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_ProjectionMatrix");
+	shader_program->modelview_matrix_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_ModelviewMatrix");
+	shader_program->texture0_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_Texture0");
+	shader_program->texture1_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_Texture1");
+	shader_program->texture2_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_Texture2");
+	shader_program->texture3_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_Texture3");
+	shader_program->color_map_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_ColorMap");
+	shader_program->normal_map_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_NormalMap");
+	shader_program->height_map_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_HeightMap");
+	shader_program->specular_map_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_SpecularMap");
+	shader_program->color_ramp_map_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_ColorRampMap");
+	shader_program->light_map_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_LightMap");
+	shader_program->shadow_projection_matrix_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_ShadowProjectionMatrix");
+	shader_program->shadow_map_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_ShadowMap");
+	shader_program->color_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_Color");
+	shader_program->specular_color_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_SpecularColor");
+	shader_program->spec_power_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_SpecPower");
+	shader_program->light_position_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_LightPosition");
+	shader_program->light_color_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_LightColor");
+	shader_program->light_spot_direction_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_LightSpotDirection");
+	shader_program->light_distance_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_LightDistance");
+	shader_program->light_fade_speed_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_LightFadeSpeed");
+	shader_program->light_inner_cone_cos_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_LightInnerConeCos");
+	shader_program->light_outer_cone_cos_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_LightOuterConeCos");
+	shader_program->clip_start_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_ClipStart");
+	shader_program->clip_end_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_ClipEnd");
+	shader_program->viewport_width_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_ViewportWidth");
+	shader_program->viewport_height_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_ViewportHeight");
+	shader_program->parallax_scale_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_ParallaxScale");
+	shader_program->alpha_threshold_loc = gfx_get_shader_program_uniform_location(shader_program, "elf_AlphaThreshold");
+}
+
 gfx_shader_program* gfx_create_shader_program(const char* vertex, const char* fragment)
 {
 	const GLchar* my_string_ptrs[1];
@@ -10,6 +50,15 @@ gfx_shader_program* gfx_create_shader_program(const char* vertex, const char* fr
 	GLuint my_fragment_shader;
 	gfx_shader_program *shader_program;
 
+	// nothing to compile, every uniform location is left unset
+	if(driver->headless)
+	{
+		shader_program = (gfx_shader_program*)malloc(sizeof(gfx_shader_program));
+		memset(shader_program, 0x0, sizeof(gfx_shader_program));
+		gfx_init_shader_program_uniform_locations(shader_program);
+		return shader_program;
+	}
+
 	my_vertex_shader = glCreateShader(GL_VERTEX_SHADER);
 
 	if(vertex)
@@ -84,6 +133,10 @@ gfx_shader_program* gfx_create_shader_program(const char* vertex, const char* fr
 	glBindAttribLocation(shader_program->id, GFX_COLOR, "elf_ColorAttr");
 	glBindAttribLocation(shader_program->id, GFX_TANGENT, "elf_TangentAttr");
 
+	// the binary is only kept around for the shader cache if asked for before linking
+	if(driver->program_binaries && driver->shader_cache_path)
+		glProgramParameteri(shader_program->id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
 	glLinkProgram(shader_program->id);
 
 	if(vertex) glDeleteShader(my_vertex_shader);
@@ -108,36 +161,37 @@ gfx_shader_program* gfx_create_shader_program(const char* vertex, const char* fr
 	}
 #endif
 
-	shader_program->projection_matrix_loc = glGetUniformLocation(shader_program->id, "elf_ProjectionMatrix");
-	shader_program->modelview_matrix_loc = glGetUniformLocation(shader_program->id, "elf_ModelviewMatrix");
-	shader_program->texture0_loc = glGetUniformLocation(shader_program->id, "elf_Texture0");
-	shader_program->texture1_loc = glGetUniformLocation(shader_program->id, "elf_Texture1");
-	shader_program->texture2_loc = glGetUniformLocation(shader_program->id, "elf_Texture2");
-	shader_program->texture3_loc = glGetUniformLocation(shader_program->id, "elf_Texture3");
-	shader_program->color_map_loc = glGetUniformLocation(shader_program->id, "elf_ColorMap");
-	shader_program->normal_map_loc = glGetUniformLocation(shader_program->id, "elf_NormalMap");
-	shader_program->height_map_loc = glGetUniformLocation(shader_program->id, "elf_HeightMap");
-	shader_program->specular_map_loc = glGetUniformLocation(shader_program->id, "elf_SpecularMap");
-	shader_program->color_ramp_map_loc = glGetUniformLocation(shader_program->id, "elf_ColorRampMap");
-	shader_program->light_map_loc = glGetUniformLocation(shader_program->id, "elf_LightMap");
-	shader_program->shadow_projection_matrix_loc = glGetUniformLocation(shader_program->id, "elf_ShadowProjectionMatrix");
-	shader_program->shadow_map_loc = glGetUniformLocation(shader_program->id, "elf_ShadowMap");
-	shader_program->color_loc = glGetUniformLocation(shader_program->id, "elf_Color");
-	shader_program->specular_color_loc = glGetUniformLocation(shader_program->id, "elf_SpecularColor");
-	shader_program->spec_power_loc = glGetUniformLocation(shader_program->id, "elf_SpecPower");
-	shader_program->light_position_loc = glGetUniformLocation(shader_program->id, "elf_LightPosition");
-	shader_program->light_color_loc = glGetUniformLocation(shader_program->id, "elf_LightColor");
-	shader_program->light_spot_direction_loc = glGetUniformLocation(shader_program->id, "elf_LightSpotDirection");
-	shader_program->light_distance_loc = glGetUniformLocation(shader_program->id, "elf_LightDistance");
-	shader_program->light_fade_speed_loc = glGetUniformLocation(shader_program->id, "elf_LightFadeSpeed");
-	shader_program->light_inner_cone_cos_loc = glGetUniformLocation(shader_program->id, "elf_LightInnerConeCos");
-	shader_program->light_outer_cone_cos_loc = glGetUniformLocation(shader_program->id, "elf_LightOuterConeCos");
-	shader_program->clip_start_loc = glGetUniformLocation(shader_program->id, "elf_ClipStart");
-	shader_program->clip_end_loc = glGetUniformLocation(shader_program->id, "elf_ClipEnd");
-	shader_program->viewport_width_loc = glGetUniformLocation(shader_program->id, "elf_ViewportWidth");
-	shader_program->viewport_height_loc = glGetUniformLocation(shader_program->id, "elf_ViewportHeight");
-	shader_program->parallax_scale_loc = glGetUniformLocation(shader_program->id, "elf_ParallaxScale");
-	shader_program->alpha_threshold_loc = glGetUniformLocation(shader_program->id, "elf_AlphaThreshold");
+	gfx_init_shader_program_uniform_locations(shader_program);
+
+	glUseProgram(shader_program->id);
+
+	return shader_program;
+}
+
+gfx_shader_program* gfx_create_shader_program_from_binary(int format, const void *binary, int length)
+{
+	gfx_shader_program *shader_program;
+	int success;
+
+	if(driver->headless || !driver->program_binaries) return NULL;
+
+	shader_program = (gfx_shader_program*)malloc(sizeof(gfx_shader_program));
+	memset(shader_program, 0x0, sizeof(gfx_shader_program));
+
+	shader_program->id = glCreateProgram();
+
+	// the attribute bindings are part of the binary
+	glProgramBinary(shader_program->id, (GLenum)format, binary, length);
+
+	// a driver update can turn down a binary it made itself, not an error
+	glGetProgramiv(shader_program->id, GL_LINK_STATUS, &success);
+	if(!success)
+	{
+		gfx_destroy_shader_program(shader_program);
+		return NULL;
+	}
+
+	gfx_init_shader_program_uniform_locations(shader_program);
 
 	glUseProgram(shader_program->id);
 
@@ -146,7 +200,7 @@ gfx_shader_program* gfx_create_shader_program(const char* vertex, const char* fr
 
 void gfx_destroy_shader_program(gfx_shader_program *shader_program)
 {
-	if(shader_program->id) glDeleteShader(shader_program->id);
+	if(shader_program->id) glDeleteProgram(shader_program->id);
 
 	free(shader_program);
 }
@@ -160,37 +214,37 @@ void gfx_destroy_shader_programs(gfx_shader_program *shader_program)
 
 void gfx_set_shader_program_uniform_1i(const char *name, int i)
 {
-	if(!driver->shader_params.shader_program) return;
+	if(!driver->shader_params.shader_program || driver->headless) return;
 	glUniform1i(glGetUniformLocation(driver->shader_params.shader_program->id, name), i);
 }
 
 void gfx_set_shader_program_uniform_1f(const char *name, float f)
 {
-	if(!driver->shader_params.shader_program) return;
+	if(!driver->shader_params.shader_program || driver->headless) return;
 	glUniform1f(glGetUniformLocation(driver->shader_params.shader_program->id, name), f);
 }
 
 void gfx_set_shader_program_uniform_vec2(const char *name, float x, float y)
 {
-	if(!driver->shader_params.shader_program) return;
+	if(!driver->shader_params.shader_program || driver->headless) return;
 	glUniform2f(glGetUniformLocation(driver->shader_params.shader_program->id, name), x, y);
 }
 
 void gfx_set_shader_program_uniform_vec3(const char *name, float x, float y, float z)
 {
-	if(!driver->shader_params.shader_program) return;
+	if(!driver->shader_params.shader_program || driver->headless) return;
 	glUniform3f(glGetUniformLocation(driver->shader_params.shader_program->id, name), x, y, z);
 }
 
 void gfx_set_shader_program_uniform_vec4(const char *name, float x, float y, float z, float w)
 {
-	if(!driver->shader_params.shader_program) return;
+	if(!driver->shader_params.shader_program || driver->headless) return;
 	glUniform4f(glGetUniformLocation(driver->shader_params.shader_program->id, name), x, y, z, w);
 }
 
 void gfx_set_shader_program_uniform_mat4(const char *name, float *matrix)
 {
-	if(!driver->shader_params.shader_program) return;
+	if(!driver->shader_params.shader_program || driver->headless) return;
 	glUniformMatrix4fv(glGetUniformLocation(driver->shader_params.shader_program->id, name), 1, GL_FALSE, matrix);
 }
 
@@ -34,6 +34,12 @@ gfx_texture* gfx_create_2d_texture(unsigned int width, unsigned int height, floa
 	texture->format = format;
 	texture->data_format = data_format;
 
+	// mipmaps are not counted
+	texture->size_bytes = width*height*driver->texture_pixel_sizes[internal_format];
+	driver->texture_memory += texture->size_bytes;
+
+	if(driver->headless) return texture;
+
 	glActiveTexture(GL_TEXTURE0);
 	glClientActiveTexture(GL_TEXTURE0);
 
@@ -87,6 +93,8 @@ void gfx_destroy_texture(gfx_texture *texture)
 {
 	if(texture->id) glDeleteTextures(1, &texture->id);
 
+	driver->texture_memory -= texture->size_bytes;
+
 	free(texture);
 }
 
@@ -112,6 +120,8 @@ int gfx_get_texture_data_format(gfx_texture *texture)
 
 void gfx_copy_framebuffer_to_texture(gfx_texture *texture)
 {
+	if(driver->headless) return;
+
 	glActiveTexture(GL_TEXTURE0);
 	glClientActiveTexture(GL_TEXTURE0);
 	if(!glIsEnabled(GL_TEXTURE_2D)) glEnable(GL_TEXTURE_2D);
@@ -1,6 +1,7 @@
 
 void gfx_set_viewport(int x, int y, int width, int height)
 {
+	if(driver->headless) return;
 	glViewport(x, y, width, height);
 }
 
@@ -143,55 +144,221 @@ void gfx_set_orthographic(float left, float right, float bottom, float top, floa
 	gfx_get_orthographic_projection_matrix(left, right, bottom, top, near, far, matrix);
 }
 
-void gfx_recalc_transform_matrix(gfx_transform *transform)
+void gfx_calc_transform_matrix(float *position, float *orient, float *scale, unsigned char camera_mode, float *matrix)
 {
 	float temp_matrix1[16];
 	float temp_matrix2[16];
 	float inv_qua[4];
 
-	if(transform->camera_mode == GFX_FALSE)
+	if(camera_mode == GFX_FALSE)
 	{
-		gfx_matrix4_set_identity(transform->matrix);
+		gfx_matrix4_set_identity(matrix);
 
-		transform->matrix[12] = transform->position[0];
-		transform->matrix[13] = transform->position[1];
-		transform->matrix[14] = transform->position[2];
-		gfx_qua_get_inverse(transform->orient, inv_qua);
+		matrix[12] = position[0];
+		matrix[13] = position[1];
+		matrix[14] = position[2];
+		gfx_qua_get_inverse(orient, inv_qua);
 		gfx_qua_to_matrix4(inv_qua, temp_matrix1);
-		gfx_mul_matrix4_matrix4(temp_matrix1, transform->matrix, temp_matrix2);
+		gfx_mul_matrix4_matrix4(temp_matrix1, matrix, temp_matrix2);
 
 		gfx_matrix4_set_identity(temp_matrix1);
 
-		temp_matrix1[0] = transform->scale[0];
-		temp_matrix1[5] = transform->scale[1];
-		temp_matrix1[10] = transform->scale[2];
-		gfx_mul_matrix4_matrix4(temp_matrix1, temp_matrix2, transform->matrix);
+		temp_matrix1[0] = scale[0];
+		temp_matrix1[5] = scale[1];
+		temp_matrix1[10] = scale[2];
+		gfx_mul_matrix4_matrix4(temp_matrix1, temp_matrix2, matrix);
 	}
 	else
 	{
 		gfx_matrix4_set_identity(temp_matrix1);
 
-		temp_matrix1[12] = -transform->position[0];
-		temp_matrix1[13] = -transform->position[1];
-		temp_matrix1[14] = -transform->position[2];
+		temp_matrix1[12] = -position[0];
+		temp_matrix1[13] = -position[1];
+		temp_matrix1[14] = -position[2];
 
-		gfx_qua_to_matrix4(transform->orient, temp_matrix2);
+		gfx_qua_to_matrix4(orient, temp_matrix2);
 
-		gfx_mul_matrix4_matrix4(temp_matrix1, temp_matrix2, transform->matrix);
+		gfx_mul_matrix4_matrix4(temp_matrix1, temp_matrix2, matrix);
 	}
 }
 
+void gfx_recalc_transform_matrix(gfx_transform *transform)
+{
+	gfx_calc_transform_matrix(transform->position, transform->orient, transform->scale, transform->camera_mode, transform->matrix);
+}
+
+void gfx_recalc_transform_blend_matrix(gfx_transform *transform)
+{
+	float position[3];
+	float orient[4];
+	float blend;
+
+	blend = driver->transform_blend;
+
+	position[0] = transform->prev_position[0]+(transform->position[0]-transform->prev_position[0])*blend;
+	position[1] = transform->prev_position[1]+(transform->position[1]-transform->prev_position[1])*blend;
+	position[2] = transform->prev_position[2]+(transform->position[2]-transform->prev_position[2])*blend;
+	gfx_qua_slerp(transform->prev_orient, transform->orient, blend, orient);
+
+	gfx_calc_transform_matrix(position, orient, transform->scale, transform->camera_mode, transform->blend_matrix);
+}
+
 float* gfx_get_transform_matrix(gfx_transform *transform)
 {
+	unsigned char recalc;
+
+	recalc = transform->recalc_matrix;
+
 	if(transform->recalc_matrix == GFX_TRUE)
 	{
 		gfx_recalc_transform_matrix(transform);
 		transform->recalc_matrix = GFX_FALSE;
 	}
 
+	// between two saved states the matrix is blended, rebuilt once per blend or change
+	if(transform->interpolate && driver->transform_blend < 1.0)
+	{
+		if(recalc || transform->blend_frame != driver->transform_blend_frame)
+		{
+			gfx_recalc_transform_blend_matrix(transform);
+			transform->blend_frame = driver->transform_blend_frame;
+		}
+
+		return transform->blend_matrix;
+	}
+
 	return transform->matrix;
 }
 
+void gfx_calc_transform_matrix_batch(int count, float *position[3], float *orient[4], float *scale[3], float *matrix[16])
+{
+	float length, x, y, z, w;
+	float xx, xy, xz, xw, yy, yz, yw, zz, zw;
+	int i;
+
+	// the object transform of gfx_calc_transform_matrix worked out per element, one array per
+	// component so that the compiler can run the loop over several transforms at once
+	for(i = 0; i < count; i++)
+	{
+		length = 1.0f/(orient[0][i]*orient[0][i]+orient[1][i]*orient[1][i]+orient[2][i]*orient[2][i]+orient[3][i]*orient[3][i]);
+		x = orient[0][i]*(-length);
+		y = orient[1][i]*(-length);
+		z = orient[2][i]*(-length);
+		w = orient[3][i]*length;
+
+		xx = 2*x*x; xy = 2*x*y; xz = 2*x*z; xw = 2*x*w;
+		yy = 2*y*y; yz = 2*y*z; yw = 2*y*w;
+		zz = 2*z*z; zw = 2*z*w;
+
+		matrix[0][i] = scale[0][i]*(1-yy-zz);
+		matrix[1][i] = scale[0][i]*(xy-zw);
+		matrix[2][i] = scale[0][i]*(xz+yw);
+		matrix[3][i] = 0.0f;
+		matrix[4][i] = scale[1][i]*(xy+zw);
+		matrix[5][i] = scale[1][i]*(1-xx-zz);
+		matrix[6][i] = scale[1][i]*(yz-xw);
+		matrix[7][i] = 0.0f;
+		matrix[8][i] = scale[2][i]*(xz-yw);
+		matrix[9][i] = scale[2][i]*(yz+xw);
+		matrix[10][i] = scale[2][i]*(1-xx-yy);
+		matrix[11][i] = 0.0f;
+		matrix[12][i] = position[0][i];
+		matrix[13][i] = position[1][i];
+		matrix[14][i] = position[2][i];
+		matrix[15][i] = 1.0f;
+	}
+}
+
+void gfx_store_transform_batch_matrix(float *matrix[16], int idx, float *result)
+{
+	int i;
+
+	for(i = 0; i < 16; i++) result[i] = matrix[i][idx];
+}
+
+void gfx_update_transform_matrices(gfx_transform **transforms, int count)
+{
+	gfx_transform *cur_transforms[GFX_TRANSFORM_BATCH_SIZE];
+	float position_data[3][GFX_TRANSFORM_BATCH_SIZE];
+	float orient_data[4][GFX_TRANSFORM_BATCH_SIZE];
+	float scale_data[3][GFX_TRANSFORM_BATCH_SIZE];
+	float matrix_data[16][GFX_TRANSFORM_BATCH_SIZE];
+	float *position[3];
+	float *orient[4];
+	float *scale[3];
+	float *matrix[16];
+	float blend_orient[4];
+	gfx_transform *transform;
+	unsigned char blend;
+	int cur_count;
+	int pass;
+	int i, j;
+
+	for(i = 0; i < 3; i++) position[i] = position_data[i];
+	for(i = 0; i < 4; i++) orient[i] = orient_data[i];
+	for(i = 0; i < 3; i++) scale[i] = scale_data[i];
+	for(i = 0; i < 16; i++) matrix[i] = matrix_data[i];
+
+	// the current matrices first, then the blended ones of the transforms that are blended
+	for(pass = 0; pass < 2; pass++)
+	{
+		for(i = 0; i < count; )
+		{
+			cur_count = 0;
+
+			for(; i < count && cur_count < GFX_TRANSFORM_BATCH_SIZE; i++)
+			{
+				transform = transforms[i];
+				blend = transform->interpolate && driver->transform_blend < 1.0;
+
+				// camera transforms are few, they are left to gfx_get_transform_matrix
+				if(transform->camera_mode) continue;
+				if(pass == 0 && !transform->recalc_matrix) continue;
+				if(pass == 1 && (!blend || transform->blend_frame == driver->transform_blend_frame)) continue;
+
+				if(pass == 0)
+				{
+					for(j = 0; j < 3; j++) position[j][cur_count] = transform->position[j];
+					for(j = 0; j < 4; j++) orient[j][cur_count] = transform->orient[j];
+				}
+				else
+				{
+					for(j = 0; j < 3; j++)
+					{
+						position[j][cur_count] = transform->prev_position[j]+
+							(transform->position[j]-transform->prev_position[j])*driver->transform_blend;
+					}
+					gfx_qua_slerp(transform->prev_orient, transform->orient, driver->transform_blend, blend_orient);
+					for(j = 0; j < 4; j++) orient[j][cur_count] = blend_orient[j];
+				}
+				for(j = 0; j < 3; j++) scale[j][cur_count] = transform->scale[j];
+
+				cur_transforms[cur_count++] = transform;
+			}
+
+			gfx_calc_transform_matrix_batch(cur_count, position, orient, scale, matrix);
+
+			for(j = 0; j < cur_count; j++)
+			{
+				transform = cur_transforms[j];
+
+				if(pass == 0)
+				{
+					gfx_store_transform_batch_matrix(matrix, j, transform->matrix);
+					transform->recalc_matrix = GFX_FALSE;
+					// the blended matrix came from the old state, pass 1 rebuilds it
+					transform->blend_frame = -1;
+				}
+				else
+				{
+					gfx_store_transform_batch_matrix(matrix, j, transform->blend_matrix);
+					transform->blend_frame = driver->transform_blend_frame;
+				}
+			}
+		}
+	}
+}
+
 gfx_transform* gfx_create_camera_transform()
 {
 	gfx_transform *transform;
@@ -348,3 +515,65 @@ void gfx_get_transform_orientation(gfx_transform *transform, float *params)
 	memcpy(params, transform->orient, sizeof(float)*4);
 }
 
+unsigned char gfx_is_transform_matrix_outdated(gfx_transform *transform)
+{
+	if(transform->recalc_matrix) return GFX_TRUE;
+	if(transform->interpolate && driver->transform_blend < 1.0 && transform->blend_frame != driver->transform_blend_frame) return GFX_TRUE;
+	return GFX_FALSE;
+}
+
+void gfx_save_transform_state(gfx_transform *transform)
+{
+	memcpy(transform->prev_position, transform->position, sizeof(float)*3);
+	memcpy(transform->prev_orient, transform->orient, sizeof(float)*4);
+
+	transform->blend_frame = -1;
+}
+
+unsigned char gfx_update_transform_state(gfx_transform *transform)
+{
+	unsigned char interpolate;
+
+	// only a transform that changed since its state was saved is blended, the others keep their
+	// matrix. returns whether that changed
+	interpolate = memcmp(transform->prev_position, transform->position, sizeof(float)*3) ||
+		memcmp(transform->prev_orient, transform->orient, sizeof(float)*4);
+
+	if(interpolate == transform->interpolate) return GFX_FALSE;
+
+	transform->interpolate = interpolate;
+
+	return GFX_TRUE;
+}
+
+unsigned char gfx_reset_transform_state(gfx_transform *transform)
+{
+	if(!transform->interpolate) return GFX_FALSE;
+
+	transform->interpolate = GFX_FALSE;
+
+	return GFX_TRUE;
+}
+
+unsigned char gfx_get_transform_prev_state(gfx_transform *transform, float *position, float *orient)
+{
+	memcpy(position, transform->prev_position, sizeof(float)*3);
+	memcpy(orient, transform->prev_orient, sizeof(float)*4);
+
+	return transform->interpolate;
+}
+
+void gfx_set_transform_blend(float blend)
+{
+	if(blend < 0.0) blend = 0.0;
+	if(blend > 1.0) blend = 1.0;
+
+	driver->transform_blend = blend;
+	driver->transform_blend_frame++;
+}
+
+float gfx_get_transform_blend()
+{
+	return driver->transform_blend;
+}
+
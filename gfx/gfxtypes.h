@@ -17,6 +17,8 @@ struct gfx_driver {
 
 	gfx_render_target *render_target;
 	gfx_shader_program *shader_programs;
+	gfx_shader_program *shader_program_table[GFX_SHADER_PROGRAM_TABLE_SIZE];
+	int shader_program_count;
 	gfx_shader_params shader_params;
 
 	int version;
@@ -27,6 +29,14 @@ struct gfx_driver {
 	float max_anisotropy;
 	unsigned char dirty_vertex_arrays;
 	unsigned int vertices_drawn[GFX_MAX_DRAW_MODES];
+	unsigned int draw_calls;
+	unsigned int state_changes;
+	int texture_pixel_sizes[GFX_MAX_TEXTURE_FORMATS];
+	int texture_memory;
+	int vertex_buffer_memory;
+	unsigned char headless;
+	float transform_blend;
+	int transform_blend_frame;
 
 	gfx_vertex_data* quad_vertex_data;
 	gfx_vertex_data* quad_tex_coord_data;
@@ -46,6 +56,11 @@ struct gfx_driver {
 	float prev_circle_size;
 
 	gfx_shader_config shader_config;
+
+	char *shader_cache_path;
+	unsigned int driver_hash;
+	unsigned char program_binaries;
+	int shader_cache_hits;
 };
 
 struct gfx_transform {
@@ -54,8 +69,13 @@ struct gfx_transform {
 	float scale[3];
 	float orient[4];
 	float matrix[16];
+	float prev_position[3];
+	float prev_orient[4];
+	float blend_matrix[16];
+	int blend_frame;
 	unsigned char recalc_matrix;
 	unsigned char camera_mode;
+	unsigned char interpolate;
 };
 
 struct gfx_vertex_data {
@@ -64,6 +84,7 @@ struct gfx_vertex_data {
 	int count;
 	int format;
 	int size_bytes;
+	int gpu_size_bytes;
 	int data_type;
 	void *data;
 	unsigned char changed;
@@ -97,10 +118,13 @@ struct gfx_texture {
 	unsigned int height;
 	unsigned int format;
 	unsigned int data_format;
+	int size_bytes;
 };
 
 struct gfx_shader_program {
 	gfx_shader_program *next;
+	gfx_shader_program *hash_next;
+	unsigned int hash;
 	unsigned int id;
 	int projection_matrix_loc;
 	int modelview_matrix_loc;
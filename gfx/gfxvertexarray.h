@@ -23,10 +23,36 @@ gfx_vertex_data* gfx_create_vertex_data(int count, int format, int data_type)
 	return data;
 }
 
+gfx_vertex_data* gfx_create_vertex_data_from_buffer(int count, int format, int data_type, void *buffer)
+{
+	gfx_vertex_data *data;
+
+	if(count <= 0 || !buffer) return NULL;
+	if(!(format >= GFX_FLOAT && format < GFX_MAX_FORMATS)) return NULL;
+	if(!(data_type >= GFX_VERTEX_DATA_STATIC && data_type < GFX_MAX_VERTEX_DATA_TYPES)) return NULL;
+
+	data = (gfx_vertex_data*)malloc(sizeof(gfx_vertex_data));
+	memset(data, 0x0, sizeof(gfx_vertex_data));
+	data->type = GFX_VERTEX_DATA;
+
+	// takes the ownership of the buffer, it has to be allocated with malloc
+	data->count = count;
+	data->format = format;
+	data->size_bytes = driver->format_sizes[format]*count;
+	data->data_type = data_type;
+	data->data = buffer;
+
+	gfx_global_obj_count++;
+
+	return data;
+}
+
 void gfx_destroy_vertex_data(gfx_vertex_data *data)
 {
 	if(data->vbo) glDeleteBuffers(1, &data->vbo);
 
+	driver->vertex_buffer_memory -= data->gpu_size_bytes;
+
 	free(data->data);
 	free(data);
 
@@ -80,7 +106,14 @@ void gfx_update_vertex_data_sub_data(gfx_vertex_data *data, int start, int lengt
 
 void gfx_init_vertex_data_vbo(gfx_vertex_data *data)
 {
-	if(!data->vbo)
+	// the null driver has no buffer to create but still counts its size
+	if(!data->gpu_size_bytes)
+	{
+		data->gpu_size_bytes = data->size_bytes;
+		driver->vertex_buffer_memory += data->gpu_size_bytes;
+	}
+
+	if(!data->vbo && !driver->headless)
 	{
 		glGenBuffers(1, &data->vbo);
 		glBindBuffer(GL_ARRAY_BUFFER, data->vbo);
@@ -178,6 +211,8 @@ void gfx_set_vertex_array(gfx_vertex_array *vertex_array)
 {
 	int i;
 
+	if(driver->headless) return;
+
 	if(vertex_array->gpu_data)
 	{
 		for(i = 0; i < GFX_MAX_VERTEX_ARRAYS; i++)
@@ -223,11 +258,29 @@ void gfx_draw_vertex_array(gfx_vertex_array *vertex_array, unsigned int count, u
 {
 	if(count > vertex_array->vertex_count) count -= count-vertex_array->vertex_count;
 
+	driver->draw_calls++;
+	driver->vertices_drawn[draw_mode] += count;
+
+	if(driver->headless) return;
+
 	gfx_set_vertex_array(vertex_array);
 
 	glDrawArrays(driver->draw_modes[draw_mode], 0, count);
+}
+
+void gfx_draw_vertex_array_range(gfx_vertex_array *vertex_array, unsigned int first, unsigned int count, unsigned int draw_mode)
+{
+	if(first >= vertex_array->vertex_count) return;
+	if(first+count > vertex_array->vertex_count) count = vertex_array->vertex_count-first;
 
+	driver->draw_calls++;
 	driver->vertices_drawn[draw_mode] += count;
+
+	if(driver->headless) return;
+
+	gfx_set_vertex_array(vertex_array);
+
+	glDrawArrays(driver->draw_modes[draw_mode], first, count);
 }
 
 gfx_vertex_index* gfx_create_vertex_index(unsigned char gpu_data, gfx_vertex_data *data)
@@ -267,6 +320,11 @@ int gfx_get_vertex_index_indice_count(gfx_vertex_index *vertex_index)
 
 void gfx_draw_vertex_index(gfx_vertex_index *vertex_index, unsigned int draw_mode)
 {
+	driver->draw_calls++;
+	driver->vertices_drawn[draw_mode] += vertex_index->indice_count;
+
+	if(driver->headless) return;
+
 	if(vertex_index->gpu_data)
 	{
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vertex_index->data->vbo);
@@ -279,7 +337,5 @@ void gfx_draw_vertex_index(gfx_vertex_index *vertex_index, unsigned int draw_mod
 		glDrawElements(driver->draw_modes[draw_mode],  vertex_index->indice_count,
 			driver->formats[vertex_index->data->format], vertex_index->data->data);
 	}
-
-	driver->vertices_drawn[draw_mode] += vertex_index->indice_count;
 }
 
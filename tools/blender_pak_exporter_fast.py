@@ -26,6 +26,13 @@ def write_name_to_file(name, f):
 		f.write(struct.pack('<B', 0))
 		i += 1
 
+def align_size(size):
+	return (size+15)&~15
+
+def write_padding(size, f):
+	for i in range(align_size(size)-size):
+		f.write(struct.pack('<B', 0))
+
 def trim_file_path(file_path):
 	nfile_path = file_path
 	if len(nfile_path) > 2:
@@ -203,6 +210,8 @@ class Model:
 		self.indice_count = 0
 		self.size_bytes = 0
 		self.weights_and_boneids = False
+		self.bb_min = [0.0, 0.0, 0.0]
+		self.bb_max = [0.0, 0.0, 0.0]
 
 	def load(self, obj):
 		mesh = obj.getData()
@@ -270,6 +279,23 @@ class Model:
 		if len(self.verts) < 3:
 			return False
 
+		# the engine takes the bounding box and the weights as they are
+		self.bb_min = self.verts[0].co[:]
+		self.bb_max = self.verts[0].co[:]
+		for v in self.verts:
+			for i in range(3):
+				if v.co[i] < self.bb_min[i]: self.bb_min[i] = v.co[i]
+				if v.co[i] > self.bb_max[i]: self.bb_max[i] = v.co[i]
+			for i in range(4):
+				v.weights[i] = min(max(v.weights[i], 0.0), 1.0)
+			length = v.weights[0]+v.weights[1]+v.weights[2]+v.weights[3]
+			if length > 0.0:
+				for i in range(4): v.weights[i] /= length
+
+		self.indice_count = 0
+		for area in self.areas:
+			self.indice_count += len(area.index)
+
 		self.size_bytes = 0
 
 		# magic
@@ -278,22 +304,22 @@ class Model:
 		self.size_bytes += struct.calcsize('<64s')
 		# header
 		self.size_bytes += struct.calcsize('<iiiiBBBB')
+		# bounding box
+		self.size_bytes += struct.calcsize('<ffffff')
+		# area indice counts
+		self.size_bytes += align_size(struct.calcsize('<i')*len(self.areas))
 		# frames
-		self.size_bytes += struct.calcsize('<fff')*len(self.verts)*1
-		# areas
-		self.indice_count = 0
-		for area in self.areas:
-			self.size_bytes += struct.calcsize('<i')
-			self.size_bytes += struct.calcsize('<I')*len(area.index)
-			self.indice_count += len(area.index)
+		self.size_bytes += align_size(struct.calcsize('<fff')*len(self.verts)*1)
+		# index
+		self.size_bytes += align_size(struct.calcsize('<I')*self.indice_count)
 		# normals
-		self.size_bytes += struct.calcsize('<fff')*len(self.verts)
+		self.size_bytes += align_size(struct.calcsize('<fff')*len(self.verts))
 		# tex coords
-		self.size_bytes += struct.calcsize('<ff')*len(self.verts)
+		self.size_bytes += align_size(struct.calcsize('<ff')*len(self.verts))
 		# weights and boneids
 		if self.weights_and_boneids is True:
 			self.size_bytes += struct.calcsize('<ffff')*len(self.verts)
-			self.size_bytes += struct.calcsize('<hhhh')*len(self.verts)
+			self.size_bytes += struct.calcsize('<iiii')*len(self.verts)
 
 		print 'Mesh \"'+self.name+'\" converted'
 		print '  vertices: '+str(len(self.verts))
@@ -307,7 +333,7 @@ class Model:
 		if len(self.verts) < 3: return
 
 		# write magic
-		f.write(struct.pack('<i', 179532110))
+		f.write(struct.pack('<i', 179532142))
 
 		# write name
 		write_name_to_file(self.name, f)
@@ -324,30 +350,44 @@ class Model:
 		else: f.write(struct.pack('<B', 0))
 		f.write(struct.pack('<B', 255)) # junk...
 
+		# write the bounding box
+		f.write(struct.pack('<fff', self.bb_min[0], self.bb_min[1], self.bb_min[2]))
+		f.write(struct.pack('<fff', self.bb_max[0], self.bb_max[1], self.bb_max[2]))
+
+		# every block below is padded to 16 bytes
+
+		# write the area indice counts
+		for area in self.areas:
+			f.write(struct.pack('<i', len(area.index)))
+		write_padding(struct.calcsize('<i')*len(self.areas), f)
+
 		# write the frames
 		for v in self.verts:
 			f.write(struct.pack('<fff', v.co[0], v.co[1], v.co[2]))
+		write_padding(struct.calcsize('<fff')*len(self.verts), f)
 
 		# write the index
 		for area in self.areas:
-			f.write(struct.pack('<i', len(area.index)))
 			for idx in area.index:
 				f.write(struct.pack('<I', idx))
+		write_padding(struct.calcsize('<I')*self.indice_count, f)
 
 		# write normals
 		for v in self.verts:
 			f.write(struct.pack('<fff', v.no[0], v.no[1], v.no[2]))
+		write_padding(struct.calcsize('<fff')*len(self.verts), f)
 
 		# write tex coords
 		for v in self.verts:
 			f.write(struct.pack('<ff', v.uv[0], v.uv[1]))
-			
+		write_padding(struct.calcsize('<ff')*len(self.verts), f)
+
 		# write weights and boneids
 		if self.weights_and_boneids is True:
 			for v in self.verts:
 				f.write(struct.pack('<ffff', v.weights[0], v.weights[1], v.weights[2], v.weights[3]))
 			for v in self.verts:
-				f.write(struct.pack('<hhhh', v.boneids[0], v.boneids[1], v.boneids[2], v.boneids[3]))
+				f.write(struct.pack('<iiii', v.boneids[0], v.boneids[1], v.boneids[2], v.boneids[3]))
 
 		print 'Mesh \"'+self.name+'\" saved'
 
@@ -1007,7 +1047,7 @@ def export(path):
 	f = open(path, 'wb')
 
 	# magic
-	f.write(struct.pack('<i', 179532100))
+	f.write(struct.pack('<i', 179532101))
 
 	# index count
 	f.write(struct.pack('<i', len(scenes)+len(scripts)+len(textures)+len(materials)+len(models)+len(cameras)+len(entities)+len(lights)+len(armatures)))
@@ -1036,6 +1076,7 @@ def export(path):
 	for model in models:
 		f.write(struct.pack('<B', 2))
 		write_name_to_file(model.name, f)
+		offset = align_size(offset)
 		f.write(struct.pack('<i', offset))
 		offset += model.size_bytes
 	for camera in cameras:
@@ -1069,6 +1110,7 @@ def export(path):
 	for material in materials:
 		material.save(f)
 	for model in models:
+		write_padding(f.tell(), f)
 		model.save(f)
 	for camera in cameras:
 		camera.save(f)